@@ -1,10 +1,18 @@
 #include "Texture.h"
+#include "gpumemory.h"
+#include "archive.h"
+#include "cooked.h"
 
 GLuint loadTextureFromFile(const std::string& filename)
 {
+	if (isCookedTexture(filename))
+	{
+		return loadCookedTextureFromFile(filename);
+	}
+
 	GLuint textureID;
 
-	SDL_Surface* surface = IMG_Load(filename.c_str());
+	SDL_Surface* surface = IMG_Load_RW(openAssetRWops(filename), 1);
 	if (surface == nullptr)
 	{
 		printf("Could not load image file");
@@ -19,7 +27,44 @@ GLuint loadTextureFromFile(const std::string& filename)
 	glTexImage2D(GL_TEXTURE_2D, 0, GL_RGB8, surface->w, surface->h, 0, GL_RGBA, GL_UNSIGNED_BYTE, surface->pixels);
 	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
 
+	//Drivers store RGB8 padded out to 4 bytes a texel
+	getGPUMemory().trackTexture(textureID, surface->w * surface->h * 4);
+
 	SDL_FreeSurface(surface);
 
 	return textureID;
 }
+
+GLuint loadCookedTextureFromFile(const std::string& filename)
+{
+	CookedTexture texture;
+	if (!readCookedTexture(filename, texture))
+	{
+		return 0;
+	}
+
+	GLuint textureID;
+	glGenTextures(1, &textureID);
+	glBindTexture(GL_TEXTURE_2D, textureID);
+
+	//Every level comes from the cooker, so no glGenerateMipmap at load
+	glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+	for (unsigned int level = 0; level < texture.info.mipLevels; level++)
+	{
+		glTexImage2D(GL_TEXTURE_2D, level, GL_RGBA8, glm::max(texture.info.width >> level, 1u), glm::max(texture.info.height >> level, 1u), 0,
+			GL_RGBA, GL_UNSIGNED_BYTE, texture.pixels.data() + getMipOffset(texture.info, level));
+	}
+	glPixelStorei(GL_UNPACK_ALIGNMENT, 4);
+	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAX_LEVEL, texture.info.mipLevels - 1);
+	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR_MIPMAP_LINEAR);
+
+	getGPUMemory().trackTexture(textureID, texture.pixels.size());
+
+	return textureID;
+}
+
+void deleteTexture(GLuint textureID)
+{
+	getGPUMemory().untrackTexture(textureID);
+	glDeleteTextures(1, &textureID);
+}
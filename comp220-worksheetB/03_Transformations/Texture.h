@@ -6,5 +6,12 @@
 
 #include <string>
 
+//.tex files from the cook tool go to loadCookedTextureFromFile, anything else is decoded with SDL_image
 GLuint loadTextureFromFile(const std::string& filename);
 
+//Uploads the cooked mip chain as it is
+GLuint loadCookedTextureFromFile(const std::string& filename);
+
+//Deletes a texture from loadTextureFromFile and stops counting its memory
+void deleteTexture(GLuint textureID);
+
@@ -1,5 +1,7 @@
 #pragma once
 
+#include <vector>
+
 struct Vertex
 {
 	float x, y, z;
@@ -9,4 +11,17 @@ struct Vertex
 	float tangentX, tangentY, tangentZ;
 	float biTangentX, biTangentY, biTangentZ;
 
-};
\ No newline at end of file
+};
+
+//Skinning stream kept separate from Vertex, so unskinned meshes don't pay for it
+//Weights are normalised bytes that add up to 255
+struct SkinVertex
+{
+	unsigned char joints[4];
+	unsigned char weights[4];
+};
+
+struct aiMesh;
+
+//Converts one aiMesh into our vertex and index format, appending to vertices and indices
+void copyMeshData(const aiMesh *currentMesh, std::vector<Vertex>& vertices, std::vector<unsigned int>& indices);
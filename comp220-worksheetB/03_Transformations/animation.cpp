@@ -0,0 +1,482 @@
+#include "animation.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+
+#include <glm/gtc/packing.hpp>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define ANIMATION_USE_SSE
+#include <emmintrin.h>
+#endif
+
+glm::mat4 jointPoseToMatrix(const JointPose & pose)
+{
+	//Translation * Rotation * Scale, without building the three matrices
+	glm::mat4 matrix = glm::mat4_cast(pose.rotation);
+	matrix[0] *= pose.scale.x;
+	matrix[1] *= pose.scale.y;
+	matrix[2] *= pose.scale.z;
+	matrix[3] = glm::vec4(pose.translation, 1.0f);
+	return matrix;
+}
+
+Skeleton::Skeleton()
+{
+}
+
+Skeleton::~Skeleton()
+{
+}
+
+int Skeleton::addJoint(const std::string & name, int parent, const glm::mat4 & preTransform, const JointPose & restPose, const glm::mat4 & inverseBindMatrix)
+{
+	int joint = (int)m_Names.size();
+
+	//Parents have to be added first for the single pass in buildSkinningMatrices
+	if (parent >= joint)
+	{
+		printf("Skeleton Error - joint %s added before its parent\n", name.c_str());
+		return -1;
+	}
+
+	m_Names.push_back(name);
+	m_Parents.push_back(parent);
+	m_PreTransforms.push_back(preTransform);
+	m_RestPose.push_back(restPose);
+	m_InverseBindMatrices.push_back(inverseBindMatrix);
+	return joint;
+}
+
+int Skeleton::findJoint(const std::string & name) const
+{
+	for (unsigned int i = 0; i < m_Names.size(); i++)
+	{
+		if (m_Names[i] == name)
+		{
+			return (int)i;
+		}
+	}
+	return -1;
+}
+
+int Skeleton::getParent(int joint) const
+{
+	return m_Parents[joint];
+}
+
+const JointPose & Skeleton::getRestPose(int joint) const
+{
+	return m_RestPose[joint];
+}
+
+unsigned int Skeleton::getNumberOfJoints() const
+{
+	return m_Names.size();
+}
+
+void Skeleton::buildSkinningMatrices(const JointPose * pLocalPose, glm::mat4 * pModelPose, glm::mat4 * pSkinningMatrices) const
+{
+	unsigned int numberOfJoints = m_Names.size();
+	for (unsigned int joint = 0; joint < numberOfJoints; joint++)
+	{
+		glm::mat4 localMatrix = m_PreTransforms[joint] * jointPoseToMatrix(pLocalPose[joint]);
+
+		int parent = m_Parents[joint];
+		if (parent < 0)
+		{
+			pModelPose[joint] = localMatrix;
+		}
+		else
+		{
+			pModelPose[joint] = pModelPose[parent] * localMatrix;
+		}
+		pSkinningMatrices[joint] = pModelPose[joint] * m_InverseBindMatrices[joint];
+	}
+}
+
+void Skeleton::clear()
+{
+	m_Names.clear();
+	m_Parents.clear();
+	m_PreTransforms.clear();
+	m_RestPose.clear();
+	m_InverseBindMatrices.clear();
+}
+
+AnimationClip::AnimationClip()
+{
+	m_Duration = 0.0f;
+}
+
+AnimationClip::~AnimationClip()
+{
+}
+
+void AnimationClip::init(const std::string & name, float duration, unsigned int numberOfJoints)
+{
+	m_Name = name;
+	m_Duration = duration;
+
+	TrackRange emptyTrack = { 0, 0 };
+	m_PositionTracks.assign(numberOfJoints, emptyTrack);
+	m_RotationTracks.assign(numberOfJoints, emptyTrack);
+	m_ScaleTracks.assign(numberOfJoints, emptyTrack);
+
+	m_PositionTimes.clear();
+	m_Positions.clear();
+	m_RotationTimes.clear();
+	m_Rotations.clear();
+	m_ScaleTimes.clear();
+	m_Scales.clear();
+}
+
+void AnimationClip::setTrack(unsigned int joint,
+	const std::vector<float>& positionTimes, const std::vector<glm::vec3>& positions,
+	const std::vector<float>& rotationTimes, const std::vector<glm::quat>& rotations,
+	const std::vector<float>& scaleTimes, const std::vector<glm::vec3>& scales)
+{
+	if (joint >= m_PositionTracks.size())
+	{
+		return;
+	}
+
+	//Keys for one joint are appended together, so sampling a track reads one contiguous block
+	TrackRange positionTrack = { (unsigned int)m_PositionTimes.size(), (unsigned int)positionTimes.size() };
+	m_PositionTimes.insert(m_PositionTimes.end(), positionTimes.begin(), positionTimes.end());
+	m_Positions.insert(m_Positions.end(), positions.begin(), positions.end());
+	m_PositionTracks[joint] = positionTrack;
+
+	TrackRange rotationTrack = { (unsigned int)m_RotationTimes.size(), (unsigned int)rotationTimes.size() };
+	m_RotationTimes.insert(m_RotationTimes.end(), rotationTimes.begin(), rotationTimes.end());
+	for (const glm::quat& rotation : rotations)
+	{
+		glm::quat normalised = glm::normalize(rotation);
+		m_Rotations.push_back(glm::packSnorm4x16(glm::vec4(normalised.x, normalised.y, normalised.z, normalised.w)));
+	}
+	m_RotationTracks[joint] = rotationTrack;
+
+	TrackRange scaleTrack = { (unsigned int)m_ScaleTimes.size(), (unsigned int)scaleTimes.size() };
+	m_ScaleTimes.insert(m_ScaleTimes.end(), scaleTimes.begin(), scaleTimes.end());
+	m_Scales.insert(m_Scales.end(), scales.begin(), scales.end());
+	m_ScaleTracks[joint] = scaleTrack;
+}
+
+//Finds the key at or before time and how far it is towards the next key
+static unsigned int findKey(const float *pTimes, unsigned int numberOfKeys, float time, float& blend)
+{
+	const float *pNextKey = std::upper_bound(pTimes, pTimes + numberOfKeys, time);
+	blend = 0.0f;
+	if (pNextKey == pTimes)
+	{
+		return 0;
+	}
+
+	unsigned int key = (unsigned int)(pNextKey - pTimes) - 1;
+	if (key + 1 < numberOfKeys)
+	{
+		float keyLength = pTimes[key + 1] - pTimes[key];
+		if (keyLength > 0.0f)
+		{
+			blend = (time - pTimes[key]) / keyLength;
+		}
+	}
+	return key;
+}
+
+static glm::quat unpackRotation(glm::uint64 packedRotation)
+{
+	glm::vec4 unpacked = glm::unpackSnorm4x16(packedRotation);
+	return glm::normalize(glm::quat(unpacked.w, unpacked.x, unpacked.y, unpacked.z));
+}
+
+void AnimationClip::sample(const Skeleton & skeleton, float time, bool loop, JointPose * pLocalPose) const
+{
+	if (loop && m_Duration > 0.0f)
+	{
+		time = fmodf(time, m_Duration);
+		if (time < 0.0f)
+		{
+			time += m_Duration;
+		}
+	}
+
+	unsigned int numberOfJoints = skeleton.getNumberOfJoints();
+	for (unsigned int joint = 0; joint < numberOfJoints; joint++)
+	{
+		JointPose pose = skeleton.getRestPose(joint);
+		if (joint < m_PositionTracks.size())
+		{
+			float blend;
+
+			const TrackRange& positionTrack = m_PositionTracks[joint];
+			if (positionTrack.numberOfKeys > 0)
+			{
+				unsigned int key = findKey(&m_PositionTimes[positionTrack.firstKey], positionTrack.numberOfKeys, time, blend);
+				const glm::vec3 *pKeys = &m_Positions[positionTrack.firstKey];
+				pose.translation = blend > 0.0f ? glm::mix(pKeys[key], pKeys[key + 1], blend) : pKeys[key];
+			}
+
+			const TrackRange& rotationTrack = m_RotationTracks[joint];
+			if (rotationTrack.numberOfKeys > 0)
+			{
+				unsigned int key = findKey(&m_RotationTimes[rotationTrack.firstKey], rotationTrack.numberOfKeys, time, blend);
+				const glm::uint64 *pKeys = &m_Rotations[rotationTrack.firstKey];
+				pose.rotation = unpackRotation(pKeys[key]);
+				if (blend > 0.0f)
+				{
+					pose.rotation = glm::slerp(pose.rotation, unpackRotation(pKeys[key + 1]), blend);
+				}
+			}
+
+			const TrackRange& scaleTrack = m_ScaleTracks[joint];
+			if (scaleTrack.numberOfKeys > 0)
+			{
+				unsigned int key = findKey(&m_ScaleTimes[scaleTrack.firstKey], scaleTrack.numberOfKeys, time, blend);
+				const glm::vec3 *pKeys = &m_Scales[scaleTrack.firstKey];
+				pose.scale = blend > 0.0f ? glm::mix(pKeys[key], pKeys[key + 1], blend) : pKeys[key];
+			}
+		}
+		pLocalPose[joint] = pose;
+	}
+}
+
+const std::string & AnimationClip::getName() const
+{
+	return m_Name;
+}
+
+float AnimationClip::getDuration() const
+{
+	return m_Duration;
+}
+
+unsigned int AnimationClip::getSizeInBytes() const
+{
+	return (m_PositionTimes.size() + m_RotationTimes.size() + m_ScaleTimes.size()) * sizeof(float)
+		+ (m_Positions.size() + m_Scales.size()) * sizeof(glm::vec3)
+		+ m_Rotations.size() * sizeof(glm::uint64)
+		+ (m_PositionTracks.size() + m_RotationTracks.size() + m_ScaleTracks.size()) * sizeof(TrackRange);
+}
+
+void initCharacter(Character & character, const Skeleton * pSkeleton, const AnimationClip * pClip)
+{
+	character.pSkeleton = pSkeleton;
+	character.pClip = pClip;
+	character.time = 0.0f;
+	character.speed = 1.0f;
+
+	unsigned int numberOfJoints = pSkeleton->getNumberOfJoints();
+	character.localPose.resize(numberOfJoints);
+	character.modelPose.resize(numberOfJoints);
+	character.skinningMatrices.resize(numberOfJoints, glm::mat4(1.0f));
+}
+
+void updateCharacters(JobSystem & jobSystem, Character * pCharacters, unsigned int numberOfCharacters, float deltaTime)
+{
+	//Characters don't share any output, so each batch can run on any thread
+	jobSystem.parallelFor(numberOfCharacters, 16, [pCharacters, deltaTime](unsigned int start, unsigned int end)
+	{
+		for (unsigned int i = start; i < end; i++)
+		{
+			Character& character = pCharacters[i];
+			if (character.pSkeleton == nullptr || character.pClip == nullptr || character.localPose.empty())
+			{
+				continue;
+			}
+
+			character.time += deltaTime * character.speed;
+			character.pClip->sample(*character.pSkeleton, character.time, true, character.localPose.data());
+			character.pSkeleton->buildSkinningMatrices(character.localPose.data(), character.modelPose.data(), character.skinningMatrices.data());
+		}
+	});
+}
+
+void skinVerticesScalar(const glm::mat4 * pSkinningMatrices, const SkinVertex * pSkinVerts, const Vertex * pBindVerts, Vertex * pSkinnedVerts, unsigned int numberOfVerts)
+{
+	const float weightScale = 1.0f / 255.0f;
+	for (unsigned int v = 0; v < numberOfVerts; v++)
+	{
+		const SkinVertex& skin = pSkinVerts[v];
+		const Vertex& bind = pBindVerts[v];
+
+		glm::mat4 blended = pSkinningMatrices[skin.joints[0]] * (skin.weights[0] * weightScale)
+			+ pSkinningMatrices[skin.joints[1]] * (skin.weights[1] * weightScale)
+			+ pSkinningMatrices[skin.joints[2]] * (skin.weights[2] * weightScale)
+			+ pSkinningMatrices[skin.joints[3]] * (skin.weights[3] * weightScale);
+
+		glm::vec4 position = blended * glm::vec4(bind.x, bind.y, bind.z, 1.0f);
+		glm::vec3 normal = glm::normalize(glm::vec3(blended * glm::vec4(bind.normalX, bind.normalY, bind.normalZ, 0.0f)));
+		glm::vec3 tangent = glm::vec3(blended * glm::vec4(bind.tangentX, bind.tangentY, bind.tangentZ, 0.0f));
+		glm::vec3 biTangent = glm::vec3(blended * glm::vec4(bind.biTangentX, bind.biTangentY, bind.biTangentZ, 0.0f));
+
+		Vertex& skinned = pSkinnedVerts[v];
+		skinned = bind;
+		skinned.x = position.x; skinned.y = position.y; skinned.z = position.z;
+		skinned.normalX = normal.x; skinned.normalY = normal.y; skinned.normalZ = normal.z;
+		skinned.tangentX = tangent.x; skinned.tangentY = tangent.y; skinned.tangentZ = tangent.z;
+		skinned.biTangentX = biTangent.x; skinned.biTangentY = biTangent.y; skinned.biTangentZ = biTangent.z;
+	}
+}
+
+#ifdef ANIMATION_USE_SSE
+//Rotates and translates (x, y, z, w) by the blended matrix columns
+static inline __m128 transformSSE(const __m128 *pColumns, float x, float y, float z, float w)
+{
+	__m128 result = _mm_mul_ps(pColumns[0], _mm_set1_ps(x));
+	result = _mm_add_ps(result, _mm_mul_ps(pColumns[1], _mm_set1_ps(y)));
+	result = _mm_add_ps(result, _mm_mul_ps(pColumns[2], _mm_set1_ps(z)));
+	if (w != 0.0f)
+	{
+		result = _mm_add_ps(result, pColumns[3]);
+	}
+	return result;
+}
+#endif
+
+void skinVertices(const glm::mat4 * pSkinningMatrices, const SkinVertex * pSkinVerts, const Vertex * pBindVerts, Vertex * pSkinnedVerts, unsigned int numberOfVerts)
+{
+#ifdef ANIMATION_USE_SSE
+	const float weightScale = 1.0f / 255.0f;
+	for (unsigned int v = 0; v < numberOfVerts; v++)
+	{
+		const SkinVertex& skin = pSkinVerts[v];
+		const Vertex& bind = pBindVerts[v];
+
+		//Blend the four joint matrices one column at a time
+		__m128 columns[4];
+		for (int c = 0; c < 4; c++)
+		{
+			columns[c] = _mm_setzero_ps();
+		}
+		for (int i = 0; i < 4; i++)
+		{
+			if (skin.weights[i] == 0)
+			{
+				continue;
+			}
+			__m128 weight = _mm_set1_ps(skin.weights[i] * weightScale);
+			const float *pMatrix = &pSkinningMatrices[skin.joints[i]][0][0];
+			for (int c = 0; c < 4; c++)
+			{
+				columns[c] = _mm_add_ps(columns[c], _mm_mul_ps(_mm_loadu_ps(pMatrix + c * 4), weight));
+			}
+		}
+
+		__m128 position = transformSSE(columns, bind.x, bind.y, bind.z, 1.0f);
+		__m128 normal = transformSSE(columns, bind.normalX, bind.normalY, bind.normalZ, 0.0f);
+		__m128 tangent = transformSSE(columns, bind.tangentX, bind.tangentY, bind.tangentZ, 0.0f);
+		__m128 biTangent = transformSSE(columns, bind.biTangentX, bind.biTangentY, bind.biTangentZ, 0.0f);
+
+		//Normalise the normal, w is 0 so it doesn't add to the length
+		__m128 lengthSquared = _mm_mul_ps(normal, normal);
+		lengthSquared = _mm_add_ps(lengthSquared, _mm_shuffle_ps(lengthSquared, lengthSquared, _MM_SHUFFLE(2, 3, 0, 1)));
+		lengthSquared = _mm_add_ps(lengthSquared, _mm_shuffle_ps(lengthSquared, lengthSquared, _MM_SHUFFLE(1, 0, 3, 2)));
+		normal = _mm_div_ps(normal, _mm_sqrt_ps(_mm_max_ps(lengthSquared, _mm_set1_ps(1e-12f))));
+
+		//Vertex fields are only 3 floats wide, so go through a temporary to avoid writing over the next field
+		float result[4];
+		Vertex& skinned = pSkinnedVerts[v];
+		skinned = bind;
+		_mm_storeu_ps(result, position);
+		skinned.x = result[0]; skinned.y = result[1]; skinned.z = result[2];
+		_mm_storeu_ps(result, normal);
+		skinned.normalX = result[0]; skinned.normalY = result[1]; skinned.normalZ = result[2];
+		_mm_storeu_ps(result, tangent);
+		skinned.tangentX = result[0]; skinned.tangentY = result[1]; skinned.tangentZ = result[2];
+		_mm_storeu_ps(result, biTangent);
+		skinned.biTangentX = result[0]; skinned.biTangentY = result[1]; skinned.biTangentZ = result[2];
+	}
+#else
+	skinVerticesScalar(pSkinningMatrices, pSkinVerts, pBindVerts, pSkinnedVerts, numberOfVerts);
+#endif
+}
+
+void runAnimationBenchmark(JobSystem & jobSystem, unsigned int numberOfCharacters, unsigned int numberOfFrames)
+{
+	const unsigned int numberOfJoints = MAX_SHADER_JOINTS;
+	const unsigned int numberOfKeys = 60;
+	const unsigned int numberOfVerts = 2048;
+	const float duration = 2.0f;
+
+	//Binary tree skeleton, every joint animated on all three channels
+	Skeleton skeleton;
+	JointPose restPose = { glm::vec3(0.0f, 1.0f, 0.0f), glm::quat(1.0f, 0.0f, 0.0f, 0.0f), glm::vec3(1.0f) };
+	for (unsigned int joint = 0; joint < numberOfJoints; joint++)
+	{
+		int parent = joint == 0 ? -1 : (int)(joint - 1) / 2;
+		skeleton.addJoint("joint" + std::to_string(joint), parent, glm::mat4(1.0f), restPose, glm::mat4(1.0f));
+	}
+
+	AnimationClip clip;
+	clip.init("benchmark", duration, numberOfJoints);
+	std::vector<float> times(numberOfKeys);
+	std::vector<glm::vec3> positions(numberOfKeys);
+	std::vector<glm::quat> rotations(numberOfKeys);
+	std::vector<glm::vec3> scales(numberOfKeys);
+	for (unsigned int joint = 0; joint < numberOfJoints; joint++)
+	{
+		for (unsigned int key = 0; key < numberOfKeys; key++)
+		{
+			float angle = (float)(key + joint) * 0.1f;
+			times[key] = duration * key / (numberOfKeys - 1);
+			positions[key] = glm::vec3(sinf(angle), 1.0f, cosf(angle)) * 0.1f;
+			rotations[key] = glm::angleAxis(angle, glm::normalize(glm::vec3(1.0f, 2.0f, 3.0f)));
+			scales[key] = glm::vec3(1.0f + 0.1f * sinf(angle));
+		}
+		clip.setTrack(joint, times, positions, times, rotations, times, scales);
+	}
+
+	SkinnedMeshData skin;
+	skin.bindVertices.resize(numberOfVerts);
+	skin.skinVertices.resize(numberOfVerts);
+	for (unsigned int v = 0; v < numberOfVerts; v++)
+	{
+		Vertex vertex = { (float)v, 0.0f, 0.0f, 1.0f, 1.0f, 1.0f, 1.0f, 0.0f, 0.0f, 0.0f, 1.0f, 0.0f, 1.0f, 0.0f, 0.0f, 0.0f, 0.0f, 1.0f };
+		SkinVertex skinVertex = { { (unsigned char)(v % numberOfJoints), (unsigned char)((v + 1) % numberOfJoints), (unsigned char)((v + 7) % numberOfJoints), 0 }, { 128, 64, 63, 0 } };
+		skin.bindVertices[v] = vertex;
+		skin.skinVertices[v] = skinVertex;
+	}
+
+	std::vector<Character> characters(numberOfCharacters);
+	for (unsigned int i = 0; i < numberOfCharacters; i++)
+	{
+		initCharacter(characters[i], &skeleton, &clip);
+		characters[i].time = (float)i * 0.013f;
+	}
+
+	typedef std::chrono::high_resolution_clock Clock;
+	const float deltaTime = 1.0f / 60.0f;
+
+	Clock::time_point start = Clock::now();
+	for (unsigned int frame = 0; frame < numberOfFrames; frame++)
+	{
+		updateCharacters(jobSystem, characters.data(), numberOfCharacters, deltaTime);
+	}
+	double poseTime = std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+
+	//CPU skinning on top, each batch reuses one output buffer
+	start = Clock::now();
+	for (unsigned int frame = 0; frame < numberOfFrames; frame++)
+	{
+		updateCharacters(jobSystem, characters.data(), numberOfCharacters, deltaTime);
+		jobSystem.parallelFor(numberOfCharacters, 16, [&characters, &skin, numberOfVerts](unsigned int first, unsigned int last)
+		{
+			std::vector<Vertex> skinnedVertices(numberOfVerts);
+			for (unsigned int i = first; i < last; i++)
+			{
+				skinVertices(characters[i].skinningMatrices.data(), skin.skinVertices.data(), skin.bindVertices.data(), skinnedVertices.data(), numberOfVerts);
+			}
+		});
+	}
+	double skinTime = std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+
+	double totalCharacters = (double)numberOfCharacters * numberOfFrames;
+	printf("Animation benchmark - %u characters, %u joints, %u keys per track, %u frames, %u workers\n",
+		numberOfCharacters, numberOfJoints, numberOfKeys, numberOfFrames, jobSystem.getNumberOfWorkers());
+	printf("Clip size %u bytes\n", clip.getSizeInBytes());
+	printf("Pose evaluation: %.2f characters/ms\n", totalCharacters / poseTime);
+	printf("Pose + CPU skinning (%u verts): %.2f characters/ms\n", numberOfVerts, totalCharacters / skinTime);
+}
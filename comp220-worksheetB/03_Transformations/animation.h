@@ -0,0 +1,132 @@
+#pragma once
+
+#include <string>
+#include <vector>
+
+#include <glm/glm.hpp>
+#include <glm/gtc/quaternion.hpp>
+
+#include "vertex.h"
+#include "jobs.h"
+
+//Has to match the jointMatrices array size in skinnedBlinnPhongVert.glsl
+#define MAX_SHADER_JOINTS 64
+
+//Local transform of a single joint
+struct JointPose
+{
+	glm::vec3 translation;
+	glm::quat rotation;
+	glm::vec3 scale;
+};
+
+glm::mat4 jointPoseToMatrix(const JointPose& pose);
+
+//Joints are stored parent first, so a single pass from 0 to n builds the model space pose
+class Skeleton
+{
+public:
+	Skeleton();
+	~Skeleton();
+
+	//preTransform is any non-joint nodes between the parent joint and this joint
+	int addJoint(const std::string& name, int parent, const glm::mat4& preTransform, const JointPose& restPose, const glm::mat4& inverseBindMatrix);
+
+	int findJoint(const std::string& name) const;
+	int getParent(int joint) const;
+	const JointPose& getRestPose(int joint) const;
+	unsigned int getNumberOfJoints() const;
+
+	void buildSkinningMatrices(const JointPose *pLocalPose, glm::mat4 *pModelPose, glm::mat4 *pSkinningMatrices) const;
+	void clear();
+private:
+	std::vector<std::string> m_Names;
+	std::vector<int> m_Parents;
+	std::vector<glm::mat4> m_PreTransforms;
+	std::vector<JointPose> m_RestPose;
+	std::vector<glm::mat4> m_InverseBindMatrices;
+};
+
+//Where a joint's keys live in the clip's flat key arrays
+struct TrackRange
+{
+	unsigned int firstKey;
+	unsigned int numberOfKeys;
+};
+
+//Keyframes for every joint in flat arrays, rotations are quantised to 4 x 16 bit snorm
+class AnimationClip
+{
+public:
+	AnimationClip();
+	~AnimationClip();
+
+	void init(const std::string& name, float duration, unsigned int numberOfJoints);
+	void setTrack(unsigned int joint,
+		const std::vector<float>& positionTimes, const std::vector<glm::vec3>& positions,
+		const std::vector<float>& rotationTimes, const std::vector<glm::quat>& rotations,
+		const std::vector<float>& scaleTimes, const std::vector<glm::vec3>& scales);
+
+	//Joints without a track keep their rest pose
+	void sample(const Skeleton& skeleton, float time, bool loop, JointPose *pLocalPose) const;
+
+	const std::string& getName() const;
+	float getDuration() const;
+	unsigned int getSizeInBytes() const;
+private:
+	std::string m_Name;
+	float m_Duration;
+
+	std::vector<TrackRange> m_PositionTracks;
+	std::vector<TrackRange> m_RotationTracks;
+	std::vector<TrackRange> m_ScaleTracks;
+
+	std::vector<float> m_PositionTimes;
+	std::vector<glm::vec3> m_Positions;
+	std::vector<float> m_RotationTimes;
+	std::vector<glm::uint64> m_Rotations;
+	std::vector<float> m_ScaleTimes;
+	std::vector<glm::vec3> m_Scales;
+};
+
+//CPU copy of a skinned mesh's bind pose, only needed for the CPU skinning path
+struct SkinnedMeshData
+{
+	unsigned int meshIndex;
+	std::vector<Vertex> bindVertices;
+	std::vector<SkinVertex> skinVertices;
+	std::vector<Vertex> skinnedVertices;
+};
+
+//Everything the animated loader pulls out of a file
+struct AnimatedModel
+{
+	Skeleton skeleton;
+	std::vector<AnimationClip> clips;
+	std::vector<SkinnedMeshData> skins;
+};
+
+//One animated instance of a skeleton
+struct Character
+{
+	const Skeleton *pSkeleton;
+	const AnimationClip *pClip;
+	float time;
+	float speed;
+
+	std::vector<JointPose> localPose;
+	std::vector<glm::mat4> modelPose;
+	std::vector<glm::mat4> skinningMatrices;
+};
+
+void initCharacter(Character& character, const Skeleton *pSkeleton, const AnimationClip *pClip);
+
+//Advances and evaluates every character, spread across the job system's workers
+void updateCharacters(JobSystem& jobSystem, Character *pCharacters, unsigned int numberOfCharacters, float deltaTime);
+
+//Writes the skinned positions, normals and tangents into skinnedVertices, uses SSE when available
+void skinVertices(const glm::mat4 *pSkinningMatrices, const SkinVertex *pSkinVerts, const Vertex *pBindVerts, Vertex *pSkinnedVerts, unsigned int numberOfVerts);
+void skinVerticesScalar(const glm::mat4 *pSkinningMatrices, const SkinVertex *pSkinVerts, const Vertex *pBindVerts, Vertex *pSkinnedVerts, unsigned int numberOfVerts);
+
+//Prints how many characters per millisecond can be animated and skinned
+void runAnimationBenchmark(JobSystem& jobSystem, unsigned int numberOfCharacters, unsigned int numberOfFrames);
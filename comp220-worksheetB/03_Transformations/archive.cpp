@@ -0,0 +1,565 @@
+#include "archive.h"
+
+#include <algorithm>
+#include <cctype>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+
+#include <assimp\DefaultIOSystem.h>
+
+#ifdef _WIN32
+#define WIN32_LEAN_AND_MEAN
+#define NOMINMAX
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#include "compression.h"
+
+std::string normaliseAssetPath(const std::string & path)
+{
+	std::string normalised;
+	normalised.reserve(path.size());
+	for (char c : path)
+	{
+		normalised += c == '\\' ? '/' : (char)tolower((unsigned char)c);
+	}
+	while (normalised.compare(0, 2, "./") == 0)
+	{
+		normalised.erase(0, 2);
+	}
+	return normalised;
+}
+
+uint64_t hashAssetPath(const std::string & normalisedPath)
+{
+	//64 bit FNV-1a, plenty for a few thousand names and names are still compared on a match
+	uint64_t hash = 14695981039346656037ull;
+	for (char c : normalisedPath)
+	{
+		hash ^= (unsigned char)c;
+		hash *= 1099511628211ull;
+	}
+	return hash;
+}
+
+Archive::Archive()
+{
+	m_pData = nullptr;
+	m_Size = 0;
+	m_pEntries = nullptr;
+	m_pNames = nullptr;
+	m_NumberOfEntries = 0;
+#ifdef _WIN32
+	m_File = INVALID_HANDLE_VALUE;
+	m_Mapping = nullptr;
+#else
+	m_File = -1;
+#endif
+}
+
+Archive::~Archive()
+{
+	close();
+}
+
+bool Archive::open(const std::string & filename)
+{
+	close();
+
+#ifdef _WIN32
+	m_File = CreateFileA(filename.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+	if (m_File == INVALID_HANDLE_VALUE)
+	{
+		printf("Could not open archive %s\n", filename.c_str());
+		return false;
+	}
+	LARGE_INTEGER fileSize;
+	GetFileSizeEx(m_File, &fileSize);
+	m_Size = (size_t)fileSize.QuadPart;
+	m_Mapping = CreateFileMappingA(m_File, nullptr, PAGE_READONLY, 0, 0, nullptr);
+	if (m_Mapping)
+	{
+		m_pData = (const unsigned char*)MapViewOfFile(m_Mapping, FILE_MAP_READ, 0, 0, 0);
+	}
+#else
+	m_File = ::open(filename.c_str(), O_RDONLY);
+	if (m_File < 0)
+	{
+		printf("Could not open archive %s\n", filename.c_str());
+		return false;
+	}
+	struct stat fileStat;
+	fstat(m_File, &fileStat);
+	m_Size = (size_t)fileStat.st_size;
+	if (m_Size > 0)
+	{
+		void *pMapped = mmap(nullptr, m_Size, PROT_READ, MAP_PRIVATE, m_File, 0);
+		m_pData = pMapped == MAP_FAILED ? nullptr : (const unsigned char*)pMapped;
+	}
+#endif
+	if (m_pData == nullptr)
+	{
+		printf("Could not map archive %s\n", filename.c_str());
+		close();
+		return false;
+	}
+
+	//Everything the table points at has to be inside the file
+	const ArchiveHeader *pHeader = (const ArchiveHeader*)m_pData;
+	size_t tableEnd = sizeof(ArchiveHeader);
+	bool valid = m_Size >= sizeof(ArchiveHeader) && pHeader->magic == ARCHIVE_MAGIC && pHeader->version == ARCHIVE_VERSION;
+	if (valid)
+	{
+		tableEnd += (size_t)pHeader->numberOfEntries * sizeof(ArchiveEntry) + pHeader->nameTableSize;
+		valid = tableEnd <= m_Size;
+	}
+	if (valid)
+	{
+		m_NumberOfEntries = pHeader->numberOfEntries;
+		m_pEntries = (const ArchiveEntry*)(m_pData + sizeof(ArchiveHeader));
+		m_pNames = (const char*)(m_pEntries + m_NumberOfEntries);
+		for (unsigned int i = 0; i < m_NumberOfEntries && valid; i++)
+		{
+			const ArchiveEntry& entry = m_pEntries[i];
+			valid = entry.offset >= tableEnd && entry.offset <= m_Size && entry.storedSize <= m_Size - entry.offset && entry.nameOffset < pHeader->nameTableSize;
+		}
+		valid = valid && (pHeader->nameTableSize == 0 || m_pNames[pHeader->nameTableSize - 1] == '\0');
+	}
+	if (!valid)
+	{
+		printf("Archive %s is corrupt or from another version\n", filename.c_str());
+		close();
+		return false;
+	}
+	return true;
+}
+
+void Archive::close()
+{
+#ifdef _WIN32
+	if (m_pData)
+	{
+		UnmapViewOfFile(m_pData);
+	}
+	if (m_Mapping)
+	{
+		CloseHandle(m_Mapping);
+	}
+	if (m_File != INVALID_HANDLE_VALUE)
+	{
+		CloseHandle(m_File);
+	}
+	m_File = INVALID_HANDLE_VALUE;
+	m_Mapping = nullptr;
+#else
+	if (m_pData)
+	{
+		munmap((void*)m_pData, m_Size);
+	}
+	if (m_File >= 0)
+	{
+		::close(m_File);
+	}
+	m_File = -1;
+#endif
+	m_pData = nullptr;
+	m_Size = 0;
+	m_pEntries = nullptr;
+	m_pNames = nullptr;
+	m_NumberOfEntries = 0;
+}
+
+int Archive::findEntry(const std::string & name) const
+{
+	std::string normalised = normaliseAssetPath(name);
+	uint64_t hash = hashAssetPath(normalised);
+
+	//Table is sorted by hash, equal hashes sit together and are told apart by name
+	const ArchiveEntry *pFirst = std::lower_bound(m_pEntries, m_pEntries + m_NumberOfEntries, hash,
+		[](const ArchiveEntry& entry, uint64_t value) { return entry.nameHash < value; });
+	for (const ArchiveEntry *pEntry = pFirst; pEntry != m_pEntries + m_NumberOfEntries && pEntry->nameHash == hash; pEntry++)
+	{
+		if (normalised == m_pNames + pEntry->nameOffset)
+		{
+			return pEntry - m_pEntries;
+		}
+	}
+	return -1;
+}
+
+unsigned int Archive::getNumberOfEntries() const
+{
+	return m_NumberOfEntries;
+}
+
+const ArchiveEntry & Archive::getEntry(int entry) const
+{
+	return m_pEntries[entry];
+}
+
+std::string Archive::getEntryName(int entry) const
+{
+	return m_pNames + m_pEntries[entry].nameOffset;
+}
+
+const unsigned char * Archive::mapEntry(int entry) const
+{
+	if (entry < 0 || entry >= (int)m_NumberOfEntries || m_pEntries[entry].compression != ARCHIVE_STORED)
+	{
+		return nullptr;
+	}
+	return m_pData + m_pEntries[entry].offset;
+}
+
+bool Archive::readEntry(int entry, std::vector<unsigned char>& data) const
+{
+	if (entry < 0 || entry >= (int)m_NumberOfEntries)
+	{
+		return false;
+	}
+	const ArchiveEntry& archiveEntry = m_pEntries[entry];
+	const unsigned char *pStored = m_pData + archiveEntry.offset;
+	data.resize((size_t)archiveEntry.size);
+
+	if (archiveEntry.compression == ARCHIVE_STORED)
+	{
+		if (archiveEntry.storedSize != archiveEntry.size)
+		{
+			return false;
+		}
+		std::copy(pStored, pStored + archiveEntry.size, data.begin());
+		return true;
+	}
+	if (archiveEntry.compression == ARCHIVE_LZ4)
+	{
+		return decompressBlock(pStored, (size_t)archiveEntry.storedSize, data.data(), data.size());
+	}
+	printf("Archive entry %s uses unknown compression %u\n", getEntryName(entry).c_str(), archiveEntry.compression);
+	return false;
+}
+
+static bool readFile(const std::string& filename, std::vector<unsigned char>& data)
+{
+	std::ifstream file(filename, std::ios::in | std::ios::binary);
+	if (!file.is_open())
+	{
+		return false;
+	}
+	file.seekg(0, std::ios::end);
+	data.resize((size_t)file.tellg());
+	file.seekg(0, std::ios::beg);
+	file.read((char*)data.data(), data.size());
+	return file.good() || data.empty();
+}
+
+bool ArchiveWriter::addFile(const std::string & name, const std::string & filename)
+{
+	std::vector<unsigned char> data;
+	if (!readFile(filename, data))
+	{
+		printf("Could not read %s for the archive\n", filename.c_str());
+		return false;
+	}
+	addData(name, data.data(), data.size(), true);
+	return true;
+}
+
+void ArchiveWriter::addData(const std::string & name, const void * pData, size_t size, bool compress)
+{
+	PendingEntry pending;
+	pending.name = normaliseAssetPath(name);
+	memset(&pending.entry, 0, sizeof(pending.entry));
+	pending.entry.nameHash = hashAssetPath(pending.name);
+	pending.entry.size = size;
+	pending.entry.compression = ARCHIVE_STORED;
+
+	//Already compressed formats like PNG don't shrink, those stay stored and can be mapped directly
+	if (compress && size > 0)
+	{
+		compressBlock(pData, size, pending.data);
+		if (pending.data.size() < size)
+		{
+			pending.entry.compression = ARCHIVE_LZ4;
+		}
+	}
+	if (pending.entry.compression == ARCHIVE_STORED)
+	{
+		pending.data.assign((const unsigned char*)pData, (const unsigned char*)pData + size);
+	}
+	pending.entry.storedSize = pending.data.size();
+
+	//Adding the same name again replaces it
+	for (PendingEntry& existing : m_Entries)
+	{
+		if (existing.name == pending.name)
+		{
+			existing = std::move(pending);
+			return;
+		}
+	}
+	m_Entries.push_back(std::move(pending));
+}
+
+bool ArchiveWriter::write(const std::string & filename)
+{
+	std::sort(m_Entries.begin(), m_Entries.end(), [](const PendingEntry& a, const PendingEntry& b)
+	{
+		return a.entry.nameHash < b.entry.nameHash;
+	});
+
+	std::vector<char> names;
+	for (PendingEntry& pending : m_Entries)
+	{
+		pending.entry.nameOffset = names.size();
+		names.insert(names.end(), pending.name.begin(), pending.name.end());
+		names.push_back('\0');
+	}
+
+	ArchiveHeader header;
+	header.magic = ARCHIVE_MAGIC;
+	header.version = ARCHIVE_VERSION;
+	header.numberOfEntries = m_Entries.size();
+	header.nameTableSize = names.size();
+
+	uint64_t offset = sizeof(ArchiveHeader) + m_Entries.size() * sizeof(ArchiveEntry) + names.size();
+	for (PendingEntry& pending : m_Entries)
+	{
+		offset = (offset + ARCHIVE_ALIGNMENT - 1) & ~(uint64_t)(ARCHIVE_ALIGNMENT - 1);
+		pending.entry.offset = offset;
+		offset += pending.entry.storedSize;
+	}
+
+	FILE *pFile = fopen(filename.c_str(), "wb");
+	if (pFile == nullptr)
+	{
+		printf("Could not write archive %s\n", filename.c_str());
+		return false;
+	}
+	fwrite(&header, sizeof(header), 1, pFile);
+	for (PendingEntry& pending : m_Entries)
+	{
+		fwrite(&pending.entry, sizeof(ArchiveEntry), 1, pFile);
+	}
+	fwrite(names.data(), 1, names.size(), pFile);
+
+	const char padding[ARCHIVE_ALIGNMENT] = {};
+	long position = ftell(pFile);
+	for (PendingEntry& pending : m_Entries)
+	{
+		fwrite(padding, 1, (size_t)(pending.entry.offset - position), pFile);
+		fwrite(pending.data.data(), 1, pending.data.size(), pFile);
+		position = (long)(pending.entry.offset + pending.entry.storedSize);
+	}
+	bool written = ferror(pFile) == 0;
+	fclose(pFile);
+	return written;
+}
+
+//Reads from memory, either straight out of the mapping or from its own decompressed copy
+class ArchiveIOStream : public Assimp::IOStream
+{
+public:
+	ArchiveIOStream(const unsigned char *pData, size_t size, std::vector<unsigned char>&& ownedData)
+	{
+		m_OwnedData = std::move(ownedData);
+		m_pData = pData ? pData : m_OwnedData.data();
+		m_Size = size;
+		m_Position = 0;
+	}
+
+	size_t Read(void *pvBuffer, size_t pSize, size_t pCount)
+	{
+		if (pSize == 0)
+		{
+			return 0;
+		}
+		size_t count = std::min(pCount, (m_Size - m_Position) / pSize);
+		memcpy(pvBuffer, m_pData + m_Position, count * pSize);
+		m_Position += count * pSize;
+		return count;
+	}
+
+	//Archives are read only
+	size_t Write(const void * /*pvBuffer*/, size_t /*pSize*/, size_t /*pCount*/)
+	{
+		return 0;
+	}
+
+	aiReturn Seek(size_t pOffset, aiOrigin pOrigin)
+	{
+		size_t base = pOrigin == aiOrigin_SET ? 0 : pOrigin == aiOrigin_CUR ? m_Position : m_Size;
+		if (base + pOffset > m_Size)
+		{
+			return aiReturn_FAILURE;
+		}
+		m_Position = base + pOffset;
+		return aiReturn_SUCCESS;
+	}
+
+	size_t Tell() const
+	{
+		return m_Position;
+	}
+
+	size_t FileSize() const
+	{
+		return m_Size;
+	}
+
+	void Flush()
+	{
+	}
+private:
+	std::vector<unsigned char> m_OwnedData;
+	const unsigned char *m_pData;
+	size_t m_Size;
+	size_t m_Position;
+};
+
+ArchiveIOSystem::ArchiveIOSystem(const Archive * pArchive)
+{
+	m_pArchive = pArchive;
+	m_pDiskIOSystem = new Assimp::DefaultIOSystem();
+}
+
+ArchiveIOSystem::~ArchiveIOSystem()
+{
+	delete m_pDiskIOSystem;
+}
+
+bool ArchiveIOSystem::Exists(const char * pFile) const
+{
+	return m_pArchive->findEntry(pFile) >= 0 || m_pDiskIOSystem->Exists(pFile);
+}
+
+char ArchiveIOSystem::getOsSeparator() const
+{
+	return '/';
+}
+
+Assimp::IOStream * ArchiveIOSystem::Open(const char * pFile, const char * pMode)
+{
+	int entry = m_pArchive->findEntry(pFile);
+	if (entry < 0 || strchr(pMode, 'w'))
+	{
+		return m_pDiskIOSystem->Open(pFile, pMode);
+	}
+
+	std::vector<unsigned char> data;
+	const unsigned char *pMapped = m_pArchive->mapEntry(entry);
+	if (pMapped == nullptr && !m_pArchive->readEntry(entry, data))
+	{
+		return nullptr;
+	}
+	return new ArchiveIOStream(pMapped, (size_t)m_pArchive->getEntry(entry).size, std::move(data));
+}
+
+void ArchiveIOSystem::Close(Assimp::IOStream * pFile)
+{
+	delete pFile;
+}
+
+static const Archive *s_pAssetArchive = nullptr;
+
+void setAssetArchive(const Archive * pArchive)
+{
+	s_pAssetArchive = pArchive;
+}
+
+const Archive * getAssetArchive()
+{
+	return s_pAssetArchive;
+}
+
+//Memory RWops keep their buffer in hidden.mem.base, decompressed ones own it
+static int SDLCALL closeOwnedRWops(SDL_RWops *pRWops)
+{
+	SDL_free(pRWops->hidden.mem.base);
+	SDL_FreeRW(pRWops);
+	return 0;
+}
+
+SDL_RWops * openAssetRWops(const std::string & filename)
+{
+	int entry = s_pAssetArchive ? s_pAssetArchive->findEntry(filename) : -1;
+	if (entry < 0)
+	{
+		return SDL_RWFromFile(filename.c_str(), "rb");
+	}
+
+	const ArchiveEntry& archiveEntry = s_pAssetArchive->getEntry(entry);
+	const unsigned char *pMapped = s_pAssetArchive->mapEntry(entry);
+	if (pMapped)
+	{
+		return SDL_RWFromConstMem(pMapped, (int)archiveEntry.size);
+	}
+
+	std::vector<unsigned char> data;
+	if (!s_pAssetArchive->readEntry(entry, data))
+	{
+		SDL_SetError("Archive entry %s is corrupt", filename.c_str());
+		return nullptr;
+	}
+	void *pBuffer = SDL_malloc(data.size() > 0 ? data.size() : 1);
+	memcpy(pBuffer, data.data(), data.size());
+	SDL_RWops *pRWops = SDL_RWFromConstMem(pBuffer, (int)data.size());
+	if (pRWops == nullptr)
+	{
+		SDL_free(pBuffer);
+		return nullptr;
+	}
+	pRWops->close = closeOwnedRWops;
+	return pRWops;
+}
+
+bool readAsset(const std::string & filename, std::vector<unsigned char>& data)
+{
+	int entry = s_pAssetArchive ? s_pAssetArchive->findEntry(filename) : -1;
+	if (entry >= 0)
+	{
+		return s_pAssetArchive->readEntry(entry, data);
+	}
+	return readFile(filename, data);
+}
+
+bool assetExists(const std::string & filename)
+{
+	if (s_pAssetArchive && s_pAssetArchive->findEntry(filename) >= 0)
+	{
+		return true;
+	}
+	std::ifstream file(filename, std::ios::in | std::ios::binary);
+	return file.is_open();
+}
+
+void useAssetArchive(Assimp::Importer & importer)
+{
+	if (s_pAssetArchive)
+	{
+		importer.SetIOHandler(new ArchiveIOSystem(s_pAssetArchive));
+	}
+}
+
+bool packArchive(const std::string & archiveFilename, const std::vector<std::string>& filenames)
+{
+	ArchiveWriter writer;
+	for (const std::string& filename : filenames)
+	{
+		if (!writer.addFile(filename, filename))
+		{
+			return false;
+		}
+	}
+	if (!writer.write(archiveFilename))
+	{
+		return false;
+	}
+	printf("Packed %u files into %s\n", (unsigned int)filenames.size(), archiveFilename.c_str());
+	return true;
+}
@@ -0,0 +1,133 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include <SDL.h>
+#include <assimp\Importer.hpp>
+#include <assimp\IOStream.hpp>
+#include <assimp\IOSystem.hpp>
+
+#define ARCHIVE_MAGIC 0x314b4150 //"PAK1"
+#define ARCHIVE_VERSION 1
+
+//Entry data starts on this boundary, so uncompressed entries can be used straight from the mapping
+#define ARCHIVE_ALIGNMENT 64
+
+enum ArchiveCompression
+{
+	ARCHIVE_STORED = 0,
+	ARCHIVE_LZ4 = 1
+};
+
+//Layout on disk is the header, the table of contents sorted by hash, the name table and then the entries
+struct ArchiveHeader
+{
+	uint32_t magic;
+	uint32_t version;
+	uint32_t numberOfEntries;
+	uint32_t nameTableSize;
+};
+
+struct ArchiveEntry
+{
+	uint64_t nameHash;
+	uint64_t offset;
+	uint64_t size;
+	uint64_t storedSize;
+	uint32_t compression;
+	uint32_t nameOffset;
+};
+
+//Lower case with forward slashes and no leading ./, the form names are hashed and looked up in
+std::string normaliseAssetPath(const std::string& path);
+uint64_t hashAssetPath(const std::string& normalisedPath);
+
+//Read only view of an archive file, memory mapped so opening an entry costs no copy unless it is compressed
+class Archive
+{
+public:
+	Archive();
+	~Archive();
+
+	bool open(const std::string& filename);
+	void close();
+
+	//-1 if the archive doesn't have it
+	int findEntry(const std::string& name) const;
+	unsigned int getNumberOfEntries() const;
+	const ArchiveEntry& getEntry(int entry) const;
+	std::string getEntryName(int entry) const;
+
+	//Pointer into the mapping for stored entries, nullptr for compressed ones
+	const unsigned char *mapEntry(int entry) const;
+
+	//Works for every entry, decompressing if needed
+	bool readEntry(int entry, std::vector<unsigned char>& data) const;
+private:
+	const unsigned char *m_pData;
+	size_t m_Size;
+	const ArchiveEntry *m_pEntries;
+	const char *m_pNames;
+	unsigned int m_NumberOfEntries;
+
+#ifdef _WIN32
+	void *m_File;
+	void *m_Mapping;
+#else
+	int m_File;
+#endif
+};
+
+//Collects files and writes them out as one archive, entries only stay compressed if that saves space
+class ArchiveWriter
+{
+public:
+	bool addFile(const std::string& name, const std::string& filename);
+	void addData(const std::string& name, const void *pData, size_t size, bool compress);
+	bool write(const std::string& filename);
+private:
+	struct PendingEntry
+	{
+		std::string name;
+		ArchiveEntry entry;
+		std::vector<unsigned char> data;
+	};
+	std::vector<PendingEntry> m_Entries;
+};
+
+//Assimp reads through this when an archive is set, files the archive doesn't have fall back to the disk
+class ArchiveIOSystem : public Assimp::IOSystem
+{
+public:
+	ArchiveIOSystem(const Archive *pArchive);
+	~ArchiveIOSystem();
+
+	bool Exists(const char *pFile) const;
+	char getOsSeparator() const;
+	Assimp::IOStream *Open(const char *pFile, const char *pMode = "rb");
+	void Close(Assimp::IOStream *pFile);
+private:
+	const Archive *m_pArchive;
+	Assimp::IOSystem *m_pDiskIOSystem;
+};
+
+//The archive every loader reads from, nullptr reads loose files from disk
+void setAssetArchive(const Archive *pArchive);
+const Archive *getAssetArchive();
+
+//SDL_RWops over an asset, for IMG_Load_RW and anything else SDL, closes itself when the caller closes it
+SDL_RWops *openAssetRWops(const std::string& filename);
+
+//Whole asset into memory, from the archive if it has it
+bool readAsset(const std::string& filename, std::vector<unsigned char>& data);
+
+//In the archive or on the disk
+bool assetExists(const std::string& filename);
+
+//Points the importer at the asset archive if there is one, the importer owns the IO system after this
+void useAssetArchive(Assimp::Importer& importer);
+
+//Packs the given files into an archive, for --pack on the command line
+bool packArchive(const std::string& archiveFilename, const std::vector<std::string>& filenames);
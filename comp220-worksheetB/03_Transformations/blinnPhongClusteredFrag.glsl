@@ -0,0 +1,119 @@
+#version 330 core
+
+in vec4 vertexColoursOut;
+in vec2 vertexTextureCoordOut;
+in vec3 vertexNormalsOut;
+in vec3 worldPositionOut;
+in float viewDepthOut;
+
+out vec4 colour;
+
+//Has to match the cluster grid in lights.h
+const int clusterCountX=16;
+const int clusterCountY=9;
+const int clusterCountZ=24;
+
+//Has to match SHADOW_CASCADES in shadows.h
+const int shadowCascades=4;
+
+//Base textures live in a texture atlas, the transform is xy scale and zw offset into the layer
+uniform sampler2DArray baseTexture;
+uniform float baseTextureLayer;
+uniform vec4 baseTextureTransform;
+
+uniform vec4 ambientLightColour;
+uniform vec4 diffuseLightColour;
+uniform vec4 specularLightColour;
+
+uniform vec3 lightDirection;
+
+uniform vec4 ambientMaterialColour;
+uniform vec4 diffuseMaterialColour;
+uniform vec4 specularMaterialColour;
+uniform float specularMaterialPower;
+
+uniform vec3 cameraPosition;
+
+//Light data is 3 texels per light: position and radius, colour and intensity, spot direction and cutoff
+uniform samplerBuffer lightData;
+uniform usamplerBuffer clusterLights;
+uniform usamplerBuffer lightIndices;
+
+//The buffers are a ring shared between frames, these are where this frame's data starts in texels
+uniform int lightDataOffset;
+uniform int clusterLightsOffset;
+uniform int lightIndicesOffset;
+
+uniform vec2 clusterTileSize;
+uniform float clusterDepthScale;
+uniform float clusterDepthBias;
+
+//Cascaded shadow map for the directional light, cascadeSplits are the view depths where each cascade ends
+uniform sampler2DArrayShadow shadowMap;
+uniform mat4 shadowMatrices[shadowCascades];
+uniform float cascadeSplits[shadowCascades];
+
+float directionalShadow()
+{
+	//Nothing past the last cascade is shadowed
+	if(viewDepthOut>=cascadeSplits[shadowCascades-1])
+	{
+		return 1.0;
+	}
+	int cascade=0;
+	while(viewDepthOut>=cascadeSplits[cascade])
+	{
+		cascade++;
+	}
+
+	vec4 shadowPosition=shadowMatrices[cascade]*vec4(worldPositionOut,1.0);
+	vec3 shadowCoord=shadowPosition.xyz/shadowPosition.w*0.5+0.5;
+	return texture(shadowMap,vec4(shadowCoord.xy,float(cascade),shadowCoord.z-0.0005));
+}
+
+void main()
+{
+	vec3 normal=normalize(vertexNormalsOut);
+	vec3 viewDirection=normalize(cameraPosition-worldPositionOut);
+
+	//Directional light, same as blinnPhongFrag
+	float nDotl=max(dot(normal,normalize(lightDirection)),0.0);
+	vec3 halfWay=normalize(lightDirection+viewDirection);
+	float nDoth=pow(max(dot(normal,halfWay),0.0),specularMaterialPower);
+
+	vec4 diffuseColour=diffuseMaterialColour*texture(baseTexture,vec3(vertexTextureCoordOut*baseTextureTransform.xy+baseTextureTransform.zw,baseTextureLayer));
+
+	float shadow=directionalShadow();
+	colour=(ambientLightColour*ambientMaterialColour)+shadow*((diffuseLightColour*nDotl*diffuseColour)+(specularLightColour*nDoth*specularMaterialColour));
+
+	//Find the cluster from the screen tile and the depth slice
+	ivec2 tile=clamp(ivec2(gl_FragCoord.xy/clusterTileSize),ivec2(0),ivec2(clusterCountX-1,clusterCountY-1));
+	int slice=clamp(int(log(viewDepthOut)*clusterDepthScale+clusterDepthBias),0,clusterCountZ-1);
+	int cluster=(slice*clusterCountY+tile.y)*clusterCountX+tile.x;
+	uvec2 range=texelFetch(clusterLights,clusterLightsOffset+cluster).xy;
+
+	//Only the lights binned into this cluster are walked
+	vec3 lightColour=vec3(0.0);
+	for(uint i=0u;i<range.y;i++)
+	{
+		int light=int(texelFetch(lightIndices,lightIndicesOffset+int(range.x+i)).x);
+		vec4 positionRadius=texelFetch(lightData,lightDataOffset+light*3);
+		vec4 colourIntensity=texelFetch(lightData,lightDataOffset+light*3+1);
+		vec4 spot=texelFetch(lightData,lightDataOffset+light*3+2);
+
+		vec3 toLight=positionRadius.xyz-worldPositionOut;
+		float distance=length(toLight);
+		vec3 lightVector=toLight/max(distance,0.0001);
+
+		//Falls off to nothing at the light's radius, spot lights also fade at the edge of their cone
+		float attenuation=clamp(1.0-distance/positionRadius.w,0.0,1.0);
+		attenuation*=attenuation;
+		attenuation*=smoothstep(spot.w,spot.w+0.05,dot(-lightVector,spot.xyz));
+
+		float pointDiffuse=max(dot(normal,lightVector),0.0);
+		float pointSpecular=pow(max(dot(normal,normalize(lightVector+viewDirection)),0.0),specularMaterialPower);
+		lightColour+=colourIntensity.rgb*colourIntensity.a*attenuation*(pointDiffuse*diffuseColour.rgb+pointSpecular*specularMaterialColour.rgb);
+	}
+
+	colour.rgb+=lightColour;
+}
@@ -0,0 +1,37 @@
+#version 330 core
+
+layout(location = 0) in vec3 vertexPosition;
+layout(location = 1) in vec4 vertexColours;
+layout(location=2) in vec2 vertexTextureCoord;
+layout(location=3) in vec3 vertexNormals;
+
+//Per draw model matrix, instanced from the indirect batch or set as a constant attribute by its fallback
+layout(location=8) in mat4 instanceModelMatrix;
+
+//The depth pre-pass is tested with GL_EQUAL, so both passes have to produce bit identical positions
+invariant gl_Position;
+
+uniform mat4 viewMatrix;
+uniform mat4 projectionMatrix;
+
+out vec4 vertexColoursOut;
+out vec2 vertexTextureCoordOut;
+out vec3 vertexNormalsOut;
+out vec3 worldPositionOut;
+out float viewDepthOut;
+
+void main(){
+
+	vec4 worldPosition=instanceModelMatrix*vec4(vertexPosition,1.0f);
+	vec4 viewPosition=viewMatrix*worldPosition;
+
+	vertexColoursOut=vertexColours;
+	vertexTextureCoordOut=vertexTextureCoord;
+	vertexNormalsOut=normalize(instanceModelMatrix*vec4(vertexNormals,0.0f)).xyz;
+
+	//The clustered fragment shader needs the world position for lighting and the view depth to find its cluster
+	worldPositionOut=worldPosition.xyz;
+	viewDepthOut=-viewPosition.z;
+
+	gl_Position=projectionMatrix*viewPosition;
+}
@@ -0,0 +1,228 @@
+#include "compression.h"
+
+#include <cstring>
+
+#define LZ4_MIN_MATCH 4
+//The format needs the last 5 bytes to be literals and the last match to start at least 12 bytes from the end
+#define LZ4_LAST_LITERALS 5
+#define LZ4_MATCH_FIND_LIMIT 12
+#define LZ4_MAX_OFFSET 65535
+#define LZ4_HASH_BITS 12
+
+static unsigned int read32(const unsigned char *p)
+{
+	unsigned int value;
+	memcpy(&value, p, sizeof(value));
+	return value;
+}
+
+static unsigned int hash32(unsigned int value)
+{
+	return (value * 2654435761u) >> (32 - LZ4_HASH_BITS);
+}
+
+//Lengths of 15 or more spill into extra bytes, 255 at a time
+static unsigned char *writeLength(unsigned char *pOut, size_t length)
+{
+	while (length >= 255)
+	{
+		*pOut++ = 255;
+		length -= 255;
+	}
+	*pOut++ = (unsigned char)length;
+	return pOut;
+}
+
+static unsigned char *writeSequence(unsigned char *pOut, const unsigned char *pLiterals, size_t literalLength, size_t offset, size_t matchLength)
+{
+	unsigned char *pToken = pOut++;
+	unsigned char token = 0;
+
+	if (literalLength >= 15)
+	{
+		token = 15 << 4;
+		pOut = writeLength(pOut, literalLength - 15);
+	}
+	else
+	{
+		token = (unsigned char)(literalLength << 4);
+	}
+	if (literalLength > 0)
+	{
+		memcpy(pOut, pLiterals, literalLength);
+		pOut += literalLength;
+	}
+
+	//The last sequence is literals only
+	if (matchLength > 0)
+	{
+		*pOut++ = (unsigned char)(offset & 0xff);
+		*pOut++ = (unsigned char)(offset >> 8);
+
+		size_t extraLength = matchLength - LZ4_MIN_MATCH;
+		if (extraLength >= 15)
+		{
+			token |= 15;
+			pOut = writeLength(pOut, extraLength - 15);
+		}
+		else
+		{
+			token |= (unsigned char)extraLength;
+		}
+	}
+	*pToken = token;
+	return pOut;
+}
+
+size_t getCompressBound(size_t size)
+{
+	return size + size / 255 + 16;
+}
+
+size_t compressBlock(const unsigned char * pSource, size_t sourceSize, unsigned char * pDestination)
+{
+	unsigned char *pOut = pDestination;
+	size_t anchor = 0;
+
+	if (sourceSize > LZ4_MATCH_FIND_LIMIT)
+	{
+		//Last position seen for each hash of 4 bytes, plus one so zero means empty
+		std::vector<unsigned int> table(1 << LZ4_HASH_BITS, 0);
+		size_t matchLimit = sourceSize - LZ4_LAST_LITERALS;
+		size_t searchLimit = sourceSize - LZ4_MATCH_FIND_LIMIT;
+		size_t position = 0;
+
+		while (position < searchLimit)
+		{
+			unsigned int sequence = read32(pSource + position);
+			unsigned int hash = hash32(sequence);
+			size_t candidate = table[hash];
+			table[hash] = (unsigned int)(position + 1);
+
+			if (candidate == 0 || position - (candidate - 1) > LZ4_MAX_OFFSET || read32(pSource + candidate - 1) != sequence)
+			{
+				position++;
+				continue;
+			}
+			size_t reference = candidate - 1;
+
+			//Grow the match backwards into the pending literals, then forwards as far as it goes
+			while (position > anchor && reference > 0 && pSource[position - 1] == pSource[reference - 1])
+			{
+				position--;
+				reference--;
+			}
+			size_t matchLength = LZ4_MIN_MATCH;
+			while (position + matchLength < matchLimit && pSource[position + matchLength] == pSource[reference + matchLength])
+			{
+				matchLength++;
+			}
+
+			pOut = writeSequence(pOut, pSource + anchor, position - anchor, position - reference, matchLength);
+			position += matchLength;
+			anchor = position;
+
+			//Positions skipped by the match still help later ones
+			if (position - 2 < searchLimit)
+			{
+				table[hash32(read32(pSource + position - 2))] = (unsigned int)(position - 2 + 1);
+			}
+		}
+	}
+
+	pOut = writeSequence(pOut, pSource + anchor, sourceSize - anchor, 0, 0);
+	return pOut - pDestination;
+}
+
+void compressBlock(const void * pSource, size_t sourceSize, std::vector<unsigned char>& compressed)
+{
+	compressed.resize(getCompressBound(sourceSize));
+	compressed.resize(compressBlock((const unsigned char*)pSource, sourceSize, compressed.data()));
+}
+
+//Reads the extra bytes of a length, false if the input runs out first
+static bool readLength(const unsigned char *pSource, size_t sourceSize, size_t& position, size_t& length)
+{
+	unsigned char byte;
+	do
+	{
+		if (position >= sourceSize)
+		{
+			return false;
+		}
+		byte = pSource[position++];
+		length += byte;
+	} while (byte == 255);
+	return true;
+}
+
+bool decompressBlock(const unsigned char * pSource, size_t sourceSize, unsigned char * pDestination, size_t destinationSize)
+{
+	size_t in = 0;
+	size_t out = 0;
+	while (in < sourceSize)
+	{
+		unsigned char token = pSource[in++];
+
+		size_t literalLength = token >> 4;
+		if (literalLength == 15 && !readLength(pSource, sourceSize, in, literalLength))
+		{
+			return false;
+		}
+		if (literalLength > sourceSize - in || literalLength > destinationSize - out)
+		{
+			return false;
+		}
+		if (literalLength > 0)
+		{
+			memcpy(pDestination + out, pSource + in, literalLength);
+		}
+		in += literalLength;
+		out += literalLength;
+
+		//Only the last sequence ends straight after its literals
+		if (in == sourceSize)
+		{
+			break;
+		}
+
+		if (sourceSize - in < 2)
+		{
+			return false;
+		}
+		size_t offset = pSource[in] | (pSource[in + 1] << 8);
+		in += 2;
+		if (offset == 0 || offset > out)
+		{
+			return false;
+		}
+
+		size_t matchLength = token & 15;
+		if (matchLength == 15 && !readLength(pSource, sourceSize, in, matchLength))
+		{
+			return false;
+		}
+		matchLength += LZ4_MIN_MATCH;
+		if (matchLength > destinationSize - out)
+		{
+			return false;
+		}
+
+		//Matches can overlap what they are writing, which is how runs are encoded, so copy a byte at a time
+		const unsigned char *pMatch = pDestination + out - offset;
+		unsigned char *pWrite = pDestination + out;
+		if (offset >= matchLength)
+		{
+			memcpy(pWrite, pMatch, matchLength);
+		}
+		else
+		{
+			for (size_t i = 0; i < matchLength; i++)
+			{
+				pWrite[i] = pMatch[i];
+			}
+		}
+		out += matchLength;
+	}
+	return out == destinationSize;
+}
@@ -0,0 +1,17 @@
+#pragma once
+
+#include <cstddef>
+#include <vector>
+
+//LZ4 block format, so data compressed here can be read by the reference lz4 library and the other way round
+//Fast enough to run on eviction and load paths, the ratio is modest but decompression is close to memcpy speed
+
+//Largest compressed size for an input of size bytes
+size_t getCompressBound(size_t size);
+
+//pDestination has to hold getCompressBound(sourceSize) bytes, returns the compressed size
+size_t compressBlock(const unsigned char *pSource, size_t sourceSize, unsigned char *pDestination);
+void compressBlock(const void *pSource, size_t sourceSize, std::vector<unsigned char>& compressed);
+
+//Checks every length and offset, returns false on corrupt data or if it doesn't decompress to exactly destinationSize
+bool decompressBlock(const unsigned char *pSource, size_t sourceSize, unsigned char *pDestination, size_t destinationSize);
@@ -0,0 +1,458 @@
+#include "cooked.h"
+
+#include <algorithm>
+#include <cctype>
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+
+#include <glm/gtc/packing.hpp>
+
+#include "archive.h"
+#include "compression.h"
+
+static bool hasExtension(const std::string& filename, const char *pExtension)
+{
+	size_t length = strlen(pExtension);
+	if (filename.size() < length)
+	{
+		return false;
+	}
+	for (size_t i = 0; i < length; i++)
+	{
+		if (tolower((unsigned char)filename[filename.size() - length + i]) != pExtension[i])
+		{
+			return false;
+		}
+	}
+	return true;
+}
+
+bool isCookedMesh(const std::string & filename)
+{
+	return hasExtension(filename, ".mesh");
+}
+
+bool isCookedTexture(const std::string & filename)
+{
+	return hasExtension(filename, ".tex");
+}
+
+//Octahedral encoding, the unit sphere folded onto the square [-1, 1]
+static void encodeDirection(float x, float y, float z, int16_t *pEncoded)
+{
+	float length = fabsf(x) + fabsf(y) + fabsf(z);
+	if (length < 1e-8f)
+	{
+		pEncoded[0] = 0;
+		pEncoded[1] = 0;
+		return;
+	}
+	glm::vec2 folded = glm::vec2(x, y) / length;
+	if (z < 0.0f)
+	{
+		folded = (1.0f - glm::abs(glm::vec2(folded.y, folded.x))) * glm::vec2(folded.x >= 0.0f ? 1.0f : -1.0f, folded.y >= 0.0f ? 1.0f : -1.0f);
+	}
+	pEncoded[0] = (int16_t)glm::packSnorm1x16(folded.x);
+	pEncoded[1] = (int16_t)glm::packSnorm1x16(folded.y);
+}
+
+static glm::vec3 decodeDirection(const int16_t *pEncoded)
+{
+	glm::vec2 folded = glm::vec2(glm::unpackSnorm1x16((uint16_t)pEncoded[0]), glm::unpackSnorm1x16((uint16_t)pEncoded[1]));
+	glm::vec3 direction = glm::vec3(folded.x, folded.y, 1.0f - fabsf(folded.x) - fabsf(folded.y));
+	if (direction.z < 0.0f)
+	{
+		glm::vec2 unfolded = (1.0f - glm::abs(glm::vec2(direction.y, direction.x))) * glm::vec2(direction.x >= 0.0f ? 1.0f : -1.0f, direction.y >= 0.0f ? 1.0f : -1.0f);
+		direction.x = unfolded.x;
+		direction.y = unfolded.y;
+	}
+	return glm::normalize(direction);
+}
+
+void quantizeVertices(const Vertex * pVerts, unsigned int numberOfVerts, const glm::vec3 & boundsMin, const glm::vec3 & boundsMax, QuantizedVertex * pQuantized)
+{
+	//A flat axis quantizes everything to 0
+	glm::vec3 extent = boundsMax - boundsMin;
+	glm::vec3 scale = glm::vec3(extent.x > 0.0f ? 65535.0f / extent.x : 0.0f, extent.y > 0.0f ? 65535.0f / extent.y : 0.0f, extent.z > 0.0f ? 65535.0f / extent.z : 0.0f);
+
+	for (unsigned int i = 0; i < numberOfVerts; i++)
+	{
+		const Vertex& vertex = pVerts[i];
+		QuantizedVertex& quantized = pQuantized[i];
+
+		glm::vec3 position = glm::clamp((glm::vec3(vertex.x, vertex.y, vertex.z) - boundsMin) * scale, 0.0f, 65535.0f);
+		quantized.position[0] = (uint16_t)(position.x + 0.5f);
+		quantized.position[1] = (uint16_t)(position.y + 0.5f);
+		quantized.position[2] = (uint16_t)(position.z + 0.5f);
+
+		uint32_t colour = glm::packUnorm4x8(glm::vec4(vertex.r, vertex.g, vertex.b, vertex.a));
+		memcpy(quantized.colour, &colour, sizeof(quantized.colour));
+
+		quantized.textureCoords[0] = glm::packHalf1x16(vertex.tu);
+		quantized.textureCoords[1] = glm::packHalf1x16(vertex.tv);
+
+		encodeDirection(vertex.normalX, vertex.normalY, vertex.normalZ, quantized.normal);
+		encodeDirection(vertex.tangentX, vertex.tangentY, vertex.tangentZ, quantized.tangent);
+		encodeDirection(vertex.biTangentX, vertex.biTangentY, vertex.biTangentZ, quantized.biTangent);
+	}
+}
+
+void dequantizeVertices(const QuantizedVertex * pQuantized, unsigned int numberOfVerts, const glm::vec3 & boundsMin, const glm::vec3 & boundsMax, Vertex * pVerts)
+{
+	glm::vec3 scale = (boundsMax - boundsMin) / 65535.0f;
+
+	for (unsigned int i = 0; i < numberOfVerts; i++)
+	{
+		const QuantizedVertex& quantized = pQuantized[i];
+		Vertex& vertex = pVerts[i];
+
+		glm::vec3 position = boundsMin + glm::vec3(quantized.position[0], quantized.position[1], quantized.position[2]) * scale;
+		vertex.x = position.x;
+		vertex.y = position.y;
+		vertex.z = position.z;
+
+		uint32_t packedColour;
+		memcpy(&packedColour, quantized.colour, sizeof(packedColour));
+		glm::vec4 colour = glm::unpackUnorm4x8(packedColour);
+		vertex.r = colour.r;
+		vertex.g = colour.g;
+		vertex.b = colour.b;
+		vertex.a = colour.a;
+
+		vertex.tu = glm::unpackHalf1x16(quantized.textureCoords[0]);
+		vertex.tv = glm::unpackHalf1x16(quantized.textureCoords[1]);
+
+		glm::vec3 normal = decodeDirection(quantized.normal);
+		glm::vec3 tangent = decodeDirection(quantized.tangent);
+		glm::vec3 biTangent = decodeDirection(quantized.biTangent);
+		vertex.normalX = normal.x;
+		vertex.normalY = normal.y;
+		vertex.normalZ = normal.z;
+		vertex.tangentX = tangent.x;
+		vertex.tangentY = tangent.y;
+		vertex.tangentZ = tangent.z;
+		vertex.biTangentX = biTangent.x;
+		vertex.biTangentY = biTangent.y;
+		vertex.biTangentZ = biTangent.z;
+	}
+}
+
+void optimizeVertexFetch(std::vector<Vertex>& vertices, std::vector<std::vector<unsigned int>>& lodIndices)
+{
+	std::vector<unsigned int> remap(vertices.size(), ~0u);
+	std::vector<Vertex> reordered;
+	reordered.reserve(vertices.size());
+
+	//LOD 0 uses nearly every vertex, the lower LODs only pick up anything it left out
+	for (std::vector<unsigned int>& indices : lodIndices)
+	{
+		for (unsigned int& index : indices)
+		{
+			if (remap[index] == ~0u)
+			{
+				remap[index] = reordered.size();
+				reordered.push_back(vertices[index]);
+			}
+			index = remap[index];
+		}
+	}
+	vertices.swap(reordered);
+}
+
+void buildMipChain(const unsigned char * pPixels, unsigned int width, unsigned int height, CookedTexture & texture)
+{
+	texture.info.width = width;
+	texture.info.height = height;
+	texture.info.mipLevels = 1;
+	while ((width >> texture.info.mipLevels) > 0 || (height >> texture.info.mipLevels) > 0)
+	{
+		texture.info.mipLevels++;
+	}
+
+	texture.pixels.resize(getMipOffset(texture.info, texture.info.mipLevels));
+	std::copy(pPixels, pPixels + getMipSize(texture.info, 0), texture.pixels.begin());
+
+	for (unsigned int level = 1; level < texture.info.mipLevels; level++)
+	{
+		unsigned int sourceWidth = std::max(width >> (level - 1), 1u);
+		unsigned int sourceHeight = std::max(height >> (level - 1), 1u);
+		unsigned int levelWidth = std::max(width >> level, 1u);
+		unsigned int levelHeight = std::max(height >> level, 1u);
+		const unsigned char *pSource = texture.pixels.data() + getMipOffset(texture.info, level - 1);
+		unsigned char *pLevel = texture.pixels.data() + getMipOffset(texture.info, level);
+
+		//Odd sizes repeat the last row or column rather than reading past the edge
+		for (unsigned int y = 0; y < levelHeight; y++)
+		{
+			unsigned int y0 = std::min(y * 2, sourceHeight - 1);
+			unsigned int y1 = std::min(y * 2 + 1, sourceHeight - 1);
+			for (unsigned int x = 0; x < levelWidth; x++)
+			{
+				unsigned int x0 = std::min(x * 2, sourceWidth - 1);
+				unsigned int x1 = std::min(x * 2 + 1, sourceWidth - 1);
+				for (unsigned int c = 0; c < 4; c++)
+				{
+					unsigned int sum = pSource[(y0 * sourceWidth + x0) * 4 + c] + pSource[(y0 * sourceWidth + x1) * 4 + c]
+						+ pSource[(y1 * sourceWidth + x0) * 4 + c] + pSource[(y1 * sourceWidth + x1) * 4 + c];
+					pLevel[(y * levelWidth + x) * 4 + c] = (unsigned char)((sum + 2) / 4);
+				}
+			}
+		}
+	}
+}
+
+size_t getMipSize(const CookedTextureInfo & info, unsigned int level)
+{
+	return (size_t)std::max(info.width >> level, 1u) * std::max(info.height >> level, 1u) * 4;
+}
+
+size_t getMipOffset(const CookedTextureInfo & info, unsigned int level)
+{
+	size_t offset = 0;
+	for (unsigned int i = 0; i < level; i++)
+	{
+		offset += getMipSize(info, i);
+	}
+	return offset;
+}
+
+static void appendData(std::vector<unsigned char>& payload, const void *pData, size_t size)
+{
+	const unsigned char *pBytes = (const unsigned char*)pData;
+	payload.insert(payload.end(), pBytes, pBytes + size);
+}
+
+static bool writeCookedFile(const std::string& filename, uint32_t magic, const std::vector<unsigned char>& payload)
+{
+	std::vector<unsigned char> compressed;
+	compressBlock(payload.data(), payload.size(), compressed);
+
+	CookedFileHeader header = { magic, COOKED_VERSION, (uint32_t)payload.size(), (uint32_t)compressed.size() };
+
+	std::ofstream file(filename, std::ios::out | std::ios::binary | std::ios::trunc);
+	if (!file.is_open())
+	{
+		printf("Could not write %s\n", filename.c_str());
+		return false;
+	}
+	file.write((const char*)&header, sizeof(header));
+	file.write((const char*)compressed.data(), compressed.size());
+	return file.good();
+}
+
+static bool readCookedFile(const std::string& filename, uint32_t magic, std::vector<unsigned char>& payload)
+{
+	std::vector<unsigned char> data;
+	if (!readAsset(filename, data))
+	{
+		printf("Could not read cooked file %s\n", filename.c_str());
+		return false;
+	}
+
+	CookedFileHeader header;
+	if (data.size() < sizeof(header))
+	{
+		printf("Cooked file %s is truncated\n", filename.c_str());
+		return false;
+	}
+	memcpy(&header, data.data(), sizeof(header));
+	if (header.magic != magic || header.version != COOKED_VERSION || header.compressedSize != data.size() - sizeof(header))
+	{
+		printf("Cooked file %s is the wrong type or version, cook it again\n", filename.c_str());
+		return false;
+	}
+
+	payload.resize(header.size);
+	if (!decompressBlock(data.data() + sizeof(header), header.compressedSize, payload.data(), payload.size()))
+	{
+		printf("Cooked file %s is corrupt\n", filename.c_str());
+		return false;
+	}
+	return true;
+}
+
+//Bounds checked copy out of a payload, moves the read position on
+static bool readData(const std::vector<unsigned char>& payload, size_t& position, void *pData, size_t size)
+{
+	if (size > payload.size() - position)
+	{
+		return false;
+	}
+	if (size == 0)
+	{
+		return true;
+	}
+	memcpy(pData, payload.data() + position, size);
+	position += size;
+	return true;
+}
+
+bool writeCookedModel(const std::string & filename, const CookedModel & model)
+{
+	std::vector<unsigned char> payload;
+	uint32_t numberOfMeshes = model.meshes.size();
+	appendData(payload, &numberOfMeshes, sizeof(numberOfMeshes));
+	for (const CookedMesh& mesh : model.meshes)
+	{
+		//Counts come from the arrays so they can't disagree with what is written
+		CookedMeshInfo info = mesh.info;
+		info.numberOfVertices = mesh.vertices.size();
+		info.numberOfIndices = mesh.indices.size();
+		info.numberOfMeshlets = mesh.meshlets.size();
+		appendData(payload, &info, sizeof(info));
+		appendData(payload, mesh.vertices.data(), mesh.vertices.size() * sizeof(QuantizedVertex));
+		appendData(payload, mesh.indices.data(), mesh.indices.size() * sizeof(uint32_t));
+		appendData(payload, mesh.meshlets.data(), mesh.meshlets.size() * sizeof(Meshlet));
+	}
+
+	uint32_t numberOfNodes = model.nodes.size();
+	appendData(payload, &numberOfNodes, sizeof(numberOfNodes));
+	for (const CookedNode& node : model.nodes)
+	{
+		CookedNodeInfo info = node.info;
+		info.nameLength = node.name.size();
+		appendData(payload, &info, sizeof(info));
+		appendData(payload, node.name.data(), node.name.size());
+	}
+	uint32_t numberOfNodeMeshes = model.nodeMeshes.size();
+	appendData(payload, &numberOfNodeMeshes, sizeof(numberOfNodeMeshes));
+	appendData(payload, model.nodeMeshes.data(), model.nodeMeshes.size() * sizeof(uint32_t));
+	return writeCookedFile(filename, COOKED_MESH_MAGIC, payload);
+}
+
+bool writeCookedTexture(const std::string & filename, const CookedTexture & texture)
+{
+	std::vector<unsigned char> payload;
+	appendData(payload, &texture.info, sizeof(texture.info));
+	appendData(payload, texture.pixels.data(), texture.pixels.size());
+	return writeCookedFile(filename, COOKED_TEXTURE_MAGIC, payload);
+}
+
+bool readCookedModel(const std::string & filename, CookedModel & model)
+{
+	std::vector<CookedMesh>& meshes = model.meshes;
+	std::vector<unsigned char> payload;
+	if (!readCookedFile(filename, COOKED_MESH_MAGIC, payload))
+	{
+		return false;
+	}
+
+	size_t position = 0;
+	uint32_t numberOfMeshes;
+	if (!readData(payload, position, &numberOfMeshes, sizeof(numberOfMeshes)))
+	{
+		printf("Cooked file %s is corrupt\n", filename.c_str());
+		return false;
+	}
+
+	meshes.resize(numberOfMeshes);
+	for (CookedMesh& mesh : meshes)
+	{
+		bool valid = readData(payload, position, &mesh.info, sizeof(mesh.info)) && mesh.info.numberOfLODs <= COOKED_MAX_LODS;
+
+		//Checking sizes against what is left before resizing, so a bad count can't allocate gigabytes
+		size_t remaining = payload.size() - position;
+		valid = valid && mesh.info.numberOfVertices <= remaining / sizeof(QuantizedVertex)
+			&& mesh.info.numberOfIndices <= remaining / sizeof(uint32_t) && mesh.info.numberOfMeshlets <= remaining / sizeof(Meshlet);
+		if (valid)
+		{
+			mesh.vertices.resize(mesh.info.numberOfVertices);
+			mesh.indices.resize(mesh.info.numberOfIndices);
+			mesh.meshlets.resize(mesh.info.numberOfMeshlets);
+			valid = readData(payload, position, mesh.vertices.data(), mesh.vertices.size() * sizeof(QuantizedVertex))
+				&& readData(payload, position, mesh.indices.data(), mesh.indices.size() * sizeof(uint32_t))
+				&& readData(payload, position, mesh.meshlets.data(), mesh.meshlets.size() * sizeof(Meshlet));
+		}
+		for (uint32_t lod = 0; valid && lod < mesh.info.numberOfLODs; lod++)
+		{
+			valid = mesh.info.lodFirstIndex[lod] + (uint64_t)mesh.info.lodNumberOfIndices[lod] <= mesh.info.numberOfIndices;
+		}
+		for (size_t i = 0; valid && i < mesh.indices.size(); i++)
+		{
+			valid = mesh.indices[i] < mesh.info.numberOfVertices;
+		}
+		if (!valid)
+		{
+			printf("Cooked file %s is corrupt\n", filename.c_str());
+			meshes.clear();
+			return false;
+		}
+	}
+
+	//The node counts are checked against what is left like the mesh counts above
+	uint32_t numberOfNodes = 0;
+	bool valid = readData(payload, position, &numberOfNodes, sizeof(numberOfNodes))
+		&& numberOfNodes <= (payload.size() - position) / sizeof(CookedNodeInfo);
+	if (valid)
+	{
+		model.nodes.resize(numberOfNodes);
+	}
+
+	//Depth first means each parent is the node before or one of that node's ancestors
+	std::vector<int32_t> ancestors;
+	for (uint32_t i = 0; valid && i < numberOfNodes; i++)
+	{
+		CookedNode& node = model.nodes[i];
+		valid = readData(payload, position, &node.info, sizeof(node.info)) && node.info.nameLength <= payload.size() - position;
+		if (valid)
+		{
+			node.name.assign((const char*)payload.data() + position, node.info.nameLength);
+			position += node.info.nameLength;
+		}
+		while (valid && !ancestors.empty() && ancestors.back() != node.info.parent)
+		{
+			ancestors.pop_back();
+		}
+		valid = valid && (!ancestors.empty() || node.info.parent == -1);
+		ancestors.push_back(i);
+	}
+
+	uint32_t numberOfNodeMeshes = 0;
+	valid = valid && readData(payload, position, &numberOfNodeMeshes, sizeof(numberOfNodeMeshes))
+		&& numberOfNodeMeshes <= (payload.size() - position) / sizeof(uint32_t);
+	if (valid)
+	{
+		model.nodeMeshes.resize(numberOfNodeMeshes);
+		valid = readData(payload, position, model.nodeMeshes.data(), model.nodeMeshes.size() * sizeof(uint32_t));
+	}
+	for (size_t i = 0; valid && i < model.nodes.size(); i++)
+	{
+		valid = model.nodes[i].info.firstMesh + (uint64_t)model.nodes[i].info.numberOfMeshes <= numberOfNodeMeshes;
+	}
+	for (size_t i = 0; valid && i < model.nodeMeshes.size(); i++)
+	{
+		valid = model.nodeMeshes[i] < meshes.size();
+	}
+	if (!valid)
+	{
+		printf("Cooked file %s is corrupt\n", filename.c_str());
+		meshes.clear();
+		model.nodes.clear();
+		model.nodeMeshes.clear();
+		return false;
+	}
+	return true;
+}
+
+bool readCookedTexture(const std::string & filename, CookedTexture & texture)
+{
+	std::vector<unsigned char> payload;
+	if (!readCookedFile(filename, COOKED_TEXTURE_MAGIC, payload))
+	{
+		return false;
+	}
+
+	size_t position = 0;
+	bool valid = readData(payload, position, &texture.info, sizeof(texture.info));
+	valid = valid && texture.info.width > 0 && texture.info.width <= 32768 && texture.info.height > 0 && texture.info.height <= 32768;
+	valid = valid && texture.info.mipLevels > 0 && texture.info.mipLevels <= 16;
+	if (!valid || getMipOffset(texture.info, texture.info.mipLevels) != payload.size() - position)
+	{
+		printf("Cooked file %s is corrupt\n", filename.c_str());
+		return false;
+	}
+	texture.pixels.assign(payload.begin() + position, payload.end());
+	return true;
+}
@@ -0,0 +1,133 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include <glm/glm.hpp>
+
+#include "vertex.h"
+#include "meshlet.h"
+
+#define COOKED_MESH_MAGIC 0x48534d43 //"CMSH"
+#define COOKED_TEXTURE_MAGIC 0x58455443 //"CTEX"
+
+//Bumped whenever the cooker's output changes, the cooker rebuilds everything cooked by an older version
+#define COOKED_VERSION 2
+
+//Same as MAX_MESH_LODS, kept separate so this file doesn't need GL
+#define COOKED_MAX_LODS 4
+
+//Every cooked file is this header followed by an LZ4 compressed payload
+struct CookedFileHeader
+{
+	uint32_t magic;
+	uint32_t version;
+	uint32_t size;
+	uint32_t compressedSize;
+};
+
+//26 bytes against the 72 of a Vertex
+//Positions are 16 bit fractions of the mesh bounds, texture coordinates are half floats
+//and the three direction vectors are octahedral encoded into two 16 bit snorms each
+struct QuantizedVertex
+{
+	uint16_t position[3];
+	uint8_t colour[4];
+	uint16_t textureCoords[2];
+	int16_t normal[2];
+	int16_t tangent[2];
+	int16_t biTangent[2];
+};
+
+//Mesh payload is a uint32_t mesh count then for each mesh this, its vertices, its indices and its meshlets
+struct CookedMeshInfo
+{
+	uint32_t numberOfVertices;
+	uint32_t numberOfIndices;
+	uint32_t numberOfMeshlets;
+	uint32_t numberOfLODs;
+	uint32_t doubleSided;
+
+	//LODs are stored one after the other in the index list, LOD 0 first in meshlet order
+	uint32_t lodFirstIndex[COOKED_MAX_LODS];
+	uint32_t lodNumberOfIndices[COOKED_MAX_LODS];
+
+	float boundsMin[3];
+	float boundsMax[3];
+};
+
+struct CookedMesh
+{
+	CookedMeshInfo info;
+	std::vector<QuantizedVertex> vertices;
+	std::vector<uint32_t> indices;
+	std::vector<Meshlet> meshlets;
+};
+
+//After the meshes comes a uint32_t node count then for each node this and its name,
+//then a uint32_t count and the list of mesh indices the nodes' ranges point into
+//Nodes are depth first like Scene, so a parent always comes before its children
+struct CookedNodeInfo
+{
+	int32_t parent;
+	uint32_t firstMesh;
+	uint32_t numberOfMeshes;
+	uint32_t nameLength;
+
+	//Local transform, column major
+	float transform[16];
+};
+
+struct CookedNode
+{
+	CookedNodeInfo info;
+	std::string name;
+};
+
+struct CookedModel
+{
+	std::vector<CookedMesh> meshes;
+	std::vector<CookedNode> nodes;
+	std::vector<uint32_t> nodeMeshes;
+};
+
+//Texture payload is this followed by every mip level of RGBA8 texels, largest first
+struct CookedTextureInfo
+{
+	uint32_t width;
+	uint32_t height;
+	uint32_t mipLevels;
+};
+
+struct CookedTexture
+{
+	CookedTextureInfo info;
+	std::vector<unsigned char> pixels;
+};
+
+//Cooked files are picked out by extension, .mesh and .tex
+bool isCookedMesh(const std::string& filename);
+bool isCookedTexture(const std::string& filename);
+
+//Bounds are the mesh's bounding box, positions outside it are clamped
+void quantizeVertices(const Vertex *pVerts, unsigned int numberOfVerts, const glm::vec3& boundsMin, const glm::vec3& boundsMax, QuantizedVertex *pQuantized);
+void dequantizeVertices(const QuantizedVertex *pQuantized, unsigned int numberOfVerts, const glm::vec3& boundsMin, const glm::vec3& boundsMax, Vertex *pVerts);
+
+//Puts vertices in the order the indices first use them, so the vertex fetch walks memory forwards
+//Vertices no index uses are dropped, every index list is remapped
+void optimizeVertexFetch(std::vector<Vertex>& vertices, std::vector<std::vector<unsigned int>>& lodIndices);
+
+//Box filtered mip chain of RGBA8 pixels, down to 1x1
+void buildMipChain(const unsigned char *pPixels, unsigned int width, unsigned int height, CookedTexture& texture);
+
+//Byte offset and size of one level in CookedTexture::pixels
+size_t getMipOffset(const CookedTextureInfo& info, unsigned int level);
+size_t getMipSize(const CookedTextureInfo& info, unsigned int level);
+
+bool writeCookedModel(const std::string& filename, const CookedModel& model);
+bool writeCookedTexture(const std::string& filename, const CookedTexture& texture);
+
+//Read through readAsset, so cooked files can live in the asset archive
+bool readCookedModel(const std::string& filename, CookedModel& model);
+bool readCookedTexture(const std::string& filename, CookedTexture& texture);
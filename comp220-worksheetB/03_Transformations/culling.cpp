@@ -0,0 +1,56 @@
+#include "culling.h"
+
+void extractFrustumPlanes(const glm::mat4 & matrix, Frustum & frustum)
+{
+	//Rows of the matrix, glm stores columns
+	glm::vec4 row0 = glm::vec4(matrix[0][0], matrix[1][0], matrix[2][0], matrix[3][0]);
+	glm::vec4 row1 = glm::vec4(matrix[0][1], matrix[1][1], matrix[2][1], matrix[3][1]);
+	glm::vec4 row2 = glm::vec4(matrix[0][2], matrix[1][2], matrix[2][2], matrix[3][2]);
+	glm::vec4 row3 = glm::vec4(matrix[0][3], matrix[1][3], matrix[2][3], matrix[3][3]);
+
+	frustum.planes[0] = row3 + row0;
+	frustum.planes[1] = row3 - row0;
+	frustum.planes[2] = row3 + row1;
+	frustum.planes[3] = row3 - row1;
+	frustum.planes[4] = row3 + row2;
+	frustum.planes[5] = row3 - row2;
+
+	//Normalise so plane distances are real distances
+	for (int i = 0; i < 6; i++)
+	{
+		float length = glm::length(glm::vec3(frustum.planes[i]));
+		if (length > 0.0f)
+		{
+			frustum.planes[i] /= length;
+		}
+	}
+}
+
+bool sphereInFrustum(const Frustum & frustum, const glm::vec3 & centre, float radius)
+{
+	for (int i = 0; i < 6; i++)
+	{
+		if (glm::dot(glm::vec3(frustum.planes[i]), centre) + frustum.planes[i].w < -radius)
+		{
+			return false;
+		}
+	}
+	return true;
+}
+
+bool boxInFrustum(const Frustum & frustum, const glm::vec3 & boxMin, const glm::vec3 & boxMax)
+{
+	for (int i = 0; i < 6; i++)
+	{
+		//Test the corner furthest along the plane normal
+		const glm::vec4& plane = frustum.planes[i];
+		glm::vec3 furthest = glm::vec3(plane.x >= 0.0f ? boxMax.x : boxMin.x,
+			plane.y >= 0.0f ? boxMax.y : boxMin.y,
+			plane.z >= 0.0f ? boxMax.z : boxMin.z);
+		if (glm::dot(glm::vec3(plane), furthest) + plane.w < 0.0f)
+		{
+			return false;
+		}
+	}
+	return true;
+}
@@ -0,0 +1,16 @@
+#pragma once
+
+#include <glm/glm.hpp>
+
+//Six planes (left, right, bottom, top, near, far) as ax + by + cz + d, normals point inwards
+struct Frustum
+{
+	glm::vec4 planes[6];
+};
+
+//Gribb and Hartmann plane extraction, the planes end up in whatever space the matrix transforms from
+//so passing projection * view * model gives model space planes
+void extractFrustumPlanes(const glm::mat4& matrix, Frustum& frustum);
+
+bool sphereInFrustum(const Frustum& frustum, const glm::vec3& centre, float radius);
+bool boxInFrustum(const Frustum& frustum, const glm::vec3& boxMin, const glm::vec3& boxMax);
@@ -0,0 +1,21 @@
+#version 330 core
+
+layout(location = 0) in vec3 vertexPosition;
+
+//Per draw model matrix, instanced from the indirect batch or set as a constant attribute by its fallback
+layout(location=8) in mat4 instanceModelMatrix;
+
+//The depth pre-pass is tested with GL_EQUAL, so both passes have to produce bit identical positions
+invariant gl_Position;
+
+uniform mat4 viewMatrix;
+uniform mat4 projectionMatrix;
+
+void main(){
+
+	//Same order of multiplies as blinnPhongClusteredIndirectVert, so the depth written here matches it
+	vec4 worldPosition=instanceModelMatrix*vec4(vertexPosition,1.0f);
+	vec4 viewPosition=viewMatrix*worldPosition;
+
+	gl_Position=projectionMatrix*viewPosition;
+}
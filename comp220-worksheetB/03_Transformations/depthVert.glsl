@@ -0,0 +1,19 @@
+#version 330 core
+
+layout(location = 0) in vec3 vertexPosition;
+
+//The depth pre-pass is tested with GL_EQUAL, so both passes have to produce bit identical positions
+invariant gl_Position;
+
+uniform mat4 modelMatrix;
+uniform mat4 viewMatrix;
+uniform mat4 projectionMatrix;
+
+void main(){
+
+	//Same order of multiplies as the lit shaders, so the depth written here matches theirs
+	vec4 worldPosition=modelMatrix*vec4(vertexPosition,1.0f);
+	vec4 viewPosition=viewMatrix*worldPosition;
+
+	gl_Position=projectionMatrix*viewPosition;
+}
@@ -0,0 +1,196 @@
+#include "gpumemory.h"
+
+#include <algorithm>
+#include <vector>
+
+GPUMemoryRegistry::GPUMemoryRegistry()
+{
+	m_Budget = 0;
+	m_PeakBytes = 0;
+	m_Frame = 0;
+	m_Evictions = 0;
+	m_Restores = 0;
+}
+
+void GPUMemoryRegistry::setBudget(size_t bytes)
+{
+	std::lock_guard<std::mutex> lock(m_Mutex);
+	m_Budget = bytes;
+}
+
+void GPUMemoryRegistry::trackBuffer(GLuint buffer, size_t bytes)
+{
+	std::lock_guard<std::mutex> lock(m_Mutex);
+	m_Buffers[buffer] = bytes;
+	updatePeakLocked();
+}
+
+void GPUMemoryRegistry::untrackBuffer(GLuint buffer)
+{
+	std::lock_guard<std::mutex> lock(m_Mutex);
+	m_Buffers.erase(buffer);
+}
+
+void GPUMemoryRegistry::trackTexture(GLuint texture, size_t bytes)
+{
+	std::lock_guard<std::mutex> lock(m_Mutex);
+	m_Textures[texture] = bytes;
+	updatePeakLocked();
+}
+
+void GPUMemoryRegistry::untrackTexture(GLuint texture)
+{
+	std::lock_guard<std::mutex> lock(m_Mutex);
+	m_Textures.erase(texture);
+}
+
+void GPUMemoryRegistry::trackProgram(GLuint program, size_t bytes)
+{
+	std::lock_guard<std::mutex> lock(m_Mutex);
+	m_Programs[program] = bytes;
+	updatePeakLocked();
+}
+
+void GPUMemoryRegistry::untrackProgram(GLuint program)
+{
+	std::lock_guard<std::mutex> lock(m_Mutex);
+	m_Programs.erase(program);
+}
+
+void GPUMemoryRegistry::addEvictable(EvictableResource * pResource)
+{
+	std::lock_guard<std::mutex> lock(m_Mutex);
+	EvictableEntry entry = { m_Frame, false };
+	m_Evictable[pResource] = entry;
+}
+
+void GPUMemoryRegistry::removeEvictable(EvictableResource * pResource)
+{
+	std::lock_guard<std::mutex> lock(m_Mutex);
+	m_Evictable.erase(pResource);
+}
+
+void GPUMemoryRegistry::touch(EvictableResource * pResource)
+{
+	std::unique_lock<std::mutex> lock(m_Mutex);
+	auto iter = m_Evictable.find(pResource);
+	if (iter == m_Evictable.end())
+	{
+		return;
+	}
+	iter->second.lastUsedFrame = m_Frame;
+	if (!iter->second.evicted)
+	{
+		return;
+	}
+	iter->second.evicted = false;
+	m_Restores++;
+
+	//Restoring tracks its buffers again, which needs the lock
+	lock.unlock();
+	pResource->restore();
+}
+
+void GPUMemoryRegistry::endFrame()
+{
+	std::unique_lock<std::mutex> lock(m_Mutex);
+	if (m_Budget > 0 && getUsedBytesLocked() > m_Budget)
+	{
+		//Oldest first, anything used this frame is still needed
+		std::vector<std::pair<unsigned long long, EvictableResource*>> candidates;
+		for (auto& evictable : m_Evictable)
+		{
+			if (!evictable.second.evicted && evictable.second.lastUsedFrame < m_Frame)
+			{
+				candidates.push_back(std::make_pair(evictable.second.lastUsedFrame, evictable.first));
+			}
+		}
+		std::sort(candidates.begin(), candidates.end());
+
+		for (auto& candidate : candidates)
+		{
+			if (getUsedBytesLocked() <= m_Budget)
+			{
+				break;
+			}
+			m_Evictable[candidate.second].evicted = true;
+			m_Evictions++;
+
+			lock.unlock();
+			candidate.second->evict();
+			lock.lock();
+		}
+	}
+	m_Frame++;
+}
+
+size_t GPUMemoryRegistry::getUsedBytes() const
+{
+	std::lock_guard<std::mutex> lock(m_Mutex);
+	return getUsedBytesLocked();
+}
+
+size_t GPUMemoryRegistry::getUsedBytesLocked() const
+{
+	size_t total = 0;
+	for (auto& buffer : m_Buffers)
+	{
+		total += buffer.second;
+	}
+	for (auto& texture : m_Textures)
+	{
+		total += texture.second;
+	}
+	for (auto& program : m_Programs)
+	{
+		total += program.second;
+	}
+	return total;
+}
+
+void GPUMemoryRegistry::updatePeakLocked()
+{
+	m_PeakBytes = std::max(m_PeakBytes, getUsedBytesLocked());
+}
+
+GPUMemoryStats GPUMemoryRegistry::getStats() const
+{
+	std::lock_guard<std::mutex> lock(m_Mutex);
+	GPUMemoryStats stats = {};
+	stats.budget = m_Budget;
+	stats.peakBytes = m_PeakBytes;
+	stats.numberOfBuffers = m_Buffers.size();
+	stats.numberOfTextures = m_Textures.size();
+	stats.numberOfPrograms = m_Programs.size();
+	for (auto& buffer : m_Buffers)
+	{
+		stats.bufferBytes += buffer.second;
+	}
+	for (auto& texture : m_Textures)
+	{
+		stats.textureBytes += texture.second;
+	}
+	for (auto& program : m_Programs)
+	{
+		stats.programBytes += program.second;
+	}
+
+	stats.numberOfEvictable = m_Evictable.size();
+	for (auto& evictable : m_Evictable)
+	{
+		if (evictable.second.evicted)
+		{
+			stats.numberOfEvicted++;
+			stats.cacheBytes += evictable.first->getCacheSize();
+		}
+	}
+	stats.evictions = m_Evictions;
+	stats.restores = m_Restores;
+	return stats;
+}
+
+GPUMemoryRegistry & getGPUMemory()
+{
+	static GPUMemoryRegistry registry;
+	return registry;
+}
@@ -0,0 +1,101 @@
+#pragma once
+
+#include <cstddef>
+#include <mutex>
+#include <unordered_map>
+
+#include <GL\glew.h>
+#include <SDL_opengl.h>
+
+//Anything holding GPU memory that can give it up and bring it back when it is next used
+class EvictableResource
+{
+public:
+	virtual ~EvictableResource() {}
+
+	//Frees the GPU copy keeping a compressed one on the CPU, GL names stay valid so VAOs don't need rebuilding
+	virtual void evict() = 0;
+	virtual void restore() = 0;
+
+	//Size of the compressed CPU copy while evicted
+	virtual size_t getCacheSize() = 0;
+};
+
+struct GPUMemoryStats
+{
+	size_t budget;
+	size_t bufferBytes;
+	size_t textureBytes;
+	size_t programBytes;
+	size_t peakBytes;
+	unsigned int numberOfBuffers;
+	unsigned int numberOfTextures;
+	unsigned int numberOfPrograms;
+
+	unsigned int numberOfEvictable;
+	unsigned int numberOfEvicted;
+	size_t cacheBytes;
+	unsigned int evictions;
+	unsigned int restores;
+};
+
+//Keeps a count of bytes per GL buffer, texture and program, and evicts the least recently used resources
+//when the total goes over budget
+//Sizes are what we asked for, drivers add their own padding and mip tails on top
+//GL calls only happen on the main thread, the lock is for loaders tracking from other threads
+class GPUMemoryRegistry
+{
+public:
+	GPUMemoryRegistry();
+
+	//Zero means no budget, nothing is evicted
+	void setBudget(size_t bytes);
+
+	//Tracking a name again replaces its size, so reallocations only need the one call
+	void trackBuffer(GLuint buffer, size_t bytes);
+	void untrackBuffer(GLuint buffer);
+	void trackTexture(GLuint texture, size_t bytes);
+	void untrackTexture(GLuint texture);
+	void trackProgram(GLuint program, size_t bytes);
+	void untrackProgram(GLuint program);
+
+	//Adding again marks it resident, for resources that have uploaded fresh data of their own
+	void addEvictable(EvictableResource *pResource);
+	void removeEvictable(EvictableResource *pResource);
+
+	//Call before a resource's GPU data is used, restores it if it was evicted
+	//Anything touched in the current frame is never evicted
+	void touch(EvictableResource *pResource);
+
+	//Once a frame after drawing, starts the next frame and evicts until back under budget
+	void endFrame();
+
+	size_t getUsedBytes() const;
+
+	//Snapshot of the counts and sizes, safe to call from any thread
+	GPUMemoryStats getStats() const;
+private:
+	struct EvictableEntry
+	{
+		unsigned long long lastUsedFrame;
+		bool evicted;
+	};
+
+	size_t getUsedBytesLocked() const;
+	void updatePeakLocked();
+
+	mutable std::mutex m_Mutex;
+	size_t m_Budget;
+	size_t m_PeakBytes;
+	unsigned long long m_Frame;
+	unsigned int m_Evictions;
+	unsigned int m_Restores;
+
+	std::unordered_map<GLuint, size_t> m_Buffers;
+	std::unordered_map<GLuint, size_t> m_Textures;
+	std::unordered_map<GLuint, size_t> m_Programs;
+	std::unordered_map<EvictableResource*, EvictableEntry> m_Evictable;
+};
+
+//One registry for the whole program, meshes, textures and shaders all report to it
+GPUMemoryRegistry& getGPUMemory();
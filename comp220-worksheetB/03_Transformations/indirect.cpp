@@ -0,0 +1,341 @@
+#include "indirect.h"
+
+#include <cstdio>
+
+#include <SDL.h>
+
+#include <glm/gtc/matrix_transform.hpp>
+#include <glm/gtc/type_ptr.hpp>
+
+//First of the four attribute locations taken by the instanced model matrix
+static const GLuint modelMatrixAttribute = 8;
+
+IndirectBatch::IndirectBatch()
+{
+	m_pMeshCollection = nullptr;
+	m_VAO = 0;
+	m_VBO = 0;
+	m_EBO = 0;
+	m_MultiDrawIndirect = false;
+	m_AnyDoubleSided = false;
+	m_MaxDraws = 0;
+	m_NumberOfDraws = 0;
+	m_pCommands = nullptr;
+	m_pMatrices = nullptr;
+	m_CommandOffset = 0;
+	m_BaseInstance = 0;
+}
+
+IndirectBatch::~IndirectBatch()
+{
+}
+
+bool IndirectBatch::isMultiDrawIndirectSupported()
+{
+	//baseInstance is needed as well, it is how each draw finds its matrix
+	return GLEW_VERSION_4_3 || (GLEW_ARB_multi_draw_indirect && GLEW_ARB_draw_indirect && GLEW_ARB_base_instance);
+}
+
+bool IndirectBatch::init(MeshCollection * pMeshCollection, unsigned int maxDrawsPerFrame)
+{
+	m_pMeshCollection = pMeshCollection;
+	m_MaxDraws = maxDrawsPerFrame;
+
+	//Each mesh keeps its own index values, baseVertex moves them to where its vertices landed
+	unsigned int totalVertices = 0;
+	unsigned int totalIndices = 0;
+	m_Meshes.clear();
+	m_AnyDoubleSided = false;
+	for (unsigned int i = 0; i < pMeshCollection->getNumberOfMeshes(); i++)
+	{
+		Mesh *pMesh = pMeshCollection->getMesh(i);
+		MeshEntry entry;
+		entry.firstIndex = totalIndices;
+		entry.baseVertex = totalVertices;
+		for (unsigned int lod = 0; lod < pMesh->getNumberOfLODs(); lod++)
+		{
+			entry.lods.push_back(pMesh->getLOD(lod));
+		}
+		m_Meshes.push_back(entry);
+		m_AnyDoubleSided = m_AnyDoubleSided || pMesh->getMaterial().doubleSided;
+
+		totalVertices += pMesh->getNumberOfVertices();
+		totalIndices += pMesh->getNumberOfIndices();
+	}
+	if (totalVertices == 0 || totalIndices == 0)
+	{
+		printf("Indirect batch has nothing to draw\n");
+		return false;
+	}
+
+	glGenVertexArrays(1, &m_VAO);
+	glBindVertexArray(m_VAO);
+
+	glGenBuffers(1, &m_VBO);
+	glBindBuffer(GL_ARRAY_BUFFER, m_VBO);
+	glBufferData(GL_ARRAY_BUFFER, totalVertices * sizeof(Vertex), nullptr, GL_STATIC_DRAW);
+	glGenBuffers(1, &m_EBO);
+	glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, m_EBO);
+	glBufferData(GL_ELEMENT_ARRAY_BUFFER, totalIndices * sizeof(unsigned int), nullptr, GL_STATIC_DRAW);
+	getGPUMemory().trackBuffer(m_VBO, totalVertices * sizeof(Vertex));
+	getGPUMemory().trackBuffer(m_EBO, totalIndices * sizeof(unsigned int));
+
+	//Copied on the GPU, the meshes don't keep their data on the CPU
+	glBindBuffer(GL_COPY_WRITE_BUFFER, m_VBO);
+	for (unsigned int i = 0; i < m_Meshes.size(); i++)
+	{
+		Mesh *pMesh = pMeshCollection->getMesh(i);
+		glBindBuffer(GL_COPY_READ_BUFFER, pMesh->getVertexBuffer());
+		glCopyBufferSubData(GL_COPY_READ_BUFFER, GL_COPY_WRITE_BUFFER, 0, m_Meshes[i].baseVertex * sizeof(Vertex), pMesh->getNumberOfVertices() * sizeof(Vertex));
+	}
+	glBindBuffer(GL_COPY_WRITE_BUFFER, m_EBO);
+	for (unsigned int i = 0; i < m_Meshes.size(); i++)
+	{
+		Mesh *pMesh = pMeshCollection->getMesh(i);
+		glBindBuffer(GL_COPY_READ_BUFFER, pMesh->getIndexBuffer());
+		glCopyBufferSubData(GL_COPY_READ_BUFFER, GL_COPY_WRITE_BUFFER, 0, m_Meshes[i].firstIndex * sizeof(unsigned int), pMesh->getNumberOfIndices() * sizeof(unsigned int));
+	}
+	glBindBuffer(GL_COPY_READ_BUFFER, 0);
+	glBindBuffer(GL_COPY_WRITE_BUFFER, 0);
+
+	//Same layout as Mesh::copyBufferData
+	glEnableVertexAttribArray(0);
+	glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, sizeof(Vertex), (void*)0);
+	glEnableVertexAttribArray(1);
+	glVertexAttribPointer(1, 4, GL_FLOAT, GL_FALSE, sizeof(Vertex), (void*)(3 * sizeof(float)));
+	glEnableVertexAttribArray(2);
+	glVertexAttribPointer(2, 2, GL_FLOAT, GL_FALSE, sizeof(Vertex), (void*)(7 * sizeof(float)));
+	glEnableVertexAttribArray(3);
+	glVertexAttribPointer(3, 3, GL_FLOAT, GL_FALSE, sizeof(Vertex), (void*)(9 * sizeof(float)));
+	glEnableVertexAttribArray(4);
+	glVertexAttribPointer(4, 3, GL_FLOAT, GL_FALSE, sizeof(Vertex), (void*)(12 * sizeof(float)));
+	glEnableVertexAttribArray(5);
+	glVertexAttribPointer(5, 3, GL_FLOAT, GL_FALSE, sizeof(Vertex), (void*)(15 * sizeof(float)));
+
+	m_MultiDrawIndirect = isMultiDrawIndirectSupported();
+	if (m_MultiDrawIndirect)
+	{
+		//Commands and matrices are written straight into the mapped rings, one mat4 per instance
+		m_CommandBuffer.init(GL_DRAW_INDIRECT_BUFFER, maxDrawsPerFrame * sizeof(DrawElementsIndirectCommand));
+		m_MatrixBuffer.init(GL_ARRAY_BUFFER, maxDrawsPerFrame * sizeof(glm::mat4));
+
+		glBindVertexArray(m_VAO);
+		glBindBuffer(GL_ARRAY_BUFFER, m_MatrixBuffer.getBuffer());
+		for (GLuint column = 0; column < 4; column++)
+		{
+			glEnableVertexAttribArray(modelMatrixAttribute + column);
+			glVertexAttribPointer(modelMatrixAttribute + column, 4, GL_FLOAT, GL_FALSE, sizeof(glm::mat4), (void*)(column * sizeof(glm::vec4)));
+			glVertexAttribDivisor(modelMatrixAttribute + column, 1);
+		}
+	}
+	else
+	{
+		m_Commands.resize(maxDrawsPerFrame);
+		m_Matrices.resize(maxDrawsPerFrame);
+	}
+
+	glBindVertexArray(0);
+	glBindBuffer(GL_ARRAY_BUFFER, 0);
+	return true;
+}
+
+void IndirectBatch::destroy()
+{
+	if (m_MultiDrawIndirect)
+	{
+		m_CommandBuffer.destroy();
+		m_MatrixBuffer.destroy();
+	}
+	getGPUMemory().untrackBuffer(m_VBO);
+	getGPUMemory().untrackBuffer(m_EBO);
+	glDeleteVertexArrays(1, &m_VAO);
+	glDeleteBuffers(1, &m_VBO);
+	glDeleteBuffers(1, &m_EBO);
+	m_VAO = 0;
+	m_VBO = 0;
+	m_EBO = 0;
+	m_Meshes.clear();
+	m_Commands.clear();
+	m_Matrices.clear();
+	m_pCommands = nullptr;
+	m_pMatrices = nullptr;
+}
+
+void IndirectBatch::begin()
+{
+	m_NumberOfDraws = 0;
+	m_BaseInstance = 0;
+	if (!m_MultiDrawIndirect)
+	{
+		m_pCommands = m_Commands.data();
+		m_pMatrices = m_Matrices.data();
+		return;
+	}
+
+	//The whole frame's worth is claimed up front so addDraw only has to bump a counter
+	m_CommandBuffer.beginFrame();
+	m_MatrixBuffer.beginFrame();
+	GLintptr matrixOffset = 0;
+	m_pCommands = (DrawElementsIndirectCommand*)m_CommandBuffer.allocate(m_MaxDraws * sizeof(DrawElementsIndirectCommand), sizeof(GLuint), m_CommandOffset);
+	m_pMatrices = (glm::mat4*)m_MatrixBuffer.allocate(m_MaxDraws * sizeof(glm::mat4), sizeof(glm::mat4), matrixOffset);
+	m_BaseInstance = (GLuint)(matrixOffset / sizeof(glm::mat4));
+}
+
+bool IndirectBatch::addDraw(unsigned int mesh, unsigned int lod, const glm::mat4 & modelMatrix)
+{
+	if (mesh >= m_Meshes.size() || m_Meshes[mesh].lods.empty() || m_pCommands == nullptr || m_pMatrices == nullptr)
+	{
+		return false;
+	}
+
+	unsigned int draw = m_NumberOfDraws.fetch_add(1);
+	if (draw >= m_MaxDraws)
+	{
+		return false;
+	}
+
+	const MeshEntry& entry = m_Meshes[mesh];
+	const MeshLOD& range = entry.lods[glm::min(lod, (unsigned int)entry.lods.size() - 1)];
+
+	DrawElementsIndirectCommand command;
+	command.count = range.numberOfIndices;
+	command.instanceCount = 1;
+	command.firstIndex = entry.firstIndex + range.firstIndex;
+	command.baseVertex = entry.baseVertex;
+	command.baseInstance = m_BaseInstance + draw;
+	m_pCommands[draw] = command;
+	m_pMatrices[draw] = modelMatrix;
+	return true;
+}
+
+void IndirectBatch::submit()
+{
+	if (m_MultiDrawIndirect)
+	{
+		m_CommandBuffer.submit();
+		m_MatrixBuffer.submit();
+	}
+
+	m_pCommands = nullptr;
+	m_pMatrices = nullptr;
+}
+
+void IndirectBatch::draw()
+{
+	//addDraw only counts draws it could write, so nothing is drawn if begin's allocation failed
+	unsigned int numberOfDraws = getNumberOfDraws();
+	glBindVertexArray(m_VAO);
+	if (m_AnyDoubleSided)
+	{
+		glDisable(GL_CULL_FACE);
+	}
+
+	if (m_MultiDrawIndirect)
+	{
+		if (numberOfDraws > 0)
+		{
+			glBindBuffer(GL_DRAW_INDIRECT_BUFFER, m_CommandBuffer.getBuffer());
+			glMultiDrawElementsIndirect(GL_TRIANGLES, GL_UNSIGNED_INT, (void*)m_CommandOffset, numberOfDraws, 0);
+			glBindBuffer(GL_DRAW_INDIRECT_BUFFER, 0);
+		}
+	}
+	else
+	{
+		//The matrix attribute arrays are disabled, so each draw reads the constant value set here
+		for (unsigned int draw = 0; draw < numberOfDraws; draw++)
+		{
+			const DrawElementsIndirectCommand& command = m_Commands[draw];
+			const glm::mat4& modelMatrix = m_Matrices[draw];
+			for (GLuint column = 0; column < 4; column++)
+			{
+				glVertexAttrib4fv(modelMatrixAttribute + column, glm::value_ptr(modelMatrix[column]));
+			}
+			glDrawElementsBaseVertex(GL_TRIANGLES, command.count, GL_UNSIGNED_INT, (void*)(command.firstIndex * sizeof(unsigned int)), command.baseVertex);
+		}
+	}
+
+	if (m_AnyDoubleSided)
+	{
+		glEnable(GL_CULL_FACE);
+	}
+}
+
+unsigned int IndirectBatch::getNumberOfDraws()
+{
+	return glm::min(m_NumberOfDraws.load(), m_MaxDraws);
+}
+
+bool IndirectBatch::isUsingMultiDrawIndirect()
+{
+	return m_MultiDrawIndirect;
+}
+
+MeshCollection * IndirectBatch::getMeshCollection()
+{
+	return m_pMeshCollection;
+}
+
+void runSubmitBenchmark(MeshCollection * pMeshCollection, GLuint uniformProgramID, GLint modelMatrixLocation, GLuint indirectProgramID)
+{
+	const unsigned int drawCounts[3] = { 1000, 10000, 100000 };
+	const int repeats = 5;
+	unsigned int numberOfMeshes = pMeshCollection->getNumberOfMeshes();
+	if (numberOfMeshes == 0)
+	{
+		printf("Nothing to draw in the submit benchmark\n");
+		return;
+	}
+
+	IndirectBatch batch;
+	if (!batch.init(pMeshCollection, drawCounts[2]))
+	{
+		return;
+	}
+
+	//Tiny copies spread over a grid, what ends up on screen doesn't matter, only the CPU time
+	std::vector<glm::mat4> matrices(drawCounts[2]);
+	for (unsigned int i = 0; i < drawCounts[2]; i++)
+	{
+		glm::vec3 position = glm::vec3((float)(i % 100) - 50.0f, (float)((i / 100) % 100) - 50.0f, -(float)(i / 10000) - 10.0f);
+		matrices[i] = glm::scale(glm::translate(glm::mat4(1.0f), position), glm::vec3(0.01f));
+	}
+
+	printf("Submit benchmark (%s)\n", batch.isUsingMultiDrawIndirect() ? "glMultiDrawElementsIndirect" : "glDrawElementsBaseVertex fallback");
+	double frequency = (double)SDL_GetPerformanceFrequency();
+	for (unsigned int drawCount : drawCounts)
+	{
+		double uniformTime = 0.0;
+		double indirectTime = 0.0;
+		for (int repeat = 0; repeat < repeats; repeat++)
+		{
+			//One uniform and one draw call per instance, like Scene::render
+			glFinish();
+			Uint64 start = SDL_GetPerformanceCounter();
+			glUseProgram(uniformProgramID);
+			for (unsigned int i = 0; i < drawCount; i++)
+			{
+				glUniformMatrix4fv(modelMatrixLocation, 1, GL_FALSE, glm::value_ptr(matrices[i]));
+				pMeshCollection->getMesh(i % numberOfMeshes)->render(0);
+			}
+			uniformTime += (SDL_GetPerformanceCounter() - start) / frequency;
+			glFinish();
+
+			start = SDL_GetPerformanceCounter();
+			glUseProgram(indirectProgramID);
+			batch.begin();
+			for (unsigned int i = 0; i < drawCount; i++)
+			{
+				batch.addDraw(i % numberOfMeshes, 0, matrices[i]);
+			}
+			batch.submit();
+			batch.draw();
+			indirectTime += (SDL_GetPerformanceCounter() - start) / frequency;
+			glFinish();
+		}
+
+		printf("%6u draws: %8.3f ms with a call per draw, %8.3f ms indirect\n", drawCount,
+			uniformTime * 1000.0 / repeats, indirectTime * 1000.0 / repeats);
+	}
+
+	batch.destroy();
+}
@@ -0,0 +1,87 @@
+#pragma once
+
+#include <atomic>
+#include <vector>
+
+#include <GL\glew.h>
+#include <SDL_opengl.h>
+
+#include <glm/glm.hpp>
+
+#include "Mesh.h"
+#include "streambuffer.h"
+
+//Layout glMultiDrawElementsIndirect reads from GL_DRAW_INDIRECT_BUFFER
+struct DrawElementsIndirectCommand
+{
+	GLuint count;
+	GLuint instanceCount;
+	GLuint firstIndex;
+	GLint baseVertex;
+	GLuint baseInstance;
+};
+
+//Copies every mesh of a MeshCollection into one vertex and one index buffer, then draws any number of
+//mesh instances with a single glMultiDrawElementsIndirect
+//Model matrices are an instanced mat4 attribute at locations 8 to 11, see blinnPhongClusteredIndirectVert.glsl,
+//and each command's baseInstance points at its own matrix
+//Without multi draw indirect the commands are drawn one at a time with glDrawElementsBaseVertex instead,
+//the matrix attribute is then left disabled and set as a constant before each draw
+//Culling can't change inside one draw, so a batch holding any double sided mesh is drawn with it off
+class IndirectBatch
+{
+public:
+	IndirectBatch();
+	~IndirectBatch();
+
+	bool init(MeshCollection *pMeshCollection, unsigned int maxDrawsPerFrame);
+	void destroy();
+
+	static bool isMultiDrawIndirectSupported();
+
+	//addDraw can be called from any thread between begin and submit
+	void begin();
+	bool addDraw(unsigned int mesh, unsigned int lod, const glm::mat4& modelMatrix);
+	void submit();
+
+	//Draws what was submitted, as many times as needed until the next begin, e.g. a depth pre-pass then the lit pass
+	void draw();
+
+	unsigned int getNumberOfDraws();
+	bool isUsingMultiDrawIndirect();
+	MeshCollection *getMeshCollection();
+private:
+	struct MeshEntry
+	{
+		GLuint firstIndex;
+		GLint baseVertex;
+		std::vector<MeshLOD> lods;
+	};
+
+	MeshCollection *m_pMeshCollection;
+	std::vector<MeshEntry> m_Meshes;
+
+	GLuint m_VAO;
+	GLuint m_VBO;
+	GLuint m_EBO;
+
+	bool m_MultiDrawIndirect;
+	bool m_AnyDoubleSided;
+	StreamBuffer m_CommandBuffer;
+	StreamBuffer m_MatrixBuffer;
+
+	unsigned int m_MaxDraws;
+	std::atomic<unsigned int> m_NumberOfDraws;
+	std::vector<DrawElementsIndirectCommand> m_Commands;
+	std::vector<glm::mat4> m_Matrices;
+
+	//Where addDraw writes, the mapped rings with multi draw indirect and the vectors above without
+	DrawElementsIndirectCommand *m_pCommands;
+	glm::mat4 *m_pMatrices;
+	GLintptr m_CommandOffset;
+	GLuint m_BaseInstance;
+};
+
+//Compares drawing every instance with its own uniform and glDrawElements against one indirect batch
+//at 1k, 10k and 100k draws, timing only the CPU side of the submission
+void runSubmitBenchmark(MeshCollection *pMeshCollection, GLuint uniformProgramID, GLint modelMatrixLocation, GLuint indirectProgramID);
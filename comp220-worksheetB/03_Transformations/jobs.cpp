@@ -0,0 +1,156 @@
+#include "jobs.h"
+
+JobSystem::JobSystem()
+{
+	m_Running = false;
+}
+
+JobSystem::~JobSystem()
+{
+	shutdown();
+}
+
+void JobSystem::init(unsigned int numberOfWorkers)
+{
+	if (m_Running)
+	{
+		return;
+	}
+
+	if (numberOfWorkers == 0)
+	{
+		unsigned int hardwareThreads = std::thread::hardware_concurrency();
+		numberOfWorkers = hardwareThreads > 1 ? hardwareThreads - 1 : 1;
+	}
+
+	m_Running = true;
+	for (unsigned int i = 0; i < numberOfWorkers; i++)
+	{
+		m_Workers.push_back(std::thread(&JobSystem::workerLoop, this));
+	}
+}
+
+void JobSystem::shutdown()
+{
+	{
+		std::lock_guard<std::mutex> lock(m_Mutex);
+		if (!m_Running)
+		{
+			return;
+		}
+		m_Running = false;
+	}
+	m_JobAdded.notify_all();
+
+	for (std::thread& worker : m_Workers)
+	{
+		worker.join();
+	}
+	m_Workers.clear();
+
+	//Anything left over is run here so no counter is left waiting
+	while (runOneJob())
+	{
+	}
+}
+
+void JobSystem::addJob(const std::function<void()>& job, JobCounter * pCounter)
+{
+	if (pCounter)
+	{
+		pCounter->count++;
+	}
+
+	{
+		std::lock_guard<std::mutex> lock(m_Mutex);
+		Job newJob = { job, pCounter };
+		m_Jobs.push_back(newJob);
+	}
+	m_JobAdded.notify_one();
+}
+
+void JobSystem::waitFor(JobCounter & counter)
+{
+	//Help with the queue while waiting rather than sleeping
+	while (!counter.isDone())
+	{
+		if (!runOneJob())
+		{
+			std::this_thread::yield();
+		}
+	}
+}
+
+void JobSystem::parallelFor(unsigned int count, unsigned int batchSize, const std::function<void(unsigned int start, unsigned int end)>& job)
+{
+	if (batchSize == 0)
+	{
+		batchSize = 1;
+	}
+
+	//Not worth handing a single batch to another thread
+	if (count <= batchSize || m_Workers.empty())
+	{
+		job(0, count);
+		return;
+	}
+
+	JobCounter counter;
+	for (unsigned int start = 0; start < count; start += batchSize)
+	{
+		unsigned int end = start + batchSize < count ? start + batchSize : count;
+		addJob([&job, start, end]() { job(start, end); }, &counter);
+	}
+	waitFor(counter);
+}
+
+unsigned int JobSystem::getNumberOfWorkers()
+{
+	return m_Workers.size();
+}
+
+bool JobSystem::runOneJob()
+{
+	Job job;
+	{
+		std::lock_guard<std::mutex> lock(m_Mutex);
+		if (m_Jobs.empty())
+		{
+			return false;
+		}
+		job = m_Jobs.front();
+		m_Jobs.pop_front();
+	}
+
+	job.function();
+	if (job.pCounter)
+	{
+		job.pCounter->count--;
+	}
+	return true;
+}
+
+void JobSystem::workerLoop()
+{
+	while (true)
+	{
+		Job job;
+		{
+			std::unique_lock<std::mutex> lock(m_Mutex);
+			m_JobAdded.wait(lock, [this]() { return !m_Running || !m_Jobs.empty(); });
+			if (m_Jobs.empty())
+			{
+				//Only get here when shutting down
+				return;
+			}
+			job = m_Jobs.front();
+			m_Jobs.pop_front();
+		}
+
+		job.function();
+		if (job.pCounter)
+		{
+			job.pCounter->count--;
+		}
+	}
+}
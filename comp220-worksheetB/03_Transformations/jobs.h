@@ -0,0 +1,59 @@
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+//Counts the jobs still running in a group, wait on it with JobSystem::waitFor
+struct JobCounter
+{
+	std::atomic<int> count;
+
+	JobCounter()
+	{
+		count = 0;
+	}
+	bool isDone() const
+	{
+		return count.load() == 0;
+	}
+};
+
+//Small pool of worker threads, a thread that waits on a counter runs queued jobs instead of blocking
+class JobSystem
+{
+public:
+	JobSystem();
+	~JobSystem();
+
+	//0 uses one worker per hardware thread, minus the main thread
+	void init(unsigned int numberOfWorkers = 0);
+	void shutdown();
+
+	void addJob(const std::function<void()>& job, JobCounter *pCounter);
+	void waitFor(JobCounter& counter);
+
+	//Splits [0, count) into batches and blocks until all of them have run
+	void parallelFor(unsigned int count, unsigned int batchSize, const std::function<void(unsigned int start, unsigned int end)>& job);
+
+	unsigned int getNumberOfWorkers();
+private:
+	struct Job
+	{
+		std::function<void()> function;
+		JobCounter *pCounter;
+	};
+
+	bool runOneJob();
+	void workerLoop();
+
+	std::vector<std::thread> m_Workers;
+	std::deque<Job> m_Jobs;
+	std::mutex m_Mutex;
+	std::condition_variable m_JobAdded;
+	bool m_Running;
+};
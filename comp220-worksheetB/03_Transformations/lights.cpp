@@ -0,0 +1,278 @@
+#include "lights.h"
+
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define LIGHTS_USE_SSE
+#include <emmintrin.h>
+#endif
+
+static const unsigned int numberOfClusters = CLUSTER_COUNT_X * CLUSTER_COUNT_Y * CLUSTER_COUNT_Z;
+
+//Room for every cluster to be full, plus the light data and cluster ranges
+static const GLsizeiptr streamSegmentSize = 2 * 1024 * 1024;
+
+//Bytes per texel of the light data, cluster range and light index buffer textures
+static const GLsizeiptr texelSizes[3] = { 4 * sizeof(float), 2 * sizeof(unsigned int), sizeof(unsigned int) };
+
+void LightClusters::SphereList::clear()
+{
+	x.clear();
+	y.clear();
+	z.clear();
+	radius.clear();
+	light.clear();
+	count = 0;
+}
+
+void LightClusters::SphereList::add(float centreX, float centreY, float centreZ, float sphereRadius, unsigned int lightIndex)
+{
+	x.push_back(centreX);
+	y.push_back(centreY);
+	z.push_back(centreZ);
+	radius.push_back(sphereRadius);
+	light.push_back(lightIndex);
+	count++;
+}
+
+void LightClusters::SphereList::pad()
+{
+	//A huge negative radius fails every plane test
+	while (x.size() % 4 != 0)
+	{
+		x.push_back(0.0f);
+		y.push_back(0.0f);
+		z.push_back(0.0f);
+		radius.push_back(-1e30f);
+		light.push_back(0);
+	}
+}
+
+LightClusters::LightClusters()
+{
+	for (int i = 0; i < 3; i++)
+	{
+		m_Textures[i] = 0;
+		m_TexelOffsets[i] = 0;
+	}
+	m_Near = 0.1f;
+	m_Far = 100.0f;
+	m_TanHalfFovX = 1.0f;
+	m_TanHalfFovY = 1.0f;
+	m_Spheres.count = 0;
+}
+
+LightClusters::~LightClusters()
+{
+}
+
+void LightClusters::init()
+{
+	m_StreamBuffer.init(GL_TEXTURE_BUFFER, streamSegmentSize);
+	glGenTextures(3, m_Textures);
+
+	//The whole ring is visible through each texture, the per frame offsets pick out the current data
+	GLenum formats[3] = { GL_RGBA32F, GL_RG32UI, GL_R32UI };
+	for (int i = 0; i < 3; i++)
+	{
+		glBindTexture(GL_TEXTURE_BUFFER, m_Textures[i]);
+		glTexBuffer(GL_TEXTURE_BUFFER, formats[i], m_StreamBuffer.getBuffer());
+	}
+	glBindTexture(GL_TEXTURE_BUFFER, 0);
+}
+
+void LightClusters::destroy()
+{
+	glDeleteTextures(3, m_Textures);
+	m_StreamBuffer.destroy();
+	for (int i = 0; i < 3; i++)
+	{
+		m_Textures[i] = 0;
+	}
+}
+
+void LightClusters::build(JobSystem & jobSystem, const std::vector<Light>& lights, const glm::mat4 & view, const glm::mat4 & projectionMatrix)
+{
+	//Near and far planes and the field of view come straight out of a perspective matrix
+	m_Near = projectionMatrix[3][2] / (projectionMatrix[2][2] - 1.0f);
+	m_Far = projectionMatrix[3][2] / (projectionMatrix[2][2] + 1.0f);
+	m_TanHalfFovX = 1.0f / projectionMatrix[0][0];
+	m_TanHalfFovY = 1.0f / projectionMatrix[1][1];
+
+	//Light data stays in world space for the shader, only the bounding spheres are moved into view space
+	m_LightData.resize(lights.size() * 3);
+	m_Spheres.clear();
+	for (unsigned int i = 0; i < lights.size(); i++)
+	{
+		const Light& light = lights[i];
+		m_LightData[i * 3 + 0] = glm::vec4(light.position, light.radius);
+		m_LightData[i * 3 + 1] = glm::vec4(light.colour, light.intensity);
+		m_LightData[i * 3 + 2] = glm::vec4(light.direction, light.spotCutoff);
+
+		glm::vec4 centre = view * glm::vec4(light.position, 1.0f);
+		m_Spheres.add(centre.x, centre.y, centre.z, light.radius, i);
+	}
+	m_Spheres.pad();
+
+	m_ClusterRanges.resize(numberOfClusters * 2);
+	m_SliceIndices.resize(CLUSTER_COUNT_Z);
+	jobSystem.parallelFor(CLUSTER_COUNT_Z, 1, [this](unsigned int start, unsigned int end)
+	{
+		for (unsigned int slice = start; slice < end; slice++)
+		{
+			buildSlice(slice);
+		}
+	});
+
+	//Slice offsets were relative to their own list, move them to where the list lands in the joined one
+	m_LightIndices.clear();
+	for (unsigned int slice = 0; slice < CLUSTER_COUNT_Z; slice++)
+	{
+		unsigned int sliceOffset = m_LightIndices.size();
+		unsigned int firstCluster = slice * CLUSTER_COUNT_X * CLUSTER_COUNT_Y;
+		for (unsigned int cluster = firstCluster; cluster < firstCluster + CLUSTER_COUNT_X * CLUSTER_COUNT_Y; cluster++)
+		{
+			m_ClusterRanges[cluster * 2] += sliceOffset;
+		}
+		m_LightIndices.insert(m_LightIndices.end(), m_SliceIndices[slice].begin(), m_SliceIndices[slice].end());
+	}
+}
+
+void LightClusters::buildSlice(unsigned int slice)
+{
+	std::vector<unsigned int>& indices = m_SliceIndices[slice];
+	indices.clear();
+
+	//Lights overlapping the slice, then each column of the slice, then each cluster in the column
+	SphereList sliceSpheres, columnSpheres, clusterSpheres;
+
+	float sliceNear = m_Near * powf(m_Far / m_Near, (float)slice / CLUSTER_COUNT_Z);
+	float sliceFar = m_Near * powf(m_Far / m_Near, (float)(slice + 1) / CLUSTER_COUNT_Z);
+	cullSpheres(m_Spheres, glm::vec4(0.0f, 0.0f, -1.0f, -sliceNear), glm::vec4(0.0f, 0.0f, 1.0f, sliceFar), sliceSpheres);
+
+	for (unsigned int x = 0; x < CLUSTER_COUNT_X; x++)
+	{
+		//Side planes go through the eye, inside is towards the middle of the column
+		float left = (-1.0f + 2.0f * x / CLUSTER_COUNT_X) * m_TanHalfFovX;
+		float right = (-1.0f + 2.0f * (x + 1) / CLUSTER_COUNT_X) * m_TanHalfFovX;
+		glm::vec4 leftPlane = glm::vec4(glm::normalize(glm::vec3(1.0f, 0.0f, left)), 0.0f);
+		glm::vec4 rightPlane = glm::vec4(glm::normalize(glm::vec3(-1.0f, 0.0f, -right)), 0.0f);
+		cullSpheres(sliceSpheres, leftPlane, rightPlane, columnSpheres);
+
+		for (unsigned int y = 0; y < CLUSTER_COUNT_Y; y++)
+		{
+			float bottom = (-1.0f + 2.0f * y / CLUSTER_COUNT_Y) * m_TanHalfFovY;
+			float top = (-1.0f + 2.0f * (y + 1) / CLUSTER_COUNT_Y) * m_TanHalfFovY;
+			glm::vec4 bottomPlane = glm::vec4(glm::normalize(glm::vec3(0.0f, 1.0f, bottom)), 0.0f);
+			glm::vec4 topPlane = glm::vec4(glm::normalize(glm::vec3(0.0f, -1.0f, -top)), 0.0f);
+			cullSpheres(columnSpheres, bottomPlane, topPlane, clusterSpheres);
+
+			unsigned int cluster = (slice * CLUSTER_COUNT_Y + y) * CLUSTER_COUNT_X + x;
+			unsigned int count = glm::min(clusterSpheres.count, (unsigned int)MAX_LIGHTS_PER_CLUSTER);
+			m_ClusterRanges[cluster * 2] = indices.size();
+			m_ClusterRanges[cluster * 2 + 1] = count;
+			indices.insert(indices.end(), clusterSpheres.light.begin(), clusterSpheres.light.begin() + count);
+		}
+	}
+}
+
+void LightClusters::cullSpheres(const SphereList & in, const glm::vec4 & planeA, const glm::vec4 & planeB, SphereList & out)
+{
+	//A sphere is kept when it is at least partly on the inside of both planes
+	out.clear();
+#ifdef LIGHTS_USE_SSE
+	__m128 aX = _mm_set1_ps(planeA.x), aY = _mm_set1_ps(planeA.y), aZ = _mm_set1_ps(planeA.z), aW = _mm_set1_ps(planeA.w);
+	__m128 bX = _mm_set1_ps(planeB.x), bY = _mm_set1_ps(planeB.y), bZ = _mm_set1_ps(planeB.z), bW = _mm_set1_ps(planeB.w);
+	for (unsigned int i = 0; i < in.count; i += 4)
+	{
+		__m128 x = _mm_loadu_ps(&in.x[i]);
+		__m128 y = _mm_loadu_ps(&in.y[i]);
+		__m128 z = _mm_loadu_ps(&in.z[i]);
+		__m128 negativeRadius = _mm_sub_ps(_mm_setzero_ps(), _mm_loadu_ps(&in.radius[i]));
+
+		__m128 distanceA = _mm_add_ps(_mm_add_ps(_mm_mul_ps(aX, x), _mm_mul_ps(aY, y)), _mm_add_ps(_mm_mul_ps(aZ, z), aW));
+		__m128 distanceB = _mm_add_ps(_mm_add_ps(_mm_mul_ps(bX, x), _mm_mul_ps(bY, y)), _mm_add_ps(_mm_mul_ps(bZ, z), bW));
+		int mask = _mm_movemask_ps(_mm_and_ps(_mm_cmpgt_ps(distanceA, negativeRadius), _mm_cmpgt_ps(distanceB, negativeRadius)));
+
+		for (int lane = 0; mask != 0; lane++, mask >>= 1)
+		{
+			if (mask & 1)
+			{
+				out.add(in.x[i + lane], in.y[i + lane], in.z[i + lane], in.radius[i + lane], in.light[i + lane]);
+			}
+		}
+	}
+#else
+	for (unsigned int i = 0; i < in.count; i++)
+	{
+		glm::vec3 centre = glm::vec3(in.x[i], in.y[i], in.z[i]);
+		if (glm::dot(glm::vec3(planeA), centre) + planeA.w > -in.radius[i] && glm::dot(glm::vec3(planeB), centre) + planeB.w > -in.radius[i])
+		{
+			out.add(in.x[i], in.y[i], in.z[i], in.radius[i], in.light[i]);
+		}
+	}
+#endif
+	out.pad();
+}
+
+void LightClusters::upload()
+{
+	//Written straight into this frame's segment of the ring, no orphaning or driver copies
+	m_StreamBuffer.beginFrame();
+
+	const void *pData[3] = { m_LightData.data(), m_ClusterRanges.data(), m_LightIndices.data() };
+	GLsizeiptr sizes[3] = { (GLsizeiptr)(m_LightData.size() * sizeof(glm::vec4)), (GLsizeiptr)(m_ClusterRanges.size() * sizeof(unsigned int)),
+		(GLsizeiptr)(m_LightIndices.size() * sizeof(unsigned int)) };
+	for (int i = 0; i < 3; i++)
+	{
+		GLintptr offset = 0;
+		void *pDestination = m_StreamBuffer.allocate(sizes[i], texelSizes[0], offset);
+		if (pDestination == nullptr)
+		{
+			printf("Light cluster data doesn't fit in the stream buffer\n");
+			break;
+		}
+		memcpy(pDestination, pData[i], sizes[i]);
+		m_TexelOffsets[i] = (GLint)(offset / texelSizes[i]);
+	}
+
+	m_StreamBuffer.submit();
+}
+
+void LightClusters::bind(GLuint firstTextureUnit)
+{
+	for (int i = 0; i < 3; i++)
+	{
+		glActiveTexture(GL_TEXTURE0 + firstTextureUnit + i);
+		glBindTexture(GL_TEXTURE_BUFFER, m_Textures[i]);
+	}
+	glActiveTexture(GL_TEXTURE0);
+}
+
+void LightClusters::setUniforms(GLint tileSizeLocation, GLint depthScaleLocation, GLint depthBiasLocation, float viewportWidth, float viewportHeight)
+{
+	//slice = log(depth) * scale + bias, the inverse of the spacing used in buildSlice
+	float logRatio = logf(m_Far / m_Near);
+	glUniform2f(tileSizeLocation, viewportWidth / CLUSTER_COUNT_X, viewportHeight / CLUSTER_COUNT_Y);
+	glUniform1f(depthScaleLocation, CLUSTER_COUNT_Z / logRatio);
+	glUniform1f(depthBiasLocation, -CLUSTER_COUNT_Z * logf(m_Near) / logRatio);
+}
+
+void LightClusters::setOffsetUniforms(GLint lightDataOffsetLocation, GLint clusterLightsOffsetLocation, GLint lightIndicesOffsetLocation)
+{
+	glUniform1i(lightDataOffsetLocation, m_TexelOffsets[0]);
+	glUniform1i(clusterLightsOffsetLocation, m_TexelOffsets[1]);
+	glUniform1i(lightIndicesOffsetLocation, m_TexelOffsets[2]);
+}
+
+unsigned int LightClusters::getNumberOfLights()
+{
+	return m_LightData.size() / 3;
+}
+
+unsigned int LightClusters::getNumberOfLightIndices()
+{
+	return m_LightIndices.size();
+}
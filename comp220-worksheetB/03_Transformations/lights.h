@@ -0,0 +1,84 @@
+#pragma once
+
+#include <vector>
+
+#include <GL\glew.h>
+#include <SDL_opengl.h>
+
+#include <glm/glm.hpp>
+
+#include "jobs.h"
+#include "streambuffer.h"
+
+//View space froxel grid, has to match the constants in blinnPhongClusteredFrag.glsl
+//Depth slices are spaced exponentially between the near and far planes
+#define CLUSTER_COUNT_X 16
+#define CLUSTER_COUNT_Y 9
+#define CLUSTER_COUNT_Z 24
+#define MAX_LIGHTS_PER_CLUSTER 128
+
+//World space point or spot light, spotCutoff is the cosine of the cone's half angle and -1 for point lights
+struct Light
+{
+	glm::vec3 position;
+	float radius;
+	glm::vec3 colour;
+	float intensity;
+	glm::vec3 direction;
+	float spotCutoff;
+};
+
+//Bins lights into clusters on the CPU and uploads the lists to buffer textures for the clustered shader
+//Three buffer textures are used, starting at the texture unit given to bind:
+//light data (3 RGBA32F texels per light), cluster ranges (RG32UI offset and count) and light indices (R32UI)
+//All three view the same stream buffer, so the shader is given the texel offset of this frame's data in each
+class LightClusters
+{
+public:
+	LightClusters();
+	~LightClusters();
+
+	void init();
+	void destroy();
+
+	//Splits the depth slices over the job system, blocks until every cluster is filled
+	void build(JobSystem& jobSystem, const std::vector<Light>& lights, const glm::mat4& view, const glm::mat4& projectionMatrix);
+	void upload();
+
+	void bind(GLuint firstTextureUnit);
+	void setUniforms(GLint tileSizeLocation, GLint depthScaleLocation, GLint depthBiasLocation, float viewportWidth, float viewportHeight);
+	void setOffsetUniforms(GLint lightDataOffsetLocation, GLint clusterLightsOffsetLocation, GLint lightIndicesOffsetLocation);
+
+	unsigned int getNumberOfLights();
+	unsigned int getNumberOfLightIndices();
+private:
+	//Bounding spheres in view space as separate arrays, padded to a multiple of 4 with spheres that never pass
+	struct SphereList
+	{
+		std::vector<float> x, y, z, radius;
+		std::vector<unsigned int> light;
+		unsigned int count;
+
+		void clear();
+		void add(float centreX, float centreY, float centreZ, float sphereRadius, unsigned int lightIndex);
+		void pad();
+	};
+
+	static void cullSpheres(const SphereList& in, const glm::vec4& planeA, const glm::vec4& planeB, SphereList& out);
+	void buildSlice(unsigned int slice);
+
+	StreamBuffer m_StreamBuffer;
+	GLuint m_Textures[3];
+	GLint m_TexelOffsets[3];
+
+	std::vector<glm::vec4> m_LightData;
+	std::vector<unsigned int> m_ClusterRanges;
+	std::vector<unsigned int> m_LightIndices;
+
+	//Each slice fills its own index list, they are joined once all slices are done
+	std::vector<std::vector<unsigned int>> m_SliceIndices;
+
+	SphereList m_Spheres;
+	float m_Near, m_Far;
+	float m_TanHalfFovX, m_TanHalfFovY;
+};
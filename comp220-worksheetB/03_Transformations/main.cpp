@@ -17,12 +17,58 @@
 #include "vertex.h"
 #include "shader.h"
 #include "Texture.h"
+#include "textureatlas.h"
 #include "Model.h"
+#include "jobs.h"
+#include "animation.h"
+#include "lights.h"
+#include "shadows.h"
+#include "overdraw.h"
+#include "indirect.h"
+#include "gpumemory.h"
+#include "resources.h"
+#include "archive.h"
 
 using namespace glm;
 
 int main(int argc, char ** argsv)
 {
+	//Worker threads for animation and other per frame jobs
+	JobSystem jobSystem;
+	jobSystem.init();
+
+	//Benchmarks don't need a window
+	if (argc > 1 && std::string(argsv[1]) == "--benchmark-animation")
+	{
+		runAnimationBenchmark(jobSystem, 1000, 100);
+		return 0;
+	}
+	bool benchmarkSubmit = argc > 1 && std::string(argsv[1]) == "--benchmark-submit";
+
+	//--pack assets.pak file1 file2... builds an archive and exits, --archive assets.pak loads everything out of one
+	if (argc > 2 && std::string(argsv[1]) == "--pack")
+	{
+		std::vector<std::string> filenames(argsv + 3, argsv + argc);
+		return packArchive(argsv[2], filenames) ? 0 : 1;
+	}
+	Archive assetArchive;
+	for (int i = 1; i + 1 < argc; i++)
+	{
+		if (std::string(argsv[i]) == "--archive" && assetArchive.open(argsv[i + 1]))
+		{
+			setAssetArchive(&assetArchive);
+		}
+	}
+
+	//GPU memory budget in megabytes, least recently used meshes and textures are evicted to stay under it
+	for (int i = 1; i + 1 < argc; i++)
+	{
+		if (std::string(argsv[i]) == "--gpu-budget")
+		{
+			getGPUMemory().setBudget((size_t)SDL_atoi(argsv[i + 1]) * 1024 * 1024);
+		}
+	}
+
 	//Starting the SDL Library, using SDL_INIT_VIDEO to only run the video parts
 	if (SDL_Init(SDL_INIT_EVERYTHING) < 0)
 	{
@@ -81,11 +127,59 @@ int main(int argc, char ** argsv)
 		return 1;
 	}
 
-	MeshCollection * tankMesh = new MeshCollection();
-	loadMeshFromFile("Tank1.fbx", tankMesh);
+	//Models are shared through the resource manager, asking for the tank again costs a reference, not a load
+	//Output from the cook tool is used when it is there, cooked meshes have no skeleton so an animated tank stays uncooked
+	ResourceManager resources;
+	resources.init(&jobSystem);
+	ResourceHandle tankModel = resources.requestModel(assetExists("Tank1.mesh") ? "Tank1.mesh" : "Tank1.fbx");
+	resources.waitFor(tankModel);
+	MeshCollection * tankMesh = resources.getModel(tankModel)->pMeshes;
+	Scene * tankScene = resources.getModel(tankModel)->pScene;
+	AnimatedModel * tankAnimation = resources.getModel(tankModel)->pAnimation;
+
+	//Only animate if the file has both a skeleton and a clip
+	bool tankAnimated = tankAnimation->skeleton.getNumberOfJoints() > 0 && !tankAnimation->clips.empty();
+	bool cpuSkinning = false;
+	//Whether the vertex buffers hold a skinned pose rather than the bind pose
+	bool cpuSkinned = false;
+	Character tankCharacter;
+	if (tankAnimated)
+	{
+		initCharacter(tankCharacter, &tankAnimation->skeleton, &tankAnimation->clips[0]);
+	}
+	std::vector<glm::mat4> identityJointMatrices(MAX_SHADER_JOINTS, glm::mat4(1.0f));
 
-	//Loading the texture
-	GLuint textureID = loadTextureFromFile("Tank1DF.png");
+	//A static tank is drawn with one indirect batch, skinning still needs the per-draw path through the scene
+	unsigned int tankDraws = 0;
+	for (unsigned int node = 0; node < tankScene->getNumberOfNodes(); node++)
+	{
+		tankDraws += tankScene->getMeshRange(node).meshCount;
+	}
+	IndirectBatch tankBatch;
+	bool indirectDraws = !tankAnimated && tankDraws > 0 && tankBatch.init(tankMesh, tankDraws);
+
+	//A rough copy of the tank is used as an occluder, so anything behind it can be skipped
+	//The copy can poke out of the real tank, so the tank itself is never culled by it
+	OcclusionCuller occlusionCuller;
+	std::vector<int> tankOccluders;
+	for (const OccluderData& occluder : resources.getModel(tankModel)->occluders)
+	{
+		tankOccluders.push_back(occlusionCuller.addOccluderMesh(occluder.positions, occluder.indices));
+	}
+	const int tankOccluderOwner = 0;
+	std::vector<OccluderInstance> occluderInstances;
+
+	//Loading the texture into the atlas, anything else added later shares the same bind
+	TextureAtlas textureAtlas;
+	textureAtlas.init();
+	AtlasHandle tankTexture = textureAtlas.addTextureFromFile(assetExists("Tank1DF.tex") ? "Tank1DF.tex" : "Tank1DF.png");
+	if (tankTexture.layer < 0)
+	{
+		//Plain white so the material colours still show
+		const unsigned char white[4] = { 255, 255, 255, 255 };
+		tankTexture = textureAtlas.addTexture(white, 1, 1);
+	}
+	textureAtlas.generateMipmaps();
 
 	//Triangle scale/position
 	vec3 trianglePosition = vec3(0.0f, 0.0f, 0.0f);
@@ -129,6 +223,24 @@ int main(int argc, char ** argsv)
 	//Light Direction
 	glm::vec3 lightDirection = glm::vec3(0.0f, 0.0f, 1.0f);
 
+	//Point and spot lights scattered around the tank, every eighth one is a spot light pointing down
+	std::vector<Light> lights;
+	for (int i = 0; i < 256; i++)
+	{
+		Light light;
+		float angle = i * 0.618f * 6.2832f;
+		float distance = 2.0f + (i % 16) * 0.5f;
+		light.position = glm::vec3(cos(angle) * distance, 0.5f + (i % 5) * 0.5f, sin(angle) * distance);
+		light.radius = 1.5f + (i % 3) * 0.5f;
+		light.colour = glm::vec3((i % 3) == 0 ? 1.0f : 0.3f, (i % 3) == 1 ? 1.0f : 0.3f, (i % 3) == 2 ? 1.0f : 0.3f);
+		light.intensity = 1.0f;
+		light.direction = (i % 8 == 0) ? glm::vec3(0.0f, -1.0f, 0.0f) : glm::vec3(0.0f);
+		light.spotCutoff = (i % 8 == 0) ? cos(radians(30.0f)) : -1.0f;
+		lights.push_back(light);
+	}
+	LightClusters lightClusters;
+	lightClusters.init();
+
 	//Light Material Properties
 	glm::vec4 ambientMaterialColour = glm::vec4(0.5f, 0.0f, 0.0f, 1.0f);
 	glm::vec4 diffuseMaterialColour = glm::vec4(1.0f, 1.0f, 1.0f, 1.0f);
@@ -136,7 +248,11 @@ int main(int argc, char ** argsv)
 	float specularMaterialPower = 25.0f;
 
 	//Loading shaders, if not print error
-	GLint simpleProgramID = LoadShaders("blinnPhongVert.glsl", "blinnPhongFrag.glsl");
+	//Animated models use the skinning variant, it has the same uniforms plus the joint matrices
+	//Both go through the clustered fragment shader for the point and spot lights
+	//The indirect variant reads the model matrix from the batch's instance attribute instead of the uniform
+	const char *simpleVertexShader = tankAnimated ? "skinnedBlinnPhongVert.glsl" : (indirectDraws ? "blinnPhongClusteredIndirectVert.glsl" : "blinnPhongClusteredVert.glsl");
+	GLint simpleProgramID = LoadShaders(simpleVertexShader, "blinnPhongClusteredFrag.glsl");
 	if (simpleProgramID < 0)
 	{
 		printf("Shaders have not loaded");
@@ -147,6 +263,9 @@ int main(int argc, char ** argsv)
 	GLint viewMatrixLocation = glGetUniformLocation(simpleProgramID, "viewMatrix");
 	GLint projectionMatrixLocation = glGetUniformLocation(simpleProgramID, "projectionMatrix");
 	GLint textureLocation = glGetUniformLocation(simpleProgramID, "baseTexture");
+	GLint textureLayerLocation = glGetUniformLocation(simpleProgramID, "baseTextureLayer");
+	GLint textureTransformLocation = glGetUniformLocation(simpleProgramID, "baseTextureTransform");
+	GLint jointMatricesLocation = glGetUniformLocation(simpleProgramID, "jointMatrices");
 
 	//Getting the Light Colour location uniforms as well as the Light Direction
 	GLint ambientLightColourLocation = glGetUniformLocation(simpleProgramID, "ambientLightColour");
@@ -160,10 +279,67 @@ int main(int argc, char ** argsv)
 	GLint specularMaterialColourLocation = glGetUniformLocation(simpleProgramID, "specularMaterialColour");
 	GLint specularMaterialPowerLocation = glGetUniformLocation(simpleProgramID, "specularMaterialPower");
 
+	//Clustered lighting uniforms, the buffer textures use units 1 to 3
+	GLint cameraPositionLocation = glGetUniformLocation(simpleProgramID, "cameraPosition");
+	GLint lightDataLocation = glGetUniformLocation(simpleProgramID, "lightData");
+	GLint clusterLightsLocation = glGetUniformLocation(simpleProgramID, "clusterLights");
+	GLint lightIndicesLocation = glGetUniformLocation(simpleProgramID, "lightIndices");
+	GLint clusterTileSizeLocation = glGetUniformLocation(simpleProgramID, "clusterTileSize");
+	GLint clusterDepthScaleLocation = glGetUniformLocation(simpleProgramID, "clusterDepthScale");
+	GLint clusterDepthBiasLocation = glGetUniformLocation(simpleProgramID, "clusterDepthBias");
+	GLint lightDataOffsetLocation = glGetUniformLocation(simpleProgramID, "lightDataOffset");
+	GLint clusterLightsOffsetLocation = glGetUniformLocation(simpleProgramID, "clusterLightsOffset");
+	GLint lightIndicesOffsetLocation = glGetUniformLocation(simpleProgramID, "lightIndicesOffset");
+
+	//Cascaded shadow maps for the directional light, the depth array is on texture unit 4
+	GLint shadowMapLocation = glGetUniformLocation(simpleProgramID, "shadowMap");
+	GLint shadowMatricesLocation = glGetUniformLocation(simpleProgramID, "shadowMatrices");
+	GLint cascadeSplitsLocation = glGetUniformLocation(simpleProgramID, "cascadeSplits");
+
+	//Shadow casters only need positions, so they use a much smaller shader and vertex stream
+	GLint depthProgramID = LoadShaders("depthVert.glsl", "depthFrag.glsl");
+	if (depthProgramID < 0)
+	{
+		printf("Depth shaders have not loaded");
+	}
+	GLint depthModelMatrixLocation = glGetUniformLocation(depthProgramID, "modelMatrix");
+	GLint depthViewMatrixLocation = glGetUniformLocation(depthProgramID, "viewMatrix");
+	GLint depthProjectionMatrixLocation = glGetUniformLocation(depthProgramID, "projectionMatrix");
+
+	//The pre-pass has to draw exactly what the lit pass draws, so it goes through the batch whenever the lit pass does
+	GLint prepassProgramID = indirectDraws ? LoadShaders("depthIndirectVert.glsl", "depthFrag.glsl") : depthProgramID;
+	if (prepassProgramID < 0)
+	{
+		printf("Depth pre-pass shaders have not loaded");
+	}
+	GLint prepassViewMatrixLocation = glGetUniformLocation(prepassProgramID, "viewMatrix");
+	GLint prepassProjectionMatrixLocation = glGetUniformLocation(prepassProgramID, "projectionMatrix");
+
+	ShadowCascades shadowCascades;
+	shadowCascades.init();
+
 	//Running is always true as long as Escape is not pressed 
 	bool running = true;
 	float cameraSpeed = 0.05f;
 
+	//Depth pre-pass is switched with P, the overdraw average is printed every few seconds to compare the two
+	bool depthPrepass = false;
+	OverdrawQuery overdrawQuery;
+	overdrawQuery.init();
+	unsigned int frameCount = 0;
+
+	//The submit benchmark needs the GL context and the tank, so it runs here and skips the main loop
+	if (benchmarkSubmit)
+	{
+		//The main program may already be the indirect one, so the per-draw side gets its own uniform program
+		GLint uniformProgramID = LoadShaders("blinnPhongClusteredVert.glsl", "blinnPhongClusteredFrag.glsl");
+		GLint indirectProgramID = LoadShaders("blinnPhongClusteredIndirectVert.glsl", "blinnPhongClusteredFrag.glsl");
+		runSubmitBenchmark(tankMesh, uniformProgramID, glGetUniformLocation(uniformProgramID, "modelMatrix"), indirectProgramID);
+		DeleteShaders(indirectProgramID);
+		DeleteShaders(uniformProgramID);
+		running = false;
+	}
+
 	//SDL Event structure initiation
 	SDL_Event ev;
 	while (running)
@@ -238,6 +414,12 @@ int main(int argc, char ** argsv)
 				case SDLK_d:
 					cameraPos += glm::normalize(glm::cross(cameraFront, cameraUp)) * cameraSpeed;
 					break;
+				case SDLK_k:
+					cpuSkinning = !cpuSkinning; //Switch between GPU and CPU skinning
+					break;
+				case SDLK_p:
+					depthPrepass = !depthPrepass; //Switch the depth pre-pass on and off
+					break;
 
 				}
 			}
@@ -245,24 +427,58 @@ int main(int argc, char ** argsv)
 		//Declaring the view to take in all the camera components
 		view = glm::lookAt(cameraPos, cameraPos + cameraFront, cameraUp);
 
+		//Start rasterising the occluders on the workers, this runs while the GPU finishes the last frame
+		//and the uniforms below are set, and is waited for just before the scene is drawn
+		occluderInstances.clear();
+		for (int occluder : tankOccluders)
+		{
+			occluderInstances.push_back({ occluder, modelMatrix, tankOccluderOwner });
+		}
+		occlusionCuller.beginFrame(jobSystem, projectionMatrix * view, occluderInstances);
+
+		int viewportWidth, viewportHeight;
+		SDL_GL_GetDrawableSize(window, &viewportWidth, &viewportHeight);
+
+		//Shadow pass, each cascade only draws the casters inside its own box
+		//The animated tank doesn't cast yet, its depth stream is only skinned on the CPU path
+		shadowCascades.update(view, projectionMatrix, lightDirection, 30.0f, 0.75f);
+		glEnable(GL_DEPTH_TEST);
+		glEnable(GL_POLYGON_OFFSET_FILL);
+		glPolygonOffset(2.0f, 4.0f);
+		glUseProgram(depthProgramID);
+		for (unsigned int cascade = 0; cascade < SHADOW_CASCADES; cascade++)
+		{
+			shadowCascades.beginCascade(cascade);
+			glUniformMatrix4fv(depthViewMatrixLocation, 1, GL_FALSE, value_ptr(shadowCascades.getLightView(cascade)));
+			glUniformMatrix4fv(depthProjectionMatrixLocation, 1, GL_FALSE, value_ptr(shadowCascades.getLightProjection(cascade)));
+			if (!tankAnimated)
+			{
+				tankScene->updateWorldTransforms();
+				tankScene->renderDepth(tankMesh, depthModelMatrixLocation, modelMatrix, shadowCascades.getLightViewProjection(cascade), 0);
+			}
+		}
+		glDisable(GL_POLYGON_OFFSET_FILL);
+		shadowCascades.endCascades(viewportWidth, viewportHeight);
+
+		//Back faces are culled unless a mesh's material is double sided
 		glEnable(GL_DEPTH_TEST);
-		glDisable(GL_CULL_FACE);
+		glEnable(GL_CULL_FACE);
 		//Rendering goes here, noice
 		glClearColor(0.0, 0.0, 0.0,1.0);
 		glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
 
 		//bind textures
-		glActiveTexture(GL_TEXTURE0);
-		glBindTexture(GL_TEXTURE_2D, textureID);
+		textureAtlas.bind(tankTexture, 0);
 
 		//Setting programID
 		glUseProgram(simpleProgramID);
 
-		//Passing in uniforms below
-		glUniformMatrix4fv(modelMatrixLocation, 1, GL_FALSE, value_ptr(modelMatrix));
+		//Passing in uniforms below, the model matrix is set per node when the scene is rendered
 		glUniformMatrix4fv(viewMatrixLocation, 1, GL_FALSE, value_ptr(view));
 		glUniformMatrix4fv(projectionMatrixLocation, 1, GL_FALSE, value_ptr(projectionMatrix));
 		glUniform1i(textureLocation, 0);
+		glUniform1f(textureLayerLocation, (float)tankTexture.layer);
+		glUniform4fv(textureTransformLocation, 1, glm::value_ptr(tankTexture.uvTransform));
 
 		//Sending light material colour locations across
 		glUniform4fv(ambientMaterialColourLocation, 1, glm::value_ptr(ambientMaterialColour));
@@ -280,23 +496,158 @@ int main(int argc, char ** argsv)
 		//Sending light direction location accross with its value
 		glUniform3fv(lightDirectionLocation, 1, glm::value_ptr(lightDirection));
 
-		//Render mesh
-		tankMesh->render();
+		//Spin the lights around the tank, then bin them into clusters for this view
+		for (Light& light : lights)
+		{
+			light.position = glm::vec3(glm::rotate(0.01f, glm::vec3(0.0f, 1.0f, 0.0f)) * glm::vec4(light.position, 1.0f));
+		}
+		lightClusters.build(jobSystem, lights, view, projectionMatrix);
+		lightClusters.upload();
+		lightClusters.bind(1);
+		lightClusters.setUniforms(clusterTileSizeLocation, clusterDepthScaleLocation, clusterDepthBiasLocation, (float)viewportWidth, (float)viewportHeight);
+		lightClusters.setOffsetUniforms(lightDataOffsetLocation, clusterLightsOffsetLocation, lightIndicesOffsetLocation);
+		glUniform1i(lightDataLocation, 1);
+		glUniform1i(clusterLightsLocation, 2);
+		glUniform1i(lightIndicesLocation, 3);
+		glUniform3fv(cameraPositionLocation, 1, glm::value_ptr(cameraPos));
+
+		shadowCascades.bind(4);
+		shadowCascades.setUniforms(shadowMatricesLocation, cascadeSplitsLocation);
+		glUniform1i(shadowMapLocation, 4);
+
+		if (tankAnimated)
+		{
+			updateCharacters(jobSystem, &tankCharacter, 1, 1.0f / 60.0f);
+
+			if (cpuSkinning)
+			{
+				//Vertices are skinned here, the shader's joint matrices are left as identity
+				for (SkinnedMeshData& skin : tankAnimation->skins)
+				{
+					skinVertices(tankCharacter.skinningMatrices.data(), skin.skinVertices.data(), skin.bindVertices.data(), skin.skinnedVertices.data(), skin.bindVertices.size());
+					tankMesh->getMesh(skin.meshIndex)->updateVertexData(skin.skinnedVertices.data(), skin.skinnedVertices.size());
+				}
+				glUniformMatrix4fv(jointMatricesLocation, MAX_SHADER_JOINTS, GL_FALSE, value_ptr(identityJointMatrices[0]));
+				cpuSkinned = true;
+			}
+			else
+			{
+				//Put the bind pose back, otherwise the shader skins vertices that are already skinned.
+				//This also covers a mesh evicted while CPU skinned, which restores the skinned pose
+				if (cpuSkinned)
+				{
+					for (SkinnedMeshData& skin : tankAnimation->skins)
+					{
+						tankMesh->getMesh(skin.meshIndex)->updateVertexData(skin.bindVertices.data(), skin.bindVertices.size());
+					}
+					cpuSkinned = false;
+				}
+				unsigned int numberOfJoints = glm::min((unsigned int)tankCharacter.skinningMatrices.size(), (unsigned int)MAX_SHADER_JOINTS);
+				glUniformMatrix4fv(jointMatricesLocation, numberOfJoints, GL_FALSE, value_ptr(tankCharacter.skinningMatrices[0]));
+			}
+
+			//Skinning matrices are already in model space, so the node transforms aren't applied
+			glUniformMatrix4fv(modelMatrixLocation, 1, GL_FALSE, value_ptr(modelMatrix));
+			overdrawQuery.begin();
+			tankMesh->render();
+			overdrawQuery.end(viewportWidth, viewportHeight);
+		}
+		else
+		{
+			//Update any node transforms that changed, then render each node with its own model matrix
+			//and a LOD picked from how big it is on screen
+			int windowWidth, windowHeight;
+			SDL_GetWindowSize(window, &windowWidth, &windowHeight);
+			tankScene->updateWorldTransforms();
+			occlusionCuller.waitForFrame(jobSystem);
+
+			//Culled and LOD picked once, then the same draws are used by the pre-pass and the lit pass
+			if (indirectDraws)
+			{
+				tankBatch.begin();
+				tankScene->addDraws(tankBatch, modelMatrix, view, projectionMatrix, (float)windowHeight, &occlusionCuller, tankOccluderOwner);
+				tankBatch.submit();
+			}
+
+			if (depthPrepass)
+			{
+				//Depth goes down first with colour writes off, then only the nearest fragment of each pixel is shaded
+				glUseProgram(prepassProgramID);
+				glUniformMatrix4fv(prepassViewMatrixLocation, 1, GL_FALSE, value_ptr(view));
+				glUniformMatrix4fv(prepassProjectionMatrixLocation, 1, GL_FALSE, value_ptr(projectionMatrix));
+				glColorMask(GL_FALSE, GL_FALSE, GL_FALSE, GL_FALSE);
+				if (indirectDraws)
+				{
+					tankBatch.draw();
+				}
+				else
+				{
+					tankScene->renderDepth(tankMesh, depthModelMatrixLocation, modelMatrix, view, projectionMatrix, (float)windowHeight, &occlusionCuller, tankOccluderOwner);
+				}
+				glColorMask(GL_TRUE, GL_TRUE, GL_TRUE, GL_TRUE);
+
+				glDepthFunc(GL_EQUAL);
+				glDepthMask(GL_FALSE);
+				glUseProgram(simpleProgramID);
+			}
+
+			overdrawQuery.begin();
+			if (indirectDraws)
+			{
+				tankBatch.draw();
+			}
+			else
+			{
+				tankScene->render(tankMesh, modelMatrixLocation, modelMatrix, view, projectionMatrix, (float)windowHeight, &occlusionCuller, tankOccluderOwner);
+			}
+			overdrawQuery.end(viewportWidth, viewportHeight);
+
+			glDepthFunc(GL_LESS);
+			glDepthMask(GL_TRUE);
+		}
+
+		frameCount++;
+		if (frameCount % 300 == 0)
+		{
+			printf("Shaded samples per pixel: %.3f (depth pre-pass %s)\n", overdrawQuery.resetAverage(), depthPrepass ? "on" : "off");
+
+			GPUMemoryStats memoryStats = getGPUMemory().getStats();
+			const double megabyte = 1024.0 * 1024.0;
+			printf("GPU memory %.1fMB (peak %.1fMB, budget %.1fMB) - buffers %u %.1fMB, textures %u %.1fMB, programs %u %.1fMB\n",
+				(memoryStats.bufferBytes + memoryStats.textureBytes + memoryStats.programBytes) / megabyte, memoryStats.peakBytes / megabyte,
+				memoryStats.budget / megabyte, memoryStats.numberOfBuffers, memoryStats.bufferBytes / megabyte,
+				memoryStats.numberOfTextures, memoryStats.textureBytes / megabyte, memoryStats.numberOfPrograms, memoryStats.programBytes / megabyte);
+			printf("Evicted %u of %u resources, %.1fMB cached, %u evictions, %u restores\n",
+				memoryStats.numberOfEvicted, memoryStats.numberOfEvictable, memoryStats.cacheBytes / megabyte, memoryStats.evictions, memoryStats.restores);
+		}
+		getGPUMemory().endFrame();
+		resources.update();
 
 		//Setting window to be resizable
 		SDL_GL_SwapWindow(window);
 		SDL_SetWindowResizable(window, SDL_TRUE);
 	}
-	if (tankMesh)
-	{
-		tankMesh->destroy();
-		delete tankMesh;
-		tankMesh = nullptr;
-	}
+	resources.release(tankModel);
+	resources.destroy();
+	tankAnimation = nullptr;
+	tankScene = nullptr;
+	tankMesh = nullptr;
 
 	//Cleanup
-	glDeleteTextures(1, &textureID);
-	glDeleteProgram(simpleProgramID);
+	lightClusters.destroy();
+	overdrawQuery.destroy();
+	shadowCascades.destroy();
+	if (prepassProgramID != depthProgramID)
+	{
+		DeleteShaders(prepassProgramID);
+	}
+	DeleteShaders(depthProgramID);
+	textureAtlas.destroy();
+	DeleteShaders(simpleProgramID);
+	if (indirectDraws)
+	{
+		tankBatch.destroy();
+	}
 
 	//Deleting the context
 	SDL_GL_DeleteContext(gl_Context);
@@ -306,6 +657,11 @@ int main(int argc, char ** argsv)
 	IMG_Quit();
 	SDL_Quit();
 
+	occlusionCuller.waitForFrame(jobSystem);
+	jobSystem.shutdown();
+	setAssetArchive(nullptr);
+	assetArchive.close();
+
 	return 0;
 
 }
@@ -1,12 +1,23 @@
 #include "Mesh.h"
 
+#include "culling.h"
+#include "compression.h"
+
 Mesh::Mesh()
 {
 	m_VBO = 0;
 	m_EBO = 0;
 	m_VAO = 0;
+	m_SkinVBO = 0;
+	m_PositionVBO = 0;
+	m_PositionVAO = 0;
 	m_NumberOfVertices = 0;
 	m_NumberOfIndices = 0;
+	m_BoundsMin = glm::vec3(0.0f);
+	m_BoundsMax = glm::vec3(0.0f);
+	m_BoundsCentre = glm::vec3(0.0f);
+	m_BoundsRadius = 0.0f;
+	m_Material.doubleSided = false;
 }
 
 Mesh::~Mesh()
@@ -33,8 +44,37 @@ void Mesh::copyBufferData(Vertex * pVerts, unsigned int numberOfVerts, unsigned
 	glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, m_EBO);
 	glBufferData(GL_ELEMENT_ARRAY_BUFFER, numberOfIndices * sizeof(unsigned int), pIndices, GL_STATIC_DRAW);
 
+	getGPUMemory().trackBuffer(m_VBO, numberOfVerts * sizeof(Vertex));
+	getGPUMemory().trackBuffer(m_EBO, numberOfIndices * sizeof(unsigned int));
+	getGPUMemory().addEvictable(this);
+	m_EvictedData.clear();
+
 	m_NumberOfIndices = numberOfIndices;
 	m_NumberOfVertices = numberOfVerts;
+
+	//Single LOD covering the whole index buffer until copyLODData says otherwise
+	MeshLOD fullDetail = { 0, numberOfIndices };
+	m_LODs.assign(1, fullDetail);
+
+	//Bounding box and sphere for LOD selection and culling
+	if (numberOfVerts > 0)
+	{
+		m_BoundsMin = glm::vec3(pVerts[0].x, pVerts[0].y, pVerts[0].z);
+		m_BoundsMax = m_BoundsMin;
+		for (unsigned int i = 1; i < numberOfVerts; i++)
+		{
+			glm::vec3 position = glm::vec3(pVerts[i].x, pVerts[i].y, pVerts[i].z);
+			m_BoundsMin = glm::min(m_BoundsMin, position);
+			m_BoundsMax = glm::max(m_BoundsMax, position);
+		}
+		m_BoundsCentre = (m_BoundsMin + m_BoundsMax) * 0.5f;
+		m_BoundsRadius = 0.0f;
+		for (unsigned int i = 0; i < numberOfVerts; i++)
+		{
+			m_BoundsRadius = glm::max(m_BoundsRadius, glm::distance(m_BoundsCentre, glm::vec3(pVerts[i].x, pVerts[i].y, pVerts[i].z)));
+		}
+	}
+
 	glBindVertexArray(m_VAO);
 	// 1rst attribute buffer : vertices
 
@@ -56,26 +96,418 @@ void Mesh::copyBufferData(Vertex * pVerts, unsigned int numberOfVerts, unsigned
 
 	glEnableVertexAttribArray(5);
 	glVertexAttribPointer(5, 3, GL_FLOAT, GL_FALSE, sizeof(Vertex), (void*)(15 * sizeof(float)));
+
+	//Depth only passes read 12 bytes a vertex instead of the whole Vertex
+	if (m_PositionVAO == 0)
+	{
+		glGenVertexArrays(1, &m_PositionVAO);
+		glGenBuffers(1, &m_PositionVBO);
+	}
+	glBindVertexArray(m_PositionVAO);
+	glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, m_EBO);
+	copyPositionData(pVerts, numberOfVerts, true);
+	glEnableVertexAttribArray(0);
+	glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, sizeof(glm::vec3), (void*)0);
+
+	glBindVertexArray(m_VAO);
+	glBindBuffer(GL_ARRAY_BUFFER, m_VBO);
+}
+
+void Mesh::copyPositionData(Vertex * pVerts, unsigned int numberOfVerts, bool reallocate)
+{
+	std::vector<glm::vec3> positions(numberOfVerts);
+	for (unsigned int i = 0; i < numberOfVerts; i++)
+	{
+		positions[i] = glm::vec3(pVerts[i].x, pVerts[i].y, pVerts[i].z);
+	}
+
+	glBindBuffer(GL_ARRAY_BUFFER, m_PositionVBO);
+	if (reallocate)
+	{
+		glBufferData(GL_ARRAY_BUFFER, numberOfVerts * sizeof(glm::vec3), positions.data(), GL_STATIC_DRAW);
+		getGPUMemory().trackBuffer(m_PositionVBO, numberOfVerts * sizeof(glm::vec3));
+	}
+	else
+	{
+		glBufferSubData(GL_ARRAY_BUFFER, 0, numberOfVerts * sizeof(glm::vec3), positions.data());
+	}
+}
+
+void Mesh::copySkinData(SkinVertex * pSkinVerts, unsigned int numberOfVerts)
+{
+	glBindVertexArray(m_VAO);
+
+	if (m_SkinVBO == 0)
+	{
+		glGenBuffers(1, &m_SkinVBO);
+	}
+	glBindBuffer(GL_ARRAY_BUFFER, m_SkinVBO);
+	glBufferData(GL_ARRAY_BUFFER, numberOfVerts * sizeof(SkinVertex), pSkinVerts, GL_STATIC_DRAW);
+	getGPUMemory().trackBuffer(m_SkinVBO, numberOfVerts * sizeof(SkinVertex));
+
+	//Joint indices stay integers, weights are normalised to 0-1
+	glEnableVertexAttribArray(6);
+	glVertexAttribIPointer(6, 4, GL_UNSIGNED_BYTE, sizeof(SkinVertex), (void*)0);
+
+	glEnableVertexAttribArray(7);
+	glVertexAttribPointer(7, 4, GL_UNSIGNED_BYTE, GL_TRUE, sizeof(SkinVertex), (void*)(4 * sizeof(unsigned char)));
+
+	glBindBuffer(GL_ARRAY_BUFFER, m_VBO);
+}
+
+void Mesh::updateVertexData(Vertex * pVerts, unsigned int numberOfVerts)
+{
+	//Used by CPU skinning, the buffer keeps its size so there is no reallocation
+	getGPUMemory().touch(this);
+	glBindBuffer(GL_ARRAY_BUFFER, m_VBO);
+	glBufferSubData(GL_ARRAY_BUFFER, 0, numberOfVerts * sizeof(Vertex), pVerts);
+
+	//Keep the depth stream in step so shadows follow the skinned positions
+	if (m_PositionVBO != 0)
+	{
+		copyPositionData(pVerts, numberOfVerts, false);
+	}
+}
+
+void Mesh::copyLODData(Vertex * pVerts, unsigned int numberOfVerts, const std::vector<std::vector<unsigned int>>& lodIndices)
+{
+	std::vector<unsigned int> allIndices;
+	std::vector<MeshLOD> lods;
+	for (const std::vector<unsigned int>& indices : lodIndices)
+	{
+		MeshLOD lod = { (unsigned int)allIndices.size(), (unsigned int)indices.size() };
+		lods.push_back(lod);
+		allIndices.insert(allIndices.end(), indices.begin(), indices.end());
+	}
+
+	copyBufferData(pVerts, numberOfVerts, allIndices.data(), allIndices.size());
+	if (!lods.empty())
+	{
+		m_LODs = lods;
+	}
+}
+
+unsigned int Mesh::selectLOD(const glm::mat4 & modelMatrix, const glm::mat4 & view, const glm::mat4 & projectionMatrix, float viewportHeight)
+{
+	//Screen height in pixels that still gets full detail, each LOD after that halves the size
+	const float fullDetailPixels = 400.0f;
+
+	if (m_LODs.size() <= 1)
+	{
+		return 0;
+	}
+
+	//Sphere radius grows with the largest scale axis of the model matrix
+	float scale = glm::max(glm::length(glm::vec3(modelMatrix[0])), glm::max(glm::length(glm::vec3(modelMatrix[1])), glm::length(glm::vec3(modelMatrix[2]))));
+	float radius = m_BoundsRadius * scale;
+	glm::vec4 viewCentre = view * modelMatrix * glm::vec4(m_BoundsCentre, 1.0f);
+	float distance = -viewCentre.z;
+	if (distance <= radius)
+	{
+		return 0;
+	}
+
+	//projectionMatrix[1][1] is cot(fov / 2), so this is the projected diameter in pixels
+	float projectedSize = (2.0f * radius / distance) * projectionMatrix[1][1] * 0.5f * viewportHeight;
+
+	unsigned int lod = 0;
+	float threshold = fullDetailPixels;
+	while (lod + 1 < m_LODs.size() && projectedSize < threshold)
+	{
+		lod++;
+		threshold *= 0.5f;
+	}
+	return lod;
+}
+
+unsigned int Mesh::getNumberOfLODs()
+{
+	return m_LODs.size();
+}
+
+const MeshLOD & Mesh::getLOD(unsigned int lod)
+{
+	if (lod >= m_LODs.size())
+	{
+		lod = m_LODs.size() - 1;
+	}
+	return m_LODs[lod];
+}
+
+const glm::vec3 & Mesh::getBoundsCentre()
+{
+	return m_BoundsCentre;
+}
+
+float Mesh::getBoundsRadius()
+{
+	return m_BoundsRadius;
+}
+
+const glm::vec3 & Mesh::getBoundsMin()
+{
+	return m_BoundsMin;
+}
+
+const glm::vec3 & Mesh::getBoundsMax()
+{
+	return m_BoundsMax;
+}
+
+void Mesh::setMeshlets(const std::vector<Meshlet>& meshlets)
+{
+	m_Meshlets = meshlets;
+	updateMeshletCullData();
+}
+
+void Mesh::setMaterial(const Material & material)
+{
+	m_Material = material;
+	updateMeshletCullData();
+}
+
+const Material & Mesh::getMaterial()
+{
+	return m_Material;
+}
+
+GLuint Mesh::getVertexBuffer()
+{
+	getGPUMemory().touch(this);
+	return m_VBO;
+}
+
+GLuint Mesh::getIndexBuffer()
+{
+	getGPUMemory().touch(this);
+	return m_EBO;
+}
+
+unsigned int Mesh::getNumberOfVertices()
+{
+	return m_NumberOfVertices;
+}
+
+unsigned int Mesh::getNumberOfIndices()
+{
+	return m_NumberOfIndices;
+}
+
+bool Mesh::isInFrustum(const glm::mat4 & modelMatrix, const glm::mat4 & viewProjection)
+{
+	//Planes from the full matrix are in model space, so the bounds don't need transforming
+	Frustum frustum;
+	extractFrustumPlanes(viewProjection * modelMatrix, frustum);
+	return boxInFrustum(frustum, m_BoundsMin, m_BoundsMax);
+}
+
+void Mesh::updateMeshletCullData()
+{
+	//Back faces are visible on double sided meshes, so no meshlet can be cone culled
+	if (m_Material.doubleSided)
+	{
+		for (Meshlet& meshlet : m_Meshlets)
+		{
+			meshlet.coneCutoff = 1.0f;
+		}
+	}
+	buildMeshletCullData(m_Meshlets, m_MeshletCullData);
+}
+
+unsigned int Mesh::getNumberOfMeshlets()
+{
+	return m_Meshlets.size();
+}
+
+bool Mesh::renderCulled(const glm::mat4 & modelMatrix, const glm::mat4 & viewProjection, const glm::vec3 & cameraPosition, unsigned int lod)
+{
+	//Planes from the full matrix are in model space, so the bounds don't need transforming
+	glm::mat4 modelViewProjection = viewProjection * modelMatrix;
+	Frustum frustum;
+	extractFrustumPlanes(modelViewProjection, frustum);
+	if (!boxInFrustum(frustum, m_BoundsMin, m_BoundsMax))
+	{
+		return false;
+	}
+
+	//Lower LODs are cheap enough to draw whole
+	if (lod > 0 || m_Meshlets.empty())
+	{
+		render(lod);
+		return true;
+	}
+
+	glm::vec3 modelCameraPosition = glm::vec3(glm::inverse(modelMatrix) * glm::vec4(cameraPosition, 1.0f));
+	if (cullMeshlets(m_Meshlets, m_MeshletCullData, modelViewProjection, modelCameraPosition, m_DrawList) == 0)
+	{
+		return true;
+	}
+
+	getGPUMemory().touch(this);
+	glBindVertexArray(m_VAO);
+	glBindBuffer(GL_ARRAY_BUFFER, m_VBO);
+	glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, m_EBO);
+
+	//One call for every surviving range of meshlets
+	glMultiDrawElements(GL_TRIANGLES, m_DrawList.counts.data(), GL_UNSIGNED_INT, m_DrawList.offsets.data(), m_DrawList.counts.size());
+	return true;
 }
 
 void Mesh::render()
 {
+	render(0);
+}
+
+void Mesh::render(unsigned int lod)
+{
+	if (m_LODs.empty())
+	{
+		return;
+	}
+	if (lod >= m_LODs.size())
+	{
+		lod = m_LODs.size() - 1;
+	}
+
+	getGPUMemory().touch(this);
+
 	//Binding buffer arrays
 	glBindVertexArray(m_VAO);
 	glBindBuffer(GL_ARRAY_BUFFER, m_VBO);
 	glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, m_EBO);
 
 	//drawing elements
-	glDrawElements(GL_TRIANGLES, m_NumberOfIndices, GL_UNSIGNED_INT, (void*)0);
+	const MeshLOD& range = m_LODs[lod];
+	glDrawElements(GL_TRIANGLES, range.numberOfIndices, GL_UNSIGNED_INT, (void*)(range.firstIndex * sizeof(unsigned int)));
 
 }
 
+void Mesh::renderDepth(unsigned int lod)
+{
+	if (m_LODs.empty() || m_PositionVAO == 0)
+	{
+		return;
+	}
+	if (lod >= m_LODs.size())
+	{
+		lod = m_LODs.size() - 1;
+	}
+
+	getGPUMemory().touch(this);
+	glBindVertexArray(m_PositionVAO);
+	const MeshLOD& range = m_LODs[lod];
+	glDrawElements(GL_TRIANGLES, range.numberOfIndices, GL_UNSIGNED_INT, (void*)(range.firstIndex * sizeof(unsigned int)));
+}
+
+bool Mesh::renderDepthCulled(const glm::mat4 & modelMatrix, const glm::mat4 & viewProjection, unsigned int lod)
+{
+	//Whole mesh test only, the meshlet cone test is for the camera and doesn't apply to a light's view
+	Frustum frustum;
+	extractFrustumPlanes(viewProjection * modelMatrix, frustum);
+	if (!boxInFrustum(frustum, m_BoundsMin, m_BoundsMax))
+	{
+		return false;
+	}
+	renderDepth(lod);
+	return true;
+}
+
 void Mesh::destroy()
 {
+	getGPUMemory().removeEvictable(this);
+	getGPUMemory().untrackBuffer(m_VBO);
+	getGPUMemory().untrackBuffer(m_EBO);
+	getGPUMemory().untrackBuffer(m_SkinVBO);
+	getGPUMemory().untrackBuffer(m_PositionVBO);
+	m_EvictedData.clear();
+
 	//Destroying arrays/buffers
 	glDeleteVertexArrays(1, &m_VAO);
+	glDeleteVertexArrays(1, &m_PositionVAO);
 	glDeleteBuffers(1, &m_VBO);
 	glDeleteBuffers(1, &m_EBO);
+	glDeleteBuffers(1, &m_SkinVBO);
+	glDeleteBuffers(1, &m_PositionVBO);
+	m_VAO = 0;
+	m_VBO = 0;
+	m_EBO = 0;
+	m_SkinVBO = 0;
+	m_PositionVAO = 0;
+	m_PositionVBO = 0;
+}
+
+void Mesh::evict()
+{
+	size_t vertexBytes = m_NumberOfVertices * sizeof(Vertex);
+	size_t indexBytes = m_NumberOfIndices * sizeof(unsigned int);
+	size_t skinBytes = m_SkinVBO != 0 ? m_NumberOfVertices * sizeof(SkinVertex) : 0;
+
+	//Read back through the copy target so the element buffer bound to the VAO isn't disturbed
+	std::vector<unsigned char> data(vertexBytes + indexBytes + skinBytes);
+	glBindBuffer(GL_COPY_READ_BUFFER, m_VBO);
+	glGetBufferSubData(GL_COPY_READ_BUFFER, 0, vertexBytes, data.data());
+	glBufferData(GL_COPY_READ_BUFFER, 0, nullptr, GL_STATIC_DRAW);
+	glBindBuffer(GL_COPY_READ_BUFFER, m_EBO);
+	glGetBufferSubData(GL_COPY_READ_BUFFER, 0, indexBytes, data.data() + vertexBytes);
+	glBufferData(GL_COPY_READ_BUFFER, 0, nullptr, GL_STATIC_DRAW);
+	if (m_SkinVBO != 0)
+	{
+		glBindBuffer(GL_COPY_READ_BUFFER, m_SkinVBO);
+		glGetBufferSubData(GL_COPY_READ_BUFFER, 0, skinBytes, data.data() + vertexBytes + indexBytes);
+		glBufferData(GL_COPY_READ_BUFFER, 0, nullptr, GL_STATIC_DRAW);
+	}
+
+	//Positions are rebuilt from the vertices on restore
+	glBindBuffer(GL_COPY_READ_BUFFER, m_PositionVBO);
+	glBufferData(GL_COPY_READ_BUFFER, 0, nullptr, GL_STATIC_DRAW);
+	glBindBuffer(GL_COPY_READ_BUFFER, 0);
+
+	compressBlock(data.data(), data.size(), m_EvictedData);
+
+	getGPUMemory().trackBuffer(m_VBO, 0);
+	getGPUMemory().trackBuffer(m_EBO, 0);
+	getGPUMemory().trackBuffer(m_PositionVBO, 0);
+	if (m_SkinVBO != 0)
+	{
+		getGPUMemory().trackBuffer(m_SkinVBO, 0);
+	}
+}
+
+void Mesh::restore()
+{
+	size_t vertexBytes = m_NumberOfVertices * sizeof(Vertex);
+	size_t indexBytes = m_NumberOfIndices * sizeof(unsigned int);
+	size_t skinBytes = m_SkinVBO != 0 ? m_NumberOfVertices * sizeof(SkinVertex) : 0;
+
+	std::vector<unsigned char> data(vertexBytes + indexBytes + skinBytes);
+	if (!decompressBlock(m_EvictedData.data(), m_EvictedData.size(), data.data(), data.size()))
+	{
+		printf("Evicted mesh data is corrupt\n");
+		return;
+	}
+	m_EvictedData.clear();
+	m_EvictedData.shrink_to_fit();
+
+	glBindBuffer(GL_COPY_WRITE_BUFFER, m_VBO);
+	glBufferData(GL_COPY_WRITE_BUFFER, vertexBytes, data.data(), GL_STATIC_DRAW);
+	glBindBuffer(GL_COPY_WRITE_BUFFER, m_EBO);
+	glBufferData(GL_COPY_WRITE_BUFFER, indexBytes, data.data() + vertexBytes, GL_STATIC_DRAW);
+	getGPUMemory().trackBuffer(m_VBO, vertexBytes);
+	getGPUMemory().trackBuffer(m_EBO, indexBytes);
+	if (m_SkinVBO != 0)
+	{
+		glBindBuffer(GL_COPY_WRITE_BUFFER, m_SkinVBO);
+		glBufferData(GL_COPY_WRITE_BUFFER, skinBytes, data.data() + vertexBytes + indexBytes, GL_STATIC_DRAW);
+		getGPUMemory().trackBuffer(m_SkinVBO, skinBytes);
+	}
+	glBindBuffer(GL_COPY_WRITE_BUFFER, 0);
+
+	copyPositionData((Vertex*)data.data(), m_NumberOfVertices, true);
+}
+
+size_t Mesh::getCacheSize()
+{
+	return m_EvictedData.size();
 }
 
 MeshCollection::MeshCollection()
@@ -92,6 +524,20 @@ void MeshCollection::addMesh(Mesh * pMesh)
 	m_Meshes.push_back(pMesh);
 }
 
+Mesh * MeshCollection::getMesh(unsigned int index)
+{
+	if (index >= m_Meshes.size())
+	{
+		return nullptr;
+	}
+	return m_Meshes[index];
+}
+
+unsigned int MeshCollection::getNumberOfMeshes()
+{
+	return m_Meshes.size();
+}
+
 void MeshCollection::render()
 {
 	for (Mesh *pMesh : m_Meshes)
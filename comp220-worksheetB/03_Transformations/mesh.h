@@ -4,9 +4,31 @@
 #include <SDL_opengl.h>
 #include <vector>
 
+#include <glm/glm.hpp>
+
 #include "vertex.h"
+#include "meshlet.h"
+#include "gpumemory.h"
+
+//Maximum number of LODs generated per mesh at import, LOD 0 is the original
+#define MAX_MESH_LODS 4
 
-class Mesh
+//Range of the index buffer used by one LOD
+struct MeshLOD
+{
+	unsigned int firstIndex;
+	unsigned int numberOfIndices;
+};
+
+//Render state that can change per mesh, read from the aiMaterial at import
+struct Material
+{
+	//Double sided meshes draw with back face culling off and skip the meshlet cone test
+	bool doubleSided;
+};
+
+//Meshes register with the GPU memory registry, if evicted the next draw reads them back in
+class Mesh : public EvictableResource
 {
 public:
 	Mesh();
@@ -14,14 +36,83 @@ public:
 
 	void init();
 	void copyBufferData(Vertex *pVerts, unsigned int numberOfVerts, unsigned int *pIndices, unsigned int numberOfIndices);
+	void copySkinData(SkinVertex *pSkinVerts, unsigned int numberOfVerts);
+	void updateVertexData(Vertex *pVerts, unsigned int numberOfVerts);
+
+	//All LOD index lists go into one index buffer, one after the other
+	void copyLODData(Vertex *pVerts, unsigned int numberOfVerts, const std::vector<std::vector<unsigned int>>& lodIndices);
+
+	//Picks a LOD from how tall the bounding sphere is on screen in pixels
+	unsigned int selectLOD(const glm::mat4& modelMatrix, const glm::mat4& view, const glm::mat4& projectionMatrix, float viewportHeight);
+	unsigned int getNumberOfLODs();
+	const MeshLOD& getLOD(unsigned int lod);
+
+	const glm::vec3& getBoundsCentre();
+	float getBoundsRadius();
+	const glm::vec3& getBoundsMin();
+	const glm::vec3& getBoundsMax();
+
+	//Meshlets cover the LOD 0 indices, which have to already be in meshlet order
+	void setMeshlets(const std::vector<Meshlet>& meshlets);
+	unsigned int getNumberOfMeshlets();
+
+	void setMaterial(const Material& material);
+	const Material& getMaterial();
+
+	//Buffers are exposed so batches can copy them into shared buffers
+	GLuint getVertexBuffer();
+	GLuint getIndexBuffer();
+	unsigned int getNumberOfVertices();
+	unsigned int getNumberOfIndices();
+
+	//Whole mesh bounding box against the frustum of viewProjection * modelMatrix
+	bool isInFrustum(const glm::mat4& modelMatrix, const glm::mat4& viewProjection);
+
 	void render();
+	void render(unsigned int lod);
+
+	//Whole mesh frustum test, then at LOD 0 per meshlet frustum and cone tests drawn with glMultiDrawElements
+	//Returns false if the whole mesh was culled
+	bool renderCulled(const glm::mat4& modelMatrix, const glm::mat4& viewProjection, const glm::vec3& cameraPosition, unsigned int lod);
+
+	//Draws from the position only stream, for shadow and depth passes that don't need the rest of the Vertex
+	void renderDepth(unsigned int lod);
+	bool renderDepthCulled(const glm::mat4& modelMatrix, const glm::mat4& viewProjection, unsigned int lod);
 	void destroy();
+
+	//Every LOD shares the buffers, so the whole mesh is evicted and restored together
+	void evict();
+	void restore();
+	size_t getCacheSize();
 private:
+	void copyPositionData(Vertex *pVerts, unsigned int numberOfVerts, bool reallocate);
+	void updateMeshletCullData();
+
 	GLuint m_VBO;
 	GLuint m_EBO;
 	GLuint m_VAO;
+	GLuint m_SkinVBO;
+
+	//Copy of just the positions with its own VAO, shares the index buffer
+	GLuint m_PositionVBO;
+	GLuint m_PositionVAO;
 	unsigned int m_NumberOfVertices;
 	unsigned int m_NumberOfIndices;
+	std::vector<MeshLOD> m_LODs;
+
+	glm::vec3 m_BoundsMin;
+	glm::vec3 m_BoundsMax;
+	glm::vec3 m_BoundsCentre;
+	float m_BoundsRadius;
+
+	Material m_Material;
+
+	std::vector<Meshlet> m_Meshlets;
+	MeshletCullData m_MeshletCullData;
+	MultiDrawList m_DrawList;
+
+	//Vertex, index and skin data compressed one after the other while evicted
+	std::vector<unsigned char> m_EvictedData;
 };
 
 class MeshCollection
@@ -31,6 +122,8 @@ public:
 	~MeshCollection();
 
 	void addMesh(Mesh *pMesh);
+	Mesh *getMesh(unsigned int index);
+	unsigned int getNumberOfMeshes();
 
 	void render();
 	void destroy();
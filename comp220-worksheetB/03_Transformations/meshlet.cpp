@@ -0,0 +1,350 @@
+#include "meshlet.h"
+
+#include <cmath>
+
+#include "culling.h"
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define MESHLET_USE_SSE
+#include <emmintrin.h>
+#endif
+
+static glm::vec3 getPosition(const Vertex& vertex)
+{
+	return glm::vec3(vertex.x, vertex.y, vertex.z);
+}
+
+//Sphere and normal cone for the triangles in one meshlet
+static void computeMeshletBounds(const Vertex *pVerts, const unsigned int *pIndices, Meshlet& meshlet)
+{
+	unsigned int numberOfTriangles = meshlet.numberOfIndices / 3;
+
+	glm::vec3 boundsMin = getPosition(pVerts[pIndices[0]]);
+	glm::vec3 boundsMax = boundsMin;
+	for (unsigned int i = 1; i < meshlet.numberOfIndices; i++)
+	{
+		glm::vec3 position = getPosition(pVerts[pIndices[i]]);
+		boundsMin = glm::min(boundsMin, position);
+		boundsMax = glm::max(boundsMax, position);
+	}
+	meshlet.centre = (boundsMin + boundsMax) * 0.5f;
+	meshlet.radius = 0.0f;
+	for (unsigned int i = 0; i < meshlet.numberOfIndices; i++)
+	{
+		meshlet.radius = glm::max(meshlet.radius, glm::distance(meshlet.centre, getPosition(pVerts[pIndices[i]])));
+	}
+
+	//Cone axis is the average face normal, the cutoff comes from the normal furthest from it
+	std::vector<glm::vec3> normals;
+	glm::vec3 axis = glm::vec3(0.0f);
+	for (unsigned int t = 0; t < numberOfTriangles; t++)
+	{
+		glm::vec3 p0 = getPosition(pVerts[pIndices[t * 3 + 0]]);
+		glm::vec3 p1 = getPosition(pVerts[pIndices[t * 3 + 1]]);
+		glm::vec3 p2 = getPosition(pVerts[pIndices[t * 3 + 2]]);
+		glm::vec3 normal = glm::cross(p1 - p0, p2 - p0);
+		float length = glm::length(normal);
+		if (length > 0.0f)
+		{
+			normals.push_back(normal / length);
+			axis += normal / length;
+		}
+	}
+
+	meshlet.coneAxis = glm::vec3(0.0f, 0.0f, 1.0f);
+	meshlet.coneCutoff = 1.0f;
+	float axisLength = glm::length(axis);
+	if (axisLength <= 0.0f)
+	{
+		return;
+	}
+	axis /= axisLength;
+
+	float minimumDot = 1.0f;
+	for (const glm::vec3& normal : normals)
+	{
+		minimumDot = glm::min(minimumDot, glm::dot(axis, normal));
+	}
+
+	meshlet.coneAxis = axis;
+	//Cones wider than about 84 degrees either side can't ever be culled, leave the cutoff at 1
+	if (minimumDot > 0.1f)
+	{
+		meshlet.coneCutoff = sqrtf(1.0f - minimumDot * minimumDot);
+	}
+}
+
+void buildMeshlets(const Vertex * pVerts, unsigned int numberOfVerts, std::vector<unsigned int>& indices, std::vector<Meshlet>& meshlets)
+{
+	meshlets.clear();
+	unsigned int numberOfTriangles = indices.size() / 3;
+	if (numberOfTriangles == 0)
+	{
+		return;
+	}
+
+	//Triangles using each vertex, so meshlets grow into neighbouring triangles
+	std::vector<unsigned int> vertexTriangleStart(numberOfVerts + 1, 0);
+	for (unsigned int i = 0; i < numberOfTriangles * 3; i++)
+	{
+		vertexTriangleStart[indices[i] + 1]++;
+	}
+	for (unsigned int v = 0; v < numberOfVerts; v++)
+	{
+		vertexTriangleStart[v + 1] += vertexTriangleStart[v];
+	}
+	std::vector<unsigned int> vertexTriangles(numberOfTriangles * 3);
+	std::vector<unsigned int> fillPosition(vertexTriangleStart.begin(), vertexTriangleStart.end() - 1);
+	for (unsigned int t = 0; t < numberOfTriangles; t++)
+	{
+		for (int k = 0; k < 3; k++)
+		{
+			vertexTriangles[fillPosition[indices[t * 3 + k]]++] = t;
+		}
+	}
+
+	std::vector<unsigned char> triangleUsed(numberOfTriangles, 0);
+	//Which meshlet each vertex was last added to, saves clearing a set per meshlet
+	std::vector<unsigned int> vertexMeshlet(numberOfVerts, ~0u);
+	std::vector<unsigned int> reordered;
+	reordered.reserve(indices.size());
+
+	std::vector<unsigned int> meshletVertices;
+	unsigned int nextUnused = 0;
+	while (true)
+	{
+		while (nextUnused < numberOfTriangles && triangleUsed[nextUnused])
+		{
+			nextUnused++;
+		}
+		if (nextUnused == numberOfTriangles)
+		{
+			break;
+		}
+
+		unsigned int meshletIndex = meshlets.size();
+		Meshlet meshlet;
+		meshlet.firstIndex = reordered.size();
+		meshlet.numberOfIndices = 0;
+		meshletVertices.clear();
+
+		unsigned int triangle = nextUnused;
+		while (true)
+		{
+			//Add the triangle and any of its vertices not already in the meshlet
+			triangleUsed[triangle] = 1;
+			for (int k = 0; k < 3; k++)
+			{
+				unsigned int vertex = indices[triangle * 3 + k];
+				if (vertexMeshlet[vertex] != meshletIndex)
+				{
+					vertexMeshlet[vertex] = meshletIndex;
+					meshletVertices.push_back(vertex);
+				}
+				reordered.push_back(vertex);
+			}
+			meshlet.numberOfIndices += 3;
+
+			if (meshlet.numberOfIndices / 3 >= MAX_MESHLET_TRIANGLES)
+			{
+				break;
+			}
+
+			//Next triangle is the unused neighbour that adds the fewest new vertices
+			unsigned int bestTriangle = ~0u;
+			int bestNewVertices = 4;
+			for (unsigned int vertex : meshletVertices)
+			{
+				for (unsigned int i = vertexTriangleStart[vertex]; i < vertexTriangleStart[vertex + 1]; i++)
+				{
+					unsigned int candidate = vertexTriangles[i];
+					if (triangleUsed[candidate])
+					{
+						continue;
+					}
+					int newVertices = 0;
+					for (int k = 0; k < 3; k++)
+					{
+						if (vertexMeshlet[indices[candidate * 3 + k]] != meshletIndex)
+						{
+							newVertices++;
+						}
+					}
+					if (newVertices < bestNewVertices)
+					{
+						bestNewVertices = newVertices;
+						bestTriangle = candidate;
+					}
+				}
+				if (bestNewVertices == 0)
+				{
+					break;
+				}
+			}
+
+			//No connected triangle left, carry on with the next one in index order
+			if (bestTriangle == ~0u)
+			{
+				while (nextUnused < numberOfTriangles && triangleUsed[nextUnused])
+				{
+					nextUnused++;
+				}
+				if (nextUnused == numberOfTriangles)
+				{
+					break;
+				}
+				bestTriangle = nextUnused;
+				bestNewVertices = 0;
+				for (int k = 0; k < 3; k++)
+				{
+					if (vertexMeshlet[indices[bestTriangle * 3 + k]] != meshletIndex)
+					{
+						bestNewVertices++;
+					}
+				}
+			}
+
+			if (meshletVertices.size() + bestNewVertices > MAX_MESHLET_VERTICES)
+			{
+				break;
+			}
+			triangle = bestTriangle;
+		}
+
+		meshlet.numberOfVertices = meshletVertices.size();
+		computeMeshletBounds(pVerts, &reordered[meshlet.firstIndex], meshlet);
+		meshlets.push_back(meshlet);
+	}
+
+	indices.swap(reordered);
+}
+
+void buildMeshletCullData(const std::vector<Meshlet>& meshlets, MeshletCullData & cullData)
+{
+	unsigned int paddedSize = (meshlets.size() + 3) & ~3u;
+
+	//Padding entries have a negative radius so they always fail the frustum test
+	cullData.centreX.assign(paddedSize, 0.0f);
+	cullData.centreY.assign(paddedSize, 0.0f);
+	cullData.centreZ.assign(paddedSize, 0.0f);
+	cullData.radius.assign(paddedSize, -1.0f);
+	cullData.axisX.assign(paddedSize, 0.0f);
+	cullData.axisY.assign(paddedSize, 0.0f);
+	cullData.axisZ.assign(paddedSize, 1.0f);
+	cullData.cutoff.assign(paddedSize, 1.0f);
+
+	for (unsigned int i = 0; i < meshlets.size(); i++)
+	{
+		const Meshlet& meshlet = meshlets[i];
+		cullData.centreX[i] = meshlet.centre.x;
+		cullData.centreY[i] = meshlet.centre.y;
+		cullData.centreZ[i] = meshlet.centre.z;
+		cullData.radius[i] = meshlet.radius;
+		cullData.axisX[i] = meshlet.coneAxis.x;
+		cullData.axisY[i] = meshlet.coneAxis.y;
+		cullData.axisZ[i] = meshlet.coneAxis.z;
+		cullData.cutoff[i] = meshlet.coneCutoff;
+	}
+}
+
+//Adds the meshlet to the draw list, joining it onto the last range if they touch
+static void addToDrawList(const Meshlet& meshlet, MultiDrawList& drawList)
+{
+	const void *pOffset = (const void*)(meshlet.firstIndex * sizeof(unsigned int));
+	if (!drawList.counts.empty())
+	{
+		GLsizei& lastCount = drawList.counts.back();
+		const char *pLastEnd = (const char*)drawList.offsets.back() + lastCount * sizeof(unsigned int);
+		if (pLastEnd == (const char*)pOffset)
+		{
+			lastCount += meshlet.numberOfIndices;
+			return;
+		}
+	}
+	drawList.counts.push_back(meshlet.numberOfIndices);
+	drawList.offsets.push_back(pOffset);
+}
+
+unsigned int cullMeshlets(const std::vector<Meshlet>& meshlets, const MeshletCullData & cullData,
+	const glm::mat4 & modelViewProjection, const glm::vec3 & cameraPosition, MultiDrawList & drawList)
+{
+	drawList.counts.clear();
+	drawList.offsets.clear();
+
+	Frustum frustum;
+	extractFrustumPlanes(modelViewProjection, frustum);
+
+	unsigned int numberOfMeshlets = meshlets.size();
+	unsigned int visibleMeshlets = 0;
+
+#ifdef MESHLET_USE_SSE
+	__m128 planeX[6], planeY[6], planeZ[6], planeW[6];
+	for (int p = 0; p < 6; p++)
+	{
+		planeX[p] = _mm_set1_ps(frustum.planes[p].x);
+		planeY[p] = _mm_set1_ps(frustum.planes[p].y);
+		planeZ[p] = _mm_set1_ps(frustum.planes[p].z);
+		planeW[p] = _mm_set1_ps(frustum.planes[p].w);
+	}
+	__m128 cameraX = _mm_set1_ps(cameraPosition.x);
+	__m128 cameraY = _mm_set1_ps(cameraPosition.y);
+	__m128 cameraZ = _mm_set1_ps(cameraPosition.z);
+
+	//Four meshlets per loop, one in each lane
+	for (unsigned int i = 0; i < numberOfMeshlets; i += 4)
+	{
+		__m128 centreX = _mm_loadu_ps(&cullData.centreX[i]);
+		__m128 centreY = _mm_loadu_ps(&cullData.centreY[i]);
+		__m128 centreZ = _mm_loadu_ps(&cullData.centreZ[i]);
+		__m128 radius = _mm_loadu_ps(&cullData.radius[i]);
+		__m128 negativeRadius = _mm_sub_ps(_mm_setzero_ps(), radius);
+
+		//Inside every plane, padding has a negative radius and a zero centre so it fails here
+		__m128 visible = _mm_cmpge_ps(radius, _mm_setzero_ps());
+		for (int p = 0; p < 6; p++)
+		{
+			__m128 distance = _mm_add_ps(_mm_add_ps(_mm_mul_ps(planeX[p], centreX), _mm_mul_ps(planeY[p], centreY)),
+				_mm_add_ps(_mm_mul_ps(planeZ[p], centreZ), planeW[p]));
+			visible = _mm_and_ps(visible, _mm_cmpge_ps(distance, negativeRadius));
+		}
+
+		//Back facing if dot(centre - camera, axis) >= cutoff * |centre - camera| + radius
+		__m128 toCentreX = _mm_sub_ps(centreX, cameraX);
+		__m128 toCentreY = _mm_sub_ps(centreY, cameraY);
+		__m128 toCentreZ = _mm_sub_ps(centreZ, cameraZ);
+		__m128 distance = _mm_sqrt_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(toCentreX, toCentreX), _mm_mul_ps(toCentreY, toCentreY)), _mm_mul_ps(toCentreZ, toCentreZ)));
+		__m128 axisDot = _mm_add_ps(_mm_add_ps(_mm_mul_ps(toCentreX, _mm_loadu_ps(&cullData.axisX[i])), _mm_mul_ps(toCentreY, _mm_loadu_ps(&cullData.axisY[i]))),
+			_mm_mul_ps(toCentreZ, _mm_loadu_ps(&cullData.axisZ[i])));
+		__m128 backFacing = _mm_cmpge_ps(axisDot, _mm_add_ps(_mm_mul_ps(_mm_loadu_ps(&cullData.cutoff[i]), distance), radius));
+		visible = _mm_andnot_ps(backFacing, visible);
+
+		int mask = _mm_movemask_ps(visible);
+		for (unsigned int lane = 0; lane < 4 && mask != 0; lane++, mask >>= 1)
+		{
+			if (mask & 1)
+			{
+				addToDrawList(meshlets[i + lane], drawList);
+				visibleMeshlets++;
+			}
+		}
+	}
+#else
+	for (unsigned int i = 0; i < numberOfMeshlets; i++)
+	{
+		const Meshlet& meshlet = meshlets[i];
+		if (!sphereInFrustum(frustum, meshlet.centre, meshlet.radius))
+		{
+			continue;
+		}
+		glm::vec3 toCentre = meshlet.centre - cameraPosition;
+		if (glm::dot(toCentre, meshlet.coneAxis) >= meshlet.coneCutoff * glm::length(toCentre) + meshlet.radius)
+		{
+			continue;
+		}
+		addToDrawList(meshlet, drawList);
+		visibleMeshlets++;
+	}
+#endif
+
+	return visibleMeshlets;
+}
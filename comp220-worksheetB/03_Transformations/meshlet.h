@@ -0,0 +1,51 @@
+#pragma once
+
+#include <vector>
+
+#include <GL\glew.h>
+#include <SDL_opengl.h>
+
+#include <glm/glm.hpp>
+
+#include "vertex.h"
+
+#define MAX_MESHLET_VERTICES 64
+#define MAX_MESHLET_TRIANGLES 124
+
+//A cluster of triangles that is one contiguous range of the mesh's index buffer
+struct Meshlet
+{
+	unsigned int firstIndex;
+	unsigned int numberOfIndices;
+	unsigned int numberOfVertices;
+
+	glm::vec3 centre;
+	float radius;
+
+	//All triangles face within the cone, coneCutoff is 1 when the cone is too wide to cull with
+	glm::vec3 coneAxis;
+	float coneCutoff;
+};
+
+//Bounds copied into separate arrays, padded to a multiple of 4 for the SSE culler
+struct MeshletCullData
+{
+	std::vector<float> centreX, centreY, centreZ, radius;
+	std::vector<float> axisX, axisY, axisZ, cutoff;
+};
+
+//Ranges to draw with glMultiDrawElements, neighbouring meshlets are merged into one range
+struct MultiDrawList
+{
+	std::vector<GLsizei> counts;
+	std::vector<const void*> offsets;
+};
+
+//Reorders indices so each meshlet's triangles are next to each other
+void buildMeshlets(const Vertex *pVerts, unsigned int numberOfVerts, std::vector<unsigned int>& indices, std::vector<Meshlet>& meshlets);
+void buildMeshletCullData(const std::vector<Meshlet>& meshlets, MeshletCullData& cullData);
+
+//Frustum and back face cone tests, modelViewProjection and cameraPosition are for the mesh's model space
+//Returns the number of meshlets that survived
+unsigned int cullMeshlets(const std::vector<Meshlet>& meshlets, const MeshletCullData& cullData,
+	const glm::mat4& modelViewProjection, const glm::vec3& cameraPosition, MultiDrawList& drawList);
@@ -1,4 +1,8 @@
 #include "Model.h"
+#include "archive.h"
+#include "cooked.h"
+
+#include <glm/gtc/type_ptr.hpp>
 
 bool loadModelFromFile(const std::string& filename, GLuint VBO, GLuint EBO, unsigned int& numVerts, unsigned int& numIndices)
 {
@@ -6,6 +10,7 @@ bool loadModelFromFile(const std::string& filename, GLuint VBO, GLuint EBO, unsi
 	std::vector<unsigned int> indices;
 
 	Assimp::Importer importer;
+	useAssetArchive(importer);
 
 	const aiScene* scene = importer.ReadFile(filename, aiProcess_Triangulate | aiProcess_FlipUVs | aiProcess_GenSmoothNormals | aiProcess_GenUVCoords | aiProcess_CalcTangentSpace);
 	if (!scene)
@@ -80,11 +85,66 @@ bool loadModelFromFile(const std::string& filename, GLuint VBO, GLuint EBO, unsi
 }
 
 bool loadMeshFromFile(const std::string & filename, MeshCollection * pMeshCollection)
+{
+	return loadMeshFromFile(filename, pMeshCollection, nullptr);
+}
+
+//One Mesh per aiMesh, in the same order as scene->mMeshes so the node mesh indices line up
+static void importMeshes(const aiScene *scene, MeshCollection * pMeshCollection, Scene * pScene)
 {
 	std::vector<Vertex> vertices;
 	std::vector<unsigned int> indices;
+	std::vector<std::vector<unsigned int>> lodIndices;
+	std::vector<Meshlet> meshlets;
+
+	for (int i = 0; i < scene->mNumMeshes; i++)
+	{
+		Mesh *pMesh = new Mesh();
+		pMesh->init();
+
+		copyMeshData(scene->mMeshes[i], vertices, indices);
+
+		//Simplified versions are generated here and stored after the full detail indices
+		generateLODs(vertices.data(), vertices.size(), indices, MAX_MESH_LODS, lodIndices);
+
+		//Full detail is split into meshlets for finer culling, which reorders its triangles
+		buildMeshlets(vertices.data(), vertices.size(), lodIndices[0], meshlets);
+		pMesh->copyLODData(vertices.data(), vertices.size(), lodIndices);
+		pMesh->setMeshlets(meshlets);
+
+		//Meshes are back face culled unless their material says they are two sided
+		Material material = { false };
+		if (scene->mMeshes[i]->mMaterialIndex < scene->mNumMaterials)
+		{
+			int twoSided = 0;
+			if (scene->mMaterials[scene->mMeshes[i]->mMaterialIndex]->Get(AI_MATKEY_TWOSIDED, twoSided) == AI_SUCCESS)
+			{
+				material.doubleSided = twoSided != 0;
+			}
+		}
+		pMesh->setMaterial(material);
+
+		pMeshCollection->addMesh(pMesh);
+		vertices.clear();
+		indices.clear();
+	}
+
+	//Keep the node hierarchy so each part can have its own transform
+	if (pScene)
+	{
+		pScene->importNodes(scene);
+	}
+}
+
+bool loadMeshFromFile(const std::string & filename, MeshCollection * pMeshCollection, Scene * pScene)
+{
+	if (isCookedMesh(filename))
+	{
+		return loadCookedMeshFromFile(filename, pMeshCollection, pScene);
+	}
 
 	Assimp::Importer importer;
+	useAssetArchive(importer);
 
 	const aiScene* scene = importer.ReadFile(filename, aiProcess_Triangulate | aiProcess_FlipUVs | aiProcess_GenSmoothNormals | aiProcess_GenUVCoords | aiProcess_CalcTangentSpace);
 
@@ -94,71 +154,380 @@ bool loadMeshFromFile(const std::string & filename, MeshCollection * pMeshCollec
 		return false;
 	}
 
-	for (int i = 0; i < scene->mNumMeshes; i++)
+	importMeshes(scene, pMeshCollection, pScene);
+
+	return true;
+}
+
+bool loadCookedMeshFromFile(const std::string & filename, MeshCollection * pMeshCollection, Scene * pScene)
+{
+	CookedModel model;
+	if (!readCookedModel(filename, model))
 	{
-		aiMesh *currentMesh = scene->mMeshes[i];
+		return false;
+	}
+
+	loadCookedModel(model, pMeshCollection, pScene);
+	return true;
+}
+
+void loadCookedModel(const CookedModel & model, MeshCollection * pMeshCollection, Scene * pScene)
+{
+	static_assert(COOKED_MAX_LODS == MAX_MESH_LODS, "Cooked meshes have to hold every LOD the importer generates");
+
+	std::vector<Vertex> vertices;
+	std::vector<std::vector<unsigned int>> lodIndices;
+	for (const CookedMesh& cookedMesh : model.meshes)
+	{
+		const CookedMeshInfo& info = cookedMesh.info;
 		Mesh *pMesh = new Mesh();
 		pMesh->init();
 
-		for (int i = 0; i < scene->mNumMeshes; i++)
+		//The shaders still read full float vertices, quantizing only shrinks the file
+		vertices.resize(info.numberOfVertices);
+		dequantizeVertices(cookedMesh.vertices.data(), info.numberOfVertices, glm::vec3(info.boundsMin[0], info.boundsMin[1], info.boundsMin[2]),
+			glm::vec3(info.boundsMax[0], info.boundsMax[1], info.boundsMax[2]), vertices.data());
+
+		lodIndices.resize(info.numberOfLODs);
+		for (unsigned int lod = 0; lod < info.numberOfLODs; lod++)
+		{
+			const uint32_t *pFirst = cookedMesh.indices.data() + info.lodFirstIndex[lod];
+			lodIndices[lod].assign(pFirst, pFirst + info.lodNumberOfIndices[lod]);
+		}
+
+		pMesh->copyLODData(vertices.data(), vertices.size(), lodIndices);
+		pMesh->setMeshlets(cookedMesh.meshlets);
+
+		Material material = { info.doubleSided != 0 };
+		pMesh->setMaterial(material);
+
+		pMeshCollection->addMesh(pMesh);
+	}
+
+	if (pScene == nullptr)
+	{
+		return;
+	}
+	pScene->clear();
+	for (const CookedNode& node : model.nodes)
+	{
+		const uint32_t *pMeshes = model.nodeMeshes.data() + node.info.firstMesh;
+		pScene->addNode(node.name, node.info.parent, glm::make_mat4(node.info.transform), pMeshes, node.info.numberOfMeshes);
+	}
+
+	//Anything cooked without a hierarchy still needs a node to draw its meshes
+	if (model.nodes.empty())
+	{
+		std::vector<unsigned int> meshes;
+		for (unsigned int i = 0; i < model.meshes.size(); i++)
+		{
+			meshes.push_back(i);
+		}
+		pScene->addNode("root", -1, glm::mat4(1.0f), meshes.data(), meshes.size());
+	}
+	pScene->updateWorldTransforms();
+}
+
+static void buildNodeOccluders(const aiScene *scene, const aiNode *node, const glm::mat4& parentTransform, std::vector<OccluderData>& occluders)
+{
+	glm::mat4 transform = parentTransform * convertMatrix(node->mTransformation);
+
+	std::vector<Vertex> vertices;
+	std::vector<unsigned int> indices;
+	for (unsigned int i = 0; i < node->mNumMeshes; i++)
+	{
+		copyMeshData(scene->mMeshes[node->mMeshes[i]], vertices, indices);
+
+		//Occluders only need the rough shape, an eighth of the triangles is plenty at this resolution
+		OccluderData occluder;
+		unsigned int target = glm::max((unsigned int)indices.size() / 8, 96u);
+		simplifyMesh(vertices.data(), vertices.size(), indices.data(), indices.size(), target, occluder.indices);
+
+		for (const Vertex& vertex : vertices)
 		{
-			aiMesh *currentMesh = scene->mMeshes[i];
+			occluder.positions.push_back(glm::vec3(transform * glm::vec4(vertex.x, vertex.y, vertex.z, 1.0f)));
+		}
+		occluders.push_back(occluder);
 
-			for (int v = 0; v < currentMesh->mNumVertices; v++)
+		vertices.clear();
+		indices.clear();
+	}
+
+	for (unsigned int i = 0; i < node->mNumChildren; i++)
+	{
+		buildNodeOccluders(scene, node->mChildren[i], transform, occluders);
+	}
+}
+
+void buildOccluders(const aiScene * scene, std::vector<OccluderData>& occluders)
+{
+	if (scene == nullptr || scene->mRootNode == nullptr)
+	{
+		return;
+	}
+	buildNodeOccluders(scene, scene->mRootNode, glm::mat4(1.0f), occluders);
+}
+
+void buildOccluders(const CookedModel & model, std::vector<OccluderData>& occluders)
+{
+	//Parents come first, so their world transform is always ready
+	std::vector<glm::mat4> worldTransforms(model.nodes.size());
+	std::vector<Vertex> vertices;
+	for (unsigned int node = 0; node < model.nodes.size(); node++)
+	{
+		const CookedNodeInfo& info = model.nodes[node].info;
+		glm::mat4 localTransform = glm::make_mat4(info.transform);
+		worldTransforms[node] = info.parent < 0 ? localTransform : worldTransforms[info.parent] * localTransform;
+
+		for (unsigned int i = info.firstMesh; i < info.firstMesh + info.numberOfMeshes; i++)
+		{
+			const CookedMesh& cookedMesh = model.meshes[model.nodeMeshes[i]];
+			const CookedMeshInfo& meshInfo = cookedMesh.info;
+			if (meshInfo.numberOfLODs == 0)
 			{
-				aiVector3D currentModelVertex = currentMesh->mVertices[v];
-				aiColor4D currentModelColour = aiColor4D(1.0, 1.0, 1.0, 1.0);
-				aiVector3D currentTextureCoordinates = aiVector3D(0.0f, 0.0f, 0.0f);
-				aiVector3D currentModelNormals = aiVector3D(0.0f, 0.0f, 0.0f);
-				aiVector3D currentModelTangents = aiVector3D(0.0f, 0.0f, 0.0f);
-				aiVector3D currentModelBitangents = aiVector3D(0.0f, 0.0f, 0.0f);
-
-				if (currentMesh->HasVertexColors(0))
-				{
-					currentModelColour = currentMesh->mColors[0][v];
-				}
-				if (currentMesh->HasTextureCoords(0))
-				{
-					currentTextureCoordinates = currentMesh->mTextureCoords[0][v];
-				}
-				if (currentMesh->HasNormals())
-				{
-					currentModelNormals = currentMesh->mNormals[v];
-				}
-				if (currentMesh->HasTangentsAndBitangents())
-				{
-					currentModelTangents = currentMesh->mTangents[v];
-					currentModelBitangents = currentMesh->mBitangents[v];
-				}
-				if (currentMesh->HasNormals())
+				continue;
+			}
+
+			vertices.resize(meshInfo.numberOfVertices);
+			dequantizeVertices(cookedMesh.vertices.data(), meshInfo.numberOfVertices, glm::vec3(meshInfo.boundsMin[0], meshInfo.boundsMin[1], meshInfo.boundsMin[2]),
+				glm::vec3(meshInfo.boundsMax[0], meshInfo.boundsMax[1], meshInfo.boundsMax[2]), vertices.data());
+
+			OccluderData occluder;
+			unsigned int lod = meshInfo.numberOfLODs - 1;
+			const uint32_t *pFirst = cookedMesh.indices.data() + meshInfo.lodFirstIndex[lod];
+			occluder.indices.assign(pFirst, pFirst + meshInfo.lodNumberOfIndices[lod]);
+			for (const Vertex& vertex : vertices)
+			{
+				occluder.positions.push_back(glm::vec3(worldTransforms[node] * glm::vec4(vertex.x, vertex.y, vertex.z, 1.0f)));
+			}
+			occluders.push_back(occluder);
+		}
+	}
+}
+
+//Joints are the nodes named by a bone, added in scene order so parents come first
+static void importSkeleton(const aiScene *scene, const Scene& sceneNodes, Skeleton& skeleton)
+{
+	std::map<std::string, glm::mat4> inverseBindMatrices;
+	for (unsigned int i = 0; i < scene->mNumMeshes; i++)
+	{
+		const aiMesh *currentMesh = scene->mMeshes[i];
+		for (unsigned int b = 0; b < currentMesh->mNumBones; b++)
+		{
+			const aiBone *currentBone = currentMesh->mBones[b];
+			inverseBindMatrices[currentBone->mName.C_Str()] = convertMatrix(currentBone->mOffsetMatrix);
+		}
+	}
+
+	std::vector<int> nodeJoints(sceneNodes.getNumberOfNodes(), -1);
+	for (unsigned int node = 0; node < sceneNodes.getNumberOfNodes(); node++)
+	{
+		auto boneIter = inverseBindMatrices.find(sceneNodes.getName(node));
+		if (boneIter == inverseBindMatrices.end())
+		{
+			continue;
+		}
+
+		//Fold the transforms of any non-joint nodes between this joint and its parent joint
+		glm::mat4 preTransform = glm::mat4(1.0f);
+		int parentJoint = -1;
+		int parentNode = sceneNodes.getParent(node);
+		while (parentNode >= 0)
+		{
+			if (nodeJoints[parentNode] >= 0)
+			{
+				parentJoint = nodeJoints[parentNode];
+				break;
+			}
+			preTransform = sceneNodes.getLocalTransform(parentNode) * preTransform;
+			parentNode = sceneNodes.getParent(parentNode);
+		}
+
+		glm::vec3 scale;
+		glm::quat rotation;
+		glm::vec3 translation;
+		glm::vec3 skew;
+		glm::vec4 perspective;
+		glm::decompose(sceneNodes.getLocalTransform(node), scale, rotation, translation, skew, perspective);
+		JointPose restPose = { translation, rotation, scale };
+
+		nodeJoints[node] = skeleton.addJoint(sceneNodes.getName(node), parentJoint, preTransform, restPose, boneIter->second);
+	}
+}
+
+static void importClips(const aiScene *scene, const Skeleton& skeleton, std::vector<AnimationClip>& clips)
+{
+	for (unsigned int a = 0; a < scene->mNumAnimations; a++)
+	{
+		const aiAnimation *currentAnimation = scene->mAnimations[a];
+		float ticksPerSecond = currentAnimation->mTicksPerSecond > 0.0 ? (float)currentAnimation->mTicksPerSecond : 25.0f;
+
+		AnimationClip clip;
+		clip.init(currentAnimation->mName.C_Str(), (float)currentAnimation->mDuration / ticksPerSecond, skeleton.getNumberOfJoints());
+
+		std::vector<float> positionTimes, rotationTimes, scaleTimes;
+		std::vector<glm::vec3> positions, scales;
+		std::vector<glm::quat> rotations;
+		for (unsigned int c = 0; c < currentAnimation->mNumChannels; c++)
+		{
+			const aiNodeAnim *currentChannel = currentAnimation->mChannels[c];
+			int joint = skeleton.findJoint(currentChannel->mNodeName.C_Str());
+			if (joint < 0)
+			{
+				continue;
+			}
+
+			positionTimes.clear(); positions.clear();
+			rotationTimes.clear(); rotations.clear();
+			scaleTimes.clear(); scales.clear();
+			for (unsigned int k = 0; k < currentChannel->mNumPositionKeys; k++)
+			{
+				const aiVectorKey& key = currentChannel->mPositionKeys[k];
+				positionTimes.push_back((float)key.mTime / ticksPerSecond);
+				positions.push_back(glm::vec3(key.mValue.x, key.mValue.y, key.mValue.z));
+			}
+			for (unsigned int k = 0; k < currentChannel->mNumRotationKeys; k++)
+			{
+				const aiQuatKey& key = currentChannel->mRotationKeys[k];
+				rotationTimes.push_back((float)key.mTime / ticksPerSecond);
+				rotations.push_back(glm::quat(key.mValue.w, key.mValue.x, key.mValue.y, key.mValue.z));
+			}
+			for (unsigned int k = 0; k < currentChannel->mNumScalingKeys; k++)
+			{
+				const aiVectorKey& key = currentChannel->mScalingKeys[k];
+				scaleTimes.push_back((float)key.mTime / ticksPerSecond);
+				scales.push_back(glm::vec3(key.mValue.x, key.mValue.y, key.mValue.z));
+			}
+			clip.setTrack(joint, positionTimes, positions, rotationTimes, rotations, scaleTimes, scales);
+		}
+		clips.push_back(clip);
+	}
+}
+
+//Keeps the four largest weights per vertex and stores them as bytes that add up to 255
+static void importSkin(const aiMesh *currentMesh, const Skeleton& skeleton, std::vector<SkinVertex>& skinVertices)
+{
+	std::vector<glm::vec4> weights(currentMesh->mNumVertices, glm::vec4(0.0f));
+	std::vector<glm::uvec4> joints(currentMesh->mNumVertices, glm::uvec4(0));
+
+	for (unsigned int b = 0; b < currentMesh->mNumBones; b++)
+	{
+		const aiBone *currentBone = currentMesh->mBones[b];
+		int joint = skeleton.findJoint(currentBone->mName.C_Str());
+		if (joint < 0 || joint >= MAX_SHADER_JOINTS)
+		{
+			continue;
+		}
+
+		for (unsigned int w = 0; w < currentBone->mNumWeights; w++)
+		{
+			const aiVertexWeight& vertexWeight = currentBone->mWeights[w];
+			glm::vec4& vertexWeights = weights[vertexWeight.mVertexId];
+			glm::uvec4& vertexJoints = joints[vertexWeight.mVertexId];
+
+			//Replace the smallest weight if this one is bigger
+			int smallest = 0;
+			for (int i = 1; i < 4; i++)
+			{
+				if (vertexWeights[i] < vertexWeights[smallest])
 				{
-					currentModelNormals = currentMesh->mNormals[v];
+					smallest = i;
 				}
-				Vertex currentVertex = { currentModelVertex.x,currentModelVertex.y,currentModelVertex.z,
-					currentModelColour.r,currentModelColour.g,currentModelColour.b,currentModelColour.a,
-					currentTextureCoordinates.x,currentTextureCoordinates.y,
-					currentModelNormals.x,currentModelNormals.y,currentModelNormals.z,
-					currentModelTangents.x,currentModelTangents.y,currentModelTangents.z,
-					currentModelBitangents.x,currentModelBitangents.y,currentModelBitangents.z };
-
-				vertices.push_back(currentVertex);
+			}
+			if (vertexWeight.mWeight > vertexWeights[smallest])
+			{
+				vertexWeights[smallest] = vertexWeight.mWeight;
+				vertexJoints[smallest] = joint;
 			}
 		}
+	}
 
-		for (int f = 0; f < currentMesh->mNumFaces; f++)
+	skinVertices.resize(currentMesh->mNumVertices);
+	for (unsigned int v = 0; v < currentMesh->mNumVertices; v++)
+	{
+		SkinVertex& skinVertex = skinVertices[v];
+		float total = weights[v].x + weights[v].y + weights[v].z + weights[v].w;
+		if (total <= 0.0f)
 		{
-			aiFace currentModelFace = currentMesh->mFaces[f];
-			indices.push_back(currentModelFace.mIndices[0]);
-			indices.push_back(currentModelFace.mIndices[1]);
-			indices.push_back(currentModelFace.mIndices[2]);
+			//Unweighted vertices follow the root joint
+			SkinVertex rootOnly = { { 0, 0, 0, 0 }, { 255, 0, 0, 0 } };
+			skinVertex = rootOnly;
+			continue;
+		}
+
+		int largest = 0;
+		int byteTotal = 0;
+		for (int i = 0; i < 4; i++)
+		{
+			skinVertex.joints[i] = (unsigned char)joints[v][i];
+			skinVertex.weights[i] = (unsigned char)(weights[v][i] / total * 255.0f + 0.5f);
+			byteTotal += skinVertex.weights[i];
+			if (weights[v][i] > weights[v][largest])
+			{
+				largest = i;
+			}
 		}
+		//Rounding error goes on the largest weight
+		skinVertex.weights[largest] = (unsigned char)(skinVertex.weights[largest] + 255 - byteTotal);
+	}
+}
 
-		pMesh->copyBufferData(vertices.data(), vertices.size(), indices.data(), indices.size());
+const aiScene * importAnimatedScene(Assimp::Importer & importer, const std::string & filename)
+{
+	useAssetArchive(importer);
+	const aiScene* scene = importer.ReadFile(filename, aiProcess_Triangulate | aiProcess_FlipUVs | aiProcess_GenSmoothNormals | aiProcess_GenUVCoords | aiProcess_CalcTangentSpace | aiProcess_LimitBoneWeights);
 
-		pMeshCollection->addMesh(pMesh);
-		vertices.clear();
-		indices.clear();
+	if (!scene)
+	{
+		printf("Model Loading Error - %s\n", importer.GetErrorString());
 	}
+	return scene;
+}
+
+bool loadAnimatedMeshFromFile(const std::string & filename, MeshCollection * pMeshCollection, Scene * pScene, AnimatedModel * pAnimatedModel)
+{
+	Assimp::Importer importer;
 
+	const aiScene* scene = importAnimatedScene(importer, filename);
+	if (!scene)
+	{
+		return false;
+	}
+
+	loadAnimatedMeshFromScene(scene, pMeshCollection, pScene, pAnimatedModel);
 	return true;
-}
\ No newline at end of file
+}
+
+void loadAnimatedMeshFromScene(const aiScene * scene, MeshCollection * pMeshCollection, Scene * pScene, AnimatedModel * pAnimatedModel)
+{
+	//The skeleton is built from the node hierarchy, so a scene is needed even if the caller doesn't want one
+	Scene localScene;
+	if (pScene == nullptr)
+	{
+		pScene = &localScene;
+	}
+	importMeshes(scene, pMeshCollection, pScene);
+
+	importSkeleton(scene, *pScene, pAnimatedModel->skeleton);
+	importClips(scene, pAnimatedModel->skeleton, pAnimatedModel->clips);
+
+	std::vector<unsigned int> indices;
+	for (unsigned int i = 0; i < scene->mNumMeshes; i++)
+	{
+		const aiMesh *currentMesh = scene->mMeshes[i];
+		if (!currentMesh->HasBones())
+		{
+			continue;
+		}
+
+		SkinnedMeshData skin;
+		skin.meshIndex = i;
+		importSkin(currentMesh, pAnimatedModel->skeleton, skin.skinVertices);
+		copyMeshData(currentMesh, skin.bindVertices, indices);
+		skin.skinnedVertices = skin.bindVertices;
+		indices.clear();
+
+		pMeshCollection->getMesh(i)->copySkinData(skin.skinVertices.data(), skin.skinVertices.size());
+		pAnimatedModel->skins.push_back(skin);
+	}
+}
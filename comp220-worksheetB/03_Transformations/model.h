@@ -4,15 +4,50 @@
 #include <assimp\scene.h>
 #include <assimp\postprocess.h>
 
+#include <map>
 #include <string>
 #include <vector>
 
 #include <GL\glew.h>
 #include <SDL_opengl.h>
 
+#define GLM_ENABLE_EXPERIMENTAL
+#include <glm/glm.hpp>
+#include <glm/gtx/matrix_decompose.hpp>
+
 #include "vertex.h"
 #include "Mesh.h"
+#include "scene.h"
+#include "animation.h"
+#include "simplify.h"
+#include "occlusion.h"
+#include "cooked.h"
 
 bool loadModelFromFile(const std::string& filename, GLuint VBO, GLuint EBO, unsigned int& numVerts, unsigned int& numIndices);
 
-bool loadMeshFromFile(const std::string& filename, MeshCollection * pMeshCollection);
\ No newline at end of file
+bool loadMeshFromFile(const std::string& filename, MeshCollection * pMeshCollection);
+
+//Also imports the node hierarchy into pScene, pScene can be nullptr
+bool loadMeshFromFile(const std::string& filename, MeshCollection * pMeshCollection, Scene * pScene);
+
+//Runtime ready mesh from the cook tool, LODs and meshlets are already built so this is just a read and an upload
+//loadMeshFromFile sends .mesh files here, pScene can be nullptr
+bool loadCookedMeshFromFile(const std::string& filename, MeshCollection * pMeshCollection, Scene * pScene);
+
+//The upload half of the above, for cooked models read somewhere else
+void loadCookedModel(const CookedModel& model, MeshCollection * pMeshCollection, Scene * pScene);
+
+//Simplified copy of every mesh placed by its nodes, so the whole scene is placed with one model matrix
+//Doesn't touch GL, so it can run in the job that decoded the scene
+void buildOccluders(const aiScene *scene, std::vector<OccluderData>& occluders);
+
+//Same for a cooked model, its lowest LOD is used rather than simplifying again
+void buildOccluders(const CookedModel& model, std::vector<OccluderData>& occluders);
+
+//Also imports the bones, skeleton and animation clips, skinned meshes get a skin stream
+bool loadAnimatedMeshFromFile(const std::string& filename, MeshCollection * pMeshCollection, Scene * pScene, AnimatedModel * pAnimatedModel);
+
+//loadAnimatedMeshFromFile in two halves, the import has no GL calls so it can run on a worker thread
+//The scene belongs to the importer and is only valid while it is
+const aiScene* importAnimatedScene(Assimp::Importer& importer, const std::string& filename);
+void loadAnimatedMeshFromScene(const aiScene *scene, MeshCollection * pMeshCollection, Scene * pScene, AnimatedModel * pAnimatedModel);
\ No newline at end of file
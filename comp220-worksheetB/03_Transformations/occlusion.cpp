@@ -0,0 +1,373 @@
+#include "occlusion.h"
+
+#include <algorithm>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define OCCLUSION_USE_SSE
+#include <emmintrin.h>
+#endif
+
+static const unsigned int numberOfTiles = OCCLUSION_TILES_X * OCCLUSION_TILES_Y;
+static const unsigned int tilePixels = OCCLUSION_TILE_WIDTH * OCCLUSION_TILE_HEIGHT;
+
+//Anything closer than this in clip space w is treated as crossing the near plane
+static const float nearW = 1e-4f;
+
+//Stops an occluder hiding the object it was made from because of rounding
+static const float depthBias = 1e-5f;
+
+OcclusionCuller::OcclusionCuller()
+{
+	m_ViewProjection = glm::mat4(1.0f);
+	m_Depth.assign(OCCLUSION_BUFFER_WIDTH * OCCLUSION_BUFFER_HEIGHT, 1.0f);
+	m_Owners.assign(OCCLUSION_BUFFER_WIDTH * OCCLUSION_BUFFER_HEIGHT, -1);
+	for (unsigned int tile = 0; tile < numberOfTiles; tile++)
+	{
+		m_TileMaxDepth[tile] = 1.0f;
+		m_TileOwners[tile] = -1;
+	}
+}
+
+OcclusionCuller::~OcclusionCuller()
+{
+}
+
+int OcclusionCuller::addOccluderMesh(const std::vector<glm::vec3>& positions, const std::vector<unsigned int>& indices)
+{
+	OccluderMesh mesh;
+	for (const glm::vec3& position : positions)
+	{
+		mesh.positions.push_back(glm::vec4(position, 1.0f));
+	}
+	mesh.indices = indices;
+	m_OccluderMeshes.push_back(mesh);
+	return (int)m_OccluderMeshes.size() - 1;
+}
+
+void OcclusionCuller::beginFrame(JobSystem & jobSystem, const glm::mat4 & viewProjection, const std::vector<OccluderInstance>& instances)
+{
+	//The last frame's jobs still read the instances, so they have to finish first
+	waitForFrame(jobSystem);
+
+	m_ViewProjection = viewProjection;
+	m_Instances = instances;
+
+	JobSystem *pJobSystem = &jobSystem;
+	jobSystem.addJob([this, pJobSystem]() { renderOccluders(*pJobSystem); }, &m_FrameCounter);
+}
+
+void OcclusionCuller::waitForFrame(JobSystem & jobSystem)
+{
+	jobSystem.waitFor(m_FrameCounter);
+}
+
+unsigned int OcclusionCuller::getNumberOfOccluderTriangles() const
+{
+	unsigned int numberOfTriangles = 0;
+	for (const std::vector<OccluderTriangle>& triangles : m_Triangles)
+	{
+		numberOfTriangles += triangles.size();
+	}
+	return numberOfTriangles;
+}
+
+void OcclusionCuller::renderOccluders(JobSystem & jobSystem)
+{
+	unsigned int numberOfInstances = m_Instances.size();
+	m_Triangles.resize(numberOfInstances);
+	m_TileBins.resize(numberOfInstances);
+
+	//Transform and bin each instance, then rasterise each tile from every instance's bin
+	jobSystem.parallelFor(numberOfInstances, 1, [this](unsigned int start, unsigned int end)
+	{
+		for (unsigned int instance = start; instance < end; instance++)
+		{
+			setupTriangles(instance);
+		}
+	});
+	jobSystem.parallelFor(numberOfTiles, 4, [this](unsigned int start, unsigned int end)
+	{
+		for (unsigned int tile = start; tile < end; tile++)
+		{
+			rasteriseTile(tile);
+		}
+	});
+}
+
+void OcclusionCuller::setupTriangles(unsigned int instance)
+{
+	std::vector<OccluderTriangle>& triangles = m_Triangles[instance];
+	std::vector<std::vector<unsigned int>>& bins = m_TileBins[instance];
+	triangles.clear();
+	bins.resize(numberOfTiles);
+	for (std::vector<unsigned int>& bin : bins)
+	{
+		bin.clear();
+	}
+
+	const OccluderInstance& occluderInstance = m_Instances[instance];
+	if (occluderInstance.occluderMesh < 0 || occluderInstance.occluderMesh >= (int)m_OccluderMeshes.size())
+	{
+		return;
+	}
+	const OccluderMesh& mesh = m_OccluderMeshes[occluderInstance.occluderMesh];
+	glm::mat4 modelViewProjection = m_ViewProjection * occluderInstance.modelMatrix;
+
+	//Screen positions, w <= 0 marks vertices behind the near plane
+	std::vector<glm::vec4> screen(mesh.positions.size());
+	for (unsigned int v = 0; v < mesh.positions.size(); v++)
+	{
+		glm::vec4 clip = modelViewProjection * mesh.positions[v];
+		if (clip.w <= nearW)
+		{
+			screen[v] = glm::vec4(0.0f, 0.0f, 0.0f, -1.0f);
+			continue;
+		}
+		float inverseW = 1.0f / clip.w;
+		screen[v] = glm::vec4((clip.x * inverseW * 0.5f + 0.5f) * OCCLUSION_BUFFER_WIDTH,
+			(clip.y * inverseW * 0.5f + 0.5f) * OCCLUSION_BUFFER_HEIGHT,
+			clip.z * inverseW * 0.5f + 0.5f, 1.0f);
+	}
+
+	for (unsigned int i = 0; i + 2 < mesh.indices.size(); i += 3)
+	{
+		const glm::vec4& p0 = screen[mesh.indices[i + 0]];
+		const glm::vec4& p1 = screen[mesh.indices[i + 1]];
+		const glm::vec4& p2 = screen[mesh.indices[i + 2]];
+
+		//Not clipping, leaving out an occluder triangle only means less gets culled
+		if (p0.w < 0.0f || p1.w < 0.0f || p2.w < 0.0f)
+		{
+			continue;
+		}
+
+		//Counter clockwise is positive, back faces and slivers are skipped
+		float area = (p1.x - p0.x) * (p2.y - p0.y) - (p2.x - p0.x) * (p1.y - p0.y);
+		if (area <= 0.0f)
+		{
+			continue;
+		}
+
+		OccluderTriangle triangle;
+		triangle.minX = std::max(0, (int)std::min(p0.x, std::min(p1.x, p2.x)));
+		triangle.minY = std::max(0, (int)std::min(p0.y, std::min(p1.y, p2.y)));
+		triangle.maxX = std::min(OCCLUSION_BUFFER_WIDTH - 1, (int)std::max(p0.x, std::max(p1.x, p2.x)));
+		triangle.maxY = std::min(OCCLUSION_BUFFER_HEIGHT - 1, (int)std::max(p0.y, std::max(p1.y, p2.y)));
+		if (triangle.minX > triangle.maxX || triangle.minY > triangle.maxY)
+		{
+			continue;
+		}
+
+		const glm::vec4 *pPoints[3] = { &p0, &p1, &p2 };
+		for (int e = 0; e < 3; e++)
+		{
+			const glm::vec4& a = *pPoints[e];
+			const glm::vec4& b = *pPoints[(e + 1) % 3];
+			triangle.edgeA[e] = a.y - b.y;
+			triangle.edgeB[e] = b.x - a.x;
+			triangle.edgeC[e] = -(triangle.edgeA[e] * a.x + triangle.edgeB[e] * a.y);
+		}
+
+		//Depth is linear in screen space after the divide, so it is a plane over the triangle
+		float inverseArea = 1.0f / area;
+		triangle.depthX = ((p1.z - p0.z) * (p2.y - p0.y) - (p2.z - p0.z) * (p1.y - p0.y)) * inverseArea;
+		triangle.depthY = ((p2.z - p0.z) * (p1.x - p0.x) - (p1.z - p0.z) * (p2.x - p0.x)) * inverseArea;
+		triangle.depth0 = p0.z - triangle.depthX * p0.x - triangle.depthY * p0.y;
+
+		unsigned int triangleIndex = triangles.size();
+		triangles.push_back(triangle);
+
+		for (int tileY = triangle.minY / OCCLUSION_TILE_HEIGHT; tileY <= triangle.maxY / OCCLUSION_TILE_HEIGHT; tileY++)
+		{
+			for (int tileX = triangle.minX / OCCLUSION_TILE_WIDTH; tileX <= triangle.maxX / OCCLUSION_TILE_WIDTH; tileX++)
+			{
+				bins[tileY * OCCLUSION_TILES_X + tileX].push_back(triangleIndex);
+			}
+		}
+	}
+}
+
+void OcclusionCuller::rasteriseTile(unsigned int tile)
+{
+	float *pTileDepth = &m_Depth[tile * tilePixels];
+	int *pTileOwners = &m_Owners[tile * tilePixels];
+	std::fill(pTileDepth, pTileDepth + tilePixels, 1.0f);
+	std::fill(pTileOwners, pTileOwners + tilePixels, -1);
+
+	int tileMinX = (tile % OCCLUSION_TILES_X) * OCCLUSION_TILE_WIDTH;
+	int tileMinY = (tile / OCCLUSION_TILES_X) * OCCLUSION_TILE_HEIGHT;
+	int tileMaxX = tileMinX + OCCLUSION_TILE_WIDTH - 1;
+	int tileMaxY = tileMinY + OCCLUSION_TILE_HEIGHT - 1;
+
+	for (unsigned int instance = 0; instance < m_TileBins.size(); instance++)
+	{
+		const std::vector<OccluderTriangle>& triangles = m_Triangles[instance];
+		int owner = m_Instances[instance].owner;
+		for (unsigned int triangleIndex : m_TileBins[instance][tile])
+		{
+			const OccluderTriangle& triangle = triangles[triangleIndex];
+
+			//Rows are clipped to the tile, columns are done in groups of 4 from a 4 aligned start
+			int minX = std::max(triangle.minX, tileMinX) & ~3;
+			int maxX = std::min(triangle.maxX, tileMaxX);
+			int minY = std::max(triangle.minY, tileMinY);
+			int maxY = std::min(triangle.maxY, tileMaxY);
+
+#ifdef OCCLUSION_USE_SSE
+			__m128 pixelOffsets = _mm_setr_ps(0.5f, 1.5f, 2.5f, 3.5f);
+			__m128 edgeA[3], edgeB[3], edgeC[3];
+			for (int e = 0; e < 3; e++)
+			{
+				edgeA[e] = _mm_set1_ps(triangle.edgeA[e]);
+				edgeB[e] = _mm_set1_ps(triangle.edgeB[e]);
+				edgeC[e] = _mm_set1_ps(triangle.edgeC[e]);
+			}
+			__m128 depthX = _mm_set1_ps(triangle.depthX);
+			__m128 depthY = _mm_set1_ps(triangle.depthY);
+			__m128 depth0 = _mm_set1_ps(triangle.depth0);
+			__m128 zero = _mm_setzero_ps();
+			__m128i owners = _mm_set1_epi32(owner);
+
+			for (int y = minY; y <= maxY; y++)
+			{
+				__m128 pixelY = _mm_set1_ps(y + 0.5f);
+				float *pRow = pTileDepth + (y - tileMinY) * OCCLUSION_TILE_WIDTH - tileMinX;
+				int *pOwnerRow = pTileOwners + (y - tileMinY) * OCCLUSION_TILE_WIDTH - tileMinX;
+				for (int x = minX; x <= maxX; x += 4)
+				{
+					__m128 pixelX = _mm_add_ps(_mm_set1_ps((float)x), pixelOffsets);
+
+					__m128 inside = _mm_cmpge_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(edgeA[0], pixelX), _mm_mul_ps(edgeB[0], pixelY)), edgeC[0]), zero);
+					inside = _mm_and_ps(inside, _mm_cmpge_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(edgeA[1], pixelX), _mm_mul_ps(edgeB[1], pixelY)), edgeC[1]), zero));
+					inside = _mm_and_ps(inside, _mm_cmpge_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(edgeA[2], pixelX), _mm_mul_ps(edgeB[2], pixelY)), edgeC[2]), zero));
+					if (_mm_movemask_ps(inside) == 0)
+					{
+						continue;
+					}
+
+					//Keep the nearest depth and its owner, only where the pixel is inside
+					__m128 depth = _mm_add_ps(_mm_add_ps(_mm_mul_ps(depthX, pixelX), _mm_mul_ps(depthY, pixelY)), depth0);
+					__m128 current = _mm_loadu_ps(pRow + x);
+					__m128 closer = _mm_and_ps(inside, _mm_cmplt_ps(depth, current));
+					_mm_storeu_ps(pRow + x, _mm_or_ps(_mm_and_ps(closer, depth), _mm_andnot_ps(closer, current)));
+
+					__m128i closerMask = _mm_castps_si128(closer);
+					__m128i currentOwners = _mm_loadu_si128((const __m128i*)(pOwnerRow + x));
+					_mm_storeu_si128((__m128i*)(pOwnerRow + x), _mm_or_si128(_mm_and_si128(closerMask, owners), _mm_andnot_si128(closerMask, currentOwners)));
+				}
+			}
+#else
+			for (int y = minY; y <= maxY; y++)
+			{
+				float pixelY = y + 0.5f;
+				float *pRow = pTileDepth + (y - tileMinY) * OCCLUSION_TILE_WIDTH - tileMinX;
+				int *pOwnerRow = pTileOwners + (y - tileMinY) * OCCLUSION_TILE_WIDTH - tileMinX;
+				for (int x = minX; x <= maxX; x++)
+				{
+					float pixelX = x + 0.5f;
+					bool inside = true;
+					for (int e = 0; e < 3; e++)
+					{
+						inside = inside && triangle.edgeA[e] * pixelX + triangle.edgeB[e] * pixelY + triangle.edgeC[e] >= 0.0f;
+					}
+					float depth = triangle.depthX * pixelX + triangle.depthY * pixelY + triangle.depth0;
+					if (inside && depth < pRow[x])
+					{
+						pRow[x] = depth;
+						pOwnerRow[x] = owner;
+					}
+				}
+			}
+#endif
+		}
+	}
+
+	//Farthest depth in the tile, anything behind it is hidden everywhere in the tile
+	m_TileMaxDepth[tile] = *std::max_element(pTileDepth, pTileDepth + tilePixels);
+
+	//A single owner lets boxes of every other owner still use the tile's farthest depth
+	int tileOwner = -1;
+	for (unsigned int pixel = 0; pixel < tilePixels; pixel++)
+	{
+		if (pTileOwners[pixel] < 0 || pTileOwners[pixel] == tileOwner)
+		{
+			continue;
+		}
+		if (tileOwner >= 0)
+		{
+			tileOwner = OCCLUSION_MIXED_OWNERS;
+			break;
+		}
+		tileOwner = pTileOwners[pixel];
+	}
+	m_TileOwners[tile] = tileOwner;
+}
+
+bool OcclusionCuller::isBoxVisible(const glm::vec3 & boxMin, const glm::vec3 & boxMax, const glm::mat4 & modelMatrix, int owner) const
+{
+	glm::mat4 modelViewProjection = m_ViewProjection * modelMatrix;
+
+	//Screen rectangle and nearest depth of the eight corners
+	glm::vec2 screenMin = glm::vec2(1e30f);
+	glm::vec2 screenMax = glm::vec2(-1e30f);
+	float nearestDepth = 1.0f;
+	for (int corner = 0; corner < 8; corner++)
+	{
+		glm::vec4 position = glm::vec4((corner & 1) ? boxMax.x : boxMin.x, (corner & 2) ? boxMax.y : boxMin.y, (corner & 4) ? boxMax.z : boxMin.z, 1.0f);
+		glm::vec4 clip = modelViewProjection * position;
+		if (clip.w <= nearW)
+		{
+			return true;
+		}
+		glm::vec3 ndc = glm::vec3(clip) / clip.w;
+		glm::vec2 screen = glm::vec2((ndc.x * 0.5f + 0.5f) * OCCLUSION_BUFFER_WIDTH, (ndc.y * 0.5f + 0.5f) * OCCLUSION_BUFFER_HEIGHT);
+		screenMin = glm::min(screenMin, screen);
+		screenMax = glm::max(screenMax, screen);
+		nearestDepth = std::min(nearestDepth, ndc.z * 0.5f + 0.5f);
+	}
+	nearestDepth -= depthBias;
+
+	int minX = std::max(0, (int)screenMin.x);
+	int minY = std::max(0, (int)screenMin.y);
+	int maxX = std::min(OCCLUSION_BUFFER_WIDTH - 1, (int)screenMax.x);
+	int maxY = std::min(OCCLUSION_BUFFER_HEIGHT - 1, (int)screenMax.y);
+
+	//Off screen is for frustum culling to decide
+	if (minX > maxX || minY > maxY)
+	{
+		return true;
+	}
+
+	for (int tileY = minY / OCCLUSION_TILE_HEIGHT; tileY <= maxY / OCCLUSION_TILE_HEIGHT; tileY++)
+	{
+		for (int tileX = minX / OCCLUSION_TILE_WIDTH; tileX <= maxX / OCCLUSION_TILE_WIDTH; tileX++)
+		{
+			//Whole tile is nearer than the box, no need to look at its pixels
+			//unless some of them may belong to the box's own occluders
+			unsigned int tile = tileY * OCCLUSION_TILES_X + tileX;
+			bool ownPixels = owner >= 0 && (m_TileOwners[tile] == owner || m_TileOwners[tile] == OCCLUSION_MIXED_OWNERS);
+			if (nearestDepth > m_TileMaxDepth[tile] && !ownPixels)
+			{
+				continue;
+			}
+
+			int tileMinX = tileX * OCCLUSION_TILE_WIDTH;
+			int tileMinY = tileY * OCCLUSION_TILE_HEIGHT;
+			const float *pTileDepth = &m_Depth[tile * tilePixels];
+			const int *pTileOwners = &m_Owners[tile * tilePixels];
+			for (int y = std::max(minY, tileMinY); y <= std::min(maxY, tileMinY + OCCLUSION_TILE_HEIGHT - 1); y++)
+			{
+				const float *pRow = pTileDepth + (y - tileMinY) * OCCLUSION_TILE_WIDTH - tileMinX;
+				const int *pOwnerRow = pTileOwners + (y - tileMinY) * OCCLUSION_TILE_WIDTH - tileMinX;
+				for (int x = std::max(minX, tileMinX); x <= std::min(maxX, tileMinX + OCCLUSION_TILE_WIDTH - 1); x++)
+				{
+					if (nearestDepth <= pRow[x] || (owner >= 0 && pOwnerRow[x] == owner))
+					{
+						return true;
+					}
+				}
+			}
+		}
+	}
+	return false;
+}
@@ -0,0 +1,94 @@
+#pragma once
+
+#include <vector>
+
+#include <glm/glm.hpp>
+
+#include "jobs.h"
+
+//Low resolution depth buffer, split into tiles that are rasterised on separate jobs
+#define OCCLUSION_BUFFER_WIDTH 256
+#define OCCLUSION_BUFFER_HEIGHT 128
+#define OCCLUSION_TILE_WIDTH 32
+#define OCCLUSION_TILE_HEIGHT 16
+#define OCCLUSION_TILES_X (OCCLUSION_BUFFER_WIDTH / OCCLUSION_TILE_WIDTH)
+#define OCCLUSION_TILES_Y (OCCLUSION_BUFFER_HEIGHT / OCCLUSION_TILE_HEIGHT)
+
+//Tile owner when the tile has pixels of more than one owner
+#define OCCLUSION_MIXED_OWNERS -2
+
+//Owner identifies the object the occluder was made from, it is never tested against its own occluders
+//because the occluder is only a rough copy and can stick out in front of the real surfaces, -1 is no owner
+struct OccluderInstance
+{
+	int occluderMesh;
+	glm::mat4 modelMatrix;
+	int owner;
+};
+
+//Occluder positions and indices in the space of the model they were made from
+struct OccluderData
+{
+	std::vector<glm::vec3> positions;
+	std::vector<unsigned int> indices;
+};
+
+//Screen space triangle ready for rasterising, edges are A * x + B * y + C >= 0 inside
+struct OccluderTriangle
+{
+	float edgeA[3];
+	float edgeB[3];
+	float edgeC[3];
+	float depth0, depthX, depthY;
+	int minX, minY, maxX, maxY;
+};
+
+//Software depth buffer of a few large occluders, used to skip objects hidden behind them
+//beginFrame hands the rasterising to the job system and returns straight away, so it overlaps
+//with whatever the main thread and the GPU are doing until waitForFrame is called
+class OcclusionCuller
+{
+public:
+	OcclusionCuller();
+	~OcclusionCuller();
+
+	//Occluders should be closed and low detail, back faces are skipped
+	int addOccluderMesh(const std::vector<glm::vec3>& positions, const std::vector<unsigned int>& indices);
+
+	void beginFrame(JobSystem& jobSystem, const glm::mat4& viewProjection, const std::vector<OccluderInstance>& instances);
+	void waitForFrame(JobSystem& jobSystem);
+
+	//Only valid after waitForFrame, boxes that cross the near plane always count as visible
+	//Pixels covered by the owner's own occluders count as visible, whatever is behind them
+	bool isBoxVisible(const glm::vec3& boxMin, const glm::vec3& boxMax, const glm::mat4& modelMatrix, int owner = -1) const;
+
+	unsigned int getNumberOfOccluderTriangles() const;
+private:
+	struct OccluderMesh
+	{
+		std::vector<glm::vec4> positions;
+		std::vector<unsigned int> indices;
+	};
+
+	void renderOccluders(JobSystem& jobSystem);
+	void setupTriangles(unsigned int instance);
+	void rasteriseTile(unsigned int tile);
+
+	std::vector<OccluderMesh> m_OccluderMeshes;
+	std::vector<OccluderInstance> m_Instances;
+	glm::mat4 m_ViewProjection;
+
+	//Triangles and tile bins for each instance, so instances can be set up in parallel
+	std::vector<std::vector<OccluderTriangle>> m_Triangles;
+	std::vector<std::vector<std::vector<unsigned int>>> m_TileBins;
+
+	//Each tile's pixels are stored together, with the owner of the nearest occluder in each pixel
+	std::vector<float> m_Depth;
+	std::vector<int> m_Owners;
+	float m_TileMaxDepth[OCCLUSION_TILES_X * OCCLUSION_TILES_Y];
+
+	//Owner of every covered pixel in the tile, -1 if nothing is covered or OCCLUSION_MIXED_OWNERS
+	int m_TileOwners[OCCLUSION_TILES_X * OCCLUSION_TILES_Y];
+
+	JobCounter m_FrameCounter;
+};
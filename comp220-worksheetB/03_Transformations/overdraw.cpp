@@ -0,0 +1,90 @@
+#include "overdraw.h"
+
+OverdrawQuery::OverdrawQuery()
+{
+	for (unsigned int i = 0; i < OVERDRAW_QUERY_FRAMES; i++)
+	{
+		m_Queries[i] = 0;
+		m_Pixels[i] = 0.0;
+		m_Pending[i] = false;
+	}
+	m_Current = 0;
+	m_TotalShadedPerPixel = 0.0;
+	m_NumberOfResults = 0;
+}
+
+OverdrawQuery::~OverdrawQuery()
+{
+}
+
+void OverdrawQuery::init()
+{
+	glGenQueries(OVERDRAW_QUERY_FRAMES, m_Queries);
+}
+
+void OverdrawQuery::destroy()
+{
+	glDeleteQueries(OVERDRAW_QUERY_FRAMES, m_Queries);
+	for (unsigned int i = 0; i < OVERDRAW_QUERY_FRAMES; i++)
+	{
+		m_Queries[i] = 0;
+		m_Pending[i] = false;
+	}
+}
+
+void OverdrawQuery::begin()
+{
+	//If the GPU is so far behind the oldest query is still busy, skip counting this frame
+	collectResults();
+	if (m_Pending[m_Current])
+	{
+		return;
+	}
+	glBeginQuery(GL_SAMPLES_PASSED, m_Queries[m_Current]);
+}
+
+void OverdrawQuery::end(int viewportWidth, int viewportHeight)
+{
+	if (m_Pending[m_Current])
+	{
+		return;
+	}
+	glEndQuery(GL_SAMPLES_PASSED);
+	m_Pixels[m_Current] = (double)viewportWidth * viewportHeight;
+	m_Pending[m_Current] = true;
+	m_Current = (m_Current + 1) % OVERDRAW_QUERY_FRAMES;
+}
+
+void OverdrawQuery::collectResults()
+{
+	for (unsigned int i = 0; i < OVERDRAW_QUERY_FRAMES; i++)
+	{
+		if (!m_Pending[i])
+		{
+			continue;
+		}
+
+		GLint available = 0;
+		glGetQueryObjectiv(m_Queries[i], GL_QUERY_RESULT_AVAILABLE, &available);
+		if (available)
+		{
+			GLuint64 samples = 0;
+			glGetQueryObjectui64v(m_Queries[i], GL_QUERY_RESULT, &samples);
+			if (m_Pixels[i] > 0.0)
+			{
+				m_TotalShadedPerPixel += samples / m_Pixels[i];
+				m_NumberOfResults++;
+			}
+			m_Pending[i] = false;
+		}
+	}
+}
+
+float OverdrawQuery::resetAverage()
+{
+	collectResults();
+	float average = m_NumberOfResults > 0 ? (float)(m_TotalShadedPerPixel / m_NumberOfResults) : 0.0f;
+	m_TotalShadedPerPixel = 0.0;
+	m_NumberOfResults = 0;
+	return average;
+}
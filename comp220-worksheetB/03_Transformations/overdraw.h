@@ -0,0 +1,36 @@
+#pragma once
+
+#include <GL\glew.h>
+#include <SDL_opengl.h>
+
+//Number of frames a query result is allowed to lag behind
+#define OVERDRAW_QUERY_FRAMES 4
+
+//Counts the samples that pass the depth test in the shaded pass, with GL_SAMPLES_PASSED queries
+//Divided by the pixels on screen that gives how many times each pixel was shaded, 1 being no overdraw
+//Results are read a few frames late so the CPU never waits on the GPU
+class OverdrawQuery
+{
+public:
+	OverdrawQuery();
+	~OverdrawQuery();
+
+	void init();
+	void destroy();
+
+	void begin();
+	void end(int viewportWidth, int viewportHeight);
+
+	//Average shaded samples per pixel over every frame that has finished so far, then starts counting again
+	float resetAverage();
+private:
+	void collectResults();
+
+	GLuint m_Queries[OVERDRAW_QUERY_FRAMES];
+	double m_Pixels[OVERDRAW_QUERY_FRAMES];
+	bool m_Pending[OVERDRAW_QUERY_FRAMES];
+	unsigned int m_Current;
+
+	double m_TotalShadedPerPixel;
+	unsigned int m_NumberOfResults;
+};
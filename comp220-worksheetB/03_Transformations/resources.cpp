@@ -0,0 +1,388 @@
+#include "resources.h"
+
+#include <algorithm>
+#include <cstdio>
+
+#include <SDL_image.h>
+
+#include "archive.h"
+#include "gpumemory.h"
+#include "Texture.h"
+
+ResourceManager::ResourceManager()
+{
+	m_pJobSystem = nullptr;
+	m_Frame = 0;
+	m_NumberOfRequests = 0;
+	m_NumberOfLoads = 0;
+}
+
+ResourceManager::~ResourceManager()
+{
+}
+
+void ResourceManager::init(JobSystem * pJobSystem)
+{
+	m_pJobSystem = pJobSystem;
+}
+
+void ResourceManager::destroy()
+{
+	//Entries are taken out under the lock and waited for after it, waiting runs other jobs
+	//and one of them could be asking the manager for something
+	std::vector<std::unique_ptr<ResourceEntry>> entries;
+	{
+		std::lock_guard<std::mutex> lock(m_Mutex);
+		for (unsigned int i = 0; i < m_Entries.size(); i++)
+		{
+			if (m_Entries[i])
+			{
+				entries.push_back(std::move(m_Entries[i]));
+				freeSlot(i);
+			}
+		}
+		m_Loaded.clear();
+	}
+
+	for (std::unique_ptr<ResourceEntry>& entry : entries)
+	{
+		//The job decrements the entry's counter, so it has to finish before the entry goes
+		m_pJobSystem->waitFor(entry->decoding);
+		destroyEntry(*entry);
+	}
+}
+
+PathID ResourceManager::internPath(const std::string & path)
+{
+	std::string normalised = normaliseAssetPath(path);
+
+	std::lock_guard<std::mutex> lock(m_Mutex);
+	auto iter = m_PathIDs.find(normalised);
+	if (iter != m_PathIDs.end())
+	{
+		return iter->second;
+	}
+	PathID id = m_Paths.size();
+	m_Paths.push_back(path);
+	m_PathIDs[normalised] = id;
+	return id;
+}
+
+std::string ResourceManager::getPath(PathID path)
+{
+	std::lock_guard<std::mutex> lock(m_Mutex);
+	return path < m_Paths.size() ? m_Paths[path] : std::string();
+}
+
+ResourceHandle ResourceManager::requestModel(const std::string & path)
+{
+	return request(RESOURCE_MODEL, path);
+}
+
+ResourceHandle ResourceManager::requestTexture(const std::string & path)
+{
+	return request(RESOURCE_TEXTURE, path);
+}
+
+ResourceHandle ResourceManager::request(ResourceType type, const std::string & path)
+{
+	PathID pathID = internPath(path);
+
+	std::lock_guard<std::mutex> lock(m_Mutex);
+	m_NumberOfRequests++;
+
+	//Already loaded, loading, or waiting to be destroyed, they all just gain a reference
+	auto iter = m_Loaded.find(std::make_pair(type, pathID));
+	if (iter != m_Loaded.end())
+	{
+		m_Entries[iter->second.index]->references++;
+		return iter->second;
+	}
+
+	ResourceHandle handle;
+	if (!m_FreeSlots.empty())
+	{
+		handle.index = m_FreeSlots.back();
+		m_FreeSlots.pop_back();
+	}
+	else
+	{
+		handle.index = m_Entries.size();
+		m_Entries.emplace_back();
+		m_Generations.push_back(0);
+	}
+	handle.generation = m_Generations[handle.index];
+
+	std::unique_ptr<ResourceEntry> entry(new ResourceEntry());
+	entry->type = type;
+	entry->path = pathID;
+	entry->references = 1;
+	entry->releasedFrame = 0;
+	entry->uploaded = false;
+	entry->model.pMeshes = nullptr;
+	entry->model.pScene = nullptr;
+	entry->model.pAnimation = nullptr;
+	entry->texture = 0;
+
+	//The promise is shared with the job, everyone asking for this path waits on the same future
+	std::shared_ptr<std::promise<std::shared_ptr<DecodedResource>>> pPromise = std::make_shared<std::promise<std::shared_ptr<DecodedResource>>>();
+	entry->decoded = pPromise->get_future().share();
+	std::string filename = m_Paths[pathID];
+	m_pJobSystem->addJob([pPromise, type, filename]()
+	{
+		pPromise->set_value(decode(type, filename));
+	}, &entry->decoding);
+
+	m_Entries[handle.index] = std::move(entry);
+	m_Loaded[std::make_pair(type, pathID)] = handle;
+	m_NumberOfLoads++;
+	return handle;
+}
+
+void ResourceManager::addReference(ResourceHandle handle)
+{
+	std::lock_guard<std::mutex> lock(m_Mutex);
+	ResourceEntry *pEntry = getEntry(handle);
+	if (pEntry)
+	{
+		pEntry->references++;
+	}
+}
+
+void ResourceManager::release(ResourceHandle handle)
+{
+	std::lock_guard<std::mutex> lock(m_Mutex);
+	ResourceEntry *pEntry = getEntry(handle);
+	if (pEntry && pEntry->references > 0)
+	{
+		pEntry->references--;
+		if (pEntry->references == 0)
+		{
+			pEntry->releasedFrame = m_Frame;
+		}
+	}
+}
+
+std::shared_ptr<ResourceManager::DecodedResource> ResourceManager::decode(ResourceType type, const std::string & path)
+{
+	std::shared_ptr<DecodedResource> pDecoded = std::make_shared<DecodedResource>();
+	pDecoded->pScene = nullptr;
+	pDecoded->width = 0;
+	pDecoded->height = 0;
+
+	if (type == RESOURCE_MODEL && isCookedMesh(path))
+	{
+		pDecoded->pCooked.reset(new CookedModel());
+		if (readCookedModel(path, *pDecoded->pCooked))
+		{
+			buildOccluders(*pDecoded->pCooked, pDecoded->occluders);
+		}
+		return pDecoded;
+	}
+	if (type == RESOURCE_MODEL)
+	{
+		pDecoded->importer.reset(new Assimp::Importer());
+		pDecoded->pScene = importAnimatedScene(*pDecoded->importer, path);
+
+		//Simplifying is the slow part, so it is done here rather than in the upload
+		buildOccluders(pDecoded->pScene, pDecoded->occluders);
+		return pDecoded;
+	}
+
+	SDL_Surface* surface = IMG_Load_RW(openAssetRWops(path), 1);
+	if (surface == nullptr)
+	{
+		printf("Could not load image file %s\n", path.c_str());
+		return pDecoded;
+	}
+	SDL_Surface* rgbaSurface = SDL_ConvertSurfaceFormat(surface, SDL_PIXELFORMAT_ABGR8888, 0);
+	SDL_FreeSurface(surface);
+	if (rgbaSurface == nullptr)
+	{
+		printf("Could not convert image file %s\n", path.c_str());
+		return pDecoded;
+	}
+
+	pDecoded->width = rgbaSurface->w;
+	pDecoded->height = rgbaSurface->h;
+	pDecoded->pixels.resize(rgbaSurface->w * rgbaSurface->h * 4);
+	for (int row = 0; row < rgbaSurface->h; row++)
+	{
+		const unsigned char *pRow = (const unsigned char*)rgbaSurface->pixels + row * rgbaSurface->pitch;
+		std::copy(pRow, pRow + rgbaSurface->w * 4, pDecoded->pixels.begin() + row * rgbaSurface->w * 4);
+	}
+	SDL_FreeSurface(rgbaSurface);
+	return pDecoded;
+}
+
+void ResourceManager::upload(ResourceEntry & entry)
+{
+	std::shared_ptr<DecodedResource> pDecoded = entry.decoded.get();
+
+	if (entry.type == RESOURCE_MODEL)
+	{
+		entry.model.pMeshes = new MeshCollection();
+		entry.model.pScene = new Scene();
+		entry.model.pAnimation = new AnimatedModel();
+		if (pDecoded->pScene)
+		{
+			loadAnimatedMeshFromScene(pDecoded->pScene, entry.model.pMeshes, entry.model.pScene, entry.model.pAnimation);
+		}
+		else if (pDecoded->pCooked)
+		{
+			//Cooked models have no skeleton, the animation is left empty
+			loadCookedModel(*pDecoded->pCooked, entry.model.pMeshes, entry.model.pScene);
+		}
+		entry.model.occluders = std::move(pDecoded->occluders);
+	}
+	else if (!pDecoded->pixels.empty())
+	{
+		glGenTextures(1, &entry.texture);
+		glBindTexture(GL_TEXTURE_2D, entry.texture);
+		glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+		glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA8, pDecoded->width, pDecoded->height, 0, GL_RGBA, GL_UNSIGNED_BYTE, pDecoded->pixels.data());
+		glPixelStorei(GL_UNPACK_ALIGNMENT, 4);
+		glGenerateMipmap(GL_TEXTURE_2D);
+		glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR_MIPMAP_LINEAR);
+		glBindTexture(GL_TEXTURE_2D, 0);
+
+		//A full mip chain adds a third
+		getGPUMemory().trackTexture(entry.texture, (size_t)pDecoded->width * pDecoded->height * 4 * 4 / 3);
+	}
+
+	//The CPU copy isn't needed once it is on the GPU
+	entry.decoded = std::shared_future<std::shared_ptr<DecodedResource>>();
+	entry.uploaded = true;
+}
+
+void ResourceManager::destroyEntry(ResourceEntry & entry)
+{
+	if (entry.model.pMeshes)
+	{
+		entry.model.pMeshes->destroy();
+		delete entry.model.pMeshes;
+		entry.model.pMeshes = nullptr;
+	}
+	if (entry.model.pScene)
+	{
+		delete entry.model.pScene;
+		entry.model.pScene = nullptr;
+	}
+	if (entry.model.pAnimation)
+	{
+		delete entry.model.pAnimation;
+		entry.model.pAnimation = nullptr;
+	}
+	entry.model.occluders.clear();
+	if (entry.texture)
+	{
+		deleteTexture(entry.texture);
+		entry.texture = 0;
+	}
+}
+
+void ResourceManager::update()
+{
+	std::lock_guard<std::mutex> lock(m_Mutex);
+	for (unsigned int i = 0; i < m_Entries.size(); i++)
+	{
+		ResourceEntry *pEntry = m_Entries[i].get();
+		if (pEntry == nullptr)
+		{
+			continue;
+		}
+		if (!pEntry->uploaded && pEntry->decoding.isDone())
+		{
+			upload(*pEntry);
+		}
+
+		//Unreferenced for long enough that nothing in flight can still be using it
+		if (pEntry->uploaded && pEntry->references == 0 && m_Frame - pEntry->releasedFrame >= RESOURCE_DESTROY_DELAY)
+		{
+			destroyEntry(*pEntry);
+			m_Loaded.erase(std::make_pair(pEntry->type, pEntry->path));
+			m_Entries[i].reset();
+			freeSlot(i);
+		}
+	}
+	m_Frame++;
+}
+
+void ResourceManager::waitFor(ResourceHandle handle)
+{
+	ResourceEntry *pEntry;
+	{
+		std::lock_guard<std::mutex> lock(m_Mutex);
+		pEntry = getEntry(handle);
+		if (pEntry == nullptr || pEntry->uploaded)
+		{
+			return;
+		}
+	}
+
+	//Waiting on the counter rather than the future lets this thread run the job if the workers are busy
+	m_pJobSystem->waitFor(pEntry->decoding);
+
+	std::lock_guard<std::mutex> lock(m_Mutex);
+	pEntry = getEntry(handle);
+	if (pEntry && !pEntry->uploaded)
+	{
+		upload(*pEntry);
+	}
+}
+
+bool ResourceManager::isReady(ResourceHandle handle)
+{
+	std::lock_guard<std::mutex> lock(m_Mutex);
+	ResourceEntry *pEntry = getEntry(handle);
+	return pEntry && pEntry->uploaded;
+}
+
+ModelResource * ResourceManager::getModel(ResourceHandle handle)
+{
+	std::lock_guard<std::mutex> lock(m_Mutex);
+	ResourceEntry *pEntry = getEntry(handle);
+	if (pEntry == nullptr || !pEntry->uploaded || pEntry->type != RESOURCE_MODEL)
+	{
+		return nullptr;
+	}
+	return &pEntry->model;
+}
+
+GLuint ResourceManager::getTexture(ResourceHandle handle)
+{
+	std::lock_guard<std::mutex> lock(m_Mutex);
+	ResourceEntry *pEntry = getEntry(handle);
+	if (pEntry == nullptr || !pEntry->uploaded || pEntry->type != RESOURCE_TEXTURE)
+	{
+		return 0;
+	}
+	return pEntry->texture;
+}
+
+unsigned int ResourceManager::getNumberOfRequests()
+{
+	std::lock_guard<std::mutex> lock(m_Mutex);
+	return m_NumberOfRequests;
+}
+
+unsigned int ResourceManager::getNumberOfLoads()
+{
+	std::lock_guard<std::mutex> lock(m_Mutex);
+	return m_NumberOfLoads;
+}
+
+void ResourceManager::freeSlot(int index)
+{
+	m_Generations[index]++;
+	m_FreeSlots.push_back(index);
+}
+
+ResourceManager::ResourceEntry * ResourceManager::getEntry(ResourceHandle handle)
+{
+	if (handle.index < 0 || handle.index >= (int)m_Entries.size() || m_Generations[handle.index] != handle.generation)
+	{
+		return nullptr;
+	}
+	return m_Entries[handle.index].get();
+}
@@ -0,0 +1,141 @@
+#pragma once
+
+#include <future>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include <GL\glew.h>
+#include <SDL_opengl.h>
+
+#include "Model.h"
+#include "jobs.h"
+
+//Released resources are kept this many frames before destruction, long enough for the GPU to finish with them
+//and for a quick re-request to pick them back up without a reload
+#define RESOURCE_DESTROY_DELAY 3
+
+//Interned path, the same file always gets the same id however it was spelled
+typedef unsigned int PathID;
+
+//An index of -1 is never a valid handle
+//Slots are reused, so the generation has to match the slot's as well, a handle to a destroyed
+//resource stays dead rather than finding whatever was loaded into its slot afterwards
+struct ResourceHandle
+{
+	int index;
+	unsigned int generation;
+};
+
+enum ResourceType
+{
+	RESOURCE_MODEL,
+	RESOURCE_TEXTURE
+};
+
+//Everything loadAnimatedMeshFromFile fills in, a file without bones just has an empty skeleton
+//Cooked .mesh files fill in the meshes and the scene, their animation is always empty
+//Occluders are the simplified copies from buildOccluders, ready for OcclusionCuller::addOccluderMesh
+struct ModelResource
+{
+	MeshCollection *pMeshes;
+	Scene *pScene;
+	AnimatedModel *pAnimation;
+	std::vector<OccluderData> occluders;
+};
+
+//Shares models and textures between everyone who asks for them
+//Files are read and decoded by a job on the job system, only the GL upload happens on the main thread in update or waitFor
+//Requests for a path that is already loading share its future instead of starting a second load
+class ResourceManager
+{
+public:
+	ResourceManager();
+	~ResourceManager();
+
+	void init(JobSystem *pJobSystem);
+
+	//Destroys everything straight away, whether it is still referenced or not
+	void destroy();
+
+	//Separators and case are ignored, so Tank1.FBX and .\tank1.fbx are the same file
+	PathID internPath(const std::string& path);
+	std::string getPath(PathID path);
+
+	//Every request adds a reference, starting the load if nothing else holds the path
+	//Safe to call from any thread
+	ResourceHandle requestModel(const std::string& path);
+	ResourceHandle requestTexture(const std::string& path);
+	void addReference(ResourceHandle handle);
+	void release(ResourceHandle handle);
+
+	//Main thread only, once a frame, uploads finished loads and destroys resources nobody has wanted for a while
+	void update();
+
+	//Main thread only, blocks until the handle is uploaded, helping with the job queue meanwhile
+	//A file that fails to load still becomes ready, as an empty model or a zero texture
+	void waitFor(ResourceHandle handle);
+
+	bool isReady(ResourceHandle handle);
+	ModelResource *getModel(ResourceHandle handle);
+	GLuint getTexture(ResourceHandle handle);
+
+	//Requests against loads, so how much deduplication is saving
+	unsigned int getNumberOfRequests();
+	unsigned int getNumberOfLoads();
+private:
+	//What the job produces, nothing in here touches GL
+	//Models are either an Assimp scene or, for .mesh files, a cooked model
+	struct DecodedResource
+	{
+		std::unique_ptr<Assimp::Importer> importer;
+		const aiScene *pScene;
+		std::unique_ptr<CookedModel> pCooked;
+		std::vector<OccluderData> occluders;
+
+		int width;
+		int height;
+		std::vector<unsigned char> pixels;
+	};
+
+	struct ResourceEntry
+	{
+		ResourceType type;
+		PathID path;
+		int references;
+		unsigned long long releasedFrame;
+
+		JobCounter decoding;
+		std::shared_future<std::shared_ptr<DecodedResource>> decoded;
+		bool uploaded;
+
+		ModelResource model;
+		GLuint texture;
+	};
+
+	ResourceHandle request(ResourceType type, const std::string& path);
+	static std::shared_ptr<DecodedResource> decode(ResourceType type, const std::string& path);
+	void upload(ResourceEntry& entry);
+	void destroyEntry(ResourceEntry& entry);
+	void freeSlot(int index);
+	ResourceEntry *getEntry(ResourceHandle handle);
+
+	JobSystem *m_pJobSystem;
+	std::mutex m_Mutex;
+
+	std::unordered_map<std::string, PathID> m_PathIDs;
+	std::vector<std::string> m_Paths;
+
+	//Handles index the entries, slots of destroyed entries are reused with their generation bumped
+	std::vector<std::unique_ptr<ResourceEntry>> m_Entries;
+	std::vector<unsigned int> m_Generations;
+	std::vector<int> m_FreeSlots;
+	std::map<std::pair<ResourceType, PathID>, ResourceHandle> m_Loaded;
+
+	unsigned long long m_Frame;
+	unsigned int m_NumberOfRequests;
+	unsigned int m_NumberOfLoads;
+};
@@ -0,0 +1,370 @@
+#include "scene.h"
+
+#include <glm/gtc/type_ptr.hpp>
+
+glm::mat4 convertMatrix(const aiMatrix4x4& matrix)
+{
+	//Assimp matrices are row major, glm is column major
+	return glm::transpose(glm::make_mat4(&matrix.a1));
+}
+
+//Back face culling is on by default and only switched off around double sided meshes
+static void setBackFaceCulling(bool& cullingEnabled, const Material& material)
+{
+	if (cullingEnabled == material.doubleSided)
+	{
+		cullingEnabled = !material.doubleSided;
+		if (cullingEnabled)
+		{
+			glEnable(GL_CULL_FACE);
+		}
+		else
+		{
+			glDisable(GL_CULL_FACE);
+		}
+	}
+}
+
+Scene::Scene()
+{
+	m_AnyDirty = false;
+}
+
+Scene::~Scene()
+{
+	clear();
+}
+
+void Scene::importNodes(const aiScene * scene)
+{
+	clear();
+	if (scene == nullptr || scene->mRootNode == nullptr)
+	{
+		return;
+	}
+
+	importNode(scene->mRootNode, -1);
+	updateWorldTransforms();
+}
+
+int Scene::importNode(const aiNode * node, int parent)
+{
+	//The mesh indices match the order the meshes were added to the MeshCollection
+	int nodeIndex = addNode(node->mName.C_Str(), parent, convertMatrix(node->mTransformation), node->mMeshes, node->mNumMeshes);
+
+	//Children are added straight after their parent, depth first
+	for (unsigned int i = 0; i < node->mNumChildren; i++)
+	{
+		importNode(node->mChildren[i], nodeIndex);
+	}
+
+	return nodeIndex;
+}
+
+int Scene::addNode(const std::string & name, int parent, const glm::mat4 & localTransform, const unsigned int * pMeshes, unsigned int meshCount)
+{
+	int nodeIndex = (int)m_Parents.size();
+
+	m_Parents.push_back(parent);
+	m_SubtreeSizes.push_back(1);
+	m_LocalTransforms.push_back(localTransform);
+	m_Names.push_back(name);
+
+	//Every node starts dirty so the next update fills in its world transform
+	m_WorldTransforms.push_back(glm::mat4(1.0f));
+	m_Dirty.push_back(1);
+	m_AnyDirty = true;
+
+	MeshRange range = { (unsigned int)m_NodeMeshes.size(), meshCount };
+	m_NodeMeshes.insert(m_NodeMeshes.end(), pMeshes, pMeshes + meshCount);
+	m_MeshRanges.push_back(range);
+
+	//Each ancestor's block grows by one, it stays contiguous because nodes are added depth first
+	for (int ancestor = parent; ancestor >= 0; ancestor = m_Parents[ancestor])
+	{
+		m_SubtreeSizes[ancestor]++;
+	}
+
+	return nodeIndex;
+}
+
+void Scene::setLocalTransform(int node, const glm::mat4 & localTransform)
+{
+	m_LocalTransforms[node] = localTransform;
+	m_Dirty[node] = 1;
+	m_AnyDirty = true;
+}
+
+const glm::mat4 & Scene::getLocalTransform(int node) const
+{
+	return m_LocalTransforms[node];
+}
+
+const glm::mat4 & Scene::getWorldTransform(int node) const
+{
+	return m_WorldTransforms[node];
+}
+
+void Scene::updateWorldTransforms()
+{
+	if (!m_AnyDirty)
+	{
+		return;
+	}
+
+	//Walk the array in order, when a dirty node is found its whole subtree is updated and skipped over
+	int numberOfNodes = (int)m_Parents.size();
+	int node = 0;
+	while (node < numberOfNodes)
+	{
+		if (m_Dirty[node])
+		{
+			updateSubtree(node);
+			node += m_SubtreeSizes[node];
+		}
+		else
+		{
+			node++;
+		}
+	}
+
+	m_AnyDirty = false;
+}
+
+void Scene::updateSubtree(int node)
+{
+	//Parents come before children, so the parent world transform is always up to date here
+	int end = node + (int)m_SubtreeSizes[node];
+	for (int i = node; i < end; i++)
+	{
+		int parent = m_Parents[i];
+		if (parent < 0)
+		{
+			m_WorldTransforms[i] = m_LocalTransforms[i];
+		}
+		else
+		{
+			m_WorldTransforms[i] = m_WorldTransforms[parent] * m_LocalTransforms[i];
+		}
+		m_Dirty[i] = 0;
+	}
+}
+
+int Scene::findNode(const std::string & name) const
+{
+	for (unsigned int i = 0; i < m_Names.size(); i++)
+	{
+		if (m_Names[i] == name)
+		{
+			return (int)i;
+		}
+	}
+	return -1;
+}
+
+int Scene::getParent(int node) const
+{
+	return m_Parents[node];
+}
+
+unsigned int Scene::getSubtreeSize(int node) const
+{
+	return m_SubtreeSizes[node];
+}
+
+const std::string & Scene::getName(int node) const
+{
+	return m_Names[node];
+}
+
+const MeshRange & Scene::getMeshRange(int node) const
+{
+	return m_MeshRanges[node];
+}
+
+unsigned int Scene::getNodeMesh(unsigned int index) const
+{
+	return m_NodeMeshes[index];
+}
+
+unsigned int Scene::getNumberOfNodes() const
+{
+	return (unsigned int)m_Parents.size();
+}
+
+void Scene::render(MeshCollection * pMeshCollection, GLint modelMatrixLocation, const glm::mat4 & rootTransform)
+{
+	bool cullingEnabled = true;
+	glEnable(GL_CULL_FACE);
+	for (unsigned int node = 0; node < m_Parents.size(); node++)
+	{
+		const MeshRange& range = m_MeshRanges[node];
+		if (range.meshCount == 0)
+		{
+			continue;
+		}
+
+		//Each node gets its own model matrix so parts can move independently
+		glm::mat4 modelMatrix = rootTransform * m_WorldTransforms[node];
+		glUniformMatrix4fv(modelMatrixLocation, 1, GL_FALSE, glm::value_ptr(modelMatrix));
+
+		for (unsigned int i = range.firstMesh; i < range.firstMesh + range.meshCount; i++)
+		{
+			Mesh *pMesh = pMeshCollection->getMesh(m_NodeMeshes[i]);
+			if (pMesh)
+			{
+				setBackFaceCulling(cullingEnabled, pMesh->getMaterial());
+				pMesh->render();
+			}
+		}
+	}
+	glEnable(GL_CULL_FACE);
+}
+
+void Scene::render(MeshCollection * pMeshCollection, GLint modelMatrixLocation, const glm::mat4 & rootTransform,
+	const glm::mat4 & view, const glm::mat4 & projectionMatrix, float viewportHeight, const OcclusionCuller * pOcclusionCuller,
+	int occlusionOwner)
+{
+	glm::mat4 viewProjection = projectionMatrix * view;
+	glm::vec3 cameraPosition = glm::vec3(glm::inverse(view)[3]);
+
+	bool cullingEnabled = true;
+	glEnable(GL_CULL_FACE);
+	for (unsigned int node = 0; node < m_Parents.size(); node++)
+	{
+		const MeshRange& range = m_MeshRanges[node];
+		if (range.meshCount == 0)
+		{
+			continue;
+		}
+
+		glm::mat4 modelMatrix = rootTransform * m_WorldTransforms[node];
+		glUniformMatrix4fv(modelMatrixLocation, 1, GL_FALSE, glm::value_ptr(modelMatrix));
+
+		for (unsigned int i = range.firstMesh; i < range.firstMesh + range.meshCount; i++)
+		{
+			Mesh *pMesh = pMeshCollection->getMesh(m_NodeMeshes[i]);
+			if (pMesh && pOcclusionCuller && !pOcclusionCuller->isBoxVisible(pMesh->getBoundsMin(), pMesh->getBoundsMax(), modelMatrix, occlusionOwner))
+			{
+				continue;
+			}
+			if (pMesh)
+			{
+				setBackFaceCulling(cullingEnabled, pMesh->getMaterial());
+				unsigned int lod = pMesh->selectLOD(modelMatrix, view, projectionMatrix, viewportHeight);
+				pMesh->renderCulled(modelMatrix, viewProjection, cameraPosition, lod);
+			}
+		}
+	}
+	glEnable(GL_CULL_FACE);
+}
+
+void Scene::renderDepth(MeshCollection * pMeshCollection, GLint modelMatrixLocation, const glm::mat4 & rootTransform,
+	const glm::mat4 & viewProjection, unsigned int lod)
+{
+	bool cullingEnabled = true;
+	glEnable(GL_CULL_FACE);
+	for (unsigned int node = 0; node < m_Parents.size(); node++)
+	{
+		const MeshRange& range = m_MeshRanges[node];
+		if (range.meshCount == 0)
+		{
+			continue;
+		}
+
+		glm::mat4 modelMatrix = rootTransform * m_WorldTransforms[node];
+		glUniformMatrix4fv(modelMatrixLocation, 1, GL_FALSE, glm::value_ptr(modelMatrix));
+
+		for (unsigned int i = range.firstMesh; i < range.firstMesh + range.meshCount; i++)
+		{
+			Mesh *pMesh = pMeshCollection->getMesh(m_NodeMeshes[i]);
+			if (pMesh)
+			{
+				setBackFaceCulling(cullingEnabled, pMesh->getMaterial());
+				pMesh->renderDepthCulled(modelMatrix, viewProjection, lod);
+			}
+		}
+	}
+	glEnable(GL_CULL_FACE);
+}
+
+void Scene::renderDepth(MeshCollection * pMeshCollection, GLint modelMatrixLocation, const glm::mat4 & rootTransform,
+	const glm::mat4 & view, const glm::mat4 & projectionMatrix, float viewportHeight, const OcclusionCuller * pOcclusionCuller,
+	int occlusionOwner)
+{
+	glm::mat4 viewProjection = projectionMatrix * view;
+
+	bool cullingEnabled = true;
+	glEnable(GL_CULL_FACE);
+	for (unsigned int node = 0; node < m_Parents.size(); node++)
+	{
+		const MeshRange& range = m_MeshRanges[node];
+		if (range.meshCount == 0)
+		{
+			continue;
+		}
+
+		glm::mat4 modelMatrix = rootTransform * m_WorldTransforms[node];
+		glUniformMatrix4fv(modelMatrixLocation, 1, GL_FALSE, glm::value_ptr(modelMatrix));
+
+		//Has to skip and pick LODs exactly like render, or the GL_EQUAL pass after it will lose pixels
+		for (unsigned int i = range.firstMesh; i < range.firstMesh + range.meshCount; i++)
+		{
+			Mesh *pMesh = pMeshCollection->getMesh(m_NodeMeshes[i]);
+			if (pMesh && pOcclusionCuller && !pOcclusionCuller->isBoxVisible(pMesh->getBoundsMin(), pMesh->getBoundsMax(), modelMatrix, occlusionOwner))
+			{
+				continue;
+			}
+			if (pMesh)
+			{
+				setBackFaceCulling(cullingEnabled, pMesh->getMaterial());
+				unsigned int lod = pMesh->selectLOD(modelMatrix, view, projectionMatrix, viewportHeight);
+				pMesh->renderDepthCulled(modelMatrix, viewProjection, lod);
+			}
+		}
+	}
+	glEnable(GL_CULL_FACE);
+}
+
+void Scene::addDraws(IndirectBatch & batch, const glm::mat4 & rootTransform, const glm::mat4 & view, const glm::mat4 & projectionMatrix,
+	float viewportHeight, const OcclusionCuller * pOcclusionCuller, int occlusionOwner)
+{
+	glm::mat4 viewProjection = projectionMatrix * view;
+
+	for (unsigned int node = 0; node < m_Parents.size(); node++)
+	{
+		const MeshRange& range = m_MeshRanges[node];
+		if (range.meshCount == 0)
+		{
+			continue;
+		}
+
+		glm::mat4 modelMatrix = rootTransform * m_WorldTransforms[node];
+		for (unsigned int i = range.firstMesh; i < range.firstMesh + range.meshCount; i++)
+		{
+			Mesh *pMesh = batch.getMeshCollection()->getMesh(m_NodeMeshes[i]);
+			if (pMesh == nullptr || !pMesh->isInFrustum(modelMatrix, viewProjection))
+			{
+				continue;
+			}
+			if (pOcclusionCuller && !pOcclusionCuller->isBoxVisible(pMesh->getBoundsMin(), pMesh->getBoundsMax(), modelMatrix, occlusionOwner))
+			{
+				continue;
+			}
+			batch.addDraw(m_NodeMeshes[i], pMesh->selectLOD(modelMatrix, view, projectionMatrix, viewportHeight), modelMatrix);
+		}
+	}
+}
+
+void Scene::clear()
+{
+	m_Parents.clear();
+	m_SubtreeSizes.clear();
+	m_LocalTransforms.clear();
+	m_WorldTransforms.clear();
+	m_MeshRanges.clear();
+	m_NodeMeshes.clear();
+	m_Dirty.clear();
+	m_Names.clear();
+	m_AnyDirty = false;
+}
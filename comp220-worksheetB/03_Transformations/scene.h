@@ -0,0 +1,91 @@
+#pragma once
+
+#include <assimp\scene.h>
+
+#include <string>
+#include <vector>
+
+#include <GL\glew.h>
+#include <SDL_opengl.h>
+
+#include <glm/glm.hpp>
+
+#include "Mesh.h"
+#include "occlusion.h"
+#include "indirect.h"
+
+//Range into the scene's node mesh list, the values in that list are indices into the MeshCollection
+struct MeshRange
+{
+	unsigned int firstMesh;
+	unsigned int meshCount;
+};
+
+//Flat node hierarchy imported from an aiScene
+//Nodes are stored depth first, so a parent always comes before its children and every
+//subtree is one contiguous block [node, node + subtreeSize)
+class Scene
+{
+public:
+	Scene();
+	~Scene();
+
+	void importNodes(const aiScene *scene);
+
+	//For hierarchies that don't come from Assimp, nodes have to be added depth first
+	//World transforms are filled in by the next updateWorldTransforms
+	int addNode(const std::string& name, int parent, const glm::mat4& localTransform, const unsigned int *pMeshes, unsigned int meshCount);
+
+	void setLocalTransform(int node, const glm::mat4& localTransform);
+	const glm::mat4& getLocalTransform(int node) const;
+	const glm::mat4& getWorldTransform(int node) const;
+
+	//Only recalculates the subtrees under nodes that have been changed since the last update
+	void updateWorldTransforms();
+
+	int findNode(const std::string& name) const;
+	int getParent(int node) const;
+	unsigned int getSubtreeSize(int node) const;
+	const std::string& getName(int node) const;
+	const MeshRange& getMeshRange(int node) const;
+	unsigned int getNodeMesh(unsigned int index) const;
+	unsigned int getNumberOfNodes() const;
+
+	void render(MeshCollection *pMeshCollection, GLint modelMatrixLocation, const glm::mat4& rootTransform);
+
+	//Same as above, but each mesh is frustum and meshlet culled and picks a LOD from its size on screen
+	//Meshes hidden behind the occluders are skipped when an occlusion culler is passed in, its frame has to be finished
+	//occlusionOwner is the owner given to this scene's own occluder instances, so they never hide it
+	void render(MeshCollection *pMeshCollection, GLint modelMatrixLocation, const glm::mat4& rootTransform,
+		const glm::mat4& view, const glm::mat4& projectionMatrix, float viewportHeight, const OcclusionCuller *pOcclusionCuller = nullptr,
+		int occlusionOwner = -1);
+
+	//Position only draw for shadow casters, meshes outside viewProjection's frustum are skipped
+	void renderDepth(MeshCollection *pMeshCollection, GLint modelMatrixLocation, const glm::mat4& rootTransform,
+		const glm::mat4& viewProjection, unsigned int lod);
+
+	//Depth pre-pass for the render above, draws the same meshes at the same LODs from the position only stream
+	void renderDepth(MeshCollection *pMeshCollection, GLint modelMatrixLocation, const glm::mat4& rootTransform,
+		const glm::mat4& view, const glm::mat4& projectionMatrix, float viewportHeight, const OcclusionCuller *pOcclusionCuller = nullptr,
+		int occlusionOwner = -1);
+	//Adds a draw to the batch for every visible mesh, with the same culling and LODs as render
+	//The batch's begin and submit are left to the caller so several scenes can share one batch
+	void addDraws(IndirectBatch& batch, const glm::mat4& rootTransform, const glm::mat4& view, const glm::mat4& projectionMatrix,
+		float viewportHeight, const OcclusionCuller *pOcclusionCuller = nullptr, int occlusionOwner = -1);
+	void clear();
+private:
+	int importNode(const aiNode *node, int parent);
+	void updateSubtree(int node);
+
+	std::vector<int> m_Parents;
+	std::vector<unsigned int> m_SubtreeSizes;
+	std::vector<glm::mat4> m_LocalTransforms;
+	std::vector<glm::mat4> m_WorldTransforms;
+	std::vector<MeshRange> m_MeshRanges;
+	std::vector<unsigned int> m_NodeMeshes;
+	std::vector<unsigned char> m_Dirty;
+	std::vector<std::string> m_Names;
+	bool m_AnyDirty;
+};
+
+glm::mat4 convertMatrix(const aiMatrix4x4& matrix);
@@ -1,4 +1,6 @@
 #include "shader.h"
+#include "gpumemory.h"
+#include "archive.h"
 
 
 GLuint LoadShaders(const char * vertex_file_path, const char * fragment_file_path) {
@@ -7,14 +9,11 @@ GLuint LoadShaders(const char * vertex_file_path, const char * fragment_file_pat
 	GLuint VertexShaderID = glCreateShader(GL_VERTEX_SHADER);
 	GLuint FragmentShaderID = glCreateShader(GL_FRAGMENT_SHADER);
 
-	// Read the Vertex Shader code from the file
+	// Read the Vertex Shader code from the asset archive or the file
+	std::vector<unsigned char> ShaderData;
 	std::string VertexShaderCode;
-	std::ifstream VertexShaderStream(vertex_file_path, std::ios::in);
-	if (VertexShaderStream.is_open()) {
-		std::string Line = "";
-		while (getline(VertexShaderStream, Line))
-			VertexShaderCode += "\n" + Line;
-		VertexShaderStream.close();
+	if (readAsset(vertex_file_path, ShaderData)) {
+		VertexShaderCode.assign(ShaderData.begin(), ShaderData.end());
 	}
 
 	else {
@@ -23,14 +22,10 @@ GLuint LoadShaders(const char * vertex_file_path, const char * fragment_file_pat
 		return 0;
 	}
 
-	// Read the Fragment Shader code from the file
+	// Read the Fragment Shader code from the asset archive or the file
 	std::string FragmentShaderCode;
-	std::ifstream FragmentShaderStream(fragment_file_path, std::ios::in);
-	if (FragmentShaderStream.is_open()) {
-		std::string Line = "";
-		while (getline(FragmentShaderStream, Line))
-			FragmentShaderCode += "\n" + Line;
-		FragmentShaderStream.close();
+	if (readAsset(fragment_file_path, ShaderData)) {
+		FragmentShaderCode.assign(ShaderData.begin(), ShaderData.end());
 	}
 
 	GLint Result = GL_FALSE;
@@ -88,5 +83,17 @@ GLuint LoadShaders(const char * vertex_file_path, const char * fragment_file_pat
 	glDeleteShader(VertexShaderID);
 	glDeleteShader(FragmentShaderID);
 
+	// The binary length is the closest thing to a size the driver will report
+	GLint BinaryLength = 0;
+	if (GLEW_VERSION_4_1 || GLEW_ARB_get_program_binary) {
+		glGetProgramiv(ProgramID, GL_PROGRAM_BINARY_LENGTH, &BinaryLength);
+	}
+	getGPUMemory().trackProgram(ProgramID, BinaryLength);
+
 	return ProgramID;
+}
+
+void DeleteShaders(GLuint ProgramID) {
+	getGPUMemory().untrackProgram(ProgramID);
+	glDeleteProgram(ProgramID);
 }
\ No newline at end of file
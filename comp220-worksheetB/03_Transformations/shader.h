@@ -10,4 +10,7 @@
 
 GLuint LoadShaders(const char * vertex_file_path, const char * fragment_file_path);
 
+//Deletes a program from LoadShaders and stops counting its memory
+void DeleteShaders(GLuint ProgramID);
+
 
@@ -0,0 +1,173 @@
+#include "shadows.h"
+#include "gpumemory.h"
+
+#include <cmath>
+#include <cstdio>
+
+#include <glm/gtc/matrix_transform.hpp>
+#include <glm/gtc/type_ptr.hpp>
+
+//How far behind a cascade casters are still picked up, towards the light
+static const float casterDistance = 50.0f;
+
+ShadowCascades::ShadowCascades()
+{
+	m_Framebuffer = 0;
+	m_DepthTexture = 0;
+	for (unsigned int i = 0; i < SHADOW_CASCADES; i++)
+	{
+		m_LightViews[i] = glm::mat4(1.0f);
+		m_LightProjections[i] = glm::mat4(1.0f);
+		m_LightViewProjections[i] = glm::mat4(1.0f);
+		m_SplitDepths[i] = 0.0f;
+	}
+}
+
+ShadowCascades::~ShadowCascades()
+{
+}
+
+bool ShadowCascades::init()
+{
+	glGenTextures(1, &m_DepthTexture);
+	glBindTexture(GL_TEXTURE_2D_ARRAY, m_DepthTexture);
+	glTexImage3D(GL_TEXTURE_2D_ARRAY, 0, GL_DEPTH_COMPONENT32F, SHADOW_MAP_SIZE, SHADOW_MAP_SIZE, SHADOW_CASCADES, 0, GL_DEPTH_COMPONENT, GL_FLOAT, nullptr);
+	getGPUMemory().trackTexture(m_DepthTexture, (size_t)SHADOW_MAP_SIZE * SHADOW_MAP_SIZE * SHADOW_CASCADES * sizeof(float));
+
+	//Hardware comparison with linear filtering gives 2x2 PCF for free
+	glTexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+	glTexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+	glTexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+	glTexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+	glTexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_COMPARE_MODE, GL_COMPARE_REF_TO_TEXTURE);
+	glTexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_COMPARE_FUNC, GL_LEQUAL);
+	glBindTexture(GL_TEXTURE_2D_ARRAY, 0);
+
+	glGenFramebuffers(1, &m_Framebuffer);
+	glBindFramebuffer(GL_FRAMEBUFFER, m_Framebuffer);
+	glFramebufferTextureLayer(GL_FRAMEBUFFER, GL_DEPTH_ATTACHMENT, m_DepthTexture, 0, 0);
+	glDrawBuffer(GL_NONE);
+	glReadBuffer(GL_NONE);
+
+	GLenum status = glCheckFramebufferStatus(GL_FRAMEBUFFER);
+	glBindFramebuffer(GL_FRAMEBUFFER, 0);
+	if (status != GL_FRAMEBUFFER_COMPLETE)
+	{
+		printf("Shadow map framebuffer is incomplete - %x\n", status);
+		return false;
+	}
+	return true;
+}
+
+void ShadowCascades::destroy()
+{
+	glDeleteFramebuffers(1, &m_Framebuffer);
+	getGPUMemory().untrackTexture(m_DepthTexture);
+	glDeleteTextures(1, &m_DepthTexture);
+	m_Framebuffer = 0;
+	m_DepthTexture = 0;
+}
+
+void ShadowCascades::update(const glm::mat4 & view, const glm::mat4 & projectionMatrix, const glm::vec3 & lightDirection, float maxDistance, float lambda)
+{
+	float nearPlane = projectionMatrix[3][2] / (projectionMatrix[2][2] - 1.0f);
+	float farPlane = glm::min(projectionMatrix[3][2] / (projectionMatrix[2][2] + 1.0f), maxDistance);
+	float tanHalfFovX = 1.0f / projectionMatrix[0][0];
+	float tanHalfFovY = 1.0f / projectionMatrix[1][1];
+	glm::mat4 inverseView = glm::inverse(view);
+
+	//Every cascade shares one light rotation, only the ortho box moves, so snapping the box to texels is enough
+	glm::vec3 lightForward = -glm::normalize(lightDirection);
+	glm::vec3 up = fabsf(lightForward.y) > 0.99f ? glm::vec3(0.0f, 0.0f, 1.0f) : glm::vec3(0.0f, 1.0f, 0.0f);
+	glm::mat4 lightRotation = glm::lookAt(glm::vec3(0.0f), lightForward, up);
+
+	float splitNear = nearPlane;
+	for (unsigned int cascade = 0; cascade < SHADOW_CASCADES; cascade++)
+	{
+		//Practical split scheme, a blend of logarithmic and even splits
+		float fraction = (float)(cascade + 1) / SHADOW_CASCADES;
+		float logSplit = nearPlane * powf(farPlane / nearPlane, fraction);
+		float evenSplit = nearPlane + (farPlane - nearPlane) * fraction;
+		float splitFar = lambda * logSplit + (1.0f - lambda) * evenSplit;
+		m_SplitDepths[cascade] = splitFar;
+
+		//Slice corners in world space
+		glm::vec3 corners[8];
+		for (int corner = 0; corner < 8; corner++)
+		{
+			float depth = (corner & 4) ? splitFar : splitNear;
+			float x = ((corner & 1) ? 1.0f : -1.0f) * tanHalfFovX * depth;
+			float y = ((corner & 2) ? 1.0f : -1.0f) * tanHalfFovY * depth;
+			corners[corner] = glm::vec3(inverseView * glm::vec4(x, y, -depth, 1.0f));
+		}
+
+		//A bounding sphere keeps the box the same size however the camera turns, which stops the edges swimming
+		glm::vec3 centre = glm::vec3(0.0f);
+		for (int corner = 0; corner < 8; corner++)
+		{
+			centre += corners[corner];
+		}
+		centre /= 8.0f;
+		float radius = 0.0f;
+		for (int corner = 0; corner < 8; corner++)
+		{
+			radius = glm::max(radius, glm::distance(centre, corners[corner]));
+		}
+		radius = ceilf(radius * 16.0f) / 16.0f;
+
+		//Snap the centre to whole texels in light space so the map only ever moves by a texel
+		float texelSize = 2.0f * radius / SHADOW_MAP_SIZE;
+		glm::vec3 lightCentre = glm::vec3(lightRotation * glm::vec4(centre, 1.0f));
+		lightCentre.x = floorf(lightCentre.x / texelSize) * texelSize;
+		lightCentre.y = floorf(lightCentre.y / texelSize) * texelSize;
+
+		m_LightViews[cascade] = lightRotation;
+		m_LightProjections[cascade] = glm::ortho(lightCentre.x - radius, lightCentre.x + radius, lightCentre.y - radius, lightCentre.y + radius,
+			-lightCentre.z - radius - casterDistance, -lightCentre.z + radius);
+		m_LightViewProjections[cascade] = m_LightProjections[cascade] * m_LightViews[cascade];
+
+		splitNear = splitFar;
+	}
+}
+
+void ShadowCascades::beginCascade(unsigned int cascade)
+{
+	glBindFramebuffer(GL_FRAMEBUFFER, m_Framebuffer);
+	glFramebufferTextureLayer(GL_FRAMEBUFFER, GL_DEPTH_ATTACHMENT, m_DepthTexture, 0, cascade);
+	glViewport(0, 0, SHADOW_MAP_SIZE, SHADOW_MAP_SIZE);
+	glClear(GL_DEPTH_BUFFER_BIT);
+}
+
+void ShadowCascades::endCascades(int viewportWidth, int viewportHeight)
+{
+	glBindFramebuffer(GL_FRAMEBUFFER, 0);
+	glViewport(0, 0, viewportWidth, viewportHeight);
+}
+
+const glm::mat4 & ShadowCascades::getLightView(unsigned int cascade)
+{
+	return m_LightViews[cascade];
+}
+
+const glm::mat4 & ShadowCascades::getLightProjection(unsigned int cascade)
+{
+	return m_LightProjections[cascade];
+}
+
+const glm::mat4 & ShadowCascades::getLightViewProjection(unsigned int cascade)
+{
+	return m_LightViewProjections[cascade];
+}
+
+void ShadowCascades::bind(GLuint textureUnit)
+{
+	glActiveTexture(GL_TEXTURE0 + textureUnit);
+	glBindTexture(GL_TEXTURE_2D_ARRAY, m_DepthTexture);
+	glActiveTexture(GL_TEXTURE0);
+}
+
+void ShadowCascades::setUniforms(GLint shadowMatricesLocation, GLint cascadeSplitsLocation)
+{
+	glUniformMatrix4fv(shadowMatricesLocation, SHADOW_CASCADES, GL_FALSE, glm::value_ptr(m_LightViewProjections[0]));
+	glUniform1fv(cascadeSplitsLocation, SHADOW_CASCADES, m_SplitDepths);
+}
@@ -0,0 +1,46 @@
+#pragma once
+
+#include <GL\glew.h>
+#include <SDL_opengl.h>
+
+#include <glm/glm.hpp>
+
+//Has to match shadowCascades in blinnPhongClusteredFrag.glsl
+#define SHADOW_CASCADES 4
+#define SHADOW_MAP_SIZE 2048
+
+//Cascaded shadow maps for one directional light, every cascade is a layer of one depth texture array
+class ShadowCascades
+{
+public:
+	ShadowCascades();
+	~ShadowCascades();
+
+	bool init();
+	void destroy();
+
+	//Splits the camera frustum up to maxDistance, lambda blends between even (0) and logarithmic (1) splits
+	//lightDirection points towards the light, the same as the lightDirection uniform
+	void update(const glm::mat4& view, const glm::mat4& projectionMatrix, const glm::vec3& lightDirection, float maxDistance, float lambda);
+
+	//Binds the cascade's layer for drawing, endCascades goes back to the default framebuffer
+	void beginCascade(unsigned int cascade);
+	void endCascades(int viewportWidth, int viewportHeight);
+
+	const glm::mat4& getLightView(unsigned int cascade);
+	const glm::mat4& getLightProjection(unsigned int cascade);
+	const glm::mat4& getLightViewProjection(unsigned int cascade);
+
+	void bind(GLuint textureUnit);
+	void setUniforms(GLint shadowMatricesLocation, GLint cascadeSplitsLocation);
+private:
+	GLuint m_Framebuffer;
+	GLuint m_DepthTexture;
+
+	glm::mat4 m_LightViews[SHADOW_CASCADES];
+	glm::mat4 m_LightProjections[SHADOW_CASCADES];
+	glm::mat4 m_LightViewProjections[SHADOW_CASCADES];
+
+	//View space depth where each cascade ends
+	float m_SplitDepths[SHADOW_CASCADES];
+};
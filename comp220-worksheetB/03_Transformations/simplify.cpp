@@ -0,0 +1,472 @@
+#include "simplify.h"
+
+#include <algorithm>
+#include <cmath>
+#include <map>
+#include <queue>
+#include <tuple>
+
+#include <glm/glm.hpp>
+
+//Symmetric 4x4 matrix stored as its 10 unique values
+struct Quadric
+{
+	double a2, ab, ac, ad, b2, bc, bd, c2, cd, d2;
+};
+
+static Quadric makePlaneQuadric(const glm::dvec3& normal, double distance, double weight)
+{
+	Quadric quadric;
+	quadric.a2 = normal.x * normal.x * weight;
+	quadric.ab = normal.x * normal.y * weight;
+	quadric.ac = normal.x * normal.z * weight;
+	quadric.ad = normal.x * distance * weight;
+	quadric.b2 = normal.y * normal.y * weight;
+	quadric.bc = normal.y * normal.z * weight;
+	quadric.bd = normal.y * distance * weight;
+	quadric.c2 = normal.z * normal.z * weight;
+	quadric.cd = normal.z * distance * weight;
+	quadric.d2 = distance * distance * weight;
+	return quadric;
+}
+
+static void addQuadric(Quadric& result, const Quadric& other)
+{
+	result.a2 += other.a2; result.ab += other.ab; result.ac += other.ac; result.ad += other.ad;
+	result.b2 += other.b2; result.bc += other.bc; result.bd += other.bd;
+	result.c2 += other.c2; result.cd += other.cd;
+	result.d2 += other.d2;
+}
+
+//v^T Q v with v = (x, y, z, 1)
+static double evaluateQuadric(const Quadric& quadric, const glm::dvec3& position)
+{
+	double x = position.x, y = position.y, z = position.z;
+	double error = quadric.a2 * x * x + 2.0 * quadric.ab * x * y + 2.0 * quadric.ac * x * z + 2.0 * quadric.ad * x
+		+ quadric.b2 * y * y + 2.0 * quadric.bc * y * z + 2.0 * quadric.bd * y
+		+ quadric.c2 * z * z + 2.0 * quadric.cd * z
+		+ quadric.d2;
+	return error > 0.0 ? error : 0.0;
+}
+
+struct Collapse
+{
+	double cost;
+	unsigned int from;
+	unsigned int to;
+	unsigned int fromVersion;
+	unsigned int toVersion;
+
+	bool operator>(const Collapse& other) const
+	{
+		return cost > other.cost;
+	}
+};
+
+//Boundary edges get a plane perpendicular to the face so open edges don't shrink away
+static const double boundaryWeight = 10.0;
+
+float simplifyMesh(const Vertex * pVerts, unsigned int numberOfVerts, const unsigned int * pIndices, unsigned int numberOfIndices,
+	unsigned int targetNumberOfIndices, std::vector<unsigned int>& simplifiedIndices)
+{
+	simplifiedIndices.assign(pIndices, pIndices + numberOfIndices);
+	unsigned int numberOfTriangles = numberOfIndices / 3;
+	if (targetNumberOfIndices >= numberOfIndices || numberOfTriangles == 0)
+	{
+		return 0.0f;
+	}
+
+	//Weld vertices by position, UV and normal seams would otherwise split the mesh into islands
+	std::vector<unsigned int> weldedVertex(numberOfVerts);
+	std::vector<unsigned int> representative;
+	std::vector<glm::dvec3> positions;
+	std::map<std::tuple<float, float, float>, unsigned int> positionLookup;
+	for (unsigned int v = 0; v < numberOfVerts; v++)
+	{
+		std::tuple<float, float, float> key(pVerts[v].x, pVerts[v].y, pVerts[v].z);
+		auto iter = positionLookup.find(key);
+		if (iter == positionLookup.end())
+		{
+			unsigned int welded = positions.size();
+			positionLookup[key] = welded;
+			representative.push_back(v);
+			positions.push_back(glm::dvec3(pVerts[v].x, pVerts[v].y, pVerts[v].z));
+			weldedVertex[v] = welded;
+		}
+		else
+		{
+			weldedVertex[v] = iter->second;
+		}
+	}
+	unsigned int numberOfWelded = positions.size();
+
+	//Corners keep their original vertex until the welded vertex they belong to collapses, then take
+	//the vertex of the new position on the same side of any seam
+	std::vector<unsigned int>& corners = simplifiedIndices;
+	std::vector<unsigned int> weldedCorners(numberOfTriangles * 3);
+	std::vector<unsigned char> triangleAlive(numberOfTriangles, 1);
+	std::vector<std::vector<unsigned int>> vertexTriangles(numberOfWelded);
+	std::vector<Quadric> quadrics(numberOfWelded, Quadric());
+
+	unsigned int liveTriangles = 0;
+	for (unsigned int t = 0; t < numberOfTriangles; t++)
+	{
+		unsigned int a = weldedVertex[corners[t * 3 + 0]];
+		unsigned int b = weldedVertex[corners[t * 3 + 1]];
+		unsigned int c = weldedVertex[corners[t * 3 + 2]];
+		weldedCorners[t * 3 + 0] = a;
+		weldedCorners[t * 3 + 1] = b;
+		weldedCorners[t * 3 + 2] = c;
+
+		if (a == b || b == c || a == c)
+		{
+			triangleAlive[t] = 0;
+			continue;
+		}
+		liveTriangles++;
+
+		vertexTriangles[a].push_back(t);
+		vertexTriangles[b].push_back(t);
+		vertexTriangles[c].push_back(t);
+
+		//Face plane weighted by area
+		glm::dvec3 normal = glm::cross(positions[b] - positions[a], positions[c] - positions[a]);
+		double length = glm::length(normal);
+		if (length <= 0.0)
+		{
+			continue;
+		}
+		normal /= length;
+		Quadric plane = makePlaneQuadric(normal, -glm::dot(normal, positions[a]), length * 0.5);
+		addQuadric(quadrics[a], plane);
+		addQuadric(quadrics[b], plane);
+		addQuadric(quadrics[c], plane);
+	}
+
+	//Count how many triangles use each edge to find the boundaries and the unique edges
+	std::map<std::pair<unsigned int, unsigned int>, unsigned int> edgeTriangles;
+	for (unsigned int t = 0; t < numberOfTriangles; t++)
+	{
+		if (!triangleAlive[t])
+		{
+			continue;
+		}
+		for (int e = 0; e < 3; e++)
+		{
+			unsigned int a = weldedCorners[t * 3 + e];
+			unsigned int b = weldedCorners[t * 3 + (e + 1) % 3];
+			edgeTriangles[std::make_pair(std::min(a, b), std::max(a, b))]++;
+		}
+	}
+	for (unsigned int t = 0; t < numberOfTriangles; t++)
+	{
+		if (!triangleAlive[t])
+		{
+			continue;
+		}
+		const glm::dvec3& p0 = positions[weldedCorners[t * 3 + 0]];
+		glm::dvec3 faceNormal = glm::cross(positions[weldedCorners[t * 3 + 1]] - p0, positions[weldedCorners[t * 3 + 2]] - p0);
+		for (int e = 0; e < 3; e++)
+		{
+			unsigned int a = weldedCorners[t * 3 + e];
+			unsigned int b = weldedCorners[t * 3 + (e + 1) % 3];
+			if (edgeTriangles[std::make_pair(std::min(a, b), std::max(a, b))] != 1)
+			{
+				continue;
+			}
+			glm::dvec3 edge = positions[b] - positions[a];
+			glm::dvec3 normal = glm::cross(edge, faceNormal);
+			double length = glm::length(normal);
+			if (length <= 0.0)
+			{
+				continue;
+			}
+			normal /= length;
+			Quadric plane = makePlaneQuadric(normal, -glm::dot(normal, positions[a]), glm::dot(edge, edge) * boundaryWeight);
+			addQuadric(quadrics[a], plane);
+			addQuadric(quadrics[b], plane);
+		}
+	}
+
+	std::vector<unsigned int> versions(numberOfWelded, 0);
+	std::vector<unsigned char> vertexAlive(numberOfWelded, 1);
+	std::priority_queue<Collapse, std::vector<Collapse>, std::greater<Collapse>> collapses;
+
+	//Picks the cheaper direction to collapse the edge in
+	auto pushCollapse = [&](unsigned int a, unsigned int b)
+	{
+		Quadric combined = quadrics[a];
+		addQuadric(combined, quadrics[b]);
+		double costToB = evaluateQuadric(combined, positions[b]);
+		double costToA = evaluateQuadric(combined, positions[a]);
+
+		Collapse collapse;
+		if (costToB <= costToA)
+		{
+			collapse.cost = costToB; collapse.from = a; collapse.to = b;
+		}
+		else
+		{
+			collapse.cost = costToA; collapse.from = b; collapse.to = a;
+		}
+		collapse.fromVersion = versions[collapse.from];
+		collapse.toVersion = versions[collapse.to];
+		collapses.push(collapse);
+	};
+
+	for (auto& edge : edgeTriangles)
+	{
+		pushCollapse(edge.first.first, edge.first.second);
+	}
+
+	double lastError = 0.0;
+	std::vector<unsigned int> neighbours;
+	std::vector<std::pair<unsigned int, unsigned int>> seamPairs;
+	//Collapses that would tear a seam wait here until nothing else can collapse
+	std::priority_queue<Collapse, std::vector<Collapse>, std::greater<Collapse>> seamCollapses;
+	while (liveTriangles * 3 > targetNumberOfIndices && (!collapses.empty() || !seamCollapses.empty()))
+	{
+		bool deferred = collapses.empty();
+		std::priority_queue<Collapse, std::vector<Collapse>, std::greater<Collapse>>& queue = deferred ? seamCollapses : collapses;
+		Collapse collapse = queue.top();
+		queue.pop();
+
+		unsigned int from = collapse.from;
+		unsigned int to = collapse.to;
+		if (!vertexAlive[from] || !vertexAlive[to] || versions[from] != collapse.fromVersion || versions[to] != collapse.toVersion)
+		{
+			continue;
+		}
+
+		//A position split by a UV or normal seam has a vertex for each side of it. The triangles on the
+		//collapsing edge pair each vertex of "from" with the vertex of "to" on the same side, so moved
+		//corners keep their seam rather than all taking the attributes of one vertex
+		seamPairs.clear();
+		for (unsigned int t : vertexTriangles[from])
+		{
+			if (!triangleAlive[t])
+			{
+				continue;
+			}
+			int fromCorner = -1, toCorner = -1;
+			for (int k = 0; k < 3; k++)
+			{
+				if (weldedCorners[t * 3 + k] == from)
+				{
+					fromCorner = k;
+				}
+				else if (weldedCorners[t * 3 + k] == to)
+				{
+					toCorner = k;
+				}
+			}
+			if (fromCorner >= 0 && toCorner >= 0)
+			{
+				seamPairs.push_back(std::make_pair(corners[t * 3 + fromCorner], corners[t * 3 + toCorner]));
+			}
+		}
+		auto seamPartner = [&](unsigned int vertex)
+		{
+			for (auto& pair : seamPairs)
+			{
+				if (pair.first == vertex)
+				{
+					return pair.second;
+				}
+			}
+			return ~0u;
+		};
+
+		//A vertex of "from" with no partner is on a side of a seam the edge doesn't reach, moving it
+		//would stretch that side's attributes over the other
+		if (!deferred)
+		{
+			bool tearsSeam = false;
+			for (unsigned int t : vertexTriangles[from])
+			{
+				for (int k = 0; k < 3 && triangleAlive[t]; k++)
+				{
+					if (weldedCorners[t * 3 + k] == from && seamPartner(corners[t * 3 + k]) == ~0u)
+					{
+						tearsSeam = true;
+					}
+				}
+			}
+			if (tearsSeam)
+			{
+				seamCollapses.push(collapse);
+				continue;
+			}
+		}
+
+		auto movedCorner = [&](unsigned int t, int corner)
+		{
+			unsigned int partner = seamPartner(corners[t * 3 + corner]);
+			if (partner != ~0u)
+			{
+				return partner;
+			}
+
+			//Off the edge, a triangle around "to" that shares one of this triangle's other vertices is on its side
+			unsigned int next = corners[t * 3 + (corner + 1) % 3];
+			unsigned int previous = corners[t * 3 + (corner + 2) % 3];
+			for (unsigned int other : vertexTriangles[to])
+			{
+				if (!triangleAlive[other])
+				{
+					continue;
+				}
+				const unsigned int *pOther = &corners[other * 3];
+				for (int k = 0; k < 3; k++)
+				{
+					if (weldedCorners[other * 3 + k] == to && (pOther[(k + 1) % 3] == next || pOther[(k + 2) % 3] == next ||
+						pOther[(k + 1) % 3] == previous || pOther[(k + 2) % 3] == previous))
+					{
+						return pOther[k];
+					}
+				}
+			}
+			return representative[to];
+		};
+
+		//Reject collapses that would flip a triangle that survives them
+		bool flips = false;
+		for (unsigned int t : vertexTriangles[from])
+		{
+			if (!triangleAlive[t])
+			{
+				continue;
+			}
+			unsigned int *pCorners = &weldedCorners[t * 3];
+			if (pCorners[0] == to || pCorners[1] == to || pCorners[2] == to)
+			{
+				continue;
+			}
+
+			glm::dvec3 before[3], after[3];
+			for (int k = 0; k < 3; k++)
+			{
+				before[k] = positions[pCorners[k]];
+				after[k] = pCorners[k] == from ? positions[to] : before[k];
+			}
+			glm::dvec3 normalBefore = glm::cross(before[1] - before[0], before[2] - before[0]);
+			glm::dvec3 normalAfter = glm::cross(after[1] - after[0], after[2] - after[0]);
+			if (glm::dot(normalBefore, normalAfter) <= 0.0)
+			{
+				flips = true;
+				break;
+			}
+		}
+		if (flips)
+		{
+			continue;
+		}
+
+		//Move every triangle from "from" over to "to", dropping the ones that become degenerate
+		for (unsigned int t : vertexTriangles[from])
+		{
+			if (!triangleAlive[t])
+			{
+				continue;
+			}
+			unsigned int *pCorners = &weldedCorners[t * 3];
+			for (int k = 0; k < 3; k++)
+			{
+				if (pCorners[k] == from)
+				{
+					pCorners[k] = to;
+					corners[t * 3 + k] = movedCorner(t, k);
+				}
+			}
+			if (pCorners[0] == pCorners[1] || pCorners[1] == pCorners[2] || pCorners[0] == pCorners[2])
+			{
+				triangleAlive[t] = 0;
+				liveTriangles--;
+			}
+			else
+			{
+				vertexTriangles[to].push_back(t);
+			}
+		}
+		vertexTriangles[from].clear();
+		vertexAlive[from] = 0;
+		addQuadric(quadrics[to], quadrics[from]);
+		versions[to]++;
+		lastError = collapse.cost;
+
+		//Requeue the edges around the merged vertex with the new quadric
+		neighbours.clear();
+		std::vector<unsigned int>& triangles = vertexTriangles[to];
+		unsigned int kept = 0;
+		for (unsigned int i = 0; i < triangles.size(); i++)
+		{
+			unsigned int t = triangles[i];
+			if (!triangleAlive[t])
+			{
+				continue;
+			}
+			triangles[kept++] = t;
+			for (int k = 0; k < 3; k++)
+			{
+				unsigned int other = weldedCorners[t * 3 + k];
+				if (other != to)
+				{
+					neighbours.push_back(other);
+				}
+			}
+		}
+		triangles.resize(kept);
+		std::sort(neighbours.begin(), neighbours.end());
+		neighbours.erase(std::unique(neighbours.begin(), neighbours.end()), neighbours.end());
+		for (unsigned int other : neighbours)
+		{
+			pushCollapse(to, other);
+		}
+	}
+
+	//Write out the survivors in their original order
+	unsigned int written = 0;
+	for (unsigned int t = 0; t < numberOfTriangles; t++)
+	{
+		if (!triangleAlive[t])
+		{
+			continue;
+		}
+		simplifiedIndices[written++] = corners[t * 3 + 0];
+		simplifiedIndices[written++] = corners[t * 3 + 1];
+		simplifiedIndices[written++] = corners[t * 3 + 2];
+	}
+	simplifiedIndices.resize(written);
+
+	return (float)sqrt(lastError);
+}
+
+void generateLODs(const Vertex * pVerts, unsigned int numberOfVerts, const std::vector<unsigned int>& indices,
+	unsigned int maxLODs, std::vector<std::vector<unsigned int>>& lodIndices)
+{
+	lodIndices.clear();
+	lodIndices.push_back(indices);
+
+	//Small meshes aren't worth simplifying
+	const unsigned int minimumNumberOfIndices = 32 * 3;
+
+	std::vector<unsigned int> simplified;
+	while (lodIndices.size() < maxLODs)
+	{
+		const std::vector<unsigned int>& previous = lodIndices.back();
+		unsigned int target = (previous.size() / 2) / 3 * 3;
+		if (target < minimumNumberOfIndices)
+		{
+			break;
+		}
+
+		simplifyMesh(pVerts, numberOfVerts, previous.data(), previous.size(), target, simplified);
+
+		//Stop when the simplifier gets stuck, another LOD with nearly the same triangles is a waste
+		if (simplified.size() * 10 > previous.size() * 9)
+		{
+			break;
+		}
+		lodIndices.push_back(simplified);
+	}
+}
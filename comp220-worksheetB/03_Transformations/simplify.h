@@ -0,0 +1,18 @@
+#pragma once
+
+#include <vector>
+
+#include "vertex.h"
+
+//Quadric error metric edge collapse (Garland and Heckbert)
+//Vertices with the same position are welded while simplifying, edges collapse onto one of their
+//existing end points so the result is just a new index list into the original vertex buffer
+//Collapses that would tear a UV or normal seam are put off until nothing else can collapse
+//Returns the error of the last collapse, 0 if nothing was removed
+float simplifyMesh(const Vertex *pVerts, unsigned int numberOfVerts, const unsigned int *pIndices, unsigned int numberOfIndices,
+	unsigned int targetNumberOfIndices, std::vector<unsigned int>& simplifiedIndices);
+
+//Builds up to maxLODs index lists, each roughly half the triangles of the one before
+//lodIndices[0] is the original index list
+void generateLODs(const Vertex *pVerts, unsigned int numberOfVerts, const std::vector<unsigned int>& indices,
+	unsigned int maxLODs, std::vector<std::vector<unsigned int>>& lodIndices);
@@ -0,0 +1,47 @@
+#version 330 core
+
+layout(location = 0) in vec3 vertexPosition;
+layout(location = 1) in vec4 vertexColours;
+layout(location=2) in vec2 vertexTextureCoord;
+layout(location=3) in vec3 vertexNormals;
+layout(location=6) in uvec4 jointIndices;
+layout(location=7) in vec4 jointWeights;
+
+//Has to match MAX_SHADER_JOINTS in animation.h
+const int maxJoints=64;
+
+uniform mat4 modelMatrix;
+uniform mat4 viewMatrix;
+uniform mat4 projectionMatrix;
+uniform mat4 jointMatrices[maxJoints];
+
+out vec4 vertexColoursOut;
+out vec2 vertexTextureCoordOut;
+out vec3 vertexNormalsOut;
+out vec3 worldPositionOut;
+out float viewDepthOut;
+
+void main(){
+
+	//Blend the joint matrices by the vertex weights
+	mat4 skinMatrix=jointMatrices[jointIndices.x]*jointWeights.x
+		+jointMatrices[jointIndices.y]*jointWeights.y
+		+jointMatrices[jointIndices.z]*jointWeights.z
+		+jointMatrices[jointIndices.w]*jointWeights.w;
+
+	vec4 skinnedPosition=skinMatrix*vec4(vertexPosition,1.0f);
+	vec4 skinnedNormal=skinMatrix*vec4(vertexNormals,0.0f);
+
+	vec4 worldPosition=modelMatrix*skinnedPosition;
+	vec4 viewPosition=viewMatrix*worldPosition;
+
+	vertexColoursOut=vertexColours;
+	vertexTextureCoordOut=vertexTextureCoord;
+	vertexNormalsOut=normalize(modelMatrix*skinnedNormal).xyz;
+
+	//Used by the clustered fragment shader
+	worldPositionOut=worldPosition.xyz;
+	viewDepthOut=-viewPosition.z;
+
+	gl_Position=projectionMatrix*viewPosition;
+}
\ No newline at end of file
@@ -0,0 +1,170 @@
+#include "streambuffer.h"
+#include "gpumemory.h"
+
+#include <cstdio>
+
+StreamBuffer::StreamBuffer()
+{
+	m_Target = GL_ARRAY_BUFFER;
+	m_Buffer = 0;
+	m_SegmentSize = 0;
+	m_Persistent = false;
+	m_pMapped = nullptr;
+	for (unsigned int i = 0; i < STREAM_BUFFER_SEGMENTS; i++)
+	{
+		m_Fences[i] = 0;
+	}
+	m_Segment = 0;
+	m_FrameStarted = false;
+	m_Head = 0;
+}
+
+StreamBuffer::~StreamBuffer()
+{
+}
+
+bool StreamBuffer::init(GLenum target, GLsizeiptr segmentSize)
+{
+	m_Target = target;
+	m_SegmentSize = segmentSize;
+	GLsizeiptr totalSize = segmentSize * STREAM_BUFFER_SEGMENTS;
+
+	glGenBuffers(1, &m_Buffer);
+	glBindBuffer(m_Target, m_Buffer);
+
+	m_Persistent = GLEW_VERSION_4_4 || GLEW_ARB_buffer_storage;
+	if (m_Persistent)
+	{
+		GLbitfield flags = GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT;
+		glBufferStorage(m_Target, totalSize, nullptr, flags);
+		m_pMapped = (unsigned char*)glMapBufferRange(m_Target, 0, totalSize, flags);
+		if (m_pMapped == nullptr)
+		{
+			printf("Stream buffer persistent mapping failed\n");
+			glBindBuffer(m_Target, 0);
+			return false;
+		}
+	}
+	else
+	{
+		glBufferData(m_Target, totalSize, nullptr, GL_STREAM_DRAW);
+	}
+	glBindBuffer(m_Target, 0);
+	getGPUMemory().trackBuffer(m_Buffer, totalSize);
+
+	//Starts on the last segment so the first beginFrame lands on segment 0
+	m_Segment = STREAM_BUFFER_SEGMENTS - 1;
+	return true;
+}
+
+void StreamBuffer::destroy()
+{
+	submit();
+	for (unsigned int i = 0; i < STREAM_BUFFER_SEGMENTS; i++)
+	{
+		if (m_Fences[i])
+		{
+			glDeleteSync(m_Fences[i]);
+			m_Fences[i] = 0;
+		}
+	}
+	if (m_Persistent && m_pMapped)
+	{
+		glBindBuffer(m_Target, m_Buffer);
+		glUnmapBuffer(m_Target);
+		glBindBuffer(m_Target, 0);
+	}
+	m_pMapped = nullptr;
+	getGPUMemory().untrackBuffer(m_Buffer);
+	glDeleteBuffers(1, &m_Buffer);
+	m_Buffer = 0;
+	m_FrameStarted = false;
+}
+
+void StreamBuffer::beginFrame()
+{
+	//Everything that read last frame's segment has already been sent, so a fence now covers all of it
+	if (m_FrameStarted)
+	{
+		submit();
+		m_Fences[m_Segment] = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+	}
+	m_Segment = (m_Segment + 1) % STREAM_BUFFER_SEGMENTS;
+
+	//Only stalls if the CPU is a whole ring ahead of the GPU
+	if (m_Fences[m_Segment])
+	{
+		GLenum result = glClientWaitSync(m_Fences[m_Segment], GL_SYNC_FLUSH_COMMANDS_BIT, 0);
+		while (result == GL_TIMEOUT_EXPIRED)
+		{
+			result = glClientWaitSync(m_Fences[m_Segment], GL_SYNC_FLUSH_COMMANDS_BIT, 1000000);
+		}
+		glDeleteSync(m_Fences[m_Segment]);
+		m_Fences[m_Segment] = 0;
+	}
+
+	if (!m_Persistent)
+	{
+		//Safe to skip the driver's synchronisation, the fence above already did it
+		glBindBuffer(m_Target, m_Buffer);
+		m_pMapped = (unsigned char*)glMapBufferRange(m_Target, m_Segment * m_SegmentSize, m_SegmentSize,
+			GL_MAP_WRITE_BIT | GL_MAP_UNSYNCHRONIZED_BIT | GL_MAP_INVALIDATE_RANGE_BIT);
+		glBindBuffer(m_Target, 0);
+	}
+
+	m_Head = 0;
+	m_FrameStarted = true;
+}
+
+void * StreamBuffer::allocate(GLsizeiptr size, GLsizeiptr alignment, GLintptr & offset)
+{
+	if (m_pMapped == nullptr || !m_FrameStarted)
+	{
+		return nullptr;
+	}
+
+	//Bump allocate inside the segment, retrying if another thread got there first
+	GLsizeiptr head = m_Head.load();
+	GLsizeiptr start;
+	do
+	{
+		start = (head + alignment - 1) / alignment * alignment;
+		if (start + size > m_SegmentSize)
+		{
+			return nullptr;
+		}
+	} while (!m_Head.compare_exchange_weak(head, start + size));
+
+	offset = m_Segment * m_SegmentSize + start;
+	if (m_Persistent)
+	{
+		return m_pMapped + offset;
+	}
+	return m_pMapped + start;
+}
+
+void StreamBuffer::submit()
+{
+	if (!m_Persistent && m_pMapped)
+	{
+		glBindBuffer(m_Target, m_Buffer);
+		glUnmapBuffer(m_Target);
+		glBindBuffer(m_Target, 0);
+		m_pMapped = nullptr;
+	}
+}
+
+GLuint StreamBuffer::getBuffer()
+{
+	return m_Buffer;
+}
+
+GLsizeiptr StreamBuffer::getSize()
+{
+	return m_SegmentSize * STREAM_BUFFER_SEGMENTS;
+}
+
+bool StreamBuffer::isPersistent()
+{
+	return m_Persistent;
+}
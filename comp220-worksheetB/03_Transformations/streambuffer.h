@@ -0,0 +1,50 @@
+#pragma once
+
+#include <atomic>
+
+#include <GL\glew.h>
+#include <SDL_opengl.h>
+
+//One segment is written each frame while the GPU can still be reading the other two
+#define STREAM_BUFFER_SEGMENTS 3
+
+//Ring buffer for data that changes every frame, split into segments with a fence each
+//When glBufferStorage is available the whole buffer is mapped once, persistent and coherent,
+//otherwise each segment is mapped unsynchronised for the frame, the fences make both safe
+//
+//Each frame: beginFrame, allocate and write (from any thread), submit, then draw with the offsets
+class StreamBuffer
+{
+public:
+	StreamBuffer();
+	~StreamBuffer();
+
+	bool init(GLenum target, GLsizeiptr segmentSize);
+	void destroy();
+
+	//Fences the segment used last frame, moves on and waits until the GPU has finished with the new one
+	void beginFrame();
+
+	//Thread safe, offset is from the start of the buffer, returns nullptr when this frame's segment is full
+	void *allocate(GLsizeiptr size, GLsizeiptr alignment, GLintptr& offset);
+
+	//Call once all writes are done and before any draw reads them, only does anything when not persistent
+	void submit();
+
+	GLuint getBuffer();
+	GLsizeiptr getSize();
+	bool isPersistent();
+private:
+	GLenum m_Target;
+	GLuint m_Buffer;
+	GLsizeiptr m_SegmentSize;
+	bool m_Persistent;
+
+	//Whole buffer when persistent, the current segment when not
+	unsigned char *m_pMapped;
+
+	GLsync m_Fences[STREAM_BUFFER_SEGMENTS];
+	unsigned int m_Segment;
+	bool m_FrameStarted;
+	std::atomic<GLsizeiptr> m_Head;
+};
@@ -0,0 +1,504 @@
+#include "textureatlas.h"
+
+#include <algorithm>
+
+#include "archive.h"
+#include "compression.h"
+#include "cooked.h"
+
+RectanglePacker::RectanglePacker()
+{
+	m_Width = 0;
+	m_Height = 0;
+	m_UsedArea = 0;
+}
+
+void RectanglePacker::init(int width, int height)
+{
+	m_Width = width;
+	m_Height = height;
+	m_UsedArea = 0;
+
+	SkylineSegment floor = { 0, 0, width };
+	m_Skyline.assign(1, floor);
+}
+
+int RectanglePacker::fitAt(unsigned int segment, int width, int height)
+{
+	int x = m_Skyline[segment].x;
+	if (x + width > m_Width)
+	{
+		return -1;
+	}
+
+	//Has to sit on top of the highest segment it spans
+	int y = 0;
+	int remaining = width;
+	while (remaining > 0)
+	{
+		y = std::max(y, m_Skyline[segment].y);
+		if (y + height > m_Height)
+		{
+			return -1;
+		}
+		remaining -= m_Skyline[segment].width;
+		segment++;
+	}
+	return y;
+}
+
+bool RectanglePacker::pack(int width, int height, int & x, int & y)
+{
+	if (width <= 0 || height <= 0)
+	{
+		return false;
+	}
+
+	//Lowest top edge wins, then the narrowest segment to keep gaps small
+	int bestSegment = -1;
+	int bestY = m_Height;
+	int bestWidth = m_Width + 1;
+	for (unsigned int i = 0; i < m_Skyline.size(); i++)
+	{
+		int fitY = fitAt(i, width, height);
+		if (fitY < 0)
+		{
+			continue;
+		}
+		if (fitY + height < bestY + height || (fitY == bestY && m_Skyline[i].width < bestWidth))
+		{
+			bestSegment = i;
+			bestY = fitY;
+			bestWidth = m_Skyline[i].width;
+		}
+	}
+	if (bestSegment < 0)
+	{
+		return false;
+	}
+
+	x = m_Skyline[bestSegment].x;
+	y = bestY;
+
+	//The new top edge goes in, segments under it are trimmed or removed
+	SkylineSegment top = { x, y + height, width };
+	m_Skyline.insert(m_Skyline.begin() + bestSegment, top);
+	unsigned int next = bestSegment + 1;
+	while (next < m_Skyline.size())
+	{
+		SkylineSegment& segment = m_Skyline[next];
+		int covered = top.x + top.width - segment.x;
+		if (covered <= 0)
+		{
+			break;
+		}
+		if (covered < segment.width)
+		{
+			segment.x += covered;
+			segment.width -= covered;
+			break;
+		}
+		m_Skyline.erase(m_Skyline.begin() + next);
+	}
+
+	//Neighbours at the same height become one segment
+	for (unsigned int i = 0; i + 1 < m_Skyline.size();)
+	{
+		if (m_Skyline[i].y == m_Skyline[i + 1].y)
+		{
+			m_Skyline[i].width += m_Skyline[i + 1].width;
+			m_Skyline.erase(m_Skyline.begin() + i + 1);
+		}
+		else
+		{
+			i++;
+		}
+	}
+
+	m_UsedArea += (long long)width * height;
+	return true;
+}
+
+float RectanglePacker::getOccupancy()
+{
+	if (m_Width == 0 || m_Height == 0)
+	{
+		return 0.0f;
+	}
+	return (float)((double)m_UsedArea / ((double)m_Width * m_Height));
+}
+
+static int getMipLevels(int size)
+{
+	int mipLevels = 1;
+	while ((size >> mipLevels) > 0)
+	{
+		mipLevels++;
+	}
+	return mipLevels;
+}
+
+static void setSamplerParameters()
+{
+	glTexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_MIN_FILTER, GL_LINEAR_MIPMAP_LINEAR);
+	glTexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+	glTexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+	glTexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+}
+
+TextureAtlas::TextureAtlas()
+{
+	m_Texture = 0;
+	m_Layers = 0;
+}
+
+TextureAtlas::~TextureAtlas()
+{
+}
+
+void TextureAtlas::init()
+{
+	//Starts with one page, more layers are added as the pages fill
+	glGenTextures(1, &m_Texture);
+	allocateStorage(1);
+
+	glBindTexture(GL_TEXTURE_2D_ARRAY, m_Texture);
+	setSamplerParameters();
+	glBindTexture(GL_TEXTURE_2D_ARRAY, 0);
+
+	getGPUMemory().addEvictable(this);
+}
+
+void TextureAtlas::allocateStorage(int layers)
+{
+	int mipLevels = getMipLevels(TEXTURE_ATLAS_PAGE_SIZE);
+
+	glBindTexture(GL_TEXTURE_2D_ARRAY, m_Texture);
+	for (int level = 0; level < mipLevels; level++)
+	{
+		int size = TEXTURE_ATLAS_PAGE_SIZE >> level;
+		glTexImage3D(GL_TEXTURE_2D_ARRAY, level, GL_RGBA8, size, size, layers, 0, GL_RGBA, GL_UNSIGNED_BYTE, nullptr);
+	}
+	glTexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_MAX_LEVEL, mipLevels - 1);
+	glBindTexture(GL_TEXTURE_2D_ARRAY, 0);
+
+	m_Layers = layers;
+	getGPUMemory().trackTexture(m_Texture, getStorageSize(layers));
+}
+
+void TextureAtlas::growStorage(int layers)
+{
+	//The layer count of a texture can't change, so the used pages are copied into a new bigger one
+	//on the GPU, every mip level is copied so nothing has to be regenerated
+	GLuint oldTexture = m_Texture;
+	glGenTextures(1, &m_Texture);
+	allocateStorage(layers);
+
+	GLuint framebuffer;
+	glGenFramebuffers(1, &framebuffer);
+	glBindFramebuffer(GL_READ_FRAMEBUFFER, framebuffer);
+	glReadBuffer(GL_COLOR_ATTACHMENT0);
+	glBindTexture(GL_TEXTURE_2D_ARRAY, m_Texture);
+	setSamplerParameters();
+	for (int level = 0; level < getMipLevels(TEXTURE_ATLAS_PAGE_SIZE); level++)
+	{
+		int size = TEXTURE_ATLAS_PAGE_SIZE >> level;
+		for (unsigned int page = 0; page < m_Pages.size(); page++)
+		{
+			glFramebufferTextureLayer(GL_READ_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, oldTexture, level, page);
+			glCopyTexSubImage3D(GL_TEXTURE_2D_ARRAY, level, 0, 0, page, 0, 0, size, size);
+		}
+	}
+	glBindTexture(GL_TEXTURE_2D_ARRAY, 0);
+	glBindFramebuffer(GL_READ_FRAMEBUFFER, 0);
+	glDeleteFramebuffers(1, &framebuffer);
+
+	getGPUMemory().untrackTexture(oldTexture);
+	glDeleteTextures(1, &oldTexture);
+}
+
+size_t TextureAtlas::getStorageSize(int layers)
+{
+	size_t bytes = 0;
+	for (int size = TEXTURE_ATLAS_PAGE_SIZE; size > 0; size >>= 1)
+	{
+		bytes += (size_t)size * size * 4 * layers;
+	}
+	return bytes;
+}
+
+void TextureAtlas::destroy()
+{
+	getGPUMemory().removeEvictable(this);
+	getGPUMemory().untrackTexture(m_Texture);
+	glDeleteTextures(1, &m_Texture);
+	m_Texture = 0;
+	m_Layers = 0;
+	for (GLuint texture : m_StandaloneTextures)
+	{
+		getGPUMemory().untrackTexture(texture);
+		glDeleteTextures(1, &texture);
+	}
+	m_StandaloneTextures.clear();
+	m_Pages.clear();
+	m_Loaded.clear();
+	m_EvictedPages.clear();
+}
+
+AtlasHandle TextureAtlas::addTextureFromFile(const std::string & filename)
+{
+	auto iter = m_Loaded.find(filename);
+	if (iter != m_Loaded.end())
+	{
+		return iter->second;
+	}
+
+	AtlasHandle handle = { -1, glm::vec4(1.0f, 1.0f, 0.0f, 0.0f), 0 };
+
+	//Cooked textures already hold RGBA bytes, only the top level is used since the atlas builds its own mips
+	if (isCookedTexture(filename))
+	{
+		CookedTexture texture;
+		if (readCookedTexture(filename, texture))
+		{
+			handle = addTexture(texture.pixels.data(), texture.info.width, texture.info.height);
+		}
+		if (handle.layer >= 0)
+		{
+			m_Loaded[filename] = handle;
+		}
+		return handle;
+	}
+
+	SDL_Surface* surface = IMG_Load_RW(openAssetRWops(filename), 1);
+	if (surface == nullptr)
+	{
+		printf("Could not load image file %s\n", filename.c_str());
+		return handle;
+	}
+
+	//Everything in the atlas is the same format, so convert to RGBA bytes first
+	SDL_Surface* rgbaSurface = SDL_ConvertSurfaceFormat(surface, SDL_PIXELFORMAT_ABGR8888, 0);
+	SDL_FreeSurface(surface);
+	if (rgbaSurface == nullptr)
+	{
+		printf("Could not convert image file %s\n", filename.c_str());
+		return handle;
+	}
+
+	std::vector<unsigned char> pixels(rgbaSurface->w * rgbaSurface->h * 4);
+	for (int row = 0; row < rgbaSurface->h; row++)
+	{
+		const unsigned char *pRow = (const unsigned char*)rgbaSurface->pixels + row * rgbaSurface->pitch;
+		std::copy(pRow, pRow + rgbaSurface->w * 4, pixels.begin() + row * rgbaSurface->w * 4);
+	}
+	handle = addTexture(pixels.data(), rgbaSurface->w, rgbaSurface->h);
+	SDL_FreeSurface(rgbaSurface);
+
+	if (handle.layer >= 0)
+	{
+		m_Loaded[filename] = handle;
+	}
+	return handle;
+}
+
+AtlasHandle TextureAtlas::addTexture(const unsigned char * pPixels, int width, int height)
+{
+	AtlasHandle handle = { -1, glm::vec4(1.0f, 1.0f, 0.0f, 0.0f), 0 };
+	int paddedWidth = width + TEXTURE_ATLAS_PADDING * 2;
+	int paddedHeight = height + TEXTURE_ATLAS_PADDING * 2;
+	if (width <= 0 || height <= 0)
+	{
+		return handle;
+	}
+	if (paddedWidth > TEXTURE_ATLAS_PAGE_SIZE || paddedHeight > TEXTURE_ATLAS_PAGE_SIZE)
+	{
+		printf("Texture of %dx%d is too big for an atlas page, it gets a texture of its own\n", width, height);
+		return addStandaloneTexture(pPixels, width, height);
+	}
+
+	//First page with room, a new page is started when none of them have any
+	int x = 0, y = 0;
+	int page = -1;
+	for (unsigned int i = 0; i < m_Pages.size(); i++)
+	{
+		if (m_Pages[i].pack(paddedWidth, paddedHeight, x, y))
+		{
+			page = i;
+			break;
+		}
+	}
+	if (page < 0 && m_Pages.size() < TEXTURE_ATLAS_MAX_PAGES)
+	{
+		RectanglePacker packer;
+		packer.init(TEXTURE_ATLAS_PAGE_SIZE, TEXTURE_ATLAS_PAGE_SIZE);
+		if (packer.pack(paddedWidth, paddedHeight, x, y))
+		{
+			m_Pages.push_back(packer);
+			page = m_Pages.size() - 1;
+		}
+	}
+	if (page < 0)
+	{
+		printf("Texture of %dx%d doesn't fit in the atlas, it gets a texture of its own\n", width, height);
+		return addStandaloneTexture(pPixels, width, height);
+	}
+
+	//Restores the storage if it was evicted, so a grow copies the real pages
+	getGPUMemory().touch(this);
+	if (page >= m_Layers)
+	{
+		growStorage(std::min(m_Layers * 2, TEXTURE_ATLAS_MAX_PAGES));
+	}
+
+	//Copy with the edges stretched out into the padding
+	std::vector<unsigned char> padded(paddedWidth * paddedHeight * 4);
+	for (int row = 0; row < paddedHeight; row++)
+	{
+		int sourceRow = glm::clamp(row - TEXTURE_ATLAS_PADDING, 0, height - 1);
+		for (int column = 0; column < paddedWidth; column++)
+		{
+			int sourceColumn = glm::clamp(column - TEXTURE_ATLAS_PADDING, 0, width - 1);
+			const unsigned char *pSource = pPixels + (sourceRow * width + sourceColumn) * 4;
+			std::copy(pSource, pSource + 4, padded.begin() + (row * paddedWidth + column) * 4);
+		}
+	}
+
+	glBindTexture(GL_TEXTURE_2D_ARRAY, m_Texture);
+	glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+	glTexSubImage3D(GL_TEXTURE_2D_ARRAY, 0, x, y, page, paddedWidth, paddedHeight, 1, GL_RGBA, GL_UNSIGNED_BYTE, padded.data());
+	glPixelStorei(GL_UNPACK_ALIGNMENT, 4);
+	glBindTexture(GL_TEXTURE_2D_ARRAY, 0);
+
+	float pageSize = (float)TEXTURE_ATLAS_PAGE_SIZE;
+	handle.layer = page;
+	handle.uvTransform = glm::vec4(width / pageSize, height / pageSize, (x + TEXTURE_ATLAS_PADDING) / pageSize, (y + TEXTURE_ATLAS_PADDING) / pageSize);
+	return handle;
+}
+
+AtlasHandle TextureAtlas::addStandaloneTexture(const unsigned char * pPixels, int width, int height)
+{
+	//A one layer array, so the same shaders and handle fields work for it
+	AtlasHandle handle = { 0, glm::vec4(1.0f, 1.0f, 0.0f, 0.0f), 0 };
+	glGenTextures(1, &handle.texture);
+	glBindTexture(GL_TEXTURE_2D_ARRAY, handle.texture);
+	glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+	glTexImage3D(GL_TEXTURE_2D_ARRAY, 0, GL_RGBA8, width, height, 1, 0, GL_RGBA, GL_UNSIGNED_BYTE, pPixels);
+	glPixelStorei(GL_UNPACK_ALIGNMENT, 4);
+	setSamplerParameters();
+	glGenerateMipmap(GL_TEXTURE_2D_ARRAY);
+	glBindTexture(GL_TEXTURE_2D_ARRAY, 0);
+
+	//A full mip chain adds a third
+	getGPUMemory().trackTexture(handle.texture, (size_t)width * height * 4 * 4 / 3);
+	m_StandaloneTextures.push_back(handle.texture);
+	return handle;
+}
+
+void TextureAtlas::generateMipmaps()
+{
+	getGPUMemory().touch(this);
+	glBindTexture(GL_TEXTURE_2D_ARRAY, m_Texture);
+	glGenerateMipmap(GL_TEXTURE_2D_ARRAY);
+	glBindTexture(GL_TEXTURE_2D_ARRAY, 0);
+}
+
+void TextureAtlas::bind(GLuint textureUnit)
+{
+	getGPUMemory().touch(this);
+	glActiveTexture(GL_TEXTURE0 + textureUnit);
+	glBindTexture(GL_TEXTURE_2D_ARRAY, m_Texture);
+	glActiveTexture(GL_TEXTURE0);
+}
+
+void TextureAtlas::bind(const AtlasHandle & handle, GLuint textureUnit)
+{
+	if (handle.texture == 0)
+	{
+		bind(textureUnit);
+		return;
+	}
+	glActiveTexture(GL_TEXTURE0 + textureUnit);
+	glBindTexture(GL_TEXTURE_2D_ARRAY, handle.texture);
+	glActiveTexture(GL_TEXTURE0);
+}
+
+int TextureAtlas::getNumberOfPages()
+{
+	return m_Pages.size();
+}
+
+float TextureAtlas::getOccupancy(int page)
+{
+	if (page < 0 || page >= (int)m_Pages.size())
+	{
+		return 0.0f;
+	}
+	return m_Pages[page].getOccupancy();
+}
+
+void TextureAtlas::evict()
+{
+	//Each used page is attached to a framebuffer and read back on its own, the unused layers are skipped
+	std::vector<unsigned char> pixels((size_t)TEXTURE_ATLAS_PAGE_SIZE * TEXTURE_ATLAS_PAGE_SIZE * 4);
+	GLuint framebuffer;
+	glGenFramebuffers(1, &framebuffer);
+	glBindFramebuffer(GL_READ_FRAMEBUFFER, framebuffer);
+	glReadBuffer(GL_COLOR_ATTACHMENT0);
+	glPixelStorei(GL_PACK_ALIGNMENT, 1);
+
+	m_EvictedPages.resize(m_Pages.size());
+	for (unsigned int page = 0; page < m_Pages.size(); page++)
+	{
+		glFramebufferTextureLayer(GL_READ_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, m_Texture, 0, page);
+		glReadPixels(0, 0, TEXTURE_ATLAS_PAGE_SIZE, TEXTURE_ATLAS_PAGE_SIZE, GL_RGBA, GL_UNSIGNED_BYTE, pixels.data());
+		compressBlock(pixels.data(), pixels.size(), m_EvictedPages[page]);
+	}
+
+	glPixelStorei(GL_PACK_ALIGNMENT, 4);
+	glBindFramebuffer(GL_READ_FRAMEBUFFER, 0);
+	glDeleteFramebuffers(1, &framebuffer);
+
+	//Zero sized levels free the storage but keep the texture name
+	glBindTexture(GL_TEXTURE_2D_ARRAY, m_Texture);
+	for (int level = 0; (TEXTURE_ATLAS_PAGE_SIZE >> level) > 0; level++)
+	{
+		glTexImage3D(GL_TEXTURE_2D_ARRAY, level, GL_RGBA8, 0, 0, 0, 0, GL_RGBA, GL_UNSIGNED_BYTE, nullptr);
+	}
+	glBindTexture(GL_TEXTURE_2D_ARRAY, 0);
+	getGPUMemory().trackTexture(m_Texture, 0);
+}
+
+void TextureAtlas::restore()
+{
+	allocateStorage(m_Layers);
+
+	std::vector<unsigned char> pixels((size_t)TEXTURE_ATLAS_PAGE_SIZE * TEXTURE_ATLAS_PAGE_SIZE * 4);
+	glBindTexture(GL_TEXTURE_2D_ARRAY, m_Texture);
+	glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+	for (unsigned int page = 0; page < m_EvictedPages.size(); page++)
+	{
+		const std::vector<unsigned char>& compressed = m_EvictedPages[page];
+		if (!decompressBlock(compressed.data(), compressed.size(), pixels.data(), pixels.size()))
+		{
+			printf("Evicted atlas page %u is corrupt\n", page);
+			continue;
+		}
+		glTexSubImage3D(GL_TEXTURE_2D_ARRAY, 0, 0, 0, page, TEXTURE_ATLAS_PAGE_SIZE, TEXTURE_ATLAS_PAGE_SIZE, 1, GL_RGBA, GL_UNSIGNED_BYTE, pixels.data());
+	}
+	glPixelStorei(GL_UNPACK_ALIGNMENT, 4);
+	glGenerateMipmap(GL_TEXTURE_2D_ARRAY);
+	glBindTexture(GL_TEXTURE_2D_ARRAY, 0);
+
+	m_EvictedPages.clear();
+}
+
+size_t TextureAtlas::getCacheSize()
+{
+	size_t bytes = 0;
+	for (const std::vector<unsigned char>& page : m_EvictedPages)
+	{
+		bytes += page.size();
+	}
+	return bytes;
+}
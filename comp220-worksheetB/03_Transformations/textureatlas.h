@@ -0,0 +1,103 @@
+#pragma once
+
+#include <map>
+#include <string>
+#include <vector>
+
+#include <SDL_image.h>
+#include <GL\glew.h>
+#include <SDL_opengl.h>
+
+#include <glm/glm.hpp>
+
+#include "gpumemory.h"
+
+#define TEXTURE_ATLAS_PAGE_SIZE 2048
+#define TEXTURE_ATLAS_MAX_PAGES 8
+
+//Edge pixels are copied out this far around each texture so filtering and lower mips don't bleed in neighbours
+#define TEXTURE_ATLAS_PADDING 4
+
+//Skyline bottom left packer, keeps the top edge of everything placed so far as a list of horizontal segments
+class RectanglePacker
+{
+public:
+	RectanglePacker();
+
+	void init(int width, int height);
+	bool pack(int width, int height, int& x, int& y);
+
+	//Fraction of the area that has been handed out
+	float getOccupancy();
+private:
+	struct SkylineSegment
+	{
+		int x;
+		int y;
+		int width;
+	};
+
+	//Lowest y a rectangle starting at segment can sit at, or -1 if it doesn't fit
+	int fitAt(unsigned int segment, int width, int height);
+
+	std::vector<SkylineSegment> m_Skyline;
+	int m_Width;
+	int m_Height;
+	long long m_UsedArea;
+};
+
+//Where a texture ended up, uvTransform is xy scale and zw offset for the mesh's 0-1 UVs
+//Handles are small enough to go in per draw or per instance data, so draws with different textures
+//can share one batch as long as the atlas is bound
+//texture is 0 for textures in the atlas, otherwise a one layer array of its own for textures that didn't fit
+struct AtlasHandle
+{
+	int layer;
+	glm::vec4 uvTransform;
+	GLuint texture;
+};
+
+//Packs RGBA8 textures into the layers of one GL_TEXTURE_2D_ARRAY, so a whole scene needs one texture bind
+//Layers are only allocated as pages fill, the array is reallocated and the pages copied over when it grows
+//When evicted only the pages in use are read back, the mips are regenerated on restore
+//Standalone textures aren't evicted
+class TextureAtlas : public EvictableResource
+{
+public:
+	TextureAtlas();
+	~TextureAtlas();
+
+	void init();
+	void destroy();
+
+	//Loading the same file twice returns the first handle, layer is -1 if it couldn't be loaded
+	//Textures bigger than a page, or added once every page is full, get a standalone texture instead
+	AtlasHandle addTextureFromFile(const std::string& filename);
+	AtlasHandle addTexture(const unsigned char *pPixels, int width, int height);
+
+	//Call after adding textures, before drawing with them
+	void generateMipmaps();
+	void bind(GLuint textureUnit);
+
+	//Binds the atlas or the handle's standalone texture
+	void bind(const AtlasHandle& handle, GLuint textureUnit);
+
+	int getNumberOfPages();
+	float getOccupancy(int page);
+
+	void evict();
+	void restore();
+	size_t getCacheSize();
+private:
+	void allocateStorage(int layers);
+	void growStorage(int layers);
+	AtlasHandle addStandaloneTexture(const unsigned char *pPixels, int width, int height);
+	size_t getStorageSize(int layers);
+
+	GLuint m_Texture;
+	int m_Layers;
+	std::vector<GLuint> m_StandaloneTextures;
+	std::vector<std::vector<unsigned char>> m_EvictedPages;
+	std::vector<RectanglePacker> m_Pages;
+	std::map<std::string, AtlasHandle> m_Loaded;
+};
@@ -0,0 +1,50 @@
+#include "vertex.h"
+
+#include <assimp\mesh.h>
+
+void copyMeshData(const aiMesh * currentMesh, std::vector<Vertex>& vertices, std::vector<unsigned int>& indices)
+{
+	for (int v = 0; v < currentMesh->mNumVertices; v++)
+	{
+		aiVector3D currentModelVertex = currentMesh->mVertices[v];
+		aiColor4D currentModelColour = aiColor4D(1.0, 1.0, 1.0, 1.0);
+		aiVector3D currentTextureCoordinates = aiVector3D(0.0f, 0.0f, 0.0f);
+		aiVector3D currentModelNormals = aiVector3D(0.0f, 0.0f, 0.0f);
+		aiVector3D currentModelTangents = aiVector3D(0.0f, 0.0f, 0.0f);
+		aiVector3D currentModelBitangents = aiVector3D(0.0f, 0.0f, 0.0f);
+
+		if (currentMesh->HasVertexColors(0))
+		{
+			currentModelColour = currentMesh->mColors[0][v];
+		}
+		if (currentMesh->HasTextureCoords(0))
+		{
+			currentTextureCoordinates = currentMesh->mTextureCoords[0][v];
+		}
+		if (currentMesh->HasNormals())
+		{
+			currentModelNormals = currentMesh->mNormals[v];
+		}
+		if (currentMesh->HasTangentsAndBitangents())
+		{
+			currentModelTangents = currentMesh->mTangents[v];
+			currentModelBitangents = currentMesh->mBitangents[v];
+		}
+		Vertex currentVertex = { currentModelVertex.x,currentModelVertex.y,currentModelVertex.z,
+			currentModelColour.r,currentModelColour.g,currentModelColour.b,currentModelColour.a,
+			currentTextureCoordinates.x,currentTextureCoordinates.y,
+			currentModelNormals.x,currentModelNormals.y,currentModelNormals.z,
+			currentModelTangents.x,currentModelTangents.y,currentModelTangents.z,
+			currentModelBitangents.x,currentModelBitangents.y,currentModelBitangents.z };
+
+		vertices.push_back(currentVertex);
+	}
+
+	for (int f = 0; f < currentMesh->mNumFaces; f++)
+	{
+		aiFace currentModelFace = currentMesh->mFaces[f];
+		indices.push_back(currentModelFace.mIndices[0]);
+		indices.push_back(currentModelFace.mIndices[1]);
+		indices.push_back(currentModelFace.mIndices[2]);
+	}
+}
@@ -0,0 +1,104 @@
+#pragma once
+
+#include "setup.hpp"
+#include <cmath>
+#include <limits>
+
+namespace glm{
+namespace detail
+{
+	// Square root, sine, cosine and tangent usable in constant expressions.
+	// At runtime the standard library functions are called so the results don't change,
+	// in constant expressions the results may differ from them in the last bits.
+
+	GLM_FUNC_QUALIFIER GLM_CONSTEXPR double compute_sqrt_newton(double x)
+	{
+		if(!(x > 0.0) || x > std::numeric_limits<double>::max())
+			return x < 0.0 ? std::numeric_limits<double>::quiet_NaN() : x;
+
+		// Scales x by powers of 4 into [0.25, 4], where Newton iterations converge from (1 + x) / 2 in 6 steps
+		double Scale = 1.0;
+		while(x > 4.0)
+		{
+			x *= 0.25;
+			Scale *= 2.0;
+		}
+		while(x < 0.25)
+		{
+			x *= 4.0;
+			Scale *= 0.5;
+		}
+
+		double Result = (1.0 + x) * 0.5;
+		for(int i = 0; i < 8; ++i)
+			Result = (Result + x / Result) * 0.5;
+		return Result * Scale;
+	}
+
+	// Sine of x + Quadrant * pi / 2
+	GLM_FUNC_QUALIFIER GLM_CONSTEXPR double compute_sin_taylor(double x, long long Quadrant)
+	{
+		if(x != x || x - x != 0.0)
+			return std::numeric_limits<double>::quiet_NaN();
+
+		// Reduces x into [-pi / 4, pi / 4] with pi / 2 split in two parts to keep the bits lost by the subtraction
+		double const k = x * 0.63661977236758134308;
+		long long const n = static_cast<long long>(k >= 0.0 ? k + 0.5 : k - 0.5);
+		double const r = (x - static_cast<double>(n) * 1.57079632679489655800) - static_cast<double>(n) * 6.12323399573676603587e-17;
+		double const r2 = r * r;
+
+		double Sin = r;
+		double Cos = 1.0;
+		double SinTerm = r;
+		double CosTerm = 1.0;
+		for(int i = 1; i < 12; ++i)
+		{
+			SinTerm *= -r2 / static_cast<double>((2 * i) * (2 * i + 1));
+			CosTerm *= -r2 / static_cast<double>((2 * i - 1) * (2 * i));
+			Sin += SinTerm;
+			Cos += CosTerm;
+		}
+
+		switch(static_cast<int>((n + Quadrant) & 3))
+		{
+			default:
+			case 0: return Sin;
+			case 1: return Cos;
+			case 2: return -Sin;
+			case 3: return -Cos;
+		}
+	}
+
+	template<typename genType>
+	GLM_FUNC_QUALIFIER GLM_CONSTEXPR genType constexpr_sqrt(genType x)
+	{
+		if(GLM_IS_CONSTANT_EVALUATED())
+			return static_cast<genType>(compute_sqrt_newton(static_cast<double>(x)));
+		return std::sqrt(x);
+	}
+
+	template<typename genType>
+	GLM_FUNC_QUALIFIER GLM_CONSTEXPR genType constexpr_sin(genType x)
+	{
+		if(GLM_IS_CONSTANT_EVALUATED())
+			return static_cast<genType>(compute_sin_taylor(static_cast<double>(x), 0));
+		return std::sin(x);
+	}
+
+	template<typename genType>
+	GLM_FUNC_QUALIFIER GLM_CONSTEXPR genType constexpr_cos(genType x)
+	{
+		if(GLM_IS_CONSTANT_EVALUATED())
+			return static_cast<genType>(compute_sin_taylor(static_cast<double>(x), 1));
+		return std::cos(x);
+	}
+
+	template<typename genType>
+	GLM_FUNC_QUALIFIER GLM_CONSTEXPR genType constexpr_tan(genType x)
+	{
+		if(GLM_IS_CONSTANT_EVALUATED())
+			return static_cast<genType>(compute_sin_taylor(static_cast<double>(x), 0) / compute_sin_taylor(static_cast<double>(x), 1));
+		return std::tan(x);
+	}
+}//namespace detail
+}//namespace glm
@@ -56,6 +56,39 @@ namespace detail
 			return Result;
 		}
 	};
+
+#	if GLM_ARCH & GLM_ARCH_AVX_BIT
+	template<qualifier Q>
+	struct compute_transpose<4, 4, double, Q, true>
+	{
+		GLM_FUNC_QUALIFIER static mat<4, 4, double, Q> call(mat<4, 4, double, Q> const& m)
+		{
+			mat<4, 4, double, Q> Result;
+			glm_dmat4_transpose(&m[0].data, &Result[0].data);
+			return Result;
+		}
+	};
+
+	template<qualifier Q>
+	struct compute_determinant<4, 4, double, Q, true>
+	{
+		GLM_FUNC_QUALIFIER static double call(mat<4, 4, double, Q> const& m)
+		{
+			return _mm_cvtsd_f64(_mm256_castpd256_pd128(glm_dmat4_determinant(&m[0].data)));
+		}
+	};
+
+	template<qualifier Q>
+	struct compute_inverse<4, 4, double, Q, true>
+	{
+		GLM_FUNC_QUALIFIER static mat<4, 4, double, Q> call(mat<4, 4, double, Q> const& m)
+		{
+			mat<4, 4, double, Q> Result;
+			glm_dmat4_inverse(&m[0].data, &Result[0].data);
+			return Result;
+		}
+	};
+#	endif
 }//namespace detail
 
 #	if GLM_CONFIG_ALIGNED_GENTYPES == GLM_ENABLE
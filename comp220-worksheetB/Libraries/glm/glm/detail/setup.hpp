@@ -274,9 +274,7 @@
 
 // N2235 Generalized Constant Expressions http://www.open-std.org/jtc1/sc22/wg21/docs/papers/2007/n2235.pdf
 // N3652 Extended Constant Expressions http://www.open-std.org/jtc1/sc22/wg21/docs/papers/2013/n3652.html
-#if (GLM_ARCH & GLM_ARCH_SIMD_BIT) // Compiler SIMD intrinsics don't support constexpr...
-#	define GLM_HAS_CONSTEXPR 0
-#elif (GLM_COMPILER & GLM_COMPILER_CLANG)
+#if (GLM_COMPILER & GLM_COMPILER_CLANG)
 #	define GLM_HAS_CONSTEXPR __has_feature(cxx_relaxed_constexpr)
 #elif (GLM_LANG & GLM_LANG_CXX14_FLAG)
 #	define GLM_HAS_CONSTEXPR 1
@@ -292,6 +290,31 @@
 #	define GLM_CONSTEXPR
 #endif
 
+// Compiler SIMD intrinsics don't support constexpr, the functions of the aligned types using them can't be constexpr
+#if GLM_HAS_CONSTEXPR && !(GLM_ARCH & GLM_ARCH_SIMD_BIT)
+#	define GLM_CONSTEXPR_SIMD constexpr
+#else
+#	define GLM_CONSTEXPR_SIMD
+#endif
+
+// Detects constant evaluation so that constexpr functions can keep calling the standard math functions at runtime
+#if defined(__has_builtin)
+#	if __has_builtin(__builtin_is_constant_evaluated)
+#		define GLM_HAS_IS_CONSTANT_EVALUATED GLM_HAS_CONSTEXPR
+#	endif
+#endif
+#ifndef GLM_HAS_IS_CONSTANT_EVALUATED
+#	define GLM_HAS_IS_CONSTANT_EVALUATED (GLM_HAS_CONSTEXPR && (\
+		((GLM_COMPILER & GLM_COMPILER_GCC) && (__GNUC__ >= 9)) || \
+		((GLM_COMPILER & GLM_COMPILER_VC) && (_MSC_VER >= 1925))))
+#endif
+
+#if GLM_HAS_IS_CONSTANT_EVALUATED
+#	define GLM_IS_CONSTANT_EVALUATED() __builtin_is_constant_evaluated()
+#else
+#	define GLM_IS_CONSTANT_EVALUATED() false
+#endif
+
 //
 #if GLM_LANG & GLM_LANG_CXX11_FLAG
 #	define GLM_HAS_ASSIGNABLE 1
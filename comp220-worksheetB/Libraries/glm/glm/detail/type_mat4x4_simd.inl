@@ -1,6 +1,100 @@
 /// @ref core
 
-namespace glm
+#include "../simd/matrix.h"
+
+namespace glm{
+namespace detail
 {
+#	if GLM_ARCH & GLM_ARCH_SSE2_BIT
+	template<qualifier Q>
+	struct compute_mat4_mul<float, Q, true>
+	{
+		GLM_FUNC_QUALIFIER static mat<4, 4, float, Q> call(mat<4, 4, float, Q> const& m1, mat<4, 4, float, Q> const& m2)
+		{
+			mat<4, 4, float, Q> Result;
+			glm_mat4_mul(&m1[0].data, &m2[0].data, &Result[0].data);
+			return Result;
+		}
+	};
+
+	template<qualifier Q>
+	struct compute_mat4_mul_vec4<float, Q, true>
+	{
+		GLM_FUNC_QUALIFIER static vec<4, float, Q> call(mat<4, 4, float, Q> const& m, vec<4, float, Q> const& v)
+		{
+			vec<4, float, Q> Result;
+			Result.data = glm_mat4_mul_vec4(&m[0].data, v.data);
+			return Result;
+		}
+	};
+
+	template<qualifier Q>
+	struct compute_vec4_mul_mat4<float, Q, true>
+	{
+		GLM_FUNC_QUALIFIER static vec<4, float, Q> call(vec<4, float, Q> const& v, mat<4, 4, float, Q> const& m)
+		{
+			vec<4, float, Q> Result;
+			Result.data = glm_vec4_mul_mat4(v.data, &m[0].data);
+			return Result;
+		}
+	};
+
+	template<qualifier Q>
+	struct compute_mat4_add<float, Q, true>
+	{
+		GLM_FUNC_QUALIFIER static mat<4, 4, float, Q> call(mat<4, 4, float, Q> const& m1, mat<4, 4, float, Q> const& m2)
+		{
+			mat<4, 4, float, Q> Result;
+			glm_mat4_add(&m1[0].data, &m2[0].data, &Result[0].data);
+			return Result;
+		}
+	};
+
+	template<qualifier Q>
+	struct compute_mat4_sub<float, Q, true>
+	{
+		GLM_FUNC_QUALIFIER static mat<4, 4, float, Q> call(mat<4, 4, float, Q> const& m1, mat<4, 4, float, Q> const& m2)
+		{
+			mat<4, 4, float, Q> Result;
+			glm_mat4_sub(&m1[0].data, &m2[0].data, &Result[0].data);
+			return Result;
+		}
+	};
+
+	template<qualifier Q>
+	struct compute_mat4_mul_scalar<float, Q, true>
+	{
+		GLM_FUNC_QUALIFIER static mat<4, 4, float, Q> call(mat<4, 4, float, Q> const& m, float s)
+		{
+			mat<4, 4, float, Q> Result;
+			glm_mat4_mul_scalar(&m[0].data, _mm_set1_ps(s), &Result[0].data);
+			return Result;
+		}
+	};
+#	endif
+
+#	if GLM_ARCH & GLM_ARCH_AVX_BIT
+	template<qualifier Q>
+	struct compute_mat4_mul<double, Q, true>
+	{
+		GLM_FUNC_QUALIFIER static mat<4, 4, double, Q> call(mat<4, 4, double, Q> const& m1, mat<4, 4, double, Q> const& m2)
+		{
+			mat<4, 4, double, Q> Result;
+			glm_dmat4_mul(&m1[0].data, &m2[0].data, &Result[0].data);
+			return Result;
+		}
+	};
 
+	template<qualifier Q>
+	struct compute_mat4_mul_vec4<double, Q, true>
+	{
+		GLM_FUNC_QUALIFIER static vec<4, double, Q> call(mat<4, 4, double, Q> const& m, vec<4, double, Q> const& v)
+		{
+			vec<4, double, Q> Result;
+			Result.data = glm_dmat4_mul_dvec4(&m[0].data, v.data);
+			return Result;
+		}
+	};
+#	endif
+}//namespace detail
 }//namespace glm
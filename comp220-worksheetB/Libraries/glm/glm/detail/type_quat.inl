@@ -58,6 +58,19 @@ namespace detail
 		}
 	};
 
+	template<typename T, qualifier Q, bool Aligned>
+	struct compute_quat_mul_vec3
+	{
+		static vec<3, T, Q> call(qua<T, Q> const& q, vec<3, T, Q> const& v)
+		{
+			vec<3, T, Q> const QuatVector(q.x, q.y, q.z);
+			vec<3, T, Q> const uv(glm::cross(QuatVector, v));
+			vec<3, T, Q> const uuv(glm::cross(QuatVector, uv));
+
+			return v + ((uv * q.w) + uuv) * static_cast<T>(2);
+		}
+	};
+
 	template<typename T, qualifier Q, bool Aligned>
 	struct compute_quat_mul_vec4
 	{
@@ -313,11 +326,7 @@ namespace detail
 	template<typename T, qualifier Q>
 	GLM_FUNC_QUALIFIER vec<3, T, Q> operator*(qua<T, Q> const& q, vec<3, T, Q> const& v)
 	{
-		vec<3, T, Q> const QuatVector(q.x, q.y, q.z);
-		vec<3, T, Q> const uv(glm::cross(QuatVector, v));
-		vec<3, T, Q> const uuv(glm::cross(QuatVector, uv));
-
-		return v + ((uv * q.w) + uuv) * static_cast<T>(2);
+		return detail::compute_quat_mul_vec3<T, Q, detail::is_aligned<Q>::value>::call(q, v);
 	}
 
 	template<typename T, qualifier Q>
@@ -23,6 +23,7 @@
 #include "../ext/scalar_constants.hpp"
 #include "../geometric.hpp"
 #include "../trigonometric.hpp"
+#include "../detail/compute_constexpr.hpp"
 
 #if GLM_MESSAGES == GLM_ENABLE && !defined(GLM_EXT_INCLUDED)
 #	pragma message("GLM: GLM_EXT_matrix_clip_space extension included")
@@ -40,7 +41,7 @@ namespace glm
 	/// @see - glm::ortho(T const& left, T const& right, T const& bottom, T const& top, T const& zNear, T const& zFar)
 	/// @see <a href="https://www.khronos.org/registry/OpenGL-Refpages/gl2.1/xhtml/gluOrtho2D.xml">gluOrtho2D man page</a>
 	template<typename T>
-	GLM_FUNC_DECL mat<4, 4, T, defaultp> ortho(
+	GLM_FUNC_DECL GLM_CONSTEXPR mat<4, 4, T, defaultp> ortho(
 		T left, T right, T bottom, T top);
 
 	/// Creates a matrix for an orthographic parallel viewing volume, using left-handed coordinates.
@@ -50,7 +51,7 @@ namespace glm
 	///
 	/// @see - glm::ortho(T const& left, T const& right, T const& bottom, T const& top)
 	template<typename T>
-	GLM_FUNC_DECL mat<4, 4, T, defaultp> orthoLH_ZO(
+	GLM_FUNC_DECL GLM_CONSTEXPR mat<4, 4, T, defaultp> orthoLH_ZO(
 		T left, T right, T bottom, T top, T zNear, T zFar);
 
 	/// Creates a matrix for an orthographic parallel viewing volume using right-handed coordinates.
@@ -60,7 +61,7 @@ namespace glm
 	///
 	/// @see - glm::ortho(T const& left, T const& right, T const& bottom, T const& top)
 	template<typename T>
-	GLM_FUNC_DECL mat<4, 4, T, defaultp> orthoLH_NO(
+	GLM_FUNC_DECL GLM_CONSTEXPR mat<4, 4, T, defaultp> orthoLH_NO(
 		T left, T right, T bottom, T top, T zNear, T zFar);
 
 	/// Creates a matrix for an orthographic parallel viewing volume, using left-handed coordinates.
@@ -70,7 +71,7 @@ namespace glm
 	///
 	/// @see - glm::ortho(T const& left, T const& right, T const& bottom, T const& top)
 	template<typename T>
-	GLM_FUNC_DECL mat<4, 4, T, defaultp> orthoRH_ZO(
+	GLM_FUNC_DECL GLM_CONSTEXPR mat<4, 4, T, defaultp> orthoRH_ZO(
 		T left, T right, T bottom, T top, T zNear, T zFar);
 
 	/// Creates a matrix for an orthographic parallel viewing volume, using right-handed coordinates.
@@ -80,7 +81,7 @@ namespace glm
 	///
 	/// @see - glm::ortho(T const& left, T const& right, T const& bottom, T const& top)
 	template<typename T>
-	GLM_FUNC_DECL mat<4, 4, T, defaultp> orthoRH_NO(
+	GLM_FUNC_DECL GLM_CONSTEXPR mat<4, 4, T, defaultp> orthoRH_NO(
 		T left, T right, T bottom, T top, T zNear, T zFar);
 
 	/// Creates a matrix for an orthographic parallel viewing volume, using left-handed coordinates.
@@ -90,7 +91,7 @@ namespace glm
 	///
 	/// @see - glm::ortho(T const& left, T const& right, T const& bottom, T const& top)
 	template<typename T>
-	GLM_FUNC_DECL mat<4, 4, T, defaultp> orthoZO(
+	GLM_FUNC_DECL GLM_CONSTEXPR mat<4, 4, T, defaultp> orthoZO(
 		T left, T right, T bottom, T top, T zNear, T zFar);
 
 	/// Creates a matrix for an orthographic parallel viewing volume, using left-handed coordinates if GLM_FORCE_LEFT_HANDED if defined or right-handed coordinates otherwise.
@@ -100,7 +101,7 @@ namespace glm
 	///
 	/// @see - glm::ortho(T const& left, T const& right, T const& bottom, T const& top)
 	template<typename T>
-	GLM_FUNC_DECL mat<4, 4, T, defaultp> orthoNO(
+	GLM_FUNC_DECL GLM_CONSTEXPR mat<4, 4, T, defaultp> orthoNO(
 		T left, T right, T bottom, T top, T zNear, T zFar);
 
 	/// Creates a matrix for an orthographic parallel viewing volume, using left-handed coordinates.
@@ -111,7 +112,7 @@ namespace glm
 	///
 	/// @see - glm::ortho(T const& left, T const& right, T const& bottom, T const& top)
 	template<typename T>
-	GLM_FUNC_DECL mat<4, 4, T, defaultp> orthoLH(
+	GLM_FUNC_DECL GLM_CONSTEXPR mat<4, 4, T, defaultp> orthoLH(
 		T left, T right, T bottom, T top, T zNear, T zFar);
 
 	/// Creates a matrix for an orthographic parallel viewing volume, using right-handed coordinates.
@@ -122,7 +123,7 @@ namespace glm
 	///
 	/// @see - glm::ortho(T const& left, T const& right, T const& bottom, T const& top)
 	template<typename T>
-	GLM_FUNC_DECL mat<4, 4, T, defaultp> orthoRH(
+	GLM_FUNC_DECL GLM_CONSTEXPR mat<4, 4, T, defaultp> orthoRH(
 		T left, T right, T bottom, T top, T zNear, T zFar);
 
 	/// Creates a matrix for an orthographic parallel viewing volume, using the default handedness and default near and far clip planes definition.
@@ -133,7 +134,7 @@ namespace glm
 	/// @see - glm::ortho(T const& left, T const& right, T const& bottom, T const& top)
 	/// @see <a href="https://www.khronos.org/registry/OpenGL-Refpages/gl2.1/xhtml/glOrtho.xml">glOrtho man page</a>
 	template<typename T>
-	GLM_FUNC_DECL mat<4, 4, T, defaultp> ortho(
+	GLM_FUNC_DECL GLM_CONSTEXPR mat<4, 4, T, defaultp> ortho(
 		T left, T right, T bottom, T top, T zNear, T zFar);
 
 	/// Creates a left handed frustum matrix.
@@ -141,7 +142,7 @@ namespace glm
 	///
 	/// @tparam T A floating-point scalar type
 	template<typename T>
-	GLM_FUNC_DECL mat<4, 4, T, defaultp> frustumLH_ZO(
+	GLM_FUNC_DECL GLM_CONSTEXPR mat<4, 4, T, defaultp> frustumLH_ZO(
 		T left, T right, T bottom, T top, T near, T far);
 
 	/// Creates a left handed frustum matrix.
@@ -149,7 +150,7 @@ namespace glm
 	///
 	/// @tparam T A floating-point scalar type
 	template<typename T>
-	GLM_FUNC_DECL mat<4, 4, T, defaultp> frustumLH_NO(
+	GLM_FUNC_DECL GLM_CONSTEXPR mat<4, 4, T, defaultp> frustumLH_NO(
 		T left, T right, T bottom, T top, T near, T far);
 
 	/// Creates a right handed frustum matrix.
@@ -157,7 +158,7 @@ namespace glm
 	///
 	/// @tparam T A floating-point scalar type
 	template<typename T>
-	GLM_FUNC_DECL mat<4, 4, T, defaultp> frustumRH_ZO(
+	GLM_FUNC_DECL GLM_CONSTEXPR mat<4, 4, T, defaultp> frustumRH_ZO(
 		T left, T right, T bottom, T top, T near, T far);
 
 	/// Creates a right handed frustum matrix.
@@ -165,7 +166,7 @@ namespace glm
 	///
 	/// @tparam T A floating-point scalar type
 	template<typename T>
-	GLM_FUNC_DECL mat<4, 4, T, defaultp> frustumRH_NO(
+	GLM_FUNC_DECL GLM_CONSTEXPR mat<4, 4, T, defaultp> frustumRH_NO(
 		T left, T right, T bottom, T top, T near, T far);
 
 	/// Creates a frustum matrix using left-handed coordinates if GLM_FORCE_LEFT_HANDED if defined or right-handed coordinates otherwise.
@@ -173,7 +174,7 @@ namespace glm
 	///
 	/// @tparam T A floating-point scalar type
 	template<typename T>
-	GLM_FUNC_DECL mat<4, 4, T, defaultp> frustumZO(
+	GLM_FUNC_DECL GLM_CONSTEXPR mat<4, 4, T, defaultp> frustumZO(
 		T left, T right, T bottom, T top, T near, T far);
 
 	/// Creates a frustum matrix using left-handed coordinates if GLM_FORCE_LEFT_HANDED if defined or right-handed coordinates otherwise.
@@ -181,7 +182,7 @@ namespace glm
 	///
 	/// @tparam T A floating-point scalar type
 	template<typename T>
-	GLM_FUNC_DECL mat<4, 4, T, defaultp> frustumNO(
+	GLM_FUNC_DECL GLM_CONSTEXPR mat<4, 4, T, defaultp> frustumNO(
 		T left, T right, T bottom, T top, T near, T far);
 
 	/// Creates a left handed frustum matrix.
@@ -190,7 +191,7 @@ namespace glm
 	///
 	/// @tparam T A floating-point scalar type
 	template<typename T>
-	GLM_FUNC_DECL mat<4, 4, T, defaultp> frustumLH(
+	GLM_FUNC_DECL GLM_CONSTEXPR mat<4, 4, T, defaultp> frustumLH(
 		T left, T right, T bottom, T top, T near, T far);
 
 	/// Creates a right handed frustum matrix.
@@ -199,7 +200,7 @@ namespace glm
 	///
 	/// @tparam T A floating-point scalar type
 	template<typename T>
-	GLM_FUNC_DECL mat<4, 4, T, defaultp> frustumRH(
+	GLM_FUNC_DECL GLM_CONSTEXPR mat<4, 4, T, defaultp> frustumRH(
 		T left, T right, T bottom, T top, T near, T far);
 
 	/// Creates a frustum matrix with default handedness, using the default handedness and default near and far clip planes definition.
@@ -208,7 +209,7 @@ namespace glm
 	/// @tparam T A floating-point scalar type
 	/// @see <a href="https://www.khronos.org/registry/OpenGL-Refpages/gl2.1/xhtml/glFrustum.xml">glFrustum man page</a>
 	template<typename T>
-	GLM_FUNC_DECL mat<4, 4, T, defaultp> frustum(
+	GLM_FUNC_DECL GLM_CONSTEXPR mat<4, 4, T, defaultp> frustum(
 		T left, T right, T bottom, T top, T near, T far);
 
 
@@ -222,7 +223,7 @@ namespace glm
 	///
 	/// @tparam T A floating-point scalar type
 	template<typename T>
-	GLM_FUNC_DECL mat<4, 4, T, defaultp> perspectiveRH_ZO(
+	GLM_FUNC_DECL GLM_CONSTEXPR mat<4, 4, T, defaultp> perspectiveRH_ZO(
 		T fovy, T aspect, T near, T far);
 
 	/// Creates a matrix for a right handed, symetric perspective-view frustum.
@@ -235,7 +236,7 @@ namespace glm
 	///
 	/// @tparam T A floating-point scalar type
 	template<typename T>
-	GLM_FUNC_DECL mat<4, 4, T, defaultp> perspectiveRH_NO(
+	GLM_FUNC_DECL GLM_CONSTEXPR mat<4, 4, T, defaultp> perspectiveRH_NO(
 		T fovy, T aspect, T near, T far);
 
 	/// Creates a matrix for a left handed, symetric perspective-view frustum.
@@ -248,7 +249,7 @@ namespace glm
 	///
 	/// @tparam T A floating-point scalar type
 	template<typename T>
-	GLM_FUNC_DECL mat<4, 4, T, defaultp> perspectiveLH_ZO(
+	GLM_FUNC_DECL GLM_CONSTEXPR mat<4, 4, T, defaultp> perspectiveLH_ZO(
 		T fovy, T aspect, T near, T far);
 
 	/// Creates a matrix for a left handed, symetric perspective-view frustum.
@@ -261,7 +262,7 @@ namespace glm
 	///
 	/// @tparam T A floating-point scalar type
 	template<typename T>
-	GLM_FUNC_DECL mat<4, 4, T, defaultp> perspectiveLH_NO(
+	GLM_FUNC_DECL GLM_CONSTEXPR mat<4, 4, T, defaultp> perspectiveLH_NO(
 		T fovy, T aspect, T near, T far);
 
 	/// Creates a matrix for a symetric perspective-view frustum using left-handed coordinates if GLM_FORCE_LEFT_HANDED if defined or right-handed coordinates otherwise.
@@ -274,7 +275,7 @@ namespace glm
 	///
 	/// @tparam T A floating-point scalar type
 	template<typename T>
-	GLM_FUNC_DECL mat<4, 4, T, defaultp> perspectiveZO(
+	GLM_FUNC_DECL GLM_CONSTEXPR mat<4, 4, T, defaultp> perspectiveZO(
 		T fovy, T aspect, T near, T far);
 
 	/// Creates a matrix for a symetric perspective-view frustum using left-handed coordinates if GLM_FORCE_LEFT_HANDED if defined or right-handed coordinates otherwise.
@@ -287,7 +288,7 @@ namespace glm
 	///
 	/// @tparam T A floating-point scalar type
 	template<typename T>
-	GLM_FUNC_DECL mat<4, 4, T, defaultp> perspectiveNO(
+	GLM_FUNC_DECL GLM_CONSTEXPR mat<4, 4, T, defaultp> perspectiveNO(
 		T fovy, T aspect, T near, T far);
 
 	/// Creates a matrix for a right handed, symetric perspective-view frustum.
@@ -301,7 +302,7 @@ namespace glm
 	///
 	/// @tparam T A floating-point scalar type
 	template<typename T>
-	GLM_FUNC_DECL mat<4, 4, T, defaultp> perspectiveRH(
+	GLM_FUNC_DECL GLM_CONSTEXPR mat<4, 4, T, defaultp> perspectiveRH(
 		T fovy, T aspect, T near, T far);
 
 	/// Creates a matrix for a left handed, symetric perspective-view frustum.
@@ -315,7 +316,7 @@ namespace glm
 	///
 	/// @tparam T A floating-point scalar type
 	template<typename T>
-	GLM_FUNC_DECL mat<4, 4, T, defaultp> perspectiveLH(
+	GLM_FUNC_DECL GLM_CONSTEXPR mat<4, 4, T, defaultp> perspectiveLH(
 		T fovy, T aspect, T near, T far);
 
 	/// Creates a matrix for a symetric perspective-view frustum based on the default handedness and default near and far clip planes definition.
@@ -329,7 +330,7 @@ namespace glm
 	/// @tparam T A floating-point scalar type
 	/// @see <a href="https://www.khronos.org/registry/OpenGL-Refpages/gl2.1/xhtml/gluPerspective.xml">gluPerspective man page</a>
 	template<typename T>
-	GLM_FUNC_DECL mat<4, 4, T, defaultp> perspective(
+	GLM_FUNC_DECL GLM_CONSTEXPR mat<4, 4, T, defaultp> perspective(
 		T fovy, T aspect, T near, T far);
 
 	/// Builds a perspective projection matrix based on a field of view using right-handed coordinates.
@@ -343,7 +344,7 @@ namespace glm
 	///
 	/// @tparam T A floating-point scalar type
 	template<typename T>
-	GLM_FUNC_DECL mat<4, 4, T, defaultp> perspectiveFovRH_ZO(
+	GLM_FUNC_DECL GLM_CONSTEXPR mat<4, 4, T, defaultp> perspectiveFovRH_ZO(
 		T fov, T width, T height, T near, T far);
 
 	/// Builds a perspective projection matrix based on a field of view using right-handed coordinates.
@@ -357,7 +358,7 @@ namespace glm
 	///
 	/// @tparam T A floating-point scalar type
 	template<typename T>
-	GLM_FUNC_DECL mat<4, 4, T, defaultp> perspectiveFovRH_NO(
+	GLM_FUNC_DECL GLM_CONSTEXPR mat<4, 4, T, defaultp> perspectiveFovRH_NO(
 		T fov, T width, T height, T near, T far);
 
 	/// Builds a perspective projection matrix based on a field of view using left-handed coordinates.
@@ -371,7 +372,7 @@ namespace glm
 	///
 	/// @tparam T A floating-point scalar type
 	template<typename T>
-	GLM_FUNC_DECL mat<4, 4, T, defaultp> perspectiveFovLH_ZO(
+	GLM_FUNC_DECL GLM_CONSTEXPR mat<4, 4, T, defaultp> perspectiveFovLH_ZO(
 		T fov, T width, T height, T near, T far);
 
 	/// Builds a perspective projection matrix based on a field of view using left-handed coordinates.
@@ -385,7 +386,7 @@ namespace glm
 	///
 	/// @tparam T A floating-point scalar type
 	template<typename T>
-	GLM_FUNC_DECL mat<4, 4, T, defaultp> perspectiveFovLH_NO(
+	GLM_FUNC_DECL GLM_CONSTEXPR mat<4, 4, T, defaultp> perspectiveFovLH_NO(
 		T fov, T width, T height, T near, T far);
 
 	/// Builds a perspective projection matrix based on a field of view using left-handed coordinates if GLM_FORCE_LEFT_HANDED if defined or right-handed coordinates otherwise.
@@ -399,7 +400,7 @@ namespace glm
 	///
 	/// @tparam T A floating-point scalar type
 	template<typename T>
-	GLM_FUNC_DECL mat<4, 4, T, defaultp> perspectiveFovZO(
+	GLM_FUNC_DECL GLM_CONSTEXPR mat<4, 4, T, defaultp> perspectiveFovZO(
 		T fov, T width, T height, T near, T far);
 
 	/// Builds a perspective projection matrix based on a field of view using left-handed coordinates if GLM_FORCE_LEFT_HANDED if defined or right-handed coordinates otherwise.
@@ -413,7 +414,7 @@ namespace glm
 	///
 	/// @tparam T A floating-point scalar type
 	template<typename T>
-	GLM_FUNC_DECL mat<4, 4, T, defaultp> perspectiveFovNO(
+	GLM_FUNC_DECL GLM_CONSTEXPR mat<4, 4, T, defaultp> perspectiveFovNO(
 		T fov, T width, T height, T near, T far);
 
 	/// Builds a right handed perspective projection matrix based on a field of view.
@@ -428,7 +429,7 @@ namespace glm
 	///
 	/// @tparam T A floating-point scalar type
 	template<typename T>
-	GLM_FUNC_DECL mat<4, 4, T, defaultp> perspectiveFovRH(
+	GLM_FUNC_DECL GLM_CONSTEXPR mat<4, 4, T, defaultp> perspectiveFovRH(
 		T fov, T width, T height, T near, T far);
 
 	/// Builds a left handed perspective projection matrix based on a field of view.
@@ -443,7 +444,7 @@ namespace glm
 	///
 	/// @tparam T A floating-point scalar type
 	template<typename T>
-	GLM_FUNC_DECL mat<4, 4, T, defaultp> perspectiveFovLH(
+	GLM_FUNC_DECL GLM_CONSTEXPR mat<4, 4, T, defaultp> perspectiveFovLH(
 		T fov, T width, T height, T near, T far);
 
 	/// Builds a perspective projection matrix based on a field of view and the default handedness and default near and far clip planes definition.
@@ -457,7 +458,7 @@ namespace glm
 	///
 	/// @tparam T A floating-point scalar type
 	template<typename T>
-	GLM_FUNC_DECL mat<4, 4, T, defaultp> perspectiveFov(
+	GLM_FUNC_DECL GLM_CONSTEXPR mat<4, 4, T, defaultp> perspectiveFov(
 		T fov, T width, T height, T near, T far);
 
 	/// Creates a matrix for a left handed, symmetric perspective-view frustum with far plane at infinite.
@@ -468,7 +469,7 @@ namespace glm
 	///
 	/// @tparam T A floating-point scalar type
 	template<typename T>
-	GLM_FUNC_DECL mat<4, 4, T, defaultp> infinitePerspectiveLH(
+	GLM_FUNC_DECL GLM_CONSTEXPR mat<4, 4, T, defaultp> infinitePerspectiveLH(
 		T fovy, T aspect, T near);
 
 	/// Creates a matrix for a right handed, symmetric perspective-view frustum with far plane at infinite.
@@ -479,7 +480,7 @@ namespace glm
 	///
 	/// @tparam T A floating-point scalar type
 	template<typename T>
-	GLM_FUNC_DECL mat<4, 4, T, defaultp> infinitePerspectiveRH(
+	GLM_FUNC_DECL GLM_CONSTEXPR mat<4, 4, T, defaultp> infinitePerspectiveRH(
 		T fovy, T aspect, T near);
 
 	/// Creates a matrix for a symmetric perspective-view frustum with far plane at infinite with default handedness.
@@ -490,7 +491,7 @@ namespace glm
 	///
 	/// @tparam T A floating-point scalar type
 	template<typename T>
-	GLM_FUNC_DECL mat<4, 4, T, defaultp> infinitePerspective(
+	GLM_FUNC_DECL GLM_CONSTEXPR mat<4, 4, T, defaultp> infinitePerspective(
 		T fovy, T aspect, T near);
 
 	/// Creates a matrix for a symmetric perspective-view frustum with far plane at infinite for graphics hardware that doesn't support depth clamping.
@@ -501,7 +502,7 @@ namespace glm
 	///
 	/// @tparam T A floating-point scalar type
 	template<typename T>
-	GLM_FUNC_DECL mat<4, 4, T, defaultp> tweakedInfinitePerspective(
+	GLM_FUNC_DECL GLM_CONSTEXPR mat<4, 4, T, defaultp> tweakedInfinitePerspective(
 		T fovy, T aspect, T near);
 
 	/// Creates a matrix for a symmetric perspective-view frustum with far plane at infinite for graphics hardware that doesn't support depth clamping.
@@ -513,7 +514,7 @@ namespace glm
 	///
 	/// @tparam T A floating-point scalar type
 	template<typename T>
-	GLM_FUNC_DECL mat<4, 4, T, defaultp> tweakedInfinitePerspective(
+	GLM_FUNC_DECL GLM_CONSTEXPR mat<4, 4, T, defaultp> tweakedInfinitePerspective(
 		T fovy, T aspect, T near, T ep);
 
 	/// @}
@@ -1,3 +1,5 @@
+#include "../simd/quaternion.h"
+
 #if GLM_ARCH & GLM_ARCH_SSE2_BIT
 
 namespace glm{
@@ -11,6 +13,28 @@ namespace detail
 			return _mm_cvtss_f32(glm_vec1_dot(x.data, y.data));
 		}
 	};
+
+	template<qualifier Q>
+	struct compute_quat_mix<float, Q, true>
+	{
+		GLM_FUNC_QUALIFIER static qua<float, Q> call(qua<float, Q> const& x, qua<float, Q> const& y, float a)
+		{
+			qua<float, Q> Result;
+			Result.data = glm_quat_mix(x.data, y.data, a);
+			return Result;
+		}
+	};
+
+	template<qualifier Q>
+	struct compute_quat_slerp<float, Q, true>
+	{
+		GLM_FUNC_QUALIFIER static qua<float, Q> call(qua<float, Q> const& x, qua<float, Q> const& y, float a)
+		{
+			qua<float, Q> Result;
+			Result.data = glm_quat_slerp(x.data, y.data, a);
+			return Result;
+		}
+	};
 }//namespace detail
 }//namespace glm
 
@@ -1,5 +1,20 @@
-namespace glm
+namespace glm{
+namespace detail
 {
+	template<typename T, qualifier Q, bool Aligned>
+	struct compute_quat_normalize
+	{
+		GLM_FUNC_QUALIFIER static qua<T, Q> call(qua<T, Q> const& q)
+		{
+			T len = length(q);
+			if(len <= static_cast<T>(0)) // Problem
+				return qua<T, Q>(static_cast<T>(1), static_cast<T>(0), static_cast<T>(0), static_cast<T>(0));
+			T oneOverLen = static_cast<T>(1) / len;
+			return qua<T, Q>(q.w * oneOverLen, q.x * oneOverLen, q.y * oneOverLen, q.z * oneOverLen);
+		}
+	};
+}//namespace detail
+
 	template<typename T, qualifier Q>
 	GLM_FUNC_QUALIFIER T dot(qua<T, Q> const& x, qua<T, Q> const& y)
 	{
@@ -16,11 +31,7 @@ namespace glm
 	template<typename T, qualifier Q>
 	GLM_FUNC_QUALIFIER qua<T, Q> normalize(qua<T, Q> const& q)
 	{
-		T len = length(q);
-		if(len <= static_cast<T>(0)) // Problem
-			return qua<T, Q>(static_cast<T>(1), static_cast<T>(0), static_cast<T>(0), static_cast<T>(0));
-		T oneOverLen = static_cast<T>(1) / len;
-		return qua<T, Q>(q.w * oneOverLen, q.x * oneOverLen, q.y * oneOverLen, q.z * oneOverLen);
+		return detail::compute_quat_normalize<T, Q, detail::is_aligned<Q>::value>::call(q);
 	}
 
 	template<typename T, qualifier Q>
@@ -34,3 +45,6 @@ namespace glm
 	}
 }//namespace glm
 
+#if GLM_CONFIG_SIMD == GLM_ENABLE
+#	include "quaternion_geometric_simd.inl"
+#endif
@@ -0,0 +1,21 @@
+#include "../simd/quaternion.h"
+
+#if GLM_ARCH & GLM_ARCH_SSE2_BIT
+
+namespace glm{
+namespace detail
+{
+	template<qualifier Q>
+	struct compute_quat_normalize<float, Q, true>
+	{
+		GLM_FUNC_QUALIFIER static qua<float, Q> call(qua<float, Q> const& q)
+		{
+			qua<float, Q> Result;
+			Result.data = glm_quat_normalize(q.data);
+			return Result;
+		}
+	};
+}//namespace detail
+}//namespace glm
+
+#endif//GLM_ARCH & GLM_ARCH_SSE2_BIT
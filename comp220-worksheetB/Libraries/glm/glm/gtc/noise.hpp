@@ -13,6 +13,9 @@
 /// https://github.com/ashima/webgl-noise
 /// Following Stefan Gustavson's paper "Simplex noise demystified":
 /// http://www.itn.liu.se/~stegu/simplexnoise/simplexnoise.pdf
+///
+/// Arrays of points and grids are evaluated 4 or 8 points at once, with SSE2 or AVX chosen at runtime with glm_simd_features().
+/// They give the same bits as the functions of one point on packed vectors, unless the compiler fuses multiply-adds.
 
 #pragma once
 
@@ -26,6 +29,7 @@
 #include "../vec2.hpp"
 #include "../vec3.hpp"
 #include "../vec4.hpp"
+#include "../simd/dispatch.h"
 
 #if GLM_MESSAGES == GLM_ENABLE && !defined(GLM_EXT_INCLUDED)
 #	pragma message("GLM: GLM_GTC_noise extension included")
@@ -55,6 +59,94 @@ namespace glm
 	GLM_FUNC_DECL T simplex(
 		vec<L, T, Q> const& p);
 
+	/// Fractional Brownian motion: sum of Octaves octaves of perlin noise.
+	/// The first octave is perlin(p), each next octave multiplies the frequency by Lacunarity and the amplitude by Gain.
+	/// @see gtc_noise
+	template<length_t L, typename T, qualifier Q>
+	GLM_FUNC_DECL T perlinFbm(
+		vec<L, T, Q> const& p,
+		int Octaves,
+		T Lacunarity,
+		T Gain);
+
+	/// Fractional Brownian motion: sum of Octaves octaves of simplex noise.
+	/// The first octave is simplex(p), each next octave multiplies the frequency by Lacunarity and the amplitude by Gain.
+	/// @see gtc_noise
+	template<length_t L, typename T, qualifier Q>
+	GLM_FUNC_DECL T simplexFbm(
+		vec<L, T, Q> const& p,
+		int Octaves,
+		T Lacunarity,
+		T Gain);
+
+	/// Out[i] = perlin(Points[i]) for arrays of 2D or 3D points.
+	/// @see gtc_noise
+	template<length_t L, qualifier Q>
+	GLM_FUNC_DECL void perlin(
+		vec<L, float, Q> const* Points,
+		float* Out,
+		std::size_t Count);
+
+	/// Out[i] = simplex(Points[i]) for arrays of 2D or 3D points.
+	/// @see gtc_noise
+	template<length_t L, qualifier Q>
+	GLM_FUNC_DECL void simplex(
+		vec<L, float, Q> const* Points,
+		float* Out,
+		std::size_t Count);
+
+	/// Out[i] = perlinFbm(Points[i], Octaves, Lacunarity, Gain) for arrays of 2D or 3D points.
+	/// @see gtc_noise
+	template<length_t L, qualifier Q>
+	GLM_FUNC_DECL void perlinFbm(
+		vec<L, float, Q> const* Points,
+		float* Out,
+		std::size_t Count,
+		int Octaves,
+		float Lacunarity,
+		float Gain);
+
+	/// Out[i] = simplexFbm(Points[i], Octaves, Lacunarity, Gain) for arrays of 2D or 3D points.
+	/// @see gtc_noise
+	template<length_t L, qualifier Q>
+	GLM_FUNC_DECL void simplexFbm(
+		vec<L, float, Q> const* Points,
+		float* Out,
+		std::size_t Count,
+		int Octaves,
+		float Lacunarity,
+		float Gain);
+
+	/// perlinFbm over the box [Begin, End) of a 2D or 3D grid, at the points Origin + Step * (x, y, z) of the integer coordinates.
+	/// Out is the box x first: Out[((z - Begin.z) * (End.y - Begin.y) + y - Begin.y) * (End.x - Begin.x) + x - Begin.x].
+	/// A grid can be split in boxes, bands of rows for instance, filled by separate threads with the same values as the whole grid.
+	/// @see gtc_noise
+	template<length_t L, qualifier Q>
+	GLM_FUNC_DECL void perlinGrid(
+		vec<L, float, Q> const& Origin,
+		vec<L, float, Q> const& Step,
+		vec<L, int, Q> const& Begin,
+		vec<L, int, Q> const& End,
+		float* Out,
+		int Octaves,
+		float Lacunarity,
+		float Gain);
+
+	/// simplexFbm over the box [Begin, End) of a 2D or 3D grid, at the points Origin + Step * (x, y, z) of the integer coordinates.
+	/// Out is the box x first: Out[((z - Begin.z) * (End.y - Begin.y) + y - Begin.y) * (End.x - Begin.x) + x - Begin.x].
+	/// A grid can be split in boxes, bands of rows for instance, filled by separate threads with the same values as the whole grid.
+	/// @see gtc_noise
+	template<length_t L, qualifier Q>
+	GLM_FUNC_DECL void simplexGrid(
+		vec<L, float, Q> const& Origin,
+		vec<L, float, Q> const& Step,
+		vec<L, int, Q> const& Begin,
+		vec<L, int, Q> const& End,
+		float* Out,
+		int Octaves,
+		float Lacunarity,
+		float Gain);
+
 	/// @}
 }//namespace glm
 
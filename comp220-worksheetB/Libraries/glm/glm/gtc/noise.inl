@@ -5,6 +5,8 @@
 // Following Stefan Gustavson's paper "Simplex noise demystified":
 // http://www.itn.liu.se/~stegu/simplexnoise/simplexnoise.pdf
 
+#include "../simd/noise.h"
+
 namespace glm{
 namespace gtc
 {
@@ -804,4 +806,628 @@ namespace gtc
 			(dot(m0 * m0, vec<3, T, Q>(dot(p0, x0), dot(p1, x1), dot(p2, x2))) +
 			dot(m1 * m1, vec<2, T, Q>(dot(p3, x3), dot(p4, x4))));
 	}
+
+namespace detail
+{
+	// -- Arrays of points --
+
+	// The same noise of one point, four points and eight points
+	template<length_t L, bool Simplex>
+	struct noise_kernel
+	{};
+
+#	if GLM_CONFIG_SIMD_DISPATCH == GLM_ENABLE
+	// AVX versions of the glm/simd/noise.h functions, eight points at once.
+	// Only float operations, so AVX is enough; FMA isn't used, a fused multiply-add would round differently from the scalar code.
+
+	GLM_SIMD_TARGET("avx") inline __m256 noise_floor_avx(__m256 x)
+	{
+		return _mm256_floor_ps(x);
+	}
+
+	GLM_SIMD_TARGET("avx") inline __m256 noise_abs_avx(__m256 x)
+	{
+		return _mm256_andnot_ps(_mm256_set1_ps(-0.0f), x);
+	}
+
+	GLM_SIMD_TARGET("avx") inline __m256 noise_step_avx(__m256 edge, __m256 x)
+	{
+		return _mm256_andnot_ps(_mm256_cmp_ps(x, edge, _CMP_LT_OQ), _mm256_set1_ps(1.0f));
+	}
+
+	GLM_SIMD_TARGET("avx") inline __m256 noise_fract_avx(__m256 x)
+	{
+		return _mm256_sub_ps(x, noise_floor_avx(x));
+	}
+
+	GLM_SIMD_TARGET("avx") inline __m256 noise_mix_avx(__m256 x, __m256 y, __m256 a)
+	{
+		return _mm256_add_ps(x, _mm256_mul_ps(a, _mm256_sub_ps(y, x)));
+	}
+
+	GLM_SIMD_TARGET("avx") inline __m256 noise_mod_avx(__m256 x)
+	{
+		__m256 const m = _mm256_set1_ps(289.0f);
+		return _mm256_sub_ps(x, _mm256_mul_ps(m, noise_floor_avx(_mm256_div_ps(x, m))));
+	}
+
+	GLM_SIMD_TARGET("avx") inline __m256 noise_mod289_avx(__m256 x)
+	{
+		return _mm256_sub_ps(x, _mm256_mul_ps(noise_floor_avx(_mm256_mul_ps(x, _mm256_set1_ps(1.0f / 289.0f))), _mm256_set1_ps(289.0f)));
+	}
+
+	GLM_SIMD_TARGET("avx") inline __m256 noise_permute_avx(__m256 x)
+	{
+		return noise_mod289_avx(_mm256_mul_ps(_mm256_add_ps(_mm256_mul_ps(x, _mm256_set1_ps(34.0f)), _mm256_set1_ps(1.0f)), x));
+	}
+
+	GLM_SIMD_TARGET("avx") inline __m256 noise_taylorInvSqrt_avx(__m256 r)
+	{
+		return _mm256_sub_ps(_mm256_set1_ps(static_cast<float>(1.79284291400159)), _mm256_mul_ps(_mm256_set1_ps(static_cast<float>(0.85373472095314)), r));
+	}
+
+	GLM_SIMD_TARGET("avx") inline __m256 noise_fade_avx(__m256 t)
+	{
+		__m256 const t3 = _mm256_mul_ps(_mm256_mul_ps(t, t), t);
+		__m256 const poly = _mm256_add_ps(_mm256_mul_ps(t, _mm256_sub_ps(_mm256_mul_ps(t, _mm256_set1_ps(6.0f)), _mm256_set1_ps(15.0f))), _mm256_set1_ps(10.0f));
+		return _mm256_mul_ps(t3, poly);
+	}
+
+	GLM_SIMD_TARGET("avx") inline __m256 noise_perlin2_corner_avx(__m256 i, __m256 fx, __m256 fy)
+	{
+		__m256 gx = _mm256_sub_ps(_mm256_mul_ps(_mm256_set1_ps(2.0f), noise_fract_avx(_mm256_div_ps(i, _mm256_set1_ps(41.0f)))), _mm256_set1_ps(1.0f));
+		__m256 const gy = _mm256_sub_ps(noise_abs_avx(gx), _mm256_set1_ps(0.5f));
+		__m256 const tx = noise_floor_avx(_mm256_add_ps(gx, _mm256_set1_ps(0.5f)));
+		gx = _mm256_sub_ps(gx, tx);
+
+		__m256 const norm = noise_taylorInvSqrt_avx(_mm256_add_ps(_mm256_mul_ps(gx, gx), _mm256_mul_ps(gy, gy)));
+		return _mm256_add_ps(_mm256_mul_ps(_mm256_mul_ps(gx, norm), fx), _mm256_mul_ps(_mm256_mul_ps(gy, norm), fy));
+	}
+
+	GLM_SIMD_TARGET("avx") inline __m256 perlin2_avx(__m256 x, __m256 y)
+	{
+		__m256 const zero = _mm256_setzero_ps();
+		__m256 const one = _mm256_set1_ps(1.0f);
+
+		__m256 const Pix0 = noise_mod_avx(_mm256_add_ps(noise_floor_avx(x), zero));
+		__m256 const Piy0 = noise_mod_avx(_mm256_add_ps(noise_floor_avx(y), zero));
+		__m256 const Pix1 = noise_mod_avx(_mm256_add_ps(noise_floor_avx(x), one));
+		__m256 const Piy1 = noise_mod_avx(_mm256_add_ps(noise_floor_avx(y), one));
+		__m256 const Pfx0 = _mm256_sub_ps(noise_fract_avx(x), zero);
+		__m256 const Pfy0 = _mm256_sub_ps(noise_fract_avx(y), zero);
+		__m256 const Pfx1 = _mm256_sub_ps(noise_fract_avx(x), one);
+		__m256 const Pfy1 = _mm256_sub_ps(noise_fract_avx(y), one);
+
+		__m256 const px0 = noise_permute_avx(Pix0);
+		__m256 const px1 = noise_permute_avx(Pix1);
+		__m256 const n00 = noise_perlin2_corner_avx(noise_permute_avx(_mm256_add_ps(px0, Piy0)), Pfx0, Pfy0);
+		__m256 const n10 = noise_perlin2_corner_avx(noise_permute_avx(_mm256_add_ps(px1, Piy0)), Pfx1, Pfy0);
+		__m256 const n01 = noise_perlin2_corner_avx(noise_permute_avx(_mm256_add_ps(px0, Piy1)), Pfx0, Pfy1);
+		__m256 const n11 = noise_perlin2_corner_avx(noise_permute_avx(_mm256_add_ps(px1, Piy1)), Pfx1, Pfy1);
+
+		__m256 const fade_x = noise_fade_avx(Pfx0);
+		__m256 const fade_y = noise_fade_avx(Pfy0);
+		__m256 const n_x0 = noise_mix_avx(n00, n10, fade_x);
+		__m256 const n_x1 = noise_mix_avx(n01, n11, fade_x);
+		return _mm256_mul_ps(_mm256_set1_ps(static_cast<float>(2.3)), noise_mix_avx(n_x0, n_x1, fade_y));
+	}
+
+	GLM_SIMD_TARGET("avx") inline __m256 noise_perlin3_corner_avx(__m256 ixy, __m256 fx, __m256 fy, __m256 fz)
+	{
+		__m256 const zero = _mm256_setzero_ps();
+		__m256 const half = _mm256_set1_ps(0.5f);
+		__m256 const seventh = _mm256_set1_ps(static_cast<float>(1.0 / 7.0));
+
+		__m256 gx = _mm256_mul_ps(ixy, seventh);
+		__m256 gy = _mm256_sub_ps(noise_fract_avx(_mm256_mul_ps(noise_floor_avx(gx), seventh)), half);
+		gx = noise_fract_avx(gx);
+		__m256 gz = _mm256_sub_ps(_mm256_sub_ps(half, noise_abs_avx(gx)), noise_abs_avx(gy));
+		__m256 const sz = noise_step_avx(gz, zero);
+		gx = _mm256_sub_ps(gx, _mm256_mul_ps(sz, _mm256_sub_ps(noise_step_avx(zero, gx), half)));
+		gy = _mm256_sub_ps(gy, _mm256_mul_ps(sz, _mm256_sub_ps(noise_step_avx(zero, gy), half)));
+
+		__m256 const norm = noise_taylorInvSqrt_avx(_mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(gx, gx), _mm256_mul_ps(gy, gy)), _mm256_mul_ps(gz, gz)));
+		gx = _mm256_mul_ps(gx, norm);
+		gy = _mm256_mul_ps(gy, norm);
+		gz = _mm256_mul_ps(gz, norm);
+		return _mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(gx, fx), _mm256_mul_ps(gy, fy)), _mm256_mul_ps(gz, fz));
+	}
+
+	GLM_SIMD_TARGET("avx") inline __m256 perlin3_avx(__m256 x, __m256 y, __m256 z)
+	{
+		__m256 const one = _mm256_set1_ps(1.0f);
+
+		__m256 const Pix0 = noise_mod289_avx(noise_floor_avx(x));
+		__m256 const Piy0 = noise_mod289_avx(noise_floor_avx(y));
+		__m256 const Piz0 = noise_mod289_avx(noise_floor_avx(z));
+		__m256 const Pix1 = noise_mod289_avx(_mm256_add_ps(noise_floor_avx(x), one));
+		__m256 const Piy1 = noise_mod289_avx(_mm256_add_ps(noise_floor_avx(y), one));
+		__m256 const Piz1 = noise_mod289_avx(_mm256_add_ps(noise_floor_avx(z), one));
+		__m256 const Pfx0 = noise_fract_avx(x);
+		__m256 const Pfy0 = noise_fract_avx(y);
+		__m256 const Pfz0 = noise_fract_avx(z);
+		__m256 const Pfx1 = _mm256_sub_ps(Pfx0, one);
+		__m256 const Pfy1 = _mm256_sub_ps(Pfy0, one);
+		__m256 const Pfz1 = _mm256_sub_ps(Pfz0, one);
+
+		__m256 const px0 = noise_permute_avx(Pix0);
+		__m256 const px1 = noise_permute_avx(Pix1);
+		__m256 const ixy00 = noise_permute_avx(_mm256_add_ps(px0, Piy0));
+		__m256 const ixy10 = noise_permute_avx(_mm256_add_ps(px1, Piy0));
+		__m256 const ixy01 = noise_permute_avx(_mm256_add_ps(px0, Piy1));
+		__m256 const ixy11 = noise_permute_avx(_mm256_add_ps(px1, Piy1));
+
+		__m256 const n000 = noise_perlin3_corner_avx(noise_permute_avx(_mm256_add_ps(ixy00, Piz0)), Pfx0, Pfy0, Pfz0);
+		__m256 const n100 = noise_perlin3_corner_avx(noise_permute_avx(_mm256_add_ps(ixy10, Piz0)), Pfx1, Pfy0, Pfz0);
+		__m256 const n010 = noise_perlin3_corner_avx(noise_permute_avx(_mm256_add_ps(ixy01, Piz0)), Pfx0, Pfy1, Pfz0);
+		__m256 const n110 = noise_perlin3_corner_avx(noise_permute_avx(_mm256_add_ps(ixy11, Piz0)), Pfx1, Pfy1, Pfz0);
+		__m256 const n001 = noise_perlin3_corner_avx(noise_permute_avx(_mm256_add_ps(ixy00, Piz1)), Pfx0, Pfy0, Pfz1);
+		__m256 const n101 = noise_perlin3_corner_avx(noise_permute_avx(_mm256_add_ps(ixy10, Piz1)), Pfx1, Pfy0, Pfz1);
+		__m256 const n011 = noise_perlin3_corner_avx(noise_permute_avx(_mm256_add_ps(ixy01, Piz1)), Pfx0, Pfy1, Pfz1);
+		__m256 const n111 = noise_perlin3_corner_avx(noise_permute_avx(_mm256_add_ps(ixy11, Piz1)), Pfx1, Pfy1, Pfz1);
+
+		__m256 const fade_x = noise_fade_avx(Pfx0);
+		__m256 const fade_y = noise_fade_avx(Pfy0);
+		__m256 const fade_z = noise_fade_avx(Pfz0);
+		__m256 const n_z00 = noise_mix_avx(n000, n001, fade_z);
+		__m256 const n_z10 = noise_mix_avx(n100, n101, fade_z);
+		__m256 const n_z01 = noise_mix_avx(n010, n011, fade_z);
+		__m256 const n_z11 = noise_mix_avx(n110, n111, fade_z);
+		__m256 const n_yz0 = noise_mix_avx(n_z00, n_z01, fade_y);
+		__m256 const n_yz1 = noise_mix_avx(n_z10, n_z11, fade_y);
+		return _mm256_mul_ps(_mm256_set1_ps(static_cast<float>(2.2)), noise_mix_avx(n_yz0, n_yz1, fade_x));
+	}
+
+	GLM_SIMD_TARGET("avx") inline __m256 noise_simplex2_corner_avx(__m256 p, __m256 x0, __m256 y0)
+	{
+		__m256 m = _mm256_max_ps(_mm256_setzero_ps(), _mm256_sub_ps(_mm256_set1_ps(0.5f), _mm256_add_ps(_mm256_mul_ps(x0, x0), _mm256_mul_ps(y0, y0))));
+		m = _mm256_mul_ps(m, m);
+		m = _mm256_mul_ps(m, m);
+
+		__m256 const x = _mm256_sub_ps(_mm256_mul_ps(_mm256_set1_ps(2.0f), noise_fract_avx(_mm256_mul_ps(p, _mm256_set1_ps(static_cast<float>(0.024390243902439))))), _mm256_set1_ps(1.0f));
+		__m256 const h = _mm256_sub_ps(noise_abs_avx(x), _mm256_set1_ps(0.5f));
+		__m256 const ox = noise_floor_avx(_mm256_add_ps(x, _mm256_set1_ps(0.5f)));
+		__m256 const a0 = _mm256_sub_ps(x, ox);
+
+		m = _mm256_mul_ps(m, noise_taylorInvSqrt_avx(_mm256_add_ps(_mm256_mul_ps(a0, a0), _mm256_mul_ps(h, h))));
+		return _mm256_mul_ps(m, _mm256_add_ps(_mm256_mul_ps(a0, x0), _mm256_mul_ps(h, y0)));
+	}
+
+	GLM_SIMD_TARGET("avx") inline __m256 simplex2_avx(__m256 x, __m256 y)
+	{
+		__m256 const one = _mm256_set1_ps(1.0f);
+		__m256 const C0 = _mm256_set1_ps(static_cast<float>(0.211324865405187));
+		__m256 const C1 = _mm256_set1_ps(static_cast<float>(0.366025403784439));
+		__m256 const C2 = _mm256_set1_ps(static_cast<float>(-0.577350269189626));
+
+		// First corner
+		__m256 const s = _mm256_add_ps(_mm256_mul_ps(x, C1), _mm256_mul_ps(y, C1));
+		__m256 ix = noise_floor_avx(_mm256_add_ps(x, s));
+		__m256 iy = noise_floor_avx(_mm256_add_ps(y, s));
+		__m256 const t = _mm256_add_ps(_mm256_mul_ps(ix, C0), _mm256_mul_ps(iy, C0));
+		__m256 const x0 = _mm256_add_ps(_mm256_sub_ps(x, ix), t);
+		__m256 const y0 = _mm256_add_ps(_mm256_sub_ps(y, iy), t);
+
+		// Other corners
+		__m256 const cmp = _mm256_cmp_ps(x0, y0, _CMP_GT_OQ);
+		__m256 const i1x = _mm256_and_ps(cmp, one);
+		__m256 const i1y = _mm256_andnot_ps(cmp, one);
+		__m256 const x1 = _mm256_sub_ps(_mm256_add_ps(x0, C0), i1x);
+		__m256 const y1 = _mm256_sub_ps(_mm256_add_ps(y0, C0), i1y);
+		__m256 const x2 = _mm256_add_ps(x0, C2);
+		__m256 const y2 = _mm256_add_ps(y0, C2);
+
+		// Permutations
+		ix = noise_mod_avx(ix);
+		iy = noise_mod_avx(iy);
+		__m256 const p0 = noise_permute_avx(_mm256_add_ps(_mm256_add_ps(noise_permute_avx(_mm256_add_ps(iy, _mm256_setzero_ps())), ix), _mm256_setzero_ps()));
+		__m256 const p1 = noise_permute_avx(_mm256_add_ps(_mm256_add_ps(noise_permute_avx(_mm256_add_ps(iy, i1y)), ix), i1x));
+		__m256 const p2 = noise_permute_avx(_mm256_add_ps(_mm256_add_ps(noise_permute_avx(_mm256_add_ps(iy, one)), ix), one));
+
+		__m256 const n0 = noise_simplex2_corner_avx(p0, x0, y0);
+		__m256 const n1 = noise_simplex2_corner_avx(p1, x1, y1);
+		__m256 const n2 = noise_simplex2_corner_avx(p2, x2, y2);
+		return _mm256_mul_ps(_mm256_set1_ps(130.0f), _mm256_add_ps(_mm256_add_ps(n0, n1), n2));
+	}
+
+	GLM_SIMD_TARGET("avx") inline __m256 noise_simplex3_corner_avx(__m256 p, __m256 x0, __m256 y0, __m256 z0)
+	{
+		__m256 const zero = _mm256_setzero_ps();
+		__m256 const one = _mm256_set1_ps(1.0f);
+		float const n_ = static_cast<float>(0.142857142857);
+		__m256 const nsx = _mm256_set1_ps(n_ * 2.0f - 0.0f);
+		__m256 const nsy = _mm256_set1_ps(n_ * 0.5f - 1.0f);
+		__m256 const nsz = _mm256_set1_ps(n_ * 1.0f - 0.0f);
+
+		__m256 const j = _mm256_sub_ps(p, _mm256_mul_ps(_mm256_set1_ps(49.0f), noise_floor_avx(_mm256_mul_ps(_mm256_mul_ps(p, nsz), nsz))));
+		__m256 const x_ = noise_floor_avx(_mm256_mul_ps(j, nsz));
+		__m256 const y_ = noise_floor_avx(_mm256_sub_ps(j, _mm256_mul_ps(_mm256_set1_ps(7.0f), x_)));
+
+		__m256 const x = _mm256_add_ps(_mm256_mul_ps(x_, nsx), nsy);
+		__m256 const y = _mm256_add_ps(_mm256_mul_ps(y_, nsx), nsy);
+		__m256 const h = _mm256_sub_ps(_mm256_sub_ps(one, noise_abs_avx(x)), noise_abs_avx(y));
+
+		__m256 const sx = _mm256_add_ps(_mm256_mul_ps(noise_floor_avx(x), _mm256_set1_ps(2.0f)), one);
+		__m256 const sy = _mm256_add_ps(_mm256_mul_ps(noise_floor_avx(y), _mm256_set1_ps(2.0f)), one);
+		__m256 const sh = _mm256_xor_ps(noise_step_avx(h, zero), _mm256_set1_ps(-0.0f));
+
+		__m256 gx = _mm256_add_ps(x, _mm256_mul_ps(sx, sh));
+		__m256 gy = _mm256_add_ps(y, _mm256_mul_ps(sy, sh));
+		__m256 const norm = noise_taylorInvSqrt_avx(_mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(gx, gx), _mm256_mul_ps(gy, gy)), _mm256_mul_ps(h, h)));
+		gx = _mm256_mul_ps(gx, norm);
+		gy = _mm256_mul_ps(gy, norm);
+		__m256 const gz = _mm256_mul_ps(h, norm);
+		return _mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(gx, x0), _mm256_mul_ps(gy, y0)), _mm256_mul_ps(gz, z0));
+	}
+
+	GLM_SIMD_TARGET("avx") inline __m256 noise_simplex3_falloff_avx(__m256 x0, __m256 y0, __m256 z0)
+	{
+		__m256 const d = _mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(x0, x0), _mm256_mul_ps(y0, y0)), _mm256_mul_ps(z0, z0));
+		__m256 const m = _mm256_max_ps(_mm256_setzero_ps(), _mm256_sub_ps(_mm256_set1_ps(static_cast<float>(0.6)), d));
+		__m256 const m2 = _mm256_mul_ps(m, m);
+		return _mm256_mul_ps(m2, m2);
+	}
+
+	GLM_SIMD_TARGET("avx") inline __m256 simplex3_avx(__m256 x, __m256 y, __m256 z)
+	{
+		__m256 const zero = _mm256_setzero_ps();
+		__m256 const one = _mm256_set1_ps(1.0f);
+		__m256 const Cx = _mm256_set1_ps(static_cast<float>(1.0 / 6.0));
+		__m256 const Cy = _mm256_set1_ps(static_cast<float>(1.0 / 3.0));
+
+		// First corner
+		__m256 const s = _mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(x, Cy), _mm256_mul_ps(y, Cy)), _mm256_mul_ps(z, Cy));
+		__m256 ix = noise_floor_avx(_mm256_add_ps(x, s));
+		__m256 iy = noise_floor_avx(_mm256_add_ps(y, s));
+		__m256 iz = noise_floor_avx(_mm256_add_ps(z, s));
+		__m256 const t = _mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(ix, Cx), _mm256_mul_ps(iy, Cx)), _mm256_mul_ps(iz, Cx));
+		__m256 const x0 = _mm256_add_ps(_mm256_sub_ps(x, ix), t);
+		__m256 const y0 = _mm256_add_ps(_mm256_sub_ps(y, iy), t);
+		__m256 const z0 = _mm256_add_ps(_mm256_sub_ps(z, iz), t);
+
+		// Other corners, min(a, b) and max(a, b) of glm are _mm256_min_ps(b, a) and _mm256_max_ps(b, a)
+		__m256 const gx = noise_step_avx(y0, x0);
+		__m256 const gy = noise_step_avx(z0, y0);
+		__m256 const gz = noise_step_avx(x0, z0);
+		__m256 const lx = _mm256_sub_ps(one, gx);
+		__m256 const ly = _mm256_sub_ps(one, gy);
+		__m256 const lz = _mm256_sub_ps(one, gz);
+		__m256 const i1x = _mm256_min_ps(lz, gx);
+		__m256 const i1y = _mm256_min_ps(lx, gy);
+		__m256 const i1z = _mm256_min_ps(ly, gz);
+		__m256 const i2x = _mm256_max_ps(lz, gx);
+		__m256 const i2y = _mm256_max_ps(lx, gy);
+		__m256 const i2z = _mm256_max_ps(ly, gz);
+
+		__m256 const x1 = _mm256_add_ps(_mm256_sub_ps(x0, i1x), Cx);
+		__m256 const y1 = _mm256_add_ps(_mm256_sub_ps(y0, i1y), Cx);
+		__m256 const z1 = _mm256_add_ps(_mm256_sub_ps(z0, i1z), Cx);
+		__m256 const x2 = _mm256_add_ps(_mm256_sub_ps(x0, i2x), Cy);
+		__m256 const y2 = _mm256_add_ps(_mm256_sub_ps(y0, i2y), Cy);
+		__m256 const z2 = _mm256_add_ps(_mm256_sub_ps(z0, i2z), Cy);
+		__m256 const x3 = _mm256_sub_ps(x0, _mm256_set1_ps(0.5f));
+		__m256 const y3 = _mm256_sub_ps(y0, _mm256_set1_ps(0.5f));
+		__m256 const z3 = _mm256_sub_ps(z0, _mm256_set1_ps(0.5f));
+
+		// Permutations
+		ix = noise_mod289_avx(ix);
+		iy = noise_mod289_avx(iy);
+		iz = noise_mod289_avx(iz);
+		__m256 const p0 = noise_permute_avx(_mm256_add_ps(_mm256_add_ps(noise_permute_avx(_mm256_add_ps(_mm256_add_ps(noise_permute_avx(_mm256_add_ps(iz, zero)), iy), zero)), ix), zero));
+		__m256 const p1 = noise_permute_avx(_mm256_add_ps(_mm256_add_ps(noise_permute_avx(_mm256_add_ps(_mm256_add_ps(noise_permute_avx(_mm256_add_ps(iz, i1z)), iy), i1y)), ix), i1x));
+		__m256 const p2 = noise_permute_avx(_mm256_add_ps(_mm256_add_ps(noise_permute_avx(_mm256_add_ps(_mm256_add_ps(noise_permute_avx(_mm256_add_ps(iz, i2z)), iy), i2y)), ix), i2x));
+		__m256 const p3 = noise_permute_avx(_mm256_add_ps(_mm256_add_ps(noise_permute_avx(_mm256_add_ps(_mm256_add_ps(noise_permute_avx(_mm256_add_ps(iz, one)), iy), one)), ix), one));
+
+		// Mix final noise value
+		__m256 const n0 = _mm256_mul_ps(noise_simplex3_falloff_avx(x0, y0, z0), noise_simplex3_corner_avx(p0, x0, y0, z0));
+		__m256 const n1 = _mm256_mul_ps(noise_simplex3_falloff_avx(x1, y1, z1), noise_simplex3_corner_avx(p1, x1, y1, z1));
+		__m256 const n2 = _mm256_mul_ps(noise_simplex3_falloff_avx(x2, y2, z2), noise_simplex3_corner_avx(p2, x2, y2, z2));
+		__m256 const n3 = _mm256_mul_ps(noise_simplex3_falloff_avx(x3, y3, z3), noise_simplex3_corner_avx(p3, x3, y3, z3));
+		return _mm256_mul_ps(_mm256_set1_ps(42.0f), _mm256_add_ps(_mm256_add_ps(n0, n1), _mm256_add_ps(n2, n3)));
+	}
+#	endif//GLM_CONFIG_SIMD_DISPATCH == GLM_ENABLE
+
+	template<>
+	struct noise_kernel<2, false>
+	{
+		GLM_FUNC_QUALIFIER static float call(float x, float y, float)
+		{
+			return perlin(vec<2, float, packed_highp>(x, y));
+		}
+#		if GLM_ARCH & GLM_ARCH_SSE2_BIT
+		GLM_FUNC_QUALIFIER static glm_vec4 call(glm_vec4 x, glm_vec4 y, glm_vec4)
+		{
+			return glm_vec4_perlin2(x, y);
+		}
+#		endif
+#		if GLM_CONFIG_SIMD_DISPATCH == GLM_ENABLE
+		GLM_SIMD_TARGET("avx") static inline __m256 call(__m256 x, __m256 y, __m256)
+		{
+			return perlin2_avx(x, y);
+		}
+#		endif
+	};
+
+	template<>
+	struct noise_kernel<3, false>
+	{
+		GLM_FUNC_QUALIFIER static float call(float x, float y, float z)
+		{
+			return perlin(vec<3, float, packed_highp>(x, y, z));
+		}
+#		if GLM_ARCH & GLM_ARCH_SSE2_BIT
+		GLM_FUNC_QUALIFIER static glm_vec4 call(glm_vec4 x, glm_vec4 y, glm_vec4 z)
+		{
+			return glm_vec4_perlin3(x, y, z);
+		}
+#		endif
+#		if GLM_CONFIG_SIMD_DISPATCH == GLM_ENABLE
+		GLM_SIMD_TARGET("avx") static inline __m256 call(__m256 x, __m256 y, __m256 z)
+		{
+			return perlin3_avx(x, y, z);
+		}
+#		endif
+	};
+
+	template<>
+	struct noise_kernel<2, true>
+	{
+		GLM_FUNC_QUALIFIER static float call(float x, float y, float)
+		{
+			return simplex(vec<2, float, packed_highp>(x, y));
+		}
+#		if GLM_ARCH & GLM_ARCH_SSE2_BIT
+		GLM_FUNC_QUALIFIER static glm_vec4 call(glm_vec4 x, glm_vec4 y, glm_vec4)
+		{
+			return glm_vec4_simplex2(x, y);
+		}
+#		endif
+#		if GLM_CONFIG_SIMD_DISPATCH == GLM_ENABLE
+		GLM_SIMD_TARGET("avx") static inline __m256 call(__m256 x, __m256 y, __m256)
+		{
+			return simplex2_avx(x, y);
+		}
+#		endif
+	};
+
+	template<>
+	struct noise_kernel<3, true>
+	{
+		GLM_FUNC_QUALIFIER static float call(float x, float y, float z)
+		{
+			return simplex(vec<3, float, packed_highp>(x, y, z));
+		}
+#		if GLM_ARCH & GLM_ARCH_SSE2_BIT
+		GLM_FUNC_QUALIFIER static glm_vec4 call(glm_vec4 x, glm_vec4 y, glm_vec4 z)
+		{
+			return glm_vec4_simplex3(x, y, z);
+		}
+#		endif
+#		if GLM_CONFIG_SIMD_DISPATCH == GLM_ENABLE
+		GLM_SIMD_TARGET("avx") static inline __m256 call(__m256 x, __m256 y, __m256 z)
+		{
+			return simplex3_avx(x, y, z);
+		}
+#		endif
+	};
+
+	// Octaves summed like perlinFbm and simplexFbm
+	template<typename kernel>
+	GLM_FUNC_QUALIFIER float noise_fbm(float x, float y, float z, int Octaves, float Lacunarity, float Gain)
+	{
+		float Sum = kernel::call(x, y, z);
+		float Frequency = Lacunarity;
+		float Amplitude = Gain;
+		for(int i = 1; i < Octaves; ++i)
+		{
+			Sum += Amplitude * kernel::call(x * Frequency, y * Frequency, z * Frequency);
+			Frequency *= Lacunarity;
+			Amplitude *= Gain;
+		}
+		return Sum;
+	}
+
+	// Kernels evaluate Count points and return how many they evaluated,
+	// always a multiple of their width, the caller finishes the rest with noise_fbm.
+
+#	if GLM_ARCH & GLM_ARCH_SSE2_BIT
+	template<typename kernel>
+	GLM_FUNC_QUALIFIER std::size_t noise_fbm_sse2(float const* X, float const* Y, float const* Z, float* Out, std::size_t Count, int Octaves, float Lacunarity, float Gain)
+	{
+		std::size_t const Points = Count & ~static_cast<std::size_t>(3);
+		for(std::size_t i = 0; i < Points; i += 4)
+		{
+			glm_vec4 const x = _mm_loadu_ps(X + i);
+			glm_vec4 const y = _mm_loadu_ps(Y + i);
+			glm_vec4 const z = _mm_loadu_ps(Z + i);
+
+			glm_vec4 Sum = kernel::call(x, y, z);
+			float Frequency = Lacunarity;
+			float Amplitude = Gain;
+			for(int o = 1; o < Octaves; ++o)
+			{
+				glm_vec4 const f = _mm_set1_ps(Frequency);
+				Sum = _mm_add_ps(Sum, _mm_mul_ps(_mm_set1_ps(Amplitude), kernel::call(_mm_mul_ps(x, f), _mm_mul_ps(y, f), _mm_mul_ps(z, f))));
+				Frequency *= Lacunarity;
+				Amplitude *= Gain;
+			}
+			_mm_storeu_ps(Out + i, Sum);
+		}
+		return Points;
+	}
+#	endif//GLM_ARCH & GLM_ARCH_SSE2_BIT
+
+#	if GLM_CONFIG_SIMD_DISPATCH == GLM_ENABLE
+	template<typename kernel>
+	GLM_SIMD_TARGET("avx") inline std::size_t noise_fbm_avx(float const* X, float const* Y, float const* Z, float* Out, std::size_t Count, int Octaves, float Lacunarity, float Gain)
+	{
+		std::size_t const Points = Count & ~static_cast<std::size_t>(7);
+		for(std::size_t i = 0; i < Points; i += 8)
+		{
+			__m256 const x = _mm256_loadu_ps(X + i);
+			__m256 const y = _mm256_loadu_ps(Y + i);
+			__m256 const z = _mm256_loadu_ps(Z + i);
+
+			__m256 Sum = kernel::call(x, y, z);
+			float Frequency = Lacunarity;
+			float Amplitude = Gain;
+			for(int o = 1; o < Octaves; ++o)
+			{
+				__m256 const f = _mm256_set1_ps(Frequency);
+				Sum = _mm256_add_ps(Sum, _mm256_mul_ps(_mm256_set1_ps(Amplitude), kernel::call(_mm256_mul_ps(x, f), _mm256_mul_ps(y, f), _mm256_mul_ps(z, f))));
+				Frequency *= Lacunarity;
+				Amplitude *= Gain;
+			}
+			_mm256_storeu_ps(Out + i, Sum);
+		}
+		return Points;
+	}
+#	endif//GLM_CONFIG_SIMD_DISPATCH == GLM_ENABLE
+
+	template<typename kernel>
+	GLM_FUNC_QUALIFIER void noise_fbm(float const* X, float const* Y, float const* Z, float* Out, std::size_t Count, int Octaves, float Lacunarity, float Gain)
+	{
+		std::size_t Done = 0;
+		unsigned int const Features = glm_simd_features();
+#		if GLM_CONFIG_SIMD_DISPATCH == GLM_ENABLE
+			if(Features & GLM_SIMD_AVX)
+				Done = noise_fbm_avx<kernel>(X, Y, Z, Out, Count, Octaves, Lacunarity, Gain);
+			else
+#		endif
+#		if GLM_ARCH & GLM_ARCH_SSE2_BIT
+			if(Features & GLM_SIMD_SSE2)
+				Done = noise_fbm_sse2<kernel>(X, Y, Z, Out, Count, Octaves, Lacunarity, Gain);
+#		endif
+		static_cast<void>(Features);
+
+		for(std::size_t i = Done; i < Count; ++i)
+			Out[i] = noise_fbm<kernel>(X[i], Y[i], Z[i], Octaves, Lacunarity, Gain);
+	}
+
+	// Points are copied to arrays of coordinates 64 at a time, the z coordinates of 2D points stay 0
+	static std::size_t const noise_chunk = 64;
+
+	template<typename kernel, length_t L, qualifier Q>
+	GLM_FUNC_QUALIFIER void noise_points(vec<L, float, Q> const* Points, float* Out, std::size_t Count, int Octaves, float Lacunarity, float Gain)
+	{
+		GLM_STATIC_ASSERT(L == 2 || L == 3, "Arrays of noise only accept 2D and 3D points");
+
+		float Coords[3][noise_chunk] = {};
+		for(std::size_t i = 0; i < Count; i += noise_chunk)
+		{
+			std::size_t const Size = min(noise_chunk, Count - i);
+			for(std::size_t j = 0; j < Size; ++j)
+			for(length_t c = 0; c < L; ++c)
+				Coords[c][j] = Points[i + j][c];
+
+			noise_fbm<kernel>(Coords[0], Coords[1], Coords[2], Out + i, Size, Octaves, Lacunarity, Gain);
+		}
+	}
+
+	template<typename kernel, length_t L, qualifier Q>
+	GLM_FUNC_QUALIFIER void noise_grid(vec<L, float, Q> const& Origin, vec<L, float, Q> const& Step, vec<L, int, Q> const& Begin, vec<L, int, Q> const& End, float* Out, int Octaves, float Lacunarity, float Gain)
+	{
+		GLM_STATIC_ASSERT(L == 2 || L == 3, "Grids of noise only accept 2D and 3D grids");
+
+		std::size_t Rows = 1;
+		for(length_t c = 0; c < L; ++c)
+		{
+			if(End[c] <= Begin[c])
+				return;
+			if(c > 0)
+				Rows *= static_cast<std::size_t>(End[c] - Begin[c]);
+		}
+		std::size_t const Columns = static_cast<std::size_t>(End.x - Begin.x);
+
+		float Coords[3][noise_chunk] = {};
+		for(std::size_t Row = 0; Row < Rows; ++Row)
+		{
+			// Coordinates of the row, y varying faster than z
+			std::size_t Index = Row;
+			for(length_t c = 1; c < L; ++c)
+			{
+				std::size_t const Extent = static_cast<std::size_t>(End[c] - Begin[c]);
+				float const Coord = Origin[c] + static_cast<float>(Begin[c] + static_cast<int>(Index % Extent)) * Step[c];
+				for(std::size_t j = 0; j < noise_chunk; ++j)
+					Coords[c][j] = Coord;
+				Index /= Extent;
+			}
+
+			for(std::size_t i = 0; i < Columns; i += noise_chunk)
+			{
+				std::size_t const Size = min(noise_chunk, Columns - i);
+				for(std::size_t j = 0; j < Size; ++j)
+					Coords[0][j] = Origin.x + static_cast<float>(Begin.x + static_cast<int>(i + j)) * Step.x;
+
+				noise_fbm<kernel>(Coords[0], Coords[1], Coords[2], Out + Row * Columns + i, Size, Octaves, Lacunarity, Gain);
+			}
+		}
+	}
+}//namespace detail
+
+	template<length_t L, typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER T perlinFbm(vec<L, T, Q> const& p, int Octaves, T Lacunarity, T Gain)
+	{
+		T Sum = perlin(p);
+		T Frequency = Lacunarity;
+		T Amplitude = Gain;
+		for(int i = 1; i < Octaves; ++i)
+		{
+			Sum += Amplitude * perlin(p * Frequency);
+			Frequency *= Lacunarity;
+			Amplitude *= Gain;
+		}
+		return Sum;
+	}
+
+	template<length_t L, typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER T simplexFbm(vec<L, T, Q> const& p, int Octaves, T Lacunarity, T Gain)
+	{
+		T Sum = simplex(p);
+		T Frequency = Lacunarity;
+		T Amplitude = Gain;
+		for(int i = 1; i < Octaves; ++i)
+		{
+			Sum += Amplitude * simplex(p * Frequency);
+			Frequency *= Lacunarity;
+			Amplitude *= Gain;
+		}
+		return Sum;
+	}
+
+	template<length_t L, qualifier Q>
+	GLM_FUNC_QUALIFIER void perlin(vec<L, float, Q> const* Points, float* Out, std::size_t Count)
+	{
+		detail::noise_points<detail::noise_kernel<L, false> >(Points, Out, Count, 1, 1.0f, 1.0f);
+	}
+
+	template<length_t L, qualifier Q>
+	GLM_FUNC_QUALIFIER void simplex(vec<L, float, Q> const* Points, float* Out, std::size_t Count)
+	{
+		detail::noise_points<detail::noise_kernel<L, true> >(Points, Out, Count, 1, 1.0f, 1.0f);
+	}
+
+	template<length_t L, qualifier Q>
+	GLM_FUNC_QUALIFIER void perlinFbm(vec<L, float, Q> const* Points, float* Out, std::size_t Count, int Octaves, float Lacunarity, float Gain)
+	{
+		detail::noise_points<detail::noise_kernel<L, false> >(Points, Out, Count, Octaves, Lacunarity, Gain);
+	}
+
+	template<length_t L, qualifier Q>
+	GLM_FUNC_QUALIFIER void simplexFbm(vec<L, float, Q> const* Points, float* Out, std::size_t Count, int Octaves, float Lacunarity, float Gain)
+	{
+		detail::noise_points<detail::noise_kernel<L, true> >(Points, Out, Count, Octaves, Lacunarity, Gain);
+	}
+
+	template<length_t L, qualifier Q>
+	GLM_FUNC_QUALIFIER void perlinGrid(vec<L, float, Q> const& Origin, vec<L, float, Q> const& Step, vec<L, int, Q> const& Begin, vec<L, int, Q> const& End, float* Out, int Octaves, float Lacunarity, float Gain)
+	{
+		detail::noise_grid<detail::noise_kernel<L, false> >(Origin, Step, Begin, End, Out, Octaves, Lacunarity, Gain);
+	}
+
+	template<length_t L, qualifier Q>
+	GLM_FUNC_QUALIFIER void simplexGrid(vec<L, float, Q> const& Origin, vec<L, float, Q> const& Step, vec<L, int, Q> const& Begin, vec<L, int, Q> const& End, float* Out, int Octaves, float Lacunarity, float Gain)
+	{
+		detail::noise_grid<detail::noise_kernel<L, true> >(Origin, Step, Begin, End, Out, Octaves, Lacunarity, Gain);
+	}
 }//namespace glm
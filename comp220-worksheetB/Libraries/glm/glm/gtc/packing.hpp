@@ -10,11 +10,16 @@
 ///
 /// This extension provides a set of function to convert vertors to packed
 /// formats.
+///
+/// Arrays are packed and unpacked 4 or 8 values at once with SSE2, AVX2 or F16C chosen at runtime with glm_simd_features().
+/// They give the same bits as the functions of one value.
 
 #pragma once
 
 // Dependency:
 #include "type_precision.hpp"
+#include "../packing.hpp"
+#include "../simd/dispatch.h"
 
 #if GLM_MESSAGES == GLM_ENABLE && !defined(GLM_EXT_INCLUDED)
 #	pragma message("GLM: GLM_GTC_packing extension included")
@@ -721,6 +726,68 @@ namespace glm
 	/// @see int packUint2x16(u32vec2 const& v)
 	GLM_FUNC_DECL u32vec2 unpackUint2x32(uint64 p);
 
+	/// Out[i] = packHalf1x16(In[i]) for arrays.
+	/// Halfway cases round up like packHalf1x16, the F16C instructions would round them to even.
+	///
+	/// @see gtc_packing
+	/// @see uint16 packHalf1x16(float v)
+	GLM_FUNC_DECL void packHalf1x16(float const* In, uint16* Out, std::size_t Count);
+
+	/// Out[i] = unpackHalf1x16(In[i]) for arrays.
+	/// Signaling NaNs may come out quiet when F16C is used.
+	///
+	/// @see gtc_packing
+	/// @see float unpackHalf1x16(uint16 v)
+	GLM_FUNC_DECL void unpackHalf1x16(uint16 const* In, float* Out, std::size_t Count);
+
+	/// Out[i] = packUnorm4x8(In[i]) for arrays.
+	///
+	/// @see gtc_packing
+	/// @see uint32 packUnorm4x8(vec4 const& v)
+	GLM_FUNC_DECL void packUnorm4x8(vec4 const* In, uint32* Out, std::size_t Count);
+
+	/// Out[i] = unpackUnorm4x8(In[i]) for arrays.
+	///
+	/// @see gtc_packing
+	/// @see vec4 unpackUnorm4x8(uint32 p)
+	GLM_FUNC_DECL void unpackUnorm4x8(uint32 const* In, vec4* Out, std::size_t Count);
+
+	/// Out[i] = packSnorm3x10_1x2(In[i]) for arrays.
+	///
+	/// @see gtc_packing
+	/// @see uint32 packSnorm3x10_1x2(vec4 const& v)
+	GLM_FUNC_DECL void packSnorm3x10_1x2(vec4 const* In, uint32* Out, std::size_t Count);
+
+	/// Out[i] = unpackSnorm3x10_1x2(In[i]) for arrays.
+	///
+	/// @see gtc_packing
+	/// @see vec4 unpackSnorm3x10_1x2(uint32 p)
+	GLM_FUNC_DECL void unpackSnorm3x10_1x2(uint32 const* In, vec4* Out, std::size_t Count);
+
+	/// Out[i] = packF2x11_1x10(In[i]) for arrays.
+	///
+	/// @see gtc_packing
+	/// @see uint32 packF2x11_1x10(vec3 const& v)
+	GLM_FUNC_DECL void packF2x11_1x10(vec3 const* In, uint32* Out, std::size_t Count);
+
+	/// Out[i] = unpackF2x11_1x10(In[i]) for arrays.
+	///
+	/// @see gtc_packing
+	/// @see vec3 unpackF2x11_1x10(uint32 p)
+	GLM_FUNC_DECL void unpackF2x11_1x10(uint32 const* In, vec3* Out, std::size_t Count);
+
+	/// Out[i] = packF3x9_E1x5(In[i]) for arrays.
+	///
+	/// @see gtc_packing
+	/// @see uint32 packF3x9_E1x5(vec3 const& v)
+	GLM_FUNC_DECL void packF3x9_E1x5(vec3 const* In, uint32* Out, std::size_t Count);
+
+	/// Out[i] = unpackF3x9_E1x5(In[i]) for arrays.
+	///
+	/// @see gtc_packing
+	/// @see vec3 unpackF3x9_E1x5(uint32 p)
+	GLM_FUNC_DECL void unpackF3x9_E1x5(uint32 const* In, vec3* Out, std::size_t Count);
+
 
 	/// @}
 }// namespace glm
@@ -7,6 +7,7 @@
 #include "../vec3.hpp"
 #include "../vec4.hpp"
 #include "../detail/type_half.hpp"
+#include "../simd/packing.h"
 #include <cstring>
 #include <limits>
 
@@ -934,5 +935,671 @@ namespace detail
 		memcpy(&Unpack, &p, sizeof(Unpack));
 		return Unpack;
 	}
+
+namespace detail
+{
+	// -- Arrays --
+
+#	if GLM_ARCH & GLM_ARCH_SSE2_BIT
+	GLM_FUNC_QUALIFIER std::size_t packHalf1x16_sse2(float const* In, uint16* Out, std::size_t Count)
+	{
+		std::size_t i = 0;
+		for(; i + 8 <= Count; i += 8)
+		{
+			glm_ivec4 const Lo = glm_vec4_packHalf(_mm_loadu_ps(In + i));
+			glm_ivec4 const Hi = glm_vec4_packHalf(_mm_loadu_ps(In + i + 4));
+			_mm_storeu_si128(reinterpret_cast<__m128i*>(Out + i), _mm_packs_epi32(Lo, Hi));
+		}
+		return i;
+	}
+
+	GLM_FUNC_QUALIFIER std::size_t unpackHalf1x16_sse2(uint16 const* In, float* Out, std::size_t Count)
+	{
+		std::size_t i = 0;
+		for(; i + 8 <= Count; i += 8)
+		{
+			glm_ivec4 const Packed = _mm_loadu_si128(reinterpret_cast<__m128i const*>(In + i));
+			_mm_storeu_ps(Out + i, glm_vec4_unpackHalf(_mm_unpacklo_epi16(Packed, _mm_setzero_si128())));
+			_mm_storeu_ps(Out + i + 4, glm_vec4_unpackHalf(_mm_unpackhi_epi16(Packed, _mm_setzero_si128())));
+		}
+		return i;
+	}
+
+	GLM_FUNC_QUALIFIER std::size_t packUnorm4x8_sse2(vec4 const* In, uint32* Out, std::size_t Count)
+	{
+		std::size_t i = 0;
+		for(; i + 4 <= Count; i += 4)
+		{
+			float const* Data = &In[i].x;
+			glm_uvec4 const Packed = glm_vec4_packUnorm4x8(_mm_loadu_ps(Data), _mm_loadu_ps(Data + 4), _mm_loadu_ps(Data + 8), _mm_loadu_ps(Data + 12));
+			_mm_storeu_si128(reinterpret_cast<__m128i*>(Out + i), Packed);
+		}
+		return i;
+	}
+
+	GLM_FUNC_QUALIFIER std::size_t unpackUnorm4x8_sse2(uint32 const* In, vec4* Out, std::size_t Count)
+	{
+		std::size_t i = 0;
+		for(; i + 4 <= Count; i += 4)
+		{
+			glm_vec4 Unpacked[4];
+			glm_vec4_unpackUnorm4x8(_mm_loadu_si128(reinterpret_cast<__m128i const*>(In + i)), Unpacked);
+
+			float* Data = &Out[i].x;
+			for(int j = 0; j < 4; ++j)
+				_mm_storeu_ps(Data + j * 4, Unpacked[j]);
+		}
+		return i;
+	}
+
+	GLM_FUNC_QUALIFIER std::size_t packSnorm3x10_1x2_sse2(vec4 const* In, uint32* Out, std::size_t Count)
+	{
+		std::size_t i = 0;
+		for(; i + 4 <= Count; i += 4)
+		{
+			float const* Data = &In[i].x;
+			glm_uvec4 const Packed = glm_vec4_packSnorm3x10_1x2(_mm_loadu_ps(Data), _mm_loadu_ps(Data + 4), _mm_loadu_ps(Data + 8), _mm_loadu_ps(Data + 12));
+			_mm_storeu_si128(reinterpret_cast<__m128i*>(Out + i), Packed);
+		}
+		return i;
+	}
+
+	GLM_FUNC_QUALIFIER std::size_t unpackSnorm3x10_1x2_sse2(uint32 const* In, vec4* Out, std::size_t Count)
+	{
+		std::size_t i = 0;
+		for(; i + 4 <= Count; i += 4)
+		{
+			glm_vec4 Unpacked[4];
+			glm_vec4_unpackSnorm3x10_1x2(_mm_loadu_si128(reinterpret_cast<__m128i const*>(In + i)), Unpacked);
+
+			float* Data = &Out[i].x;
+			for(int j = 0; j < 4; ++j)
+				_mm_storeu_ps(Data + j * 4, Unpacked[j]);
+		}
+		return i;
+	}
+
+	GLM_FUNC_QUALIFIER std::size_t packF2x11_1x10_sse2(vec3 const* In, uint32* Out, std::size_t Count)
+	{
+		std::size_t i = 0;
+		for(; i + 4 <= Count; i += 4)
+		{
+			float const* Data = &In[i].x;
+			glm_vec4 Comp[3];
+			glm_vec4_deinterleave3(_mm_loadu_ps(Data), _mm_loadu_ps(Data + 4), _mm_loadu_ps(Data + 8), Comp);
+			_mm_storeu_si128(reinterpret_cast<__m128i*>(Out + i), glm_vec4_packF2x11_1x10(Comp[0], Comp[1], Comp[2]));
+		}
+		return i;
+	}
+
+	GLM_FUNC_QUALIFIER std::size_t unpackF2x11_1x10_sse2(uint32 const* In, vec3* Out, std::size_t Count)
+	{
+		std::size_t i = 0;
+		for(; i + 4 <= Count; i += 4)
+		{
+			glm_vec4 Comp[3], Interleaved[3];
+			glm_vec4_unpackF2x11_1x10(_mm_loadu_si128(reinterpret_cast<__m128i const*>(In + i)), Comp);
+			glm_vec4_interleave3(Comp[0], Comp[1], Comp[2], Interleaved);
+
+			float* Data = &Out[i].x;
+			for(int j = 0; j < 3; ++j)
+				_mm_storeu_ps(Data + j * 4, Interleaved[j]);
+		}
+		return i;
+	}
+
+	GLM_FUNC_QUALIFIER std::size_t packF3x9_E1x5_sse2(vec3 const* In, uint32* Out, std::size_t Count)
+	{
+		std::size_t i = 0;
+		for(; i + 4 <= Count; i += 4)
+		{
+			float const* Data = &In[i].x;
+			glm_vec4 Comp[3];
+			glm_vec4_deinterleave3(_mm_loadu_ps(Data), _mm_loadu_ps(Data + 4), _mm_loadu_ps(Data + 8), Comp);
+			_mm_storeu_si128(reinterpret_cast<__m128i*>(Out + i), glm_vec4_packF3x9_E1x5(Comp[0], Comp[1], Comp[2]));
+		}
+		return i;
+	}
+
+	GLM_FUNC_QUALIFIER std::size_t unpackF3x9_E1x5_sse2(uint32 const* In, vec3* Out, std::size_t Count)
+	{
+		std::size_t i = 0;
+		for(; i + 4 <= Count; i += 4)
+		{
+			glm_vec4 Comp[3], Interleaved[3];
+			glm_vec4_unpackF3x9_E1x5(_mm_loadu_si128(reinterpret_cast<__m128i const*>(In + i)), Comp);
+			glm_vec4_interleave3(Comp[0], Comp[1], Comp[2], Interleaved);
+
+			float* Data = &Out[i].x;
+			for(int j = 0; j < 3; ++j)
+				_mm_storeu_ps(Data + j * 4, Interleaved[j]);
+		}
+		return i;
+	}
+#	endif//GLM_ARCH & GLM_ARCH_SSE2_BIT
+
+#	if GLM_CONFIG_SIMD_DISPATCH == GLM_ENABLE
+	// AVX2 versions of the glm/simd/packing.h functions, eight values at once.
+	// FMA isn't enabled, a fused multiply-add would round differently from the scalar code.
+
+	GLM_SIMD_TARGET("avx2") inline __m256i pack_iround_avx2(__m256 x)
+	{
+		__m256i const trc0 = _mm256_cvttps_epi32(x);
+		__m256 const frc0 = _mm256_sub_ps(x, _mm256_cvtepi32_ps(trc0));
+		__m256i const up0 = _mm256_castps_si256(_mm256_cmp_ps(frc0, _mm256_set1_ps(0.5f), _CMP_GE_OQ));
+		__m256i const dn0 = _mm256_castps_si256(_mm256_cmp_ps(frc0, _mm256_set1_ps(-0.5f), _CMP_LE_OQ));
+		return _mm256_add_epi32(_mm256_sub_epi32(trc0, up0), dn0);
+	}
+
+	// Within each 128-bit lane, like _MM_TRANSPOSE4_PS
+	GLM_SIMD_TARGET("avx2") inline void pack_transpose_avx2(__m256& r0, __m256& r1, __m256& r2, __m256& r3)
+	{
+		__m256 const t0 = _mm256_unpacklo_ps(r0, r1);
+		__m256 const t1 = _mm256_unpackhi_ps(r0, r1);
+		__m256 const t2 = _mm256_unpacklo_ps(r2, r3);
+		__m256 const t3 = _mm256_unpackhi_ps(r2, r3);
+		r0 = _mm256_shuffle_ps(t0, t2, _MM_SHUFFLE(1, 0, 1, 0));
+		r1 = _mm256_shuffle_ps(t0, t2, _MM_SHUFFLE(3, 2, 3, 2));
+		r2 = _mm256_shuffle_ps(t1, t3, _MM_SHUFFLE(1, 0, 1, 0));
+		r3 = _mm256_shuffle_ps(t1, t3, _MM_SHUFFLE(3, 2, 3, 2));
+	}
+
+	// Eight vec3 from six registers to one register per component
+	GLM_SIMD_TARGET("avx2") inline void pack_deinterleave3_avx2(float const* Data, __m256 Out[3])
+	{
+		glm_vec4 Lo[3], Hi[3];
+		glm_vec4_deinterleave3(_mm_loadu_ps(Data), _mm_loadu_ps(Data + 4), _mm_loadu_ps(Data + 8), Lo);
+		glm_vec4_deinterleave3(_mm_loadu_ps(Data + 12), _mm_loadu_ps(Data + 16), _mm_loadu_ps(Data + 20), Hi);
+		for(int j = 0; j < 3; ++j)
+			Out[j] = _mm256_insertf128_ps(_mm256_castps128_ps256(Lo[j]), Hi[j], 1);
+	}
+
+	GLM_SIMD_TARGET("avx2") inline void pack_interleave3_avx2(__m256 x, __m256 y, __m256 z, float* Data)
+	{
+		glm_vec4 Lo[3], Hi[3];
+		glm_vec4_interleave3(_mm256_castps256_ps128(x), _mm256_castps256_ps128(y), _mm256_castps256_ps128(z), Lo);
+		glm_vec4_interleave3(_mm256_extractf128_ps(x, 1), _mm256_extractf128_ps(y, 1), _mm256_extractf128_ps(z, 1), Hi);
+		for(int j = 0; j < 3; ++j)
+		{
+			_mm_storeu_ps(Data + j * 4, Lo[j]);
+			_mm_storeu_ps(Data + 12 + j * 4, Hi[j]);
+		}
+	}
+
+	GLM_SIMD_TARGET("avx2") inline __m256i pack_half_avx2(__m256 v)
+	{
+		__m256i const bits = _mm256_castps_si256(v);
+		__m256i const sign = _mm256_and_si256(_mm256_srli_epi32(bits, 16), _mm256_set1_epi32(0x8000));
+		__m256i const abs0 = _mm256_and_si256(bits, _mm256_set1_epi32(0x7fffffff));
+		__m256i const man0 = _mm256_and_si256(bits, _mm256_set1_epi32(0x007fffff));
+
+		__m256i nrm0 = _mm256_srli_epi32(_mm256_add_epi32(_mm256_sub_epi32(abs0, _mm256_set1_epi32(0x38000000)), _mm256_set1_epi32(0x1000)), 13);
+		nrm0 = _mm256_min_epu32(nrm0, _mm256_set1_epi32(0x7c00));
+
+		__m256 const sig0 = _mm256_cvtepi32_ps(_mm256_or_si256(man0, _mm256_set1_epi32(0x00800000)));
+		__m256 const scl0 = _mm256_castsi256_ps(_mm256_slli_epi32(_mm256_add_epi32(_mm256_srli_epi32(abs0, 23), _mm256_set1_epi32(14)), 23));
+		__m256i const den0 = _mm256_srli_epi32(_mm256_add_epi32(_mm256_cvttps_epi32(_mm256_mul_ps(sig0, scl0)), _mm256_set1_epi32(0x1000)), 13);
+
+		__m256i const nanm = _mm256_srli_epi32(man0, 13);
+		__m256i const nan0 = _mm256_or_si256(_mm256_or_si256(nanm, _mm256_set1_epi32(0x7c00)), _mm256_and_si256(_mm256_cmpeq_epi32(nanm, _mm256_setzero_si256()), _mm256_set1_epi32(1)));
+
+		__m256i const isNrm = _mm256_cmpgt_epi32(abs0, _mm256_set1_epi32(0x387fffff));
+		__m256i const isDen = _mm256_cmpgt_epi32(abs0, _mm256_set1_epi32(0x32ffffff));
+		__m256i const isNan = _mm256_cmpgt_epi32(abs0, _mm256_set1_epi32(0x7f800000));
+
+		__m256i half = _mm256_and_si256(isDen, _mm256_blendv_epi8(den0, nrm0, isNrm));
+		half = _mm256_blendv_epi8(half, nan0, isNan);
+		return _mm256_srai_epi32(_mm256_slli_epi32(_mm256_or_si256(sign, half), 16), 16);
+	}
+
+	GLM_SIMD_TARGET("avx2") inline __m256i pack_f11_avx2(__m256 v)
+	{
+		__m256i const bits = _mm256_castps_si256(v);
+		__m256i const expo = _mm256_and_si256(_mm256_srli_epi32(_mm256_sub_epi32(_mm256_and_si256(bits, _mm256_set1_epi32(0x7f800000)), _mm256_set1_epi32(0x38000000)), 17), _mm256_set1_epi32(0x07c0));
+		__m256i const mant = _mm256_and_si256(_mm256_srli_epi32(bits, 17), _mm256_set1_epi32(0x003f));
+
+		__m256i const isZero = _mm256_castps_si256(_mm256_cmp_ps(v, _mm256_setzero_ps(), _CMP_EQ_OQ));
+		__m256i const isNan = _mm256_castps_si256(_mm256_cmp_ps(v, v, _CMP_UNORD_Q));
+		__m256i const isInf = _mm256_cmpeq_epi32(_mm256_and_si256(bits, _mm256_set1_epi32(0x7fffffff)), _mm256_set1_epi32(0x7f800000));
+
+		__m256i Pack = _mm256_andnot_si256(_mm256_or_si256(isZero, isInf), _mm256_or_si256(expo, mant));
+		Pack = _mm256_or_si256(Pack, _mm256_and_si256(isInf, _mm256_set1_epi32(0x1f << 6)));
+		return _mm256_or_si256(Pack, _mm256_and_si256(isNan, _mm256_set1_epi32(0x07ff)));
+	}
+
+	GLM_SIMD_TARGET("avx2") inline __m256i pack_f10_avx2(__m256 v)
+	{
+		__m256i const bits = _mm256_castps_si256(v);
+		__m256i const expo = _mm256_and_si256(_mm256_srli_epi32(_mm256_sub_epi32(_mm256_and_si256(bits, _mm256_set1_epi32(0x7f800000)), _mm256_set1_epi32(0x38000000)), 18), _mm256_set1_epi32(0x03e0));
+		__m256i const mant = _mm256_and_si256(_mm256_srli_epi32(bits, 18), _mm256_set1_epi32(0x001f));
+
+		__m256i const isZero = _mm256_castps_si256(_mm256_cmp_ps(v, _mm256_setzero_ps(), _CMP_EQ_OQ));
+		__m256i const isNan = _mm256_castps_si256(_mm256_cmp_ps(v, v, _CMP_UNORD_Q));
+		__m256i const isInf = _mm256_cmpeq_epi32(_mm256_and_si256(bits, _mm256_set1_epi32(0x7fffffff)), _mm256_set1_epi32(0x7f800000));
+
+		__m256i Pack = _mm256_andnot_si256(_mm256_or_si256(isZero, isInf), _mm256_or_si256(expo, mant));
+		Pack = _mm256_or_si256(Pack, _mm256_and_si256(isInf, _mm256_set1_epi32(0x1f << 5)));
+		return _mm256_or_si256(Pack, _mm256_and_si256(isNan, _mm256_set1_epi32(0x03ff)));
+	}
+
+	GLM_SIMD_TARGET("avx2") inline __m256 unpack_f11_avx2(__m256i p)
+	{
+		__m256i const expo = _mm256_and_si256(_mm256_add_epi32(_mm256_slli_epi32(_mm256_and_si256(p, _mm256_set1_epi32(0x07c0)), 17), _mm256_set1_epi32(0x38000000)), _mm256_set1_epi32(0x7f800000));
+		__m256i const mant = _mm256_slli_epi32(_mm256_and_si256(p, _mm256_set1_epi32(0x003f)), 17);
+
+		__m256i const isZero = _mm256_cmpeq_epi32(p, _mm256_setzero_si256());
+		__m256i const isSpecial = _mm256_or_si256(_mm256_cmpeq_epi32(p, _mm256_set1_epi32(0x07ff)), _mm256_cmpeq_epi32(p, _mm256_set1_epi32(0x1f << 6)));
+
+		__m256i const Result = _mm256_andnot_si256(_mm256_or_si256(isZero, isSpecial), _mm256_or_si256(expo, mant));
+		return _mm256_or_ps(_mm256_castsi256_ps(Result), _mm256_and_ps(_mm256_castsi256_ps(isSpecial), _mm256_set1_ps(-1.0f)));
+	}
+
+	GLM_SIMD_TARGET("avx2") inline __m256 unpack_f10_avx2(__m256i p)
+	{
+		__m256i const expo = _mm256_and_si256(_mm256_add_epi32(_mm256_slli_epi32(_mm256_and_si256(p, _mm256_set1_epi32(0x03e0)), 18), _mm256_set1_epi32(0x38000000)), _mm256_set1_epi32(0x7f800000));
+		__m256i const mant = _mm256_slli_epi32(_mm256_and_si256(p, _mm256_set1_epi32(0x001f)), 18);
+
+		__m256i const isZero = _mm256_cmpeq_epi32(p, _mm256_setzero_si256());
+		__m256i const isSpecial = _mm256_or_si256(_mm256_cmpeq_epi32(p, _mm256_set1_epi32(0x03ff)), _mm256_cmpeq_epi32(p, _mm256_set1_epi32(0x1f << 5)));
+
+		__m256i const Result = _mm256_andnot_si256(_mm256_or_si256(isZero, isSpecial), _mm256_or_si256(expo, mant));
+		return _mm256_or_ps(_mm256_castsi256_ps(Result), _mm256_and_ps(_mm256_castsi256_ps(isSpecial), _mm256_set1_ps(-1.0f)));
+	}
+
+	GLM_SIMD_TARGET("avx2") inline __m256i pack_f3x9_avx2(__m256 x, __m256 y, __m256 z)
+	{
+		__m256 const zero = _mm256_setzero_ps();
+		__m256 const half = _mm256_set1_ps(0.5f);
+		__m256 const SharedExpMax = _mm256_set1_ps(32768.0f);
+
+		__m256 const cx = _mm256_min_ps(SharedExpMax, _mm256_max_ps(zero, x));
+		__m256 const cy = _mm256_min_ps(SharedExpMax, _mm256_max_ps(zero, y));
+		__m256 const cz = _mm256_min_ps(SharedExpMax, _mm256_max_ps(zero, z));
+		__m256 const MaxColor = _mm256_max_ps(_mm256_max_ps(cz, cy), cx);
+
+		__m256i const MaxBits = _mm256_and_si256(_mm256_castps_si256(MaxColor), _mm256_set1_epi32(0x7fffffff));
+		__m256i const Exp = _mm256_max_epi32(_mm256_sub_epi32(_mm256_srli_epi32(MaxBits, 23), _mm256_set1_epi32(127)), _mm256_set1_epi32(-16));
+
+		__m256i const ExpSharedP = _mm256_add_epi32(Exp, _mm256_set1_epi32(16));
+		__m256 const ScaleP = _mm256_castsi256_ps(_mm256_slli_epi32(_mm256_add_epi32(ExpSharedP, _mm256_set1_epi32(127 - 24)), 23));
+		__m256i const MaxShared = _mm256_cvttps_epi32(_mm256_add_ps(_mm256_div_ps(MaxColor, ScaleP), half));
+		__m256i const ExpShared = _mm256_sub_epi32(ExpSharedP, _mm256_cmpeq_epi32(MaxShared, _mm256_set1_epi32(512)));
+		__m256 const Scale = _mm256_castsi256_ps(_mm256_slli_epi32(_mm256_add_epi32(ExpShared, _mm256_set1_epi32(127 - 24)), 23));
+
+		__m256i const mask = _mm256_set1_epi32(0x1ff);
+		__m256i Pack = _mm256_and_si256(_mm256_cvttps_epi32(_mm256_add_ps(_mm256_div_ps(cx, Scale), half)), mask);
+		Pack = _mm256_or_si256(Pack, _mm256_slli_epi32(_mm256_and_si256(_mm256_cvttps_epi32(_mm256_add_ps(_mm256_div_ps(cy, Scale), half)), mask), 9));
+		Pack = _mm256_or_si256(Pack, _mm256_slli_epi32(_mm256_and_si256(_mm256_cvttps_epi32(_mm256_add_ps(_mm256_div_ps(cz, Scale), half)), mask), 18));
+		return _mm256_or_si256(Pack, _mm256_slli_epi32(ExpShared, 27));
+	}
+
+	GLM_SIMD_TARGET("avx2") inline std::size_t packHalf1x16_avx2(float const* In, uint16* Out, std::size_t Count)
+	{
+		std::size_t i = 0;
+		for(; i + 16 <= Count; i += 16)
+		{
+			__m256i const Lo = pack_half_avx2(_mm256_loadu_ps(In + i));
+			__m256i const Hi = pack_half_avx2(_mm256_loadu_ps(In + i + 8));
+
+			// _mm256_packs_epi32 interleaves the 128-bit lanes of its operands
+			__m256i const Packed = _mm256_permute4x64_epi64(_mm256_packs_epi32(Lo, Hi), _MM_SHUFFLE(3, 1, 2, 0));
+			_mm256_storeu_si256(reinterpret_cast<__m256i*>(Out + i), Packed);
+		}
+		return i;
+	}
+
+	// F16C converts exactly, it matches unpackHalf1x16 except on signaling NaNs that it makes quiet
+	GLM_SIMD_TARGET("avx,f16c") inline std::size_t unpackHalf1x16_f16c(uint16 const* In, float* Out, std::size_t Count)
+	{
+		std::size_t i = 0;
+		for(; i + 8 <= Count; i += 8)
+			_mm256_storeu_ps(Out + i, _mm256_cvtph_ps(_mm_loadu_si128(reinterpret_cast<__m128i const*>(In + i))));
+		return i;
+	}
+
+	GLM_SIMD_TARGET("avx2") inline std::size_t packUnorm4x8_avx2(vec4 const* In, uint32* Out, std::size_t Count)
+	{
+		__m256 const zero = _mm256_setzero_ps();
+		__m256 const one = _mm256_set1_ps(1.0f);
+		__m256 const scale = _mm256_set1_ps(255.0f);
+		__m256i const order = _mm256_setr_epi32(0, 4, 1, 5, 2, 6, 3, 7);
+
+		std::size_t i = 0;
+		for(; i + 8 <= Count; i += 8)
+		{
+			float const* Data = &In[i].x;
+			__m256i Rounded[4];
+			for(int j = 0; j < 4; ++j)
+				Rounded[j] = pack_iround_avx2(_mm256_mul_ps(_mm256_min_ps(one, _mm256_max_ps(zero, _mm256_loadu_ps(Data + j * 8))), scale));
+
+			// The packs work within 128-bit lanes: vectors 0, 2, 4, 6 end in the low lane, 1, 3, 5, 7 in the high one
+			__m256i const Packed = _mm256_packus_epi16(_mm256_packs_epi32(Rounded[0], Rounded[1]), _mm256_packs_epi32(Rounded[2], Rounded[3]));
+			_mm256_storeu_si256(reinterpret_cast<__m256i*>(Out + i), _mm256_permutevar8x32_epi32(Packed, order));
+		}
+		return i;
+	}
+
+	GLM_SIMD_TARGET("avx2") inline std::size_t unpackUnorm4x8_avx2(uint32 const* In, vec4* Out, std::size_t Count)
+	{
+		__m256 const scale = _mm256_set1_ps(0.0039215686274509803921568627451f);
+
+		std::size_t i = 0;
+		for(; i + 8 <= Count; i += 8)
+		{
+			float* Data = &Out[i].x;
+			for(int j = 0; j < 4; ++j)
+			{
+				__m256i const Bytes = _mm256_cvtepu8_epi32(_mm_loadl_epi64(reinterpret_cast<__m128i const*>(In + i + j * 2)));
+				_mm256_storeu_ps(Data + j * 8, _mm256_mul_ps(_mm256_cvtepi32_ps(Bytes), scale));
+			}
+		}
+		return i;
+	}
+
+	GLM_SIMD_TARGET("avx2") inline std::size_t packSnorm3x10_1x2_avx2(vec4 const* In, uint32* Out, std::size_t Count)
+	{
+		__m256 const minV = _mm256_set1_ps(-1.0f);
+		__m256 const maxV = _mm256_set1_ps(1.0f);
+		__m256 const scale = _mm256_setr_ps(511.0f, 511.0f, 511.0f, 1.0f, 511.0f, 511.0f, 511.0f, 1.0f);
+		__m256i const mask = _mm256_set1_epi32(0x3ff);
+		__m256i const order = _mm256_setr_epi32(0, 4, 1, 5, 2, 6, 3, 7);
+
+		std::size_t i = 0;
+		for(; i + 8 <= Count; i += 8)
+		{
+			float const* Data = &In[i].x;
+			__m256 Rounded[4];
+			for(int j = 0; j < 4; ++j)
+				Rounded[j] = _mm256_castsi256_ps(pack_iround_avx2(_mm256_mul_ps(_mm256_min_ps(maxV, _mm256_max_ps(minV, _mm256_loadu_ps(Data + j * 8))), scale)));
+			pack_transpose_avx2(Rounded[0], Rounded[1], Rounded[2], Rounded[3]);
+
+			__m256i Packed = _mm256_and_si256(_mm256_castps_si256(Rounded[0]), mask);
+			Packed = _mm256_or_si256(Packed, _mm256_slli_epi32(_mm256_and_si256(_mm256_castps_si256(Rounded[1]), mask), 10));
+			Packed = _mm256_or_si256(Packed, _mm256_slli_epi32(_mm256_and_si256(_mm256_castps_si256(Rounded[2]), mask), 20));
+			Packed = _mm256_or_si256(Packed, _mm256_slli_epi32(_mm256_castps_si256(Rounded[3]), 30));
+
+			// The transposition is within 128-bit lanes: vectors 0, 2, 4, 6 in the low lane, 1, 3, 5, 7 in the high one
+			_mm256_storeu_si256(reinterpret_cast<__m256i*>(Out + i), _mm256_permutevar8x32_epi32(Packed, order));
+		}
+		return i;
+	}
+
+	GLM_SIMD_TARGET("avx2") inline std::size_t unpackSnorm3x10_1x2_avx2(uint32 const* In, vec4* Out, std::size_t Count)
+	{
+		__m256 const minV = _mm256_set1_ps(-1.0f);
+		__m256 const maxV = _mm256_set1_ps(1.0f);
+		__m256 const scale = _mm256_set1_ps(1.f / 511.f);
+		__m256i const order = _mm256_setr_epi32(0, 2, 4, 6, 1, 3, 5, 7);
+
+		std::size_t i = 0;
+		for(; i + 8 <= Count; i += 8)
+		{
+			// Even values to the low lane and odd ones to the high lane, so the transposition gives consecutive vectors
+			__m256i const p = _mm256_permutevar8x32_epi32(_mm256_loadu_si256(reinterpret_cast<__m256i const*>(In + i)), order);
+
+			__m256 Comp[4];
+			Comp[0] = _mm256_mul_ps(_mm256_cvtepi32_ps(_mm256_srai_epi32(_mm256_slli_epi32(p, 22), 22)), scale);
+			Comp[1] = _mm256_mul_ps(_mm256_cvtepi32_ps(_mm256_srai_epi32(_mm256_slli_epi32(p, 12), 22)), scale);
+			Comp[2] = _mm256_mul_ps(_mm256_cvtepi32_ps(_mm256_srai_epi32(_mm256_slli_epi32(p, 2), 22)), scale);
+			Comp[3] = _mm256_cvtepi32_ps(_mm256_srai_epi32(p, 30));
+			for(int j = 0; j < 4; ++j)
+				Comp[j] = _mm256_min_ps(maxV, _mm256_max_ps(minV, Comp[j]));
+			pack_transpose_avx2(Comp[0], Comp[1], Comp[2], Comp[3]);
+
+			float* Data = &Out[i].x;
+			for(int j = 0; j < 4; ++j)
+				_mm256_storeu_ps(Data + j * 8, Comp[j]);
+		}
+		return i;
+	}
+
+	GLM_SIMD_TARGET("avx2") inline std::size_t packF2x11_1x10_avx2(vec3 const* In, uint32* Out, std::size_t Count)
+	{
+		std::size_t i = 0;
+		for(; i + 8 <= Count; i += 8)
+		{
+			__m256 Comp[3];
+			pack_deinterleave3_avx2(&In[i].x, Comp);
+
+			__m256i Packed = pack_f11_avx2(Comp[0]);
+			Packed = _mm256_or_si256(Packed, _mm256_slli_epi32(pack_f11_avx2(Comp[1]), 11));
+			Packed = _mm256_or_si256(Packed, _mm256_slli_epi32(pack_f10_avx2(Comp[2]), 22));
+			_mm256_storeu_si256(reinterpret_cast<__m256i*>(Out + i), Packed);
+		}
+		return i;
+	}
+
+	GLM_SIMD_TARGET("avx2") inline std::size_t unpackF2x11_1x10_avx2(uint32 const* In, vec3* Out, std::size_t Count)
+	{
+		std::size_t i = 0;
+		for(; i + 8 <= Count; i += 8)
+		{
+			__m256i const p = _mm256_loadu_si256(reinterpret_cast<__m256i const*>(In + i));
+			pack_interleave3_avx2(unpack_f11_avx2(p), unpack_f11_avx2(_mm256_srli_epi32(p, 11)), unpack_f10_avx2(_mm256_srli_epi32(p, 22)), &Out[i].x);
+		}
+		return i;
+	}
+
+	GLM_SIMD_TARGET("avx2") inline std::size_t packF3x9_E1x5_avx2(vec3 const* In, uint32* Out, std::size_t Count)
+	{
+		std::size_t i = 0;
+		for(; i + 8 <= Count; i += 8)
+		{
+			__m256 Comp[3];
+			pack_deinterleave3_avx2(&In[i].x, Comp);
+			_mm256_storeu_si256(reinterpret_cast<__m256i*>(Out + i), pack_f3x9_avx2(Comp[0], Comp[1], Comp[2]));
+		}
+		return i;
+	}
+
+	GLM_SIMD_TARGET("avx2") inline std::size_t unpackF3x9_E1x5_avx2(uint32 const* In, vec3* Out, std::size_t Count)
+	{
+		__m256i const mask = _mm256_set1_epi32(0x1ff);
+
+		std::size_t i = 0;
+		for(; i + 8 <= Count; i += 8)
+		{
+			__m256i const p = _mm256_loadu_si256(reinterpret_cast<__m256i const*>(In + i));
+			__m256 const Scale = _mm256_castsi256_ps(_mm256_slli_epi32(_mm256_add_epi32(_mm256_srli_epi32(p, 27), _mm256_set1_epi32(127 - 24)), 23));
+			pack_interleave3_avx2(
+				_mm256_mul_ps(_mm256_cvtepi32_ps(_mm256_and_si256(p, mask)), Scale),
+				_mm256_mul_ps(_mm256_cvtepi32_ps(_mm256_and_si256(_mm256_srli_epi32(p, 9), mask)), Scale),
+				_mm256_mul_ps(_mm256_cvtepi32_ps(_mm256_and_si256(_mm256_srli_epi32(p, 18), mask)), Scale),
+				&Out[i].x);
+		}
+		return i;
+	}
+#	endif//GLM_CONFIG_SIMD_DISPATCH == GLM_ENABLE
+}//namespace detail
+
+	GLM_FUNC_QUALIFIER void packHalf1x16(float const* In, uint16* Out, std::size_t Count)
+	{
+		std::size_t Done = 0;
+		unsigned int const Features = glm_simd_features();
+#		if GLM_CONFIG_SIMD_DISPATCH == GLM_ENABLE
+			if(Features & GLM_SIMD_AVX2)
+				Done = detail::packHalf1x16_avx2(In, Out, Count);
+			else
+#		endif
+#		if GLM_ARCH & GLM_ARCH_SSE2_BIT
+			if(Features & GLM_SIMD_SSE2)
+				Done = detail::packHalf1x16_sse2(In, Out, Count);
+#		endif
+		static_cast<void>(Features);
+
+		for(std::size_t i = Done; i < Count; ++i)
+			Out[i] = packHalf1x16(In[i]);
+	}
+
+	GLM_FUNC_QUALIFIER void unpackHalf1x16(uint16 const* In, float* Out, std::size_t Count)
+	{
+		std::size_t Done = 0;
+		unsigned int const Features = glm_simd_features();
+#		if GLM_CONFIG_SIMD_DISPATCH == GLM_ENABLE
+			if(Features & GLM_SIMD_F16C)
+				Done = detail::unpackHalf1x16_f16c(In, Out, Count);
+			else
+#		endif
+#		if GLM_ARCH & GLM_ARCH_SSE2_BIT
+			if(Features & GLM_SIMD_SSE2)
+				Done = detail::unpackHalf1x16_sse2(In, Out, Count);
+#		endif
+		static_cast<void>(Features);
+
+		for(std::size_t i = Done; i < Count; ++i)
+			Out[i] = unpackHalf1x16(In[i]);
+	}
+
+	GLM_FUNC_QUALIFIER void packUnorm4x8(vec4 const* In, uint32* Out, std::size_t Count)
+	{
+		std::size_t Done = 0;
+		unsigned int const Features = glm_simd_features();
+#		if GLM_CONFIG_SIMD_DISPATCH == GLM_ENABLE
+			if(Features & GLM_SIMD_AVX2)
+				Done = detail::packUnorm4x8_avx2(In, Out, Count);
+			else
+#		endif
+#		if GLM_ARCH & GLM_ARCH_SSE2_BIT
+			if(Features & GLM_SIMD_SSE2)
+				Done = detail::packUnorm4x8_sse2(In, Out, Count);
+#		endif
+		static_cast<void>(Features);
+
+		for(std::size_t i = Done; i < Count; ++i)
+			Out[i] = packUnorm4x8(In[i]);
+	}
+
+	GLM_FUNC_QUALIFIER void unpackUnorm4x8(uint32 const* In, vec4* Out, std::size_t Count)
+	{
+		std::size_t Done = 0;
+		unsigned int const Features = glm_simd_features();
+#		if GLM_CONFIG_SIMD_DISPATCH == GLM_ENABLE
+			if(Features & GLM_SIMD_AVX2)
+				Done = detail::unpackUnorm4x8_avx2(In, Out, Count);
+			else
+#		endif
+#		if GLM_ARCH & GLM_ARCH_SSE2_BIT
+			if(Features & GLM_SIMD_SSE2)
+				Done = detail::unpackUnorm4x8_sse2(In, Out, Count);
+#		endif
+		static_cast<void>(Features);
+
+		for(std::size_t i = Done; i < Count; ++i)
+			Out[i] = unpackUnorm4x8(In[i]);
+	}
+
+	GLM_FUNC_QUALIFIER void packSnorm3x10_1x2(vec4 const* In, uint32* Out, std::size_t Count)
+	{
+		std::size_t Done = 0;
+		unsigned int const Features = glm_simd_features();
+#		if GLM_CONFIG_SIMD_DISPATCH == GLM_ENABLE
+			if(Features & GLM_SIMD_AVX2)
+				Done = detail::packSnorm3x10_1x2_avx2(In, Out, Count);
+			else
+#		endif
+#		if GLM_ARCH & GLM_ARCH_SSE2_BIT
+			if(Features & GLM_SIMD_SSE2)
+				Done = detail::packSnorm3x10_1x2_sse2(In, Out, Count);
+#		endif
+		static_cast<void>(Features);
+
+		for(std::size_t i = Done; i < Count; ++i)
+			Out[i] = packSnorm3x10_1x2(In[i]);
+	}
+
+	GLM_FUNC_QUALIFIER void unpackSnorm3x10_1x2(uint32 const* In, vec4* Out, std::size_t Count)
+	{
+		std::size_t Done = 0;
+		unsigned int const Features = glm_simd_features();
+#		if GLM_CONFIG_SIMD_DISPATCH == GLM_ENABLE
+			if(Features & GLM_SIMD_AVX2)
+				Done = detail::unpackSnorm3x10_1x2_avx2(In, Out, Count);
+			else
+#		endif
+#		if GLM_ARCH & GLM_ARCH_SSE2_BIT
+			if(Features & GLM_SIMD_SSE2)
+				Done = detail::unpackSnorm3x10_1x2_sse2(In, Out, Count);
+#		endif
+		static_cast<void>(Features);
+
+		for(std::size_t i = Done; i < Count; ++i)
+			Out[i] = unpackSnorm3x10_1x2(In[i]);
+	}
+
+	GLM_FUNC_QUALIFIER void packF2x11_1x10(vec3 const* In, uint32* Out, std::size_t Count)
+	{
+		std::size_t Done = 0;
+		unsigned int const Features = glm_simd_features();
+#		if GLM_CONFIG_SIMD_DISPATCH == GLM_ENABLE
+			if(Features & GLM_SIMD_AVX2)
+				Done = detail::packF2x11_1x10_avx2(In, Out, Count);
+			else
+#		endif
+#		if GLM_ARCH & GLM_ARCH_SSE2_BIT
+			if(Features & GLM_SIMD_SSE2)
+				Done = detail::packF2x11_1x10_sse2(In, Out, Count);
+#		endif
+		static_cast<void>(Features);
+
+		for(std::size_t i = Done; i < Count; ++i)
+			Out[i] = packF2x11_1x10(In[i]);
+	}
+
+	GLM_FUNC_QUALIFIER void unpackF2x11_1x10(uint32 const* In, vec3* Out, std::size_t Count)
+	{
+		std::size_t Done = 0;
+		unsigned int const Features = glm_simd_features();
+#		if GLM_CONFIG_SIMD_DISPATCH == GLM_ENABLE
+			if(Features & GLM_SIMD_AVX2)
+				Done = detail::unpackF2x11_1x10_avx2(In, Out, Count);
+			else
+#		endif
+#		if GLM_ARCH & GLM_ARCH_SSE2_BIT
+			if(Features & GLM_SIMD_SSE2)
+				Done = detail::unpackF2x11_1x10_sse2(In, Out, Count);
+#		endif
+		static_cast<void>(Features);
+
+		for(std::size_t i = Done; i < Count; ++i)
+			Out[i] = unpackF2x11_1x10(In[i]);
+	}
+
+	GLM_FUNC_QUALIFIER void packF3x9_E1x5(vec3 const* In, uint32* Out, std::size_t Count)
+	{
+		std::size_t Done = 0;
+		unsigned int const Features = glm_simd_features();
+#		if GLM_CONFIG_SIMD_DISPATCH == GLM_ENABLE
+			if(Features & GLM_SIMD_AVX2)
+				Done = detail::packF3x9_E1x5_avx2(In, Out, Count);
+			else
+#		endif
+#		if GLM_ARCH & GLM_ARCH_SSE2_BIT
+			if(Features & GLM_SIMD_SSE2)
+				Done = detail::packF3x9_E1x5_sse2(In, Out, Count);
+#		endif
+		static_cast<void>(Features);
+
+		for(std::size_t i = Done; i < Count; ++i)
+			Out[i] = packF3x9_E1x5(In[i]);
+	}
+
+	GLM_FUNC_QUALIFIER void unpackF3x9_E1x5(uint32 const* In, vec3* Out, std::size_t Count)
+	{
+		std::size_t Done = 0;
+		unsigned int const Features = glm_simd_features();
+#		if GLM_CONFIG_SIMD_DISPATCH == GLM_ENABLE
+			if(Features & GLM_SIMD_AVX2)
+				Done = detail::unpackF3x9_E1x5_avx2(In, Out, Count);
+			else
+#		endif
+#		if GLM_ARCH & GLM_ARCH_SSE2_BIT
+			if(Features & GLM_SIMD_SSE2)
+				Done = detail::unpackF3x9_E1x5_sse2(In, Out, Count);
+#		endif
+		static_cast<void>(Features);
+
+		for(std::size_t i = Done; i < Count; ++i)
+			Out[i] = unpackF3x9_E1x5(In[i]);
+	}
 }//namespace glm
 
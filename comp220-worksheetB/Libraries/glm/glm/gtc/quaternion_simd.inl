@@ -0,0 +1,40 @@
+#include "../simd/quaternion.h"
+
+#if GLM_ARCH & GLM_ARCH_SSE2_BIT
+
+namespace glm{
+namespace detail
+{
+	template<qualifier Q>
+	struct compute_mat3_cast<float, Q, true>
+	{
+		GLM_FUNC_QUALIFIER static mat<3, 3, float, Q> call(qua<float, Q> const& q)
+		{
+			glm_vec4 Columns[4];
+			glm_quat_to_mat4(q.data, Columns);
+
+			mat<3, 3, float, Q> Result;
+			for(length_t i = 0; i < 3; ++i)
+			{
+				float Column[4];
+				_mm_storeu_ps(Column, Columns[i]);
+				Result[i] = vec<3, float, Q>(Column[0], Column[1], Column[2]);
+			}
+			return Result;
+		}
+	};
+
+	template<qualifier Q>
+	struct compute_mat4_cast<float, Q, true>
+	{
+		GLM_FUNC_QUALIFIER static mat<4, 4, float, Q> call(qua<float, Q> const& q)
+		{
+			mat<4, 4, float, Q> Result;
+			glm_quat_to_mat4(q.data, &Result[0].data);
+			return Result;
+		}
+	};
+}//namespace detail
+}//namespace glm
+
+#endif//GLM_ARCH & GLM_ARCH_SSE2_BIT
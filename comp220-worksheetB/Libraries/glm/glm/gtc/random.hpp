@@ -10,6 +10,10 @@
 /// Include <glm/gtc/random.hpp> to use the features of this extension.
 ///
 /// Generate random number from various distribution methods.
+///
+/// The functions without a generator argument use std::rand.
+/// The ones taking a philox4x32 use its explicit state instead, one generator per thread,
+/// and have array versions filled with SSE2 and AVX2 chosen at runtime with glm_simd_features().
 
 #pragma once
 
@@ -17,6 +21,7 @@
 #include "../ext/scalar_int_sized.hpp"
 #include "../ext/scalar_uint_sized.hpp"
 #include "../detail/qualifier.hpp"
+#include "../simd/dispatch.h"
 
 #if GLM_MESSAGES == GLM_ENABLE && !defined(GLM_EXT_INCLUDED)
 #	pragma message("GLM: GLM_GTC_random extension included")
@@ -76,6 +81,84 @@ namespace glm
 	template<typename T>
 	GLM_FUNC_DECL vec<3, T, defaultp> ballRand(T Radius);
 
+	/// Philox4x32-10 counter based random number generator (Salmon et al., Parallel random numbers: as easy as 1, 2, 3).
+	///
+	/// Each word of a stream is a hash of the seed, the stream and the word index, there is no shared state:
+	/// give each thread its own generator with the same seed and the thread index as stream.
+	/// It satisfies UniformRandomBitGenerator so it also works with the <random> distributions.
+	///
+	/// @see gtc_random
+	struct philox4x32
+	{
+		typedef uint32 result_type;
+
+		GLM_FUNC_DECL explicit philox4x32(uint64 Seed = 0, uint64 StreamID = 0);
+
+		/// Next word of the stream
+		GLM_FUNC_DECL uint32 operator()();
+
+		/// Skip Words words, as if operator() was called Words times
+		GLM_FUNC_DECL void discard(uint64 Words);
+
+		static GLM_FUNC_QUALIFIER GLM_CONSTEXPR uint32 (min)() {return 0u;}
+		static GLM_FUNC_QUALIFIER GLM_CONSTEXPR uint32 (max)() {return 0xFFFFFFFFu;}
+
+		uint32 Key[2];
+		uint64 Stream;
+		uint64 Position; // Index of the next word
+		uint32 Buffer[4]; // Block of Position / 4 when Position isn't a multiple of 4
+	};
+
+	/// Generate random numbers in the interval [Min, Max], according a linear distribution
+	///
+	/// @tparam genType Value type. Currently supported: float or double scalars.
+	/// @see gtc_random
+	template<typename genType>
+	GLM_FUNC_DECL genType linearRand(philox4x32& Engine, genType Min, genType Max);
+
+	/// Generate random numbers according a gaussian distribution, Deviation is the standard deviation
+	///
+	/// @tparam genType Value type. Currently supported: float or double scalars.
+	/// @see gtc_random
+	template<typename genType>
+	GLM_FUNC_DECL genType gaussRand(philox4x32& Engine, genType Mean, genType Deviation);
+
+	/// Generate a random 3D vector which coordinates are regulary distributed on a sphere of a given radius
+	///
+	/// @see gtc_random
+	template<typename T>
+	GLM_FUNC_DECL vec<3, T, defaultp> sphericalRand(philox4x32& Engine, T Radius);
+
+	/// Generate a random 3D vector which coordinates are regulary distributed within the volume of a ball of a given radius
+	///
+	/// @see gtc_random
+	template<typename T>
+	GLM_FUNC_DECL vec<3, T, defaultp> ballRand(philox4x32& Engine, T Radius);
+
+	/// Fill Out with Count random numbers in the interval [Min, Max], according a linear distribution.
+	/// Array fills start on a new block of the stream and use it by blocks of 256 words.
+	///
+	/// @see gtc_random
+	GLM_FUNC_DECL void linearRand(philox4x32& Engine, float Min, float Max, float* Out, std::size_t Count);
+
+	/// Fill Out with Count random numbers according a gaussian distribution, Deviation is the standard deviation.
+	/// The SIMD code paths compute log, sin and cos with polynomials.
+	///
+	/// @see gtc_random
+	GLM_FUNC_DECL void gaussRand(philox4x32& Engine, float Mean, float Deviation, float* Out, std::size_t Count);
+
+	/// Fill Out with Count random 3D vectors regulary distributed on a sphere of a given radius.
+	///
+	/// @see gtc_random
+	template<qualifier Q>
+	GLM_FUNC_DECL void sphericalRand(philox4x32& Engine, float Radius, vec<3, float, Q>* Out, std::size_t Count);
+
+	/// Fill Out with Count random 3D vectors regulary distributed within the volume of a ball of a given radius.
+	///
+	/// @see gtc_random
+	template<qualifier Q>
+	GLM_FUNC_DECL void ballRand(philox4x32& Engine, float Radius, vec<3, float, Q>* Out, std::size_t Count);
+
 	/// @}
 }//namespace glm
 
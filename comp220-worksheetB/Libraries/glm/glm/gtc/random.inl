@@ -2,6 +2,8 @@
 #include "../exponential.hpp"
 #include "../trigonometric.hpp"
 #include "../detail/type_vec1.hpp"
+#include "../simd/exponential.h"
+#include "../simd/trigonometric.h"
 #include <cstdlib>
 #include <ctime>
 #include <cassert>
@@ -300,4 +302,526 @@ namespace detail
 
 		return vec<3, T, defaultp>(x, y, z) * Radius;
 	}
+
+namespace detail
+{
+	// -- Philox4x32-10 --
+
+	// Block Block of the stream Stream: the 128 bit counter (Block, Stream) hashed with the 64 bit key
+	GLM_FUNC_QUALIFIER void philox4x32_block(uint32 const Key[2], uint64 Stream, uint64 Block, uint32* Out)
+	{
+		uint32 c0 = static_cast<uint32>(Block);
+		uint32 c1 = static_cast<uint32>(Block >> 32);
+		uint32 c2 = static_cast<uint32>(Stream);
+		uint32 c3 = static_cast<uint32>(Stream >> 32);
+		uint32 k0 = Key[0];
+		uint32 k1 = Key[1];
+
+		for(int Round = 0; Round < 10; ++Round)
+		{
+			uint64 const p0 = static_cast<uint64>(0xD2511F53u) * c0;
+			uint64 const p1 = static_cast<uint64>(0xCD9E8D57u) * c2;
+			c0 = static_cast<uint32>(p1 >> 32) ^ c1 ^ k0;
+			c1 = static_cast<uint32>(p1);
+			c2 = static_cast<uint32>(p0 >> 32) ^ c3 ^ k1;
+			c3 = static_cast<uint32>(p0);
+			k0 += 0x9E3779B9u;
+			k1 += 0xBB67AE85u;
+		}
+
+		Out[0] = c0;
+		Out[1] = c1;
+		Out[2] = c2;
+		Out[3] = c3;
+	}
+
+	// Kernels generate Count consecutive blocks and return how many they generated,
+	// always a multiple of their width, the caller finishes the rest with philox4x32_block.
+	// Each lane hashes one block, the words are transposed back to the order of the stream.
+
+#	if GLM_ARCH & GLM_ARCH_SSE2_BIT
+	// Low and high 32 bits of the products of the four lanes of a and a constant
+	GLM_FUNC_QUALIFIER void philox4x32_mulhilo_sse2(glm_uvec4 a, glm_uvec4 m, glm_uvec4& Lo, glm_uvec4& Hi)
+	{
+		glm_uvec4 const Even = _mm_shuffle_epi32(_mm_mul_epu32(a, m), _MM_SHUFFLE(3, 1, 2, 0));
+		glm_uvec4 const Odd = _mm_shuffle_epi32(_mm_mul_epu32(_mm_srli_epi64(a, 32), m), _MM_SHUFFLE(3, 1, 2, 0));
+		Lo = _mm_unpacklo_epi32(Even, Odd);
+		Hi = _mm_unpackhi_epi32(Even, Odd);
+	}
+
+	GLM_FUNC_QUALIFIER std::size_t philox4x32_blocks_sse2(uint32 const Key[2], uint64 Stream, uint64 Block, uint32* Out, std::size_t Count)
+	{
+		glm_uvec4 const M0 = _mm_set1_epi32(static_cast<int>(0xD2511F53u));
+		glm_uvec4 const M1 = _mm_set1_epi32(static_cast<int>(0xCD9E8D57u));
+
+		std::size_t const Blocks = Count & ~static_cast<std::size_t>(3);
+		for(std::size_t i = 0; i < Blocks; i += 4)
+		{
+			uint64 const b = Block + i;
+			glm_uvec4 c0 = _mm_set_epi32(static_cast<int>(b + 3), static_cast<int>(b + 2), static_cast<int>(b + 1), static_cast<int>(b));
+			glm_uvec4 c1 = _mm_set_epi32(static_cast<int>((b + 3) >> 32), static_cast<int>((b + 2) >> 32), static_cast<int>((b + 1) >> 32), static_cast<int>(b >> 32));
+			glm_uvec4 c2 = _mm_set1_epi32(static_cast<int>(Stream));
+			glm_uvec4 c3 = _mm_set1_epi32(static_cast<int>(Stream >> 32));
+			uint32 k0 = Key[0];
+			uint32 k1 = Key[1];
+
+			for(int Round = 0; Round < 10; ++Round)
+			{
+				glm_uvec4 Lo0, Hi0, Lo1, Hi1;
+				philox4x32_mulhilo_sse2(c0, M0, Lo0, Hi0);
+				philox4x32_mulhilo_sse2(c2, M1, Lo1, Hi1);
+				c0 = _mm_xor_si128(_mm_xor_si128(Hi1, c1), _mm_set1_epi32(static_cast<int>(k0)));
+				c1 = Lo1;
+				c2 = _mm_xor_si128(_mm_xor_si128(Hi0, c3), _mm_set1_epi32(static_cast<int>(k1)));
+				c3 = Lo0;
+				k0 += 0x9E3779B9u;
+				k1 += 0xBB67AE85u;
+			}
+
+			glm_vec4 r0 = _mm_castsi128_ps(c0);
+			glm_vec4 r1 = _mm_castsi128_ps(c1);
+			glm_vec4 r2 = _mm_castsi128_ps(c2);
+			glm_vec4 r3 = _mm_castsi128_ps(c3);
+			_MM_TRANSPOSE4_PS(r0, r1, r2, r3);
+			_mm_storeu_ps(reinterpret_cast<float*>(Out + i * 4 + 0), r0);
+			_mm_storeu_ps(reinterpret_cast<float*>(Out + i * 4 + 4), r1);
+			_mm_storeu_ps(reinterpret_cast<float*>(Out + i * 4 + 8), r2);
+			_mm_storeu_ps(reinterpret_cast<float*>(Out + i * 4 + 12), r3);
+		}
+		return Blocks;
+	}
+#	endif//GLM_ARCH & GLM_ARCH_SSE2_BIT
+
+#	if GLM_CONFIG_SIMD_DISPATCH == GLM_ENABLE
+	GLM_SIMD_TARGET("avx2,fma") inline void philox4x32_mulhilo_avx2(__m256i a, __m256i m, __m256i& Lo, __m256i& Hi)
+	{
+		__m256i const Even = _mm256_shuffle_epi32(_mm256_mul_epu32(a, m), _MM_SHUFFLE(3, 1, 2, 0));
+		__m256i const Odd = _mm256_shuffle_epi32(_mm256_mul_epu32(_mm256_srli_epi64(a, 32), m), _MM_SHUFFLE(3, 1, 2, 0));
+		Lo = _mm256_unpacklo_epi32(Even, Odd);
+		Hi = _mm256_unpackhi_epi32(Even, Odd);
+	}
+
+	GLM_SIMD_TARGET("avx2,fma") inline std::size_t philox4x32_blocks_avx2(uint32 const Key[2], uint64 Stream, uint64 Block, uint32* Out, std::size_t Count)
+	{
+		__m256i const M0 = _mm256_set1_epi32(static_cast<int>(0xD2511F53u));
+		__m256i const M1 = _mm256_set1_epi32(static_cast<int>(0xCD9E8D57u));
+
+		std::size_t const Blocks = Count & ~static_cast<std::size_t>(7);
+		for(std::size_t i = 0; i < Blocks; i += 8)
+		{
+			int Low[8], High[8];
+			for(int l = 0; l < 8; ++l)
+			{
+				Low[l] = static_cast<int>(Block + i + l);
+				High[l] = static_cast<int>((Block + i + l) >> 32);
+			}
+			__m256i c0 = _mm256_loadu_si256(reinterpret_cast<__m256i const*>(Low));
+			__m256i c1 = _mm256_loadu_si256(reinterpret_cast<__m256i const*>(High));
+			__m256i c2 = _mm256_set1_epi32(static_cast<int>(Stream));
+			__m256i c3 = _mm256_set1_epi32(static_cast<int>(Stream >> 32));
+			uint32 k0 = Key[0];
+			uint32 k1 = Key[1];
+
+			for(int Round = 0; Round < 10; ++Round)
+			{
+				__m256i Lo0, Hi0, Lo1, Hi1;
+				philox4x32_mulhilo_avx2(c0, M0, Lo0, Hi0);
+				philox4x32_mulhilo_avx2(c2, M1, Lo1, Hi1);
+				c0 = _mm256_xor_si256(_mm256_xor_si256(Hi1, c1), _mm256_set1_epi32(static_cast<int>(k0)));
+				c1 = Lo1;
+				c2 = _mm256_xor_si256(_mm256_xor_si256(Hi0, c3), _mm256_set1_epi32(static_cast<int>(k1)));
+				c3 = Lo0;
+				k0 += 0x9E3779B9u;
+				k1 += 0xBB67AE85u;
+			}
+
+			// Transposed within 128 bit lanes: r0 holds the blocks 0 and 4, r1 1 and 5...
+			__m256i const t0 = _mm256_unpacklo_epi32(c0, c1);
+			__m256i const t1 = _mm256_unpacklo_epi32(c2, c3);
+			__m256i const t2 = _mm256_unpackhi_epi32(c0, c1);
+			__m256i const t3 = _mm256_unpackhi_epi32(c2, c3);
+			__m256i const r0 = _mm256_unpacklo_epi64(t0, t1);
+			__m256i const r1 = _mm256_unpackhi_epi64(t0, t1);
+			__m256i const r2 = _mm256_unpacklo_epi64(t2, t3);
+			__m256i const r3 = _mm256_unpackhi_epi64(t2, t3);
+			__m256i* Dst = reinterpret_cast<__m256i*>(Out + i * 4);
+			_mm256_storeu_si256(Dst + 0, _mm256_permute2x128_si256(r0, r1, 0x20));
+			_mm256_storeu_si256(Dst + 1, _mm256_permute2x128_si256(r2, r3, 0x20));
+			_mm256_storeu_si256(Dst + 2, _mm256_permute2x128_si256(r0, r1, 0x31));
+			_mm256_storeu_si256(Dst + 3, _mm256_permute2x128_si256(r2, r3, 0x31));
+		}
+		return Blocks;
+	}
+#	endif//GLM_CONFIG_SIMD_DISPATCH == GLM_ENABLE
+
+	GLM_FUNC_QUALIFIER void philox4x32_blocks(uint32 const Key[2], uint64 Stream, uint64 Block, uint32* Out, std::size_t Count)
+	{
+		std::size_t Done = 0;
+		unsigned int const Features = glm_simd_features();
+#		if GLM_CONFIG_SIMD_DISPATCH == GLM_ENABLE
+			if(Features & GLM_SIMD_AVX2)
+				Done = philox4x32_blocks_avx2(Key, Stream, Block, Out, Count);
+			else
+#		endif
+#		if GLM_ARCH & GLM_ARCH_SSE2_BIT
+			if(Features & GLM_SIMD_SSE2)
+				Done = philox4x32_blocks_sse2(Key, Stream, Block, Out, Count);
+#		endif
+		static_cast<void>(Features);
+
+		for(std::size_t i = Done; i < Count; ++i)
+			philox4x32_block(Key, Stream, Block + i, Out + i * 4);
+	}
+
+	// -- Array fills --
+
+	// Array fills take the words of 64 blocks at a time and transform them as structures of arrays
+	static std::size_t const rand_chunk_words = 256;
+
+	GLM_FUNC_QUALIFIER void rand_chunk(philox4x32& Engine, uint32* Words)
+	{
+		uint64 const Block = (Engine.Position + 3) / 4;
+		philox4x32_blocks(Engine.Key, Engine.Stream, Block, Words, rand_chunk_words / 4);
+		Engine.Position = (Block + rand_chunk_words / 4) * 4;
+	}
+
+	// 24 bits uniform numbers in [0, 1] and (0, 1)
+	GLM_FUNC_QUALIFIER float rand_closed(uint32 Word)
+	{
+		return static_cast<float>(Word >> 8) * (1.0f / 16777215.0f);
+	}
+
+	GLM_FUNC_QUALIFIER float rand_open(uint32 Word)
+	{
+		return (static_cast<float>(Word >> 8) + 0.5f) * (1.0f / 16777216.0f);
+	}
+
+	// Counts are multiple of 4
+	GLM_FUNC_QUALIFIER void linear_rand_scalar(uint32 const* Words, float Min, float Max, float* Out, std::size_t Count)
+	{
+		for(std::size_t i = 0; i < Count; ++i)
+			Out[i] = rand_closed(Words[i]) * (Max - Min) + Min;
+	}
+
+	// Out[i] and Out[Pairs + i] from the Box-Muller transform of Words[i] and Words[Pairs + i]
+	GLM_FUNC_QUALIFIER void gauss_rand_scalar(uint32 const* Words, float Mean, float Deviation, float* Out, std::size_t Pairs)
+	{
+		for(std::size_t i = 0; i < Pairs; ++i)
+		{
+			float const Radius = std::sqrt(-2.0f * std::log(rand_open(Words[i]))) * Deviation;
+			float const Angle = rand_open(Words[Pairs + i]) * 6.283185307179586476925286766559f;
+			Out[i] = Radius * std::cos(Angle) + Mean;
+			Out[Pairs + i] = Radius * std::sin(Angle) + Mean;
+		}
+	}
+
+	// z uniform in [-1, 1] and a uniform angle around z, from Words[i] and Words[Count + i]
+	GLM_FUNC_QUALIFIER void spherical_rand_scalar(uint32 const* Words, float Radius, float* X, float* Y, float* Z, std::size_t Count)
+	{
+		for(std::size_t i = 0; i < Count; ++i)
+		{
+			float const z = 1.0f - 2.0f * rand_closed(Words[i]);
+			float const Angle = rand_open(Words[Count + i]) * 6.283185307179586476925286766559f;
+			float const r = std::sqrt(max(1.0f - z * z, 0.0f)) * Radius;
+			X[i] = r * std::cos(Angle);
+			Y[i] = r * std::sin(Angle);
+			Z[i] = z * Radius;
+		}
+	}
+
+	// A direction from Words[i] and Words[Count + i], scaled by the largest of three uniform numbers:
+	// its cumulative distribution is r^3, the fraction of the ball volume within r.
+	GLM_FUNC_QUALIFIER void ball_rand_scalar(uint32 const* Words, float Radius, float* X, float* Y, float* Z, std::size_t Count)
+	{
+		spherical_rand_scalar(Words, Radius, X, Y, Z, Count);
+		for(std::size_t i = 0; i < Count; ++i)
+		{
+			float const r = max(max(rand_closed(Words[Count * 2 + i]), rand_closed(Words[Count * 3 + i])), rand_closed(Words[Count * 4 + i]));
+			X[i] *= r;
+			Y[i] *= r;
+			Z[i] *= r;
+		}
+	}
+
+#	if GLM_ARCH & GLM_ARCH_SSE2_BIT
+	GLM_FUNC_QUALIFIER glm_vec4 rand_closed_sse2(uint32 const* Words)
+	{
+		glm_uvec4 const Bits = _mm_srli_epi32(_mm_loadu_si128(reinterpret_cast<glm_uvec4 const*>(Words)), 8);
+		return _mm_mul_ps(_mm_cvtepi32_ps(Bits), _mm_set1_ps(1.0f / 16777215.0f));
+	}
+
+	GLM_FUNC_QUALIFIER glm_vec4 rand_open_sse2(uint32 const* Words)
+	{
+		glm_uvec4 const Bits = _mm_srli_epi32(_mm_loadu_si128(reinterpret_cast<glm_uvec4 const*>(Words)), 8);
+		return _mm_mul_ps(_mm_add_ps(_mm_cvtepi32_ps(Bits), _mm_set1_ps(0.5f)), _mm_set1_ps(1.0f / 16777216.0f));
+	}
+
+	GLM_FUNC_QUALIFIER void linear_rand_sse2(uint32 const* Words, float Min, float Max, float* Out, std::size_t Count)
+	{
+		glm_vec4 const Scale = _mm_set1_ps(Max - Min);
+		glm_vec4 const Offset = _mm_set1_ps(Min);
+		for(std::size_t i = 0; i < Count; i += 4)
+			_mm_storeu_ps(Out + i, _mm_add_ps(_mm_mul_ps(rand_closed_sse2(Words + i), Scale), Offset));
+	}
+
+	GLM_FUNC_QUALIFIER void gauss_rand_sse2(uint32 const* Words, float Mean, float Deviation, float* Out, std::size_t Pairs)
+	{
+		for(std::size_t i = 0; i < Pairs; i += 4)
+		{
+			glm_vec4 const Radius = _mm_mul_ps(_mm_sqrt_ps(_mm_mul_ps(_mm_set1_ps(-2.0f), glm_vec4_log(rand_open_sse2(Words + i)))), _mm_set1_ps(Deviation));
+			glm_vec4 const Angle = _mm_mul_ps(rand_open_sse2(Words + Pairs + i), _mm_set1_ps(6.283185307179586476925286766559f));
+			_mm_storeu_ps(Out + i, _mm_add_ps(_mm_mul_ps(Radius, glm_vec4_cos(Angle)), _mm_set1_ps(Mean)));
+			_mm_storeu_ps(Out + Pairs + i, _mm_add_ps(_mm_mul_ps(Radius, glm_vec4_sin(Angle)), _mm_set1_ps(Mean)));
+		}
+	}
+
+	GLM_FUNC_QUALIFIER void spherical_rand_sse2(uint32 const* Words, float Radius, float* X, float* Y, float* Z, std::size_t Count)
+	{
+		glm_vec4 const One = _mm_set1_ps(1.0f);
+		for(std::size_t i = 0; i < Count; i += 4)
+		{
+			glm_vec4 const z = _mm_sub_ps(One, _mm_mul_ps(_mm_set1_ps(2.0f), rand_closed_sse2(Words + i)));
+			glm_vec4 const Angle = _mm_mul_ps(rand_open_sse2(Words + Count + i), _mm_set1_ps(6.283185307179586476925286766559f));
+			glm_vec4 const r = _mm_mul_ps(_mm_sqrt_ps(_mm_max_ps(_mm_sub_ps(One, _mm_mul_ps(z, z)), _mm_setzero_ps())), _mm_set1_ps(Radius));
+			_mm_storeu_ps(X + i, _mm_mul_ps(r, glm_vec4_cos(Angle)));
+			_mm_storeu_ps(Y + i, _mm_mul_ps(r, glm_vec4_sin(Angle)));
+			_mm_storeu_ps(Z + i, _mm_mul_ps(z, _mm_set1_ps(Radius)));
+		}
+	}
+
+	GLM_FUNC_QUALIFIER void ball_rand_sse2(uint32 const* Words, float Radius, float* X, float* Y, float* Z, std::size_t Count)
+	{
+		spherical_rand_sse2(Words, Radius, X, Y, Z, Count);
+		for(std::size_t i = 0; i < Count; i += 4)
+		{
+			glm_vec4 const r = _mm_max_ps(_mm_max_ps(rand_closed_sse2(Words + Count * 2 + i), rand_closed_sse2(Words + Count * 3 + i)), rand_closed_sse2(Words + Count * 4 + i));
+			_mm_storeu_ps(X + i, _mm_mul_ps(_mm_loadu_ps(X + i), r));
+			_mm_storeu_ps(Y + i, _mm_mul_ps(_mm_loadu_ps(Y + i), r));
+			_mm_storeu_ps(Z + i, _mm_mul_ps(_mm_loadu_ps(Z + i), r));
+		}
+	}
+#	endif//GLM_ARCH & GLM_ARCH_SSE2_BIT
+
+	// Picks the SSE2 transform of the array fills, or the scalar one
+	GLM_FUNC_QUALIFIER bool rand_use_sse2()
+	{
+#		if GLM_ARCH & GLM_ARCH_SSE2_BIT
+			return (glm_simd_features() & GLM_SIMD_SSE2) != 0;
+#		else
+			return false;
+#		endif
+	}
+
+	template<typename T>
+	struct compute_rand_unit
+	{
+		GLM_FUNC_QUALIFIER static T closed(philox4x32& Engine);
+		GLM_FUNC_QUALIFIER static T open(philox4x32& Engine);
+	};
+
+	template<>
+	struct compute_rand_unit<float>
+	{
+		GLM_FUNC_QUALIFIER static float closed(philox4x32& Engine)
+		{
+			return rand_closed(Engine());
+		}
+
+		GLM_FUNC_QUALIFIER static float open(philox4x32& Engine)
+		{
+			return rand_open(Engine());
+		}
+	};
+
+	// 53 bits from two words
+	template<>
+	struct compute_rand_unit<double>
+	{
+		GLM_FUNC_QUALIFIER static double bits(philox4x32& Engine)
+		{
+			uint64 const High = Engine() >> 5;
+			uint64 const Low = Engine() >> 6;
+			return static_cast<double>((High << 26) | Low);
+		}
+
+		GLM_FUNC_QUALIFIER static double closed(philox4x32& Engine)
+		{
+			return bits(Engine) * (1.0 / 9007199254740991.0);
+		}
+
+		GLM_FUNC_QUALIFIER static double open(philox4x32& Engine)
+		{
+			return (bits(Engine) + 0.5) * (1.0 / 9007199254740992.0);
+		}
+	};
+}//namespace detail
+
+	GLM_FUNC_QUALIFIER philox4x32::philox4x32(uint64 Seed, uint64 StreamID)
+		: Stream(StreamID)
+		, Position(0)
+	{
+		this->Key[0] = static_cast<uint32>(Seed);
+		this->Key[1] = static_cast<uint32>(Seed >> 32);
+		for(int i = 0; i < 4; ++i)
+			this->Buffer[i] = 0;
+	}
+
+	GLM_FUNC_QUALIFIER uint32 philox4x32::operator()()
+	{
+		if(this->Position % 4 == 0)
+			detail::philox4x32_block(this->Key, this->Stream, this->Position / 4, this->Buffer);
+		return this->Buffer[this->Position++ % 4];
+	}
+
+	GLM_FUNC_QUALIFIER void philox4x32::discard(uint64 Words)
+	{
+		this->Position += Words;
+		if(this->Position % 4 != 0)
+			detail::philox4x32_block(this->Key, this->Stream, this->Position / 4, this->Buffer);
+	}
+
+	template<typename genType>
+	GLM_FUNC_QUALIFIER genType linearRand(philox4x32& Engine, genType Min, genType Max)
+	{
+		GLM_STATIC_ASSERT(std::numeric_limits<genType>::is_iec559, "'linearRand' with a generator only accepts floating-point inputs");
+
+		return detail::compute_rand_unit<genType>::closed(Engine) * (Max - Min) + Min;
+	}
+
+	template<typename genType>
+	GLM_FUNC_QUALIFIER genType gaussRand(philox4x32& Engine, genType Mean, genType Deviation)
+	{
+		GLM_STATIC_ASSERT(std::numeric_limits<genType>::is_iec559, "'gaussRand' with a generator only accepts floating-point inputs");
+
+		genType const Radius = sqrt(static_cast<genType>(-2) * log(detail::compute_rand_unit<genType>::open(Engine)));
+		genType const Angle = detail::compute_rand_unit<genType>::open(Engine) * static_cast<genType>(6.283185307179586476925286766559);
+		return Radius * cos(Angle) * Deviation + Mean;
+	}
+
+	template<typename T>
+	GLM_FUNC_QUALIFIER vec<3, T, defaultp> sphericalRand(philox4x32& Engine, T Radius)
+	{
+		GLM_STATIC_ASSERT(std::numeric_limits<T>::is_iec559, "'sphericalRand' with a generator only accepts floating-point inputs");
+
+		T const z = static_cast<T>(1) - static_cast<T>(2) * detail::compute_rand_unit<T>::closed(Engine);
+		T const Angle = detail::compute_rand_unit<T>::open(Engine) * static_cast<T>(6.283185307179586476925286766559);
+		T const r = sqrt(max(static_cast<T>(1) - z * z, static_cast<T>(0)));
+		return vec<3, T, defaultp>(r * cos(Angle), r * sin(Angle), z) * Radius;
+	}
+
+	template<typename T>
+	GLM_FUNC_QUALIFIER vec<3, T, defaultp> ballRand(philox4x32& Engine, T Radius)
+	{
+		vec<3, T, defaultp> const Direction = sphericalRand(Engine, Radius);
+		T const r0 = detail::compute_rand_unit<T>::closed(Engine);
+		T const r1 = detail::compute_rand_unit<T>::closed(Engine);
+		T const r2 = detail::compute_rand_unit<T>::closed(Engine);
+		return Direction * max(max(r0, r1), r2);
+	}
+
+	GLM_FUNC_QUALIFIER void linearRand(philox4x32& Engine, float Min, float Max, float* Out, std::size_t Count)
+	{
+		std::size_t const Chunk = detail::rand_chunk_words;
+		bool const SSE2 = detail::rand_use_sse2();
+
+		for(std::size_t i = 0; i < Count; i += Chunk)
+		{
+			uint32 Words[Chunk];
+			float Values[Chunk];
+			detail::rand_chunk(Engine, Words);
+
+			std::size_t const Size = min(Chunk, Count - i);
+			float* Dst = Size == Chunk ? Out + i : Values;
+#			if GLM_ARCH & GLM_ARCH_SSE2_BIT
+				if(SSE2)
+					detail::linear_rand_sse2(Words, Min, Max, Dst, Chunk);
+				else
+#			endif
+					detail::linear_rand_scalar(Words, Min, Max, Dst, Chunk);
+
+			if(Dst == Values)
+				for(std::size_t j = 0; j < Size; ++j)
+					Out[i + j] = Values[j];
+		}
+		static_cast<void>(SSE2);
+	}
+
+	GLM_FUNC_QUALIFIER void gaussRand(philox4x32& Engine, float Mean, float Deviation, float* Out, std::size_t Count)
+	{
+		std::size_t const Chunk = detail::rand_chunk_words;
+		bool const SSE2 = detail::rand_use_sse2();
+
+		for(std::size_t i = 0; i < Count; i += Chunk)
+		{
+			uint32 Words[Chunk];
+			float Values[Chunk];
+			detail::rand_chunk(Engine, Words);
+
+			std::size_t const Size = min(Chunk, Count - i);
+			float* Dst = Size == Chunk ? Out + i : Values;
+#			if GLM_ARCH & GLM_ARCH_SSE2_BIT
+				if(SSE2)
+					detail::gauss_rand_sse2(Words, Mean, Deviation, Dst, Chunk / 2);
+				else
+#			endif
+					detail::gauss_rand_scalar(Words, Mean, Deviation, Dst, Chunk / 2);
+
+			if(Dst == Values)
+				for(std::size_t j = 0; j < Size; ++j)
+					Out[i + j] = Values[j];
+		}
+		static_cast<void>(SSE2);
+	}
+
+	template<qualifier Q>
+	GLM_FUNC_QUALIFIER void sphericalRand(philox4x32& Engine, float Radius, vec<3, float, Q>* Out, std::size_t Count)
+	{
+		// Two words per vector
+		std::size_t const Chunk = detail::rand_chunk_words / 2;
+		bool const SSE2 = detail::rand_use_sse2();
+
+		for(std::size_t i = 0; i < Count; i += Chunk)
+		{
+			uint32 Words[detail::rand_chunk_words];
+			float X[Chunk], Y[Chunk], Z[Chunk];
+			detail::rand_chunk(Engine, Words);
+
+#			if GLM_ARCH & GLM_ARCH_SSE2_BIT
+				if(SSE2)
+					detail::spherical_rand_sse2(Words, Radius, X, Y, Z, Chunk);
+				else
+#			endif
+					detail::spherical_rand_scalar(Words, Radius, X, Y, Z, Chunk);
+
+			for(std::size_t j = 0, n = min(Chunk, Count - i); j < n; ++j)
+				Out[i + j] = vec<3, float, Q>(X[j], Y[j], Z[j]);
+		}
+		static_cast<void>(SSE2);
+	}
+
+	template<qualifier Q>
+	GLM_FUNC_QUALIFIER void ballRand(philox4x32& Engine, float Radius, vec<3, float, Q>* Out, std::size_t Count)
+	{
+		// Five words per vector, 240 of the 256 words of a chunk
+		std::size_t const Chunk = 48;
+		bool const SSE2 = detail::rand_use_sse2();
+
+		for(std::size_t i = 0; i < Count; i += Chunk)
+		{
+			uint32 Words[detail::rand_chunk_words];
+			float X[Chunk], Y[Chunk], Z[Chunk];
+			detail::rand_chunk(Engine, Words);
+
+#			if GLM_ARCH & GLM_ARCH_SSE2_BIT
+				if(SSE2)
+					detail::ball_rand_sse2(Words, Radius, X, Y, Z, Chunk);
+				else
+#			endif
+					detail::ball_rand_scalar(Words, Radius, X, Y, Z, Chunk);
+
+			for(std::size_t j = 0, n = min(Chunk, Count - i); j < n; ++j)
+				Out[i + j] = vec<3, float, Q>(X[j], Y[j], Z[j]);
+		}
+		static_cast<void>(SSE2);
+	}
 }//namespace glm
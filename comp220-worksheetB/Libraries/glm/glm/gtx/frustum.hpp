@@ -0,0 +1,138 @@
+/// @ref gtx_frustum
+/// @file glm/gtx/frustum.hpp
+///
+/// @see core (dependence)
+/// @see ext_matrix_clip_space
+///
+/// @defgroup gtx_frustum GLM_GTX_frustum
+/// @ingroup gtx
+///
+/// Include <glm/gtx/frustum.hpp> to use the features of this extension.
+///
+/// View frustum planes extracted from a view-projection matrix, to cull spheres and boxes.
+/// The packet functions test 4 or 8 bounding volumes stored as structures of arrays at once,
+/// with SSE2 or AVX code chosen at runtime with glm_simd_features().
+
+#pragma once
+
+// Dependency:
+#include "../glm.hpp"
+#include "../simd/dispatch.h"
+
+#ifndef GLM_ENABLE_EXPERIMENTAL
+#	error "GLM: GLM_GTX_frustum is an experimental extension and may change in the future. Use #define GLM_ENABLE_EXPERIMENTAL before including it, if you really want to use it."
+#endif
+
+#if GLM_MESSAGES == GLM_ENABLE && !defined(GLM_EXT_INCLUDED)
+#	pragma message("GLM: GLM_GTX_frustum extension included")
+#endif
+
+namespace glm
+{
+	/// @addtogroup gtx_frustum
+	/// @{
+
+	/// The six planes of a view frustum, in the order left, right, bottom, top, near and far.
+	/// A plane (a, b, c, d) keeps the points p where a * p.x + b * p.y + c * p.z + d >= 0, its normal has unit length.
+	///
+	/// @see gtx_frustum
+	template<typename T, qualifier Q = defaultp>
+	struct tfrustum
+	{
+		// -- Implementation detail --
+
+		typedef T value_type;
+		typedef vec<4, T, Q> plane_type;
+
+		// -- Data --
+
+		plane_type planes[6];
+
+		// -- Component accesses --
+
+		typedef length_t length_type;
+		/// Return the count of planes of a frustum
+		GLM_FUNC_DECL static GLM_CONSTEXPR length_type length(){return 6;}
+
+		GLM_FUNC_DECL plane_type & operator[](length_type i);
+		GLM_FUNC_DECL plane_type const& operator[](length_type i) const;
+
+		// -- Implicit basic constructors --
+
+		GLM_FUNC_DECL tfrustum() GLM_DEFAULT;
+
+		// -- Explicit basic constructors --
+
+		/// Extract the planes of the clip volume of a view-projection or model-view-projection matrix (Gribb and Hartmann).
+		/// The planes are in the space the matrix transforms from, the near plane follows GLM_FORCE_DEPTH_ZERO_TO_ONE.
+		GLM_FUNC_DECL GLM_EXPLICIT tfrustum(mat<4, 4, T, Q> const& viewProj);
+	};
+
+	/// Frustum of single-qualifier floating-point numbers.
+	///
+	/// @see gtx_frustum
+	typedef tfrustum<float, defaultp>	ffrustum;
+
+	/// Frustum of double-qualifier floating-point numbers.
+	///
+	/// @see gtx_frustum
+	typedef tfrustum<double, defaultp>	dfrustum;
+
+	/// Return true when a sphere is at least partly inside the frustum.
+	/// Spheres near the corners of the frustum may be reported inside while they are outside.
+	///
+	/// @see gtx_frustum
+	template<typename T, qualifier Q>
+	GLM_FUNC_DECL bool intersectFrustumSphere(
+		tfrustum<T, Q> const& f,
+		vec<3, T, Q> const& center, T radius);
+
+	/// Return true when an axis aligned box is at least partly inside the frustum.
+	/// Boxes near the corners of the frustum may be reported inside while they are outside.
+	///
+	/// @see gtx_frustum
+	template<typename T, qualifier Q>
+	GLM_FUNC_DECL bool intersectFrustumAABB(
+		tfrustum<T, Q> const& f,
+		vec<3, T, Q> const& boxMin, vec<3, T, Q> const& boxMax);
+
+	/// Return true when an oriented box is at least partly inside the frustum.
+	/// The columns of orientation are the unit axes of the box, halfExtents its half sizes along them.
+	///
+	/// @see gtx_frustum
+	template<typename T, qualifier Q>
+	GLM_FUNC_DECL bool intersectFrustumOBB(
+		tfrustum<T, Q> const& f,
+		vec<3, T, Q> const& center, vec<3, T, Q> const& halfExtents, mat<3, 3, T, Q> const& orientation);
+
+	/// Test W = 4 or 8 spheres, centers stored as center[axis][sphere].
+	/// Returns a mask with bit i set when intersectFrustumSphere is true for sphere i.
+	///
+	/// @see gtx_frustum
+	template<length_t W, qualifier Q>
+	GLM_FUNC_DECL int intersectFrustumSpheres(
+		tfrustum<float, Q> const& f,
+		float const (&center)[3][W], float const (&radius)[W]);
+
+	/// Test W = 4 or 8 axis aligned boxes, stored as boxMin[axis][box].
+	/// Returns a mask with bit i set when intersectFrustumAABB is true for box i.
+	///
+	/// @see gtx_frustum
+	template<length_t W, qualifier Q>
+	GLM_FUNC_DECL int intersectFrustumAABBs(
+		tfrustum<float, Q> const& f,
+		float const (&boxMin)[3][W], float const (&boxMax)[3][W]);
+
+	/// Test W = 4 or 8 oriented boxes, stored as center[axis][box] and orientation[column][row][box].
+	/// Returns a mask with bit i set when intersectFrustumOBB is true for box i.
+	///
+	/// @see gtx_frustum
+	template<length_t W, qualifier Q>
+	GLM_FUNC_DECL int intersectFrustumOBBs(
+		tfrustum<float, Q> const& f,
+		float const (&center)[3][W], float const (&halfExtents)[3][W], float const (&orientation)[3][3][W]);
+
+	/// @}
+}//namespace glm
+
+#include "frustum.inl"
@@ -0,0 +1,401 @@
+/// @ref gtx_frustum
+
+namespace glm
+{
+	// -- Component accesses --
+
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER typename tfrustum<T, Q>::plane_type & tfrustum<T, Q>::operator[](typename tfrustum<T, Q>::length_type i)
+	{
+		assert(i >= 0 && i < this->length());
+		return planes[i];
+	}
+
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER typename tfrustum<T, Q>::plane_type const& tfrustum<T, Q>::operator[](typename tfrustum<T, Q>::length_type i) const
+	{
+		assert(i >= 0 && i < this->length());
+		return planes[i];
+	}
+
+	// -- Implicit basic constructors --
+
+#	if GLM_CONFIG_DEFAULTED_FUNCTIONS == GLM_DISABLE
+		template<typename T, qualifier Q>
+		GLM_FUNC_QUALIFIER tfrustum<T, Q>::tfrustum()
+		{}
+#	endif
+
+	// -- Explicit basic constructors --
+
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER tfrustum<T, Q>::tfrustum(mat<4, 4, T, Q> const& viewProj)
+	{
+		// A point is in the clip volume when -w <= x <= w, -w <= y <= w and -w <= z <= w, or 0 <= z <= w
+		vec<4, T, Q> const Row0(viewProj[0][0], viewProj[1][0], viewProj[2][0], viewProj[3][0]);
+		vec<4, T, Q> const Row1(viewProj[0][1], viewProj[1][1], viewProj[2][1], viewProj[3][1]);
+		vec<4, T, Q> const Row2(viewProj[0][2], viewProj[1][2], viewProj[2][2], viewProj[3][2]);
+		vec<4, T, Q> const Row3(viewProj[0][3], viewProj[1][3], viewProj[2][3], viewProj[3][3]);
+
+		planes[0] = Row3 + Row0;
+		planes[1] = Row3 - Row0;
+		planes[2] = Row3 + Row1;
+		planes[3] = Row3 - Row1;
+		planes[4] = (GLM_CONFIG_CLIP_CONTROL & GLM_CLIP_CONTROL_ZO_BIT) ? Row2 : Row3 + Row2;
+		planes[5] = Row3 - Row2;
+
+		// Unit normals, so that the plane equation gives distances
+		for(length_t i = 0; i < length(); ++i)
+			planes[i] /= glm::length(vec<3, T, Q>(planes[i]));
+	}
+
+	// -- Bounding volume tests --
+
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER bool intersectFrustumSphere
+	(
+		tfrustum<T, Q> const& f,
+		vec<3, T, Q> const& center, T radius
+	)
+	{
+		for(length_t i = 0; i < f.length(); ++i)
+			if(glm::dot(vec<3, T, Q>(f.planes[i]), center) + f.planes[i].w < -radius)
+				return false;
+		return true;
+	}
+
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER bool intersectFrustumAABB
+	(
+		tfrustum<T, Q> const& f,
+		vec<3, T, Q> const& boxMin, vec<3, T, Q> const& boxMax
+	)
+	{
+		for(length_t i = 0; i < f.length(); ++i)
+		{
+			// The corner of the box the furthest along the normal is the last one to leave the plane
+			vec<3, T, Q> const Normal(f.planes[i]);
+			vec<3, T, Q> const Corner(
+				Normal.x >= static_cast<T>(0) ? boxMax.x : boxMin.x,
+				Normal.y >= static_cast<T>(0) ? boxMax.y : boxMin.y,
+				Normal.z >= static_cast<T>(0) ? boxMax.z : boxMin.z);
+			if(glm::dot(Normal, Corner) + f.planes[i].w < static_cast<T>(0))
+				return false;
+		}
+		return true;
+	}
+
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER bool intersectFrustumOBB
+	(
+		tfrustum<T, Q> const& f,
+		vec<3, T, Q> const& center, vec<3, T, Q> const& halfExtents, mat<3, 3, T, Q> const& orientation
+	)
+	{
+		for(length_t i = 0; i < f.length(); ++i)
+		{
+			// Radius of the box projected on the normal
+			vec<3, T, Q> const Normal(f.planes[i]);
+			T const Radius =
+				abs(glm::dot(Normal, orientation[0])) * halfExtents.x +
+				abs(glm::dot(Normal, orientation[1])) * halfExtents.y +
+				abs(glm::dot(Normal, orientation[2])) * halfExtents.z;
+			if(glm::dot(Normal, center) + f.planes[i].w < -Radius)
+				return false;
+		}
+		return true;
+	}
+
+namespace detail
+{
+	// The kernels test the bounding volumes of the lanes against the six planes, with the operations
+	// of the scalar functions in the same order to give the same bits, and return the visible lanes as a bitmask.
+	// Rejections are tested rather than acceptances, so NaNs are visible like in the scalar functions.
+
+#	if GLM_ARCH & GLM_ARCH_SSE2_BIT
+	template<qualifier Q>
+	GLM_FUNC_QUALIFIER int frustum_spheres_sse2(tfrustum<float, Q> const& f, float const* CenterX, float const* CenterY, float const* CenterZ, float const* Radius)
+	{
+		glm_vec4 const x = _mm_loadu_ps(CenterX);
+		glm_vec4 const y = _mm_loadu_ps(CenterY);
+		glm_vec4 const z = _mm_loadu_ps(CenterZ);
+		glm_vec4 const NegRadius = _mm_xor_ps(_mm_loadu_ps(Radius), _mm_set1_ps(-0.0f));
+
+		glm_vec4 Outside = _mm_setzero_ps();
+		for(length_t i = 0; i < f.length(); ++i)
+		{
+			glm_vec4 const Distance = _mm_add_ps(_mm_add_ps(_mm_add_ps(
+				_mm_mul_ps(_mm_set1_ps(f.planes[i].x), x),
+				_mm_mul_ps(_mm_set1_ps(f.planes[i].y), y)),
+				_mm_mul_ps(_mm_set1_ps(f.planes[i].z), z)),
+				_mm_set1_ps(f.planes[i].w));
+			Outside = _mm_or_ps(Outside, _mm_cmplt_ps(Distance, NegRadius));
+		}
+		return _mm_movemask_ps(Outside) ^ 0xF;
+	}
+
+	template<qualifier Q>
+	GLM_FUNC_QUALIFIER int frustum_aabbs_sse2(tfrustum<float, Q> const& f, float const* const BoxMin[3], float const* const BoxMax[3])
+	{
+		glm_vec4 const Min[3] = {_mm_loadu_ps(BoxMin[0]), _mm_loadu_ps(BoxMin[1]), _mm_loadu_ps(BoxMin[2])};
+		glm_vec4 const Max[3] = {_mm_loadu_ps(BoxMax[0]), _mm_loadu_ps(BoxMax[1]), _mm_loadu_ps(BoxMax[2])};
+
+		glm_vec4 Outside = _mm_setzero_ps();
+		for(length_t i = 0; i < f.length(); ++i)
+		{
+			// The plane is the same for all the lanes, so is the choice of the corner
+			glm_vec4 const Distance = _mm_add_ps(_mm_add_ps(_mm_add_ps(
+				_mm_mul_ps(_mm_set1_ps(f.planes[i].x), f.planes[i].x >= 0.0f ? Max[0] : Min[0]),
+				_mm_mul_ps(_mm_set1_ps(f.planes[i].y), f.planes[i].y >= 0.0f ? Max[1] : Min[1])),
+				_mm_mul_ps(_mm_set1_ps(f.planes[i].z), f.planes[i].z >= 0.0f ? Max[2] : Min[2])),
+				_mm_set1_ps(f.planes[i].w));
+			Outside = _mm_or_ps(Outside, _mm_cmplt_ps(Distance, _mm_setzero_ps()));
+		}
+		return _mm_movemask_ps(Outside) ^ 0xF;
+	}
+
+	template<qualifier Q>
+	GLM_FUNC_QUALIFIER int frustum_obbs_sse2(tfrustum<float, Q> const& f, float const* const Center[3], float const* const HalfExtents[3], float const* const Orientation[3][3])
+	{
+		glm_vec4 const c[3] = {_mm_loadu_ps(Center[0]), _mm_loadu_ps(Center[1]), _mm_loadu_ps(Center[2])};
+		glm_vec4 const h[3] = {_mm_loadu_ps(HalfExtents[0]), _mm_loadu_ps(HalfExtents[1]), _mm_loadu_ps(HalfExtents[2])};
+		glm_vec4 o[3][3];
+		for(int Column = 0; Column < 3; ++Column)
+		for(int Row = 0; Row < 3; ++Row)
+			o[Column][Row] = _mm_loadu_ps(Orientation[Column][Row]);
+
+		glm_vec4 const SignMask = _mm_set1_ps(-0.0f);
+		glm_vec4 Outside = _mm_setzero_ps();
+		for(length_t i = 0; i < f.length(); ++i)
+		{
+			glm_vec4 const nx = _mm_set1_ps(f.planes[i].x);
+			glm_vec4 const ny = _mm_set1_ps(f.planes[i].y);
+			glm_vec4 const nz = _mm_set1_ps(f.planes[i].z);
+
+			glm_vec4 Projected[3];
+			for(int Column = 0; Column < 3; ++Column)
+			{
+				glm_vec4 const Dot = _mm_add_ps(_mm_add_ps(_mm_mul_ps(nx, o[Column][0]), _mm_mul_ps(ny, o[Column][1])), _mm_mul_ps(nz, o[Column][2]));
+				Projected[Column] = _mm_mul_ps(_mm_andnot_ps(SignMask, Dot), h[Column]);
+			}
+			glm_vec4 const NegRadius = _mm_xor_ps(_mm_add_ps(_mm_add_ps(Projected[0], Projected[1]), Projected[2]), SignMask);
+
+			glm_vec4 const Distance = _mm_add_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(nx, c[0]), _mm_mul_ps(ny, c[1])), _mm_mul_ps(nz, c[2])), _mm_set1_ps(f.planes[i].w));
+			Outside = _mm_or_ps(Outside, _mm_cmplt_ps(Distance, NegRadius));
+		}
+		return _mm_movemask_ps(Outside) ^ 0xF;
+	}
+#	endif//GLM_ARCH & GLM_ARCH_SSE2_BIT
+
+#	if GLM_CONFIG_SIMD_DISPATCH == GLM_ENABLE
+	// The SSE2 kernels on eight lanes
+	template<qualifier Q>
+	GLM_SIMD_TARGET("avx") inline int frustum_spheres_avx(tfrustum<float, Q> const& f, float const* CenterX, float const* CenterY, float const* CenterZ, float const* Radius)
+	{
+		__m256 const x = _mm256_loadu_ps(CenterX);
+		__m256 const y = _mm256_loadu_ps(CenterY);
+		__m256 const z = _mm256_loadu_ps(CenterZ);
+		__m256 const NegRadius = _mm256_xor_ps(_mm256_loadu_ps(Radius), _mm256_set1_ps(-0.0f));
+
+		__m256 Outside = _mm256_setzero_ps();
+		for(length_t i = 0; i < f.length(); ++i)
+		{
+			__m256 const Distance = _mm256_add_ps(_mm256_add_ps(_mm256_add_ps(
+				_mm256_mul_ps(_mm256_set1_ps(f.planes[i].x), x),
+				_mm256_mul_ps(_mm256_set1_ps(f.planes[i].y), y)),
+				_mm256_mul_ps(_mm256_set1_ps(f.planes[i].z), z)),
+				_mm256_set1_ps(f.planes[i].w));
+			Outside = _mm256_or_ps(Outside, _mm256_cmp_ps(Distance, NegRadius, _CMP_LT_OQ));
+		}
+		return _mm256_movemask_ps(Outside) ^ 0xFF;
+	}
+
+	template<qualifier Q>
+	GLM_SIMD_TARGET("avx") inline int frustum_aabbs_avx(tfrustum<float, Q> const& f, float const* const BoxMin[3], float const* const BoxMax[3])
+	{
+		__m256 const Min[3] = {_mm256_loadu_ps(BoxMin[0]), _mm256_loadu_ps(BoxMin[1]), _mm256_loadu_ps(BoxMin[2])};
+		__m256 const Max[3] = {_mm256_loadu_ps(BoxMax[0]), _mm256_loadu_ps(BoxMax[1]), _mm256_loadu_ps(BoxMax[2])};
+
+		__m256 Outside = _mm256_setzero_ps();
+		for(length_t i = 0; i < f.length(); ++i)
+		{
+			__m256 const Distance = _mm256_add_ps(_mm256_add_ps(_mm256_add_ps(
+				_mm256_mul_ps(_mm256_set1_ps(f.planes[i].x), f.planes[i].x >= 0.0f ? Max[0] : Min[0]),
+				_mm256_mul_ps(_mm256_set1_ps(f.planes[i].y), f.planes[i].y >= 0.0f ? Max[1] : Min[1])),
+				_mm256_mul_ps(_mm256_set1_ps(f.planes[i].z), f.planes[i].z >= 0.0f ? Max[2] : Min[2])),
+				_mm256_set1_ps(f.planes[i].w));
+			Outside = _mm256_or_ps(Outside, _mm256_cmp_ps(Distance, _mm256_setzero_ps(), _CMP_LT_OQ));
+		}
+		return _mm256_movemask_ps(Outside) ^ 0xFF;
+	}
+
+	template<qualifier Q>
+	GLM_SIMD_TARGET("avx") inline int frustum_obbs_avx(tfrustum<float, Q> const& f, float const* const Center[3], float const* const HalfExtents[3], float const* const Orientation[3][3])
+	{
+		__m256 const c[3] = {_mm256_loadu_ps(Center[0]), _mm256_loadu_ps(Center[1]), _mm256_loadu_ps(Center[2])};
+		__m256 const h[3] = {_mm256_loadu_ps(HalfExtents[0]), _mm256_loadu_ps(HalfExtents[1]), _mm256_loadu_ps(HalfExtents[2])};
+		__m256 o[3][3];
+		for(int Column = 0; Column < 3; ++Column)
+		for(int Row = 0; Row < 3; ++Row)
+			o[Column][Row] = _mm256_loadu_ps(Orientation[Column][Row]);
+
+		__m256 const SignMask = _mm256_set1_ps(-0.0f);
+		__m256 Outside = _mm256_setzero_ps();
+		for(length_t i = 0; i < f.length(); ++i)
+		{
+			__m256 const nx = _mm256_set1_ps(f.planes[i].x);
+			__m256 const ny = _mm256_set1_ps(f.planes[i].y);
+			__m256 const nz = _mm256_set1_ps(f.planes[i].z);
+
+			__m256 Projected[3];
+			for(int Column = 0; Column < 3; ++Column)
+			{
+				__m256 const Dot = _mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(nx, o[Column][0]), _mm256_mul_ps(ny, o[Column][1])), _mm256_mul_ps(nz, o[Column][2]));
+				Projected[Column] = _mm256_mul_ps(_mm256_andnot_ps(SignMask, Dot), h[Column]);
+			}
+			__m256 const NegRadius = _mm256_xor_ps(_mm256_add_ps(_mm256_add_ps(Projected[0], Projected[1]), Projected[2]), SignMask);
+
+			__m256 const Distance = _mm256_add_ps(_mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(nx, c[0]), _mm256_mul_ps(ny, c[1])), _mm256_mul_ps(nz, c[2])), _mm256_set1_ps(f.planes[i].w));
+			Outside = _mm256_or_ps(Outside, _mm256_cmp_ps(Distance, NegRadius, _CMP_LT_OQ));
+		}
+		return _mm256_movemask_ps(Outside) ^ 0xFF;
+	}
+#	endif//GLM_CONFIG_SIMD_DISPATCH == GLM_ENABLE
+}//namespace detail
+
+	template<length_t W, qualifier Q>
+	GLM_FUNC_QUALIFIER int intersectFrustumSpheres
+	(
+		tfrustum<float, Q> const& f,
+		float const (&center)[3][W], float const (&radius)[W]
+	)
+	{
+		GLM_STATIC_ASSERT(W == 4 || W == 8, "'intersectFrustumSpheres' only accepts packets of 4 or 8 spheres");
+
+		int Mask = 0;
+		length_t Done = 0;
+		unsigned int const Features = glm_simd_features();
+#		if GLM_CONFIG_SIMD_DISPATCH == GLM_ENABLE
+			if(W == 8 && (Features & GLM_SIMD_AVX))
+			{
+				Mask = detail::frustum_spheres_avx(f, center[0], center[1], center[2], radius);
+				Done = W;
+			}
+			else
+#		endif
+#		if GLM_ARCH & GLM_ARCH_SSE2_BIT
+			if(Features & GLM_SIMD_SSE2)
+			{
+				for(; Done < W; Done += 4)
+					Mask |= detail::frustum_spheres_sse2(f, center[0] + Done, center[1] + Done, center[2] + Done, radius + Done) << Done;
+			}
+#		endif
+		static_cast<void>(Features);
+
+		for(length_t i = Done; i < W; ++i)
+			if(intersectFrustumSphere(f, vec<3, float, Q>(center[0][i], center[1][i], center[2][i]), radius[i]))
+				Mask |= 1 << i;
+		return Mask;
+	}
+
+	template<length_t W, qualifier Q>
+	GLM_FUNC_QUALIFIER int intersectFrustumAABBs
+	(
+		tfrustum<float, Q> const& f,
+		float const (&boxMin)[3][W], float const (&boxMax)[3][W]
+	)
+	{
+		GLM_STATIC_ASSERT(W == 4 || W == 8, "'intersectFrustumAABBs' only accepts packets of 4 or 8 boxes");
+
+		int Mask = 0;
+		length_t Done = 0;
+		unsigned int const Features = glm_simd_features();
+#		if GLM_CONFIG_SIMD_DISPATCH == GLM_ENABLE
+			if(W == 8 && (Features & GLM_SIMD_AVX))
+			{
+				float const* const Min[3] = {boxMin[0], boxMin[1], boxMin[2]};
+				float const* const Max[3] = {boxMax[0], boxMax[1], boxMax[2]};
+				Mask = detail::frustum_aabbs_avx(f, Min, Max);
+				Done = W;
+			}
+			else
+#		endif
+#		if GLM_ARCH & GLM_ARCH_SSE2_BIT
+			if(Features & GLM_SIMD_SSE2)
+			{
+				for(; Done < W; Done += 4)
+				{
+					float const* const Min[3] = {boxMin[0] + Done, boxMin[1] + Done, boxMin[2] + Done};
+					float const* const Max[3] = {boxMax[0] + Done, boxMax[1] + Done, boxMax[2] + Done};
+					Mask |= detail::frustum_aabbs_sse2(f, Min, Max) << Done;
+				}
+			}
+#		endif
+		static_cast<void>(Features);
+
+		for(length_t i = Done; i < W; ++i)
+			if(intersectFrustumAABB(f,
+				vec<3, float, Q>(boxMin[0][i], boxMin[1][i], boxMin[2][i]),
+				vec<3, float, Q>(boxMax[0][i], boxMax[1][i], boxMax[2][i])))
+				Mask |= 1 << i;
+		return Mask;
+	}
+
+	template<length_t W, qualifier Q>
+	GLM_FUNC_QUALIFIER int intersectFrustumOBBs
+	(
+		tfrustum<float, Q> const& f,
+		float const (&center)[3][W], float const (&halfExtents)[3][W], float const (&orientation)[3][3][W]
+	)
+	{
+		GLM_STATIC_ASSERT(W == 4 || W == 8, "'intersectFrustumOBBs' only accepts packets of 4 or 8 boxes");
+
+		int Mask = 0;
+		length_t Done = 0;
+		unsigned int const Features = glm_simd_features();
+#		if GLM_CONFIG_SIMD_DISPATCH == GLM_ENABLE
+			if(W == 8 && (Features & GLM_SIMD_AVX))
+			{
+				float const* const Center[3] = {center[0], center[1], center[2]};
+				float const* const HalfExtents[3] = {halfExtents[0], halfExtents[1], halfExtents[2]};
+				float const* const Orientation[3][3] = {
+					{orientation[0][0], orientation[0][1], orientation[0][2]},
+					{orientation[1][0], orientation[1][1], orientation[1][2]},
+					{orientation[2][0], orientation[2][1], orientation[2][2]}};
+				Mask = detail::frustum_obbs_avx(f, Center, HalfExtents, Orientation);
+				Done = W;
+			}
+			else
+#		endif
+#		if GLM_ARCH & GLM_ARCH_SSE2_BIT
+			if(Features & GLM_SIMD_SSE2)
+			{
+				for(; Done < W; Done += 4)
+				{
+					float const* const Center[3] = {center[0] + Done, center[1] + Done, center[2] + Done};
+					float const* const HalfExtents[3] = {halfExtents[0] + Done, halfExtents[1] + Done, halfExtents[2] + Done};
+					float const* const Orientation[3][3] = {
+						{orientation[0][0] + Done, orientation[0][1] + Done, orientation[0][2] + Done},
+						{orientation[1][0] + Done, orientation[1][1] + Done, orientation[1][2] + Done},
+						{orientation[2][0] + Done, orientation[2][1] + Done, orientation[2][2] + Done}};
+					Mask |= detail::frustum_obbs_sse2(f, Center, HalfExtents, Orientation) << Done;
+				}
+			}
+#		endif
+		static_cast<void>(Features);
+
+		for(length_t i = Done; i < W; ++i)
+		{
+			mat<3, 3, float, Q> const Orientation(
+				orientation[0][0][i], orientation[0][1][i], orientation[0][2][i],
+				orientation[1][0][i], orientation[1][1][i], orientation[1][2][i],
+				orientation[2][0][i], orientation[2][1][i], orientation[2][2][i]);
+			if(intersectFrustumOBB(f,
+				vec<3, float, Q>(center[0][i], center[1][i], center[2][i]),
+				vec<3, float, Q>(halfExtents[0][i], halfExtents[1][i], halfExtents[2][i]),
+				Orientation))
+				Mask |= 1 << i;
+		}
+		return Mask;
+	}
+}//namespace glm
@@ -10,6 +10,9 @@
 /// Include <glm/gtx/intersect.hpp> to use the features of this extension.
 ///
 /// Add intersection functions
+///
+/// The packet functions test 4 or 8 triangles, boxes or rays stored as structures of arrays at once,
+/// with SSE2 or AVX code chosen at runtime with glm_simd_features().
 
 #pragma once
 
@@ -20,6 +23,7 @@
 #include "../geometric.hpp"
 #include "../gtx/closest_point.hpp"
 #include "../gtx/vector_query.hpp"
+#include "../simd/dispatch.h"
 
 #ifndef GLM_ENABLE_EXPERIMENTAL
 #	error "GLM: GLM_GTX_closest_point is an experimental extension and may change in the future. Use #define GLM_ENABLE_EXPERIMENTAL before including it, if you really want to use it."
@@ -86,6 +90,52 @@ namespace glm
 		genType & intersectionPosition1, genType & intersectionNormal1,
 		genType & intersectionPosition2 = genType(), genType & intersectionNormal2 = genType());
 
+	//! Compute the intersection of a ray and an axis aligned box with the slab method.
+	//! The distance is the one where the ray enters the box, 0 when the origin is inside it.
+	//! From GLM_GTX_intersect extension.
+	template<typename T, qualifier Q>
+	GLM_FUNC_DECL bool intersectRayBox(
+		vec<3, T, Q> const& orig, vec<3, T, Q> const& dir,
+		vec<3, T, Q> const& boxMin, vec<3, T, Q> const& boxMax,
+		T & distance);
+
+	//! Compute the intersections of a ray and W = 4 or 8 triangles, vertex coordinates stored as vert[axis][triangle].
+	//! Returns a mask with bit i set when triangle i is hit, only the outputs of those triangles are written.
+	//! Each hit matches intersectRayTriangle on the same triangle.
+	//! From GLM_GTX_intersect extension.
+	template<length_t W, qualifier Q>
+	GLM_FUNC_DECL int intersectRayTriangles(
+		vec<3, float, Q> const& orig, vec<3, float, Q> const& dir,
+		float const (&vert0)[3][W], float const (&vert1)[3][W], float const (&vert2)[3][W],
+		float (&baryPosition)[2][W], float (&distance)[W]);
+
+	//! Compute the intersections of W = 4 or 8 rays, stored as orig[axis][ray], and a triangle.
+	//! Returns a mask with bit i set when ray i hits, only the outputs of those rays are written.
+	//! From GLM_GTX_intersect extension.
+	template<length_t W, qualifier Q>
+	GLM_FUNC_DECL int intersectRaysTriangle(
+		float const (&orig)[3][W], float const (&dir)[3][W],
+		vec<3, float, Q> const& vert0, vec<3, float, Q> const& vert1, vec<3, float, Q> const& vert2,
+		float (&baryPosition)[2][W], float (&distance)[W]);
+
+	//! Compute the intersections of a ray and W = 4 or 8 axis aligned boxes, stored as boxMin[axis][box].
+	//! Returns a mask with bit i set when box i is hit, only the distances of those boxes are written.
+	//! From GLM_GTX_intersect extension.
+	template<length_t W, qualifier Q>
+	GLM_FUNC_DECL int intersectRayBoxes(
+		vec<3, float, Q> const& orig, vec<3, float, Q> const& dir,
+		float const (&boxMin)[3][W], float const (&boxMax)[3][W],
+		float (&distance)[W]);
+
+	//! Compute the intersections of W = 4 or 8 rays, stored as orig[axis][ray], and an axis aligned box.
+	//! Returns a mask with bit i set when ray i hits, only the distances of those rays are written.
+	//! From GLM_GTX_intersect extension.
+	template<length_t W, qualifier Q>
+	GLM_FUNC_DECL int intersectRaysBox(
+		float const (&orig)[3][W], float const (&dir)[3][W],
+		vec<3, float, Q> const& boxMin, vec<3, float, Q> const& boxMax,
+		float (&distance)[W]);
+
 	/// @}
 }//namespace glm
 
@@ -194,4 +194,460 @@ namespace glm
 		intersectionNormal2 = (intersectionPoint2 - sphereCenter) / sphereRadius;
 		return true;
 	}
+
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER bool intersectRayBox
+	(
+		vec<3, T, Q> const& orig, vec<3, T, Q> const& dir,
+		vec<3, T, Q> const& boxMin, vec<3, T, Q> const& boxMax,
+		T& distance
+	)
+	{
+		// distances to the two planes of each slab
+		vec<3, T, Q> const InvDir = static_cast<T>(1) / dir;
+		vec<3, T, Q> const Dist1 = (boxMin - orig) * InvDir;
+		vec<3, T, Q> const Dist2 = (boxMax - orig) * InvDir;
+		vec<3, T, Q> const Near = min(Dist1, Dist2);
+		vec<3, T, Q> const Far = max(Dist1, Dist2);
+
+		// the ray is in the box between the last entry and the first exit, from its origin
+		T const Entry = max(max(max(Near.x, Near.y), Near.z), static_cast<T>(0));
+		T const Exit = min(min(Far.x, Far.y), Far.z);
+		if(!(Exit >= Entry))
+			return false;
+
+		distance = Entry;
+		return true;
+	}
+
+namespace detail
+{
+#	if GLM_ARCH & GLM_ARCH_SSE2_BIT
+	GLM_FUNC_QUALIFIER glm_vec4 intersect_dot_sse2(glm_vec4 const a[3], glm_vec4 const b[3])
+	{
+		return _mm_add_ps(_mm_add_ps(_mm_mul_ps(a[0], b[0]), _mm_mul_ps(a[1], b[1])), _mm_mul_ps(a[2], b[2]));
+	}
+
+	GLM_FUNC_QUALIFIER void intersect_cross_sse2(glm_vec4 const x[3], glm_vec4 const y[3], glm_vec4 Out[3])
+	{
+		Out[0] = _mm_sub_ps(_mm_mul_ps(x[1], y[2]), _mm_mul_ps(y[1], x[2]));
+		Out[1] = _mm_sub_ps(_mm_mul_ps(x[2], y[0]), _mm_mul_ps(y[2], x[0]));
+		Out[2] = _mm_sub_ps(_mm_mul_ps(x[0], y[1]), _mm_mul_ps(y[0], x[1]));
+	}
+
+	// intersectRayTriangle of 4 lanes, with the operations in the same order to give the same bits.
+	// Returns the hit lanes as a bitmask; the outputs of the other lanes are meaningless.
+	GLM_FUNC_QUALIFIER int intersect_ray_triangle_sse2(
+		glm_vec4 const orig[3], glm_vec4 const dir[3],
+		glm_vec4 const vert0[3], glm_vec4 const vert1[3], glm_vec4 const vert2[3],
+		float* BaryX, float* BaryY, float* Distance)
+	{
+		glm_vec4 const zero = _mm_setzero_ps();
+
+		glm_vec4 const edge1[3] = {_mm_sub_ps(vert1[0], vert0[0]), _mm_sub_ps(vert1[1], vert0[1]), _mm_sub_ps(vert1[2], vert0[2])};
+		glm_vec4 const edge2[3] = {_mm_sub_ps(vert2[0], vert0[0]), _mm_sub_ps(vert2[1], vert0[1]), _mm_sub_ps(vert2[2], vert0[2])};
+
+		glm_vec4 p[3];
+		intersect_cross_sse2(dir, edge2, p);
+		glm_vec4 const det = intersect_dot_sse2(edge1, p);
+
+		glm_vec4 const dist[3] = {_mm_sub_ps(orig[0], vert0[0]), _mm_sub_ps(orig[1], vert0[1]), _mm_sub_ps(orig[2], vert0[2])};
+		glm_vec4 const u = intersect_dot_sse2(dist, p);
+
+		glm_vec4 Perpendicular[3];
+		intersect_cross_sse2(dist, edge1, Perpendicular);
+		glm_vec4 const v = intersect_dot_sse2(dir, Perpendicular);
+		glm_vec4 const uv = _mm_add_ps(u, v);
+
+		// Rejections are tested rather than acceptances, so NaNs pass like in the scalar function
+		glm_vec4 const Front = _mm_cmpgt_ps(det, _mm_set1_ps(std::numeric_limits<float>::epsilon()));
+		glm_vec4 const FrontOut = _mm_or_ps(_mm_or_ps(_mm_cmplt_ps(u, zero), _mm_cmpgt_ps(u, det)), _mm_or_ps(_mm_cmplt_ps(v, zero), _mm_cmpgt_ps(uv, det)));
+		glm_vec4 const Back = _mm_cmplt_ps(det, _mm_set1_ps(-std::numeric_limits<float>::epsilon()));
+		glm_vec4 const BackOut = _mm_or_ps(_mm_or_ps(_mm_cmpgt_ps(u, zero), _mm_cmplt_ps(u, det)), _mm_or_ps(_mm_cmpgt_ps(v, zero), _mm_cmplt_ps(uv, det)));
+		glm_vec4 const Hit = _mm_or_ps(_mm_andnot_ps(FrontOut, Front), _mm_andnot_ps(BackOut, Back));
+
+		glm_vec4 const inv_det = _mm_div_ps(_mm_set1_ps(1.0f), det);
+		_mm_storeu_ps(Distance, _mm_mul_ps(intersect_dot_sse2(edge2, Perpendicular), inv_det));
+		_mm_storeu_ps(BaryX, _mm_mul_ps(u, inv_det));
+		_mm_storeu_ps(BaryY, _mm_mul_ps(v, inv_det));
+
+		return _mm_movemask_ps(Hit);
+	}
+
+	// intersectRayBox of 4 lanes, with the operands of glm's min and max to give the same bits
+	GLM_FUNC_QUALIFIER int intersect_ray_box_sse2(
+		glm_vec4 const orig[3], glm_vec4 const dir[3],
+		glm_vec4 const boxMin[3], glm_vec4 const boxMax[3],
+		float* Distance)
+	{
+		glm_vec4 Near[3], Far[3];
+		for(int i = 0; i < 3; ++i)
+		{
+			glm_vec4 const InvDir = _mm_div_ps(_mm_set1_ps(1.0f), dir[i]);
+			glm_vec4 const Dist1 = _mm_mul_ps(_mm_sub_ps(boxMin[i], orig[i]), InvDir);
+			glm_vec4 const Dist2 = _mm_mul_ps(_mm_sub_ps(boxMax[i], orig[i]), InvDir);
+			Near[i] = _mm_min_ps(Dist2, Dist1);
+			Far[i] = _mm_max_ps(Dist2, Dist1);
+		}
+
+		glm_vec4 const Entry = _mm_max_ps(_mm_setzero_ps(), _mm_max_ps(Near[2], _mm_max_ps(Near[1], Near[0])));
+		glm_vec4 const Exit = _mm_min_ps(Far[2], _mm_min_ps(Far[1], Far[0]));
+		_mm_storeu_ps(Distance, Entry);
+
+		return _mm_movemask_ps(_mm_cmpge_ps(Exit, Entry));
+	}
+#	endif//GLM_ARCH & GLM_ARCH_SSE2_BIT
+
+#	if GLM_CONFIG_SIMD_DISPATCH == GLM_ENABLE
+	// AVX versions of the functions above, 8 lanes at once.
+	// FMA isn't enabled, a fused multiply-add would round differently from the scalar code.
+
+	GLM_SIMD_TARGET("avx") inline __m256 intersect_dot_avx(__m256 const a[3], __m256 const b[3])
+	{
+		return _mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(a[0], b[0]), _mm256_mul_ps(a[1], b[1])), _mm256_mul_ps(a[2], b[2]));
+	}
+
+	GLM_SIMD_TARGET("avx") inline void intersect_cross_avx(__m256 const x[3], __m256 const y[3], __m256 Out[3])
+	{
+		Out[0] = _mm256_sub_ps(_mm256_mul_ps(x[1], y[2]), _mm256_mul_ps(y[1], x[2]));
+		Out[1] = _mm256_sub_ps(_mm256_mul_ps(x[2], y[0]), _mm256_mul_ps(y[2], x[0]));
+		Out[2] = _mm256_sub_ps(_mm256_mul_ps(x[0], y[1]), _mm256_mul_ps(y[0], x[1]));
+	}
+
+	GLM_SIMD_TARGET("avx") inline int intersect_ray_triangle_avx(
+		__m256 const orig[3], __m256 const dir[3],
+		__m256 const vert0[3], __m256 const vert1[3], __m256 const vert2[3],
+		float* BaryX, float* BaryY, float* Distance)
+	{
+		__m256 const zero = _mm256_setzero_ps();
+
+		__m256 const edge1[3] = {_mm256_sub_ps(vert1[0], vert0[0]), _mm256_sub_ps(vert1[1], vert0[1]), _mm256_sub_ps(vert1[2], vert0[2])};
+		__m256 const edge2[3] = {_mm256_sub_ps(vert2[0], vert0[0]), _mm256_sub_ps(vert2[1], vert0[1]), _mm256_sub_ps(vert2[2], vert0[2])};
+
+		__m256 p[3];
+		intersect_cross_avx(dir, edge2, p);
+		__m256 const det = intersect_dot_avx(edge1, p);
+
+		__m256 const dist[3] = {_mm256_sub_ps(orig[0], vert0[0]), _mm256_sub_ps(orig[1], vert0[1]), _mm256_sub_ps(orig[2], vert0[2])};
+		__m256 const u = intersect_dot_avx(dist, p);
+
+		__m256 Perpendicular[3];
+		intersect_cross_avx(dist, edge1, Perpendicular);
+		__m256 const v = intersect_dot_avx(dir, Perpendicular);
+		__m256 const uv = _mm256_add_ps(u, v);
+
+		__m256 const Front = _mm256_cmp_ps(det, _mm256_set1_ps(std::numeric_limits<float>::epsilon()), _CMP_GT_OQ);
+		__m256 const FrontOut = _mm256_or_ps(
+			_mm256_or_ps(_mm256_cmp_ps(u, zero, _CMP_LT_OQ), _mm256_cmp_ps(u, det, _CMP_GT_OQ)),
+			_mm256_or_ps(_mm256_cmp_ps(v, zero, _CMP_LT_OQ), _mm256_cmp_ps(uv, det, _CMP_GT_OQ)));
+		__m256 const Back = _mm256_cmp_ps(det, _mm256_set1_ps(-std::numeric_limits<float>::epsilon()), _CMP_LT_OQ);
+		__m256 const BackOut = _mm256_or_ps(
+			_mm256_or_ps(_mm256_cmp_ps(u, zero, _CMP_GT_OQ), _mm256_cmp_ps(u, det, _CMP_LT_OQ)),
+			_mm256_or_ps(_mm256_cmp_ps(v, zero, _CMP_GT_OQ), _mm256_cmp_ps(uv, det, _CMP_LT_OQ)));
+		__m256 const Hit = _mm256_or_ps(_mm256_andnot_ps(FrontOut, Front), _mm256_andnot_ps(BackOut, Back));
+
+		__m256 const inv_det = _mm256_div_ps(_mm256_set1_ps(1.0f), det);
+		_mm256_storeu_ps(Distance, _mm256_mul_ps(intersect_dot_avx(edge2, Perpendicular), inv_det));
+		_mm256_storeu_ps(BaryX, _mm256_mul_ps(u, inv_det));
+		_mm256_storeu_ps(BaryY, _mm256_mul_ps(v, inv_det));
+
+		return _mm256_movemask_ps(Hit);
+	}
+
+	GLM_SIMD_TARGET("avx") inline int intersect_ray_box_avx(
+		__m256 const orig[3], __m256 const dir[3],
+		__m256 const boxMin[3], __m256 const boxMax[3],
+		float* Distance)
+	{
+		__m256 Near[3], Far[3];
+		for(int i = 0; i < 3; ++i)
+		{
+			__m256 const InvDir = _mm256_div_ps(_mm256_set1_ps(1.0f), dir[i]);
+			__m256 const Dist1 = _mm256_mul_ps(_mm256_sub_ps(boxMin[i], orig[i]), InvDir);
+			__m256 const Dist2 = _mm256_mul_ps(_mm256_sub_ps(boxMax[i], orig[i]), InvDir);
+			Near[i] = _mm256_min_ps(Dist2, Dist1);
+			Far[i] = _mm256_max_ps(Dist2, Dist1);
+		}
+
+		__m256 const Entry = _mm256_max_ps(_mm256_setzero_ps(), _mm256_max_ps(Near[2], _mm256_max_ps(Near[1], Near[0])));
+		__m256 const Exit = _mm256_min_ps(Far[2], _mm256_min_ps(Far[1], Far[0]));
+		_mm256_storeu_ps(Distance, Entry);
+
+		return _mm256_movemask_ps(_mm256_cmp_ps(Exit, Entry, _CMP_GE_OQ));
+	}
+
+	GLM_SIMD_TARGET("avx") inline void intersect_set1_avx(float x, float y, float z, __m256 Out[3])
+	{
+		Out[0] = _mm256_set1_ps(x);
+		Out[1] = _mm256_set1_ps(y);
+		Out[2] = _mm256_set1_ps(z);
+	}
+
+	GLM_SIMD_TARGET("avx") inline void intersect_load_avx(float const* x, float const* y, float const* z, __m256 Out[3])
+	{
+		Out[0] = _mm256_loadu_ps(x);
+		Out[1] = _mm256_loadu_ps(y);
+		Out[2] = _mm256_loadu_ps(z);
+	}
+#	endif//GLM_CONFIG_SIMD_DISPATCH == GLM_ENABLE
+
+#	if GLM_ARCH & GLM_ARCH_SSE2_BIT
+	GLM_FUNC_QUALIFIER void intersect_set1_sse2(float x, float y, float z, glm_vec4 Out[3])
+	{
+		Out[0] = _mm_set1_ps(x);
+		Out[1] = _mm_set1_ps(y);
+		Out[2] = _mm_set1_ps(z);
+	}
+
+	GLM_FUNC_QUALIFIER void intersect_load_sse2(float const* x, float const* y, float const* z, glm_vec4 Out[3])
+	{
+		Out[0] = _mm_loadu_ps(x);
+		Out[1] = _mm_loadu_ps(y);
+		Out[2] = _mm_loadu_ps(z);
+	}
+#	endif//GLM_ARCH & GLM_ARCH_SSE2_BIT
+}//namespace detail
+
+	template<length_t W, qualifier Q>
+	GLM_FUNC_QUALIFIER int intersectRayTriangles
+	(
+		vec<3, float, Q> const& orig, vec<3, float, Q> const& dir,
+		float const (&vert0)[3][W], float const (&vert1)[3][W], float const (&vert2)[3][W],
+		float (&baryPosition)[2][W], float (&distance)[W]
+	)
+	{
+		GLM_STATIC_ASSERT(W == 4 || W == 8, "'intersectRayTriangles' only accepts packets of 4 or 8 triangles");
+
+		int Mask = 0;
+		length_t Done = 0;
+		unsigned int const Features = glm_simd_features();
+#		if GLM_CONFIG_SIMD_DISPATCH == GLM_ENABLE
+			if(W == 8 && (Features & GLM_SIMD_AVX))
+			{
+				__m256 Orig[3], Dir[3], Vert0[3], Vert1[3], Vert2[3];
+				detail::intersect_set1_avx(orig.x, orig.y, orig.z, Orig);
+				detail::intersect_set1_avx(dir.x, dir.y, dir.z, Dir);
+				detail::intersect_load_avx(vert0[0], vert0[1], vert0[2], Vert0);
+				detail::intersect_load_avx(vert1[0], vert1[1], vert1[2], Vert1);
+				detail::intersect_load_avx(vert2[0], vert2[1], vert2[2], Vert2);
+				Mask = detail::intersect_ray_triangle_avx(Orig, Dir, Vert0, Vert1, Vert2, baryPosition[0], baryPosition[1], distance);
+				Done = W;
+			}
+			else
+#		endif
+#		if GLM_ARCH & GLM_ARCH_SSE2_BIT
+			if(Features & GLM_SIMD_SSE2)
+			{
+				glm_vec4 Orig[3], Dir[3];
+				detail::intersect_set1_sse2(orig.x, orig.y, orig.z, Orig);
+				detail::intersect_set1_sse2(dir.x, dir.y, dir.z, Dir);
+				for(; Done < W; Done += 4)
+				{
+					glm_vec4 Vert0[3], Vert1[3], Vert2[3];
+					detail::intersect_load_sse2(vert0[0] + Done, vert0[1] + Done, vert0[2] + Done, Vert0);
+					detail::intersect_load_sse2(vert1[0] + Done, vert1[1] + Done, vert1[2] + Done, Vert1);
+					detail::intersect_load_sse2(vert2[0] + Done, vert2[1] + Done, vert2[2] + Done, Vert2);
+					Mask |= detail::intersect_ray_triangle_sse2(Orig, Dir, Vert0, Vert1, Vert2, baryPosition[0] + Done, baryPosition[1] + Done, distance + Done) << Done;
+				}
+			}
+#		endif
+		static_cast<void>(Features);
+
+		for(length_t i = Done; i < W; ++i)
+		{
+			vec<2, float, Q> Bary(0.0f);
+			float Distance = 0.0f;
+			if(intersectRayTriangle(orig, dir,
+				vec<3, float, Q>(vert0[0][i], vert0[1][i], vert0[2][i]),
+				vec<3, float, Q>(vert1[0][i], vert1[1][i], vert1[2][i]),
+				vec<3, float, Q>(vert2[0][i], vert2[1][i], vert2[2][i]),
+				Bary, Distance))
+			{
+				Mask |= 1 << i;
+				baryPosition[0][i] = Bary.x;
+				baryPosition[1][i] = Bary.y;
+				distance[i] = Distance;
+			}
+		}
+		return Mask;
+	}
+
+	template<length_t W, qualifier Q>
+	GLM_FUNC_QUALIFIER int intersectRaysTriangle
+	(
+		float const (&orig)[3][W], float const (&dir)[3][W],
+		vec<3, float, Q> const& vert0, vec<3, float, Q> const& vert1, vec<3, float, Q> const& vert2,
+		float (&baryPosition)[2][W], float (&distance)[W]
+	)
+	{
+		GLM_STATIC_ASSERT(W == 4 || W == 8, "'intersectRaysTriangle' only accepts packets of 4 or 8 rays");
+
+		int Mask = 0;
+		length_t Done = 0;
+		unsigned int const Features = glm_simd_features();
+#		if GLM_CONFIG_SIMD_DISPATCH == GLM_ENABLE
+			if(W == 8 && (Features & GLM_SIMD_AVX))
+			{
+				__m256 Orig[3], Dir[3], Vert0[3], Vert1[3], Vert2[3];
+				detail::intersect_load_avx(orig[0], orig[1], orig[2], Orig);
+				detail::intersect_load_avx(dir[0], dir[1], dir[2], Dir);
+				detail::intersect_set1_avx(vert0.x, vert0.y, vert0.z, Vert0);
+				detail::intersect_set1_avx(vert1.x, vert1.y, vert1.z, Vert1);
+				detail::intersect_set1_avx(vert2.x, vert2.y, vert2.z, Vert2);
+				Mask = detail::intersect_ray_triangle_avx(Orig, Dir, Vert0, Vert1, Vert2, baryPosition[0], baryPosition[1], distance);
+				Done = W;
+			}
+			else
+#		endif
+#		if GLM_ARCH & GLM_ARCH_SSE2_BIT
+			if(Features & GLM_SIMD_SSE2)
+			{
+				glm_vec4 Vert0[3], Vert1[3], Vert2[3];
+				detail::intersect_set1_sse2(vert0.x, vert0.y, vert0.z, Vert0);
+				detail::intersect_set1_sse2(vert1.x, vert1.y, vert1.z, Vert1);
+				detail::intersect_set1_sse2(vert2.x, vert2.y, vert2.z, Vert2);
+				for(; Done < W; Done += 4)
+				{
+					glm_vec4 Orig[3], Dir[3];
+					detail::intersect_load_sse2(orig[0] + Done, orig[1] + Done, orig[2] + Done, Orig);
+					detail::intersect_load_sse2(dir[0] + Done, dir[1] + Done, dir[2] + Done, Dir);
+					Mask |= detail::intersect_ray_triangle_sse2(Orig, Dir, Vert0, Vert1, Vert2, baryPosition[0] + Done, baryPosition[1] + Done, distance + Done) << Done;
+				}
+			}
+#		endif
+		static_cast<void>(Features);
+
+		for(length_t i = Done; i < W; ++i)
+		{
+			vec<2, float, Q> Bary(0.0f);
+			float Distance = 0.0f;
+			if(intersectRayTriangle(
+				vec<3, float, Q>(orig[0][i], orig[1][i], orig[2][i]),
+				vec<3, float, Q>(dir[0][i], dir[1][i], dir[2][i]),
+				vert0, vert1, vert2, Bary, Distance))
+			{
+				Mask |= 1 << i;
+				baryPosition[0][i] = Bary.x;
+				baryPosition[1][i] = Bary.y;
+				distance[i] = Distance;
+			}
+		}
+		return Mask;
+	}
+
+	template<length_t W, qualifier Q>
+	GLM_FUNC_QUALIFIER int intersectRayBoxes
+	(
+		vec<3, float, Q> const& orig, vec<3, float, Q> const& dir,
+		float const (&boxMin)[3][W], float const (&boxMax)[3][W],
+		float (&distance)[W]
+	)
+	{
+		GLM_STATIC_ASSERT(W == 4 || W == 8, "'intersectRayBoxes' only accepts packets of 4 or 8 boxes");
+
+		int Mask = 0;
+		length_t Done = 0;
+		unsigned int const Features = glm_simd_features();
+#		if GLM_CONFIG_SIMD_DISPATCH == GLM_ENABLE
+			if(W == 8 && (Features & GLM_SIMD_AVX))
+			{
+				__m256 Orig[3], Dir[3], BoxMin[3], BoxMax[3];
+				detail::intersect_set1_avx(orig.x, orig.y, orig.z, Orig);
+				detail::intersect_set1_avx(dir.x, dir.y, dir.z, Dir);
+				detail::intersect_load_avx(boxMin[0], boxMin[1], boxMin[2], BoxMin);
+				detail::intersect_load_avx(boxMax[0], boxMax[1], boxMax[2], BoxMax);
+				Mask = detail::intersect_ray_box_avx(Orig, Dir, BoxMin, BoxMax, distance);
+				Done = W;
+			}
+			else
+#		endif
+#		if GLM_ARCH & GLM_ARCH_SSE2_BIT
+			if(Features & GLM_SIMD_SSE2)
+			{
+				glm_vec4 Orig[3], Dir[3];
+				detail::intersect_set1_sse2(orig.x, orig.y, orig.z, Orig);
+				detail::intersect_set1_sse2(dir.x, dir.y, dir.z, Dir);
+				for(; Done < W; Done += 4)
+				{
+					glm_vec4 BoxMin[3], BoxMax[3];
+					detail::intersect_load_sse2(boxMin[0] + Done, boxMin[1] + Done, boxMin[2] + Done, BoxMin);
+					detail::intersect_load_sse2(boxMax[0] + Done, boxMax[1] + Done, boxMax[2] + Done, BoxMax);
+					Mask |= detail::intersect_ray_box_sse2(Orig, Dir, BoxMin, BoxMax, distance + Done) << Done;
+				}
+			}
+#		endif
+		static_cast<void>(Features);
+
+		for(length_t i = Done; i < W; ++i)
+		{
+			float Distance = 0.0f;
+			if(intersectRayBox(orig, dir,
+				vec<3, float, Q>(boxMin[0][i], boxMin[1][i], boxMin[2][i]),
+				vec<3, float, Q>(boxMax[0][i], boxMax[1][i], boxMax[2][i]),
+				Distance))
+			{
+				Mask |= 1 << i;
+				distance[i] = Distance;
+			}
+		}
+		return Mask;
+	}
+
+	template<length_t W, qualifier Q>
+	GLM_FUNC_QUALIFIER int intersectRaysBox
+	(
+		float const (&orig)[3][W], float const (&dir)[3][W],
+		vec<3, float, Q> const& boxMin, vec<3, float, Q> const& boxMax,
+		float (&distance)[W]
+	)
+	{
+		GLM_STATIC_ASSERT(W == 4 || W == 8, "'intersectRaysBox' only accepts packets of 4 or 8 rays");
+
+		int Mask = 0;
+		length_t Done = 0;
+		unsigned int const Features = glm_simd_features();
+#		if GLM_CONFIG_SIMD_DISPATCH == GLM_ENABLE
+			if(W == 8 && (Features & GLM_SIMD_AVX))
+			{
+				__m256 Orig[3], Dir[3], BoxMin[3], BoxMax[3];
+				detail::intersect_load_avx(orig[0], orig[1], orig[2], Orig);
+				detail::intersect_load_avx(dir[0], dir[1], dir[2], Dir);
+				detail::intersect_set1_avx(boxMin.x, boxMin.y, boxMin.z, BoxMin);
+				detail::intersect_set1_avx(boxMax.x, boxMax.y, boxMax.z, BoxMax);
+				Mask = detail::intersect_ray_box_avx(Orig, Dir, BoxMin, BoxMax, distance);
+				Done = W;
+			}
+			else
+#		endif
+#		if GLM_ARCH & GLM_ARCH_SSE2_BIT
+			if(Features & GLM_SIMD_SSE2)
+			{
+				glm_vec4 BoxMin[3], BoxMax[3];
+				detail::intersect_set1_sse2(boxMin.x, boxMin.y, boxMin.z, BoxMin);
+				detail::intersect_set1_sse2(boxMax.x, boxMax.y, boxMax.z, BoxMax);
+				for(; Done < W; Done += 4)
+				{
+					glm_vec4 Orig[3], Dir[3];
+					detail::intersect_load_sse2(orig[0] + Done, orig[1] + Done, orig[2] + Done, Orig);
+					detail::intersect_load_sse2(dir[0] + Done, dir[1] + Done, dir[2] + Done, Dir);
+					Mask |= detail::intersect_ray_box_sse2(Orig, Dir, BoxMin, BoxMax, distance + Done) << Done;
+				}
+			}
+#		endif
+		static_cast<void>(Features);
+
+		for(length_t i = Done; i < W; ++i)
+		{
+			float Distance = 0.0f;
+			if(intersectRayBox(
+				vec<3, float, Q>(orig[0][i], orig[1][i], orig[2][i]),
+				vec<3, float, Q>(dir[0][i], dir[1][i], dir[2][i]),
+				boxMin, boxMax, Distance))
+			{
+				Mask |= 1 << i;
+				distance[i] = Distance;
+			}
+		}
+		return Mask;
+	}
 }//namespace glm
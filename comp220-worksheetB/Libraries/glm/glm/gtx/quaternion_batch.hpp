@@ -0,0 +1,48 @@
+/// @ref gtx_quaternion_batch
+/// @file glm/gtx/quaternion_batch.hpp
+///
+/// @see core (dependence)
+/// @see gtc_quaternion (dependence)
+///
+/// @defgroup gtx_quaternion_batch GLM_GTX_quaternion_batch
+/// @ingroup gtx
+///
+/// Include <glm/gtx/quaternion_batch.hpp> to use the features of this extension.
+///
+/// Interpolate arrays of quaternion pairs.
+/// SSE2 and AVX2 code paths are chosen at runtime with glm_simd_features().
+///
+/// Arrays have no alignment requirement.
+/// Outputs may be the same arrays as the inputs, but must not partially overlap them.
+
+#pragma once
+
+// Dependency:
+#include "../glm.hpp"
+#include "../gtc/quaternion.hpp"
+#include "../simd/dispatch.h"
+
+#ifndef GLM_ENABLE_EXPERIMENTAL
+#	error "GLM: GLM_GTX_quaternion_batch is an experimental extension and may change in the future. Use #define GLM_ENABLE_EXPERIMENTAL before including it, if you really want to use it."
+#endif
+
+#if GLM_MESSAGES == GLM_ENABLE && !defined(GLM_EXT_INCLUDED)
+#	pragma message("GLM: GLM_GTX_quaternion_batch extension included")
+#endif
+
+namespace glm
+{
+	/// @addtogroup gtx_quaternion_batch
+	/// @{
+
+	/// Out[i] = slerp(X[i], Y[i], A[i]), taking the short path like slerp.
+	/// The SIMD code paths compute sin and acos with polynomials, within 1e-6 of slerp for A[i] in [0, 1].
+	/// @see gtx_quaternion_batch
+	/// @see ext_quaternion_common
+	template<qualifier Q>
+	GLM_FUNC_DECL void slerp(qua<float, Q> const* X, qua<float, Q> const* Y, float const* A, qua<float, Q>* Out, std::size_t Count);
+
+	/// @}
+}// namespace glm
+
+#include "quaternion_batch.inl"
@@ -0,0 +1,205 @@
+/// @ref gtx_quaternion_batch
+
+#include "../simd/quaternion.h"
+#include <limits>
+
+namespace glm{
+namespace detail
+{
+	// Kernels take quaternions as x, y, z, w floats and return how many pairs they interpolated,
+	// always a multiple of their width, the caller finishes the rest with slerp.
+	// Four quaternions are transposed to x, y, z and w registers, so each lane interpolates one pair.
+
+#	if GLM_ARCH & GLM_ARCH_SSE2_BIT
+	GLM_FUNC_QUALIFIER std::size_t slerp_quat_sse2(float const* X, float const* Y, float const* A, float* Out, std::size_t Count)
+	{
+		glm_vec4 const Threshold = _mm_set1_ps(1.0f - std::numeric_limits<float>::epsilon());
+		glm_vec4 const One = _mm_set1_ps(1.0f);
+
+		std::size_t const Blocks = Count & ~static_cast<std::size_t>(3);
+		for(std::size_t i = 0; i < Blocks; i += 4)
+		{
+			glm_vec4 X0 = _mm_loadu_ps(X + i * 4 + 0);
+			glm_vec4 X1 = _mm_loadu_ps(X + i * 4 + 4);
+			glm_vec4 X2 = _mm_loadu_ps(X + i * 4 + 8);
+			glm_vec4 X3 = _mm_loadu_ps(X + i * 4 + 12);
+			glm_vec4 Y0 = _mm_loadu_ps(Y + i * 4 + 0);
+			glm_vec4 Y1 = _mm_loadu_ps(Y + i * 4 + 4);
+			glm_vec4 Y2 = _mm_loadu_ps(Y + i * 4 + 8);
+			glm_vec4 Y3 = _mm_loadu_ps(Y + i * 4 + 12);
+			_MM_TRANSPOSE4_PS(X0, X1, X2, X3);
+			_MM_TRANSPOSE4_PS(Y0, Y1, Y2, Y3);
+			glm_vec4 const a = _mm_loadu_ps(A + i);
+
+			// Same summation order as dot(qua, qua)
+			glm_vec4 CosTheta = _mm_add_ps(_mm_add_ps(_mm_mul_ps(X0, Y0), _mm_mul_ps(X1, Y1)), _mm_add_ps(_mm_mul_ps(X2, Y2), _mm_mul_ps(X3, Y3)));
+
+			// Negate Y where cosTheta < 0 to take the short way around the sphere
+			glm_vec4 const Sign = _mm_and_ps(_mm_cmplt_ps(CosTheta, _mm_setzero_ps()), _mm_set1_ps(-0.0f));
+			CosTheta = _mm_xor_ps(CosTheta, Sign);
+			Y0 = _mm_xor_ps(Y0, Sign);
+			Y1 = _mm_xor_ps(Y1, Sign);
+			Y2 = _mm_xor_ps(Y2, Sign);
+			Y3 = _mm_xor_ps(Y3, Sign);
+
+			glm_vec4 const Angle = glm_vec4_acos(CosTheta);
+			glm_vec4 const OneOverSin = _mm_div_ps(One, glm_vec4_sin(Angle));
+			glm_vec4 const Sin0 = glm_vec4_sin(_mm_mul_ps(_mm_sub_ps(One, a), Angle));
+			glm_vec4 const Sin1 = glm_vec4_sin(_mm_mul_ps(a, Angle));
+
+			// Linear interpolation where sin(angle) is too close to 0 to divide by
+			glm_vec4 const Linear = _mm_cmpgt_ps(CosTheta, Threshold);
+			glm_vec4 const Weight0 = _mm_or_ps(_mm_and_ps(Linear, _mm_sub_ps(One, a)), _mm_andnot_ps(Linear, _mm_mul_ps(Sin0, OneOverSin)));
+			glm_vec4 const Weight1 = _mm_or_ps(_mm_and_ps(Linear, a), _mm_andnot_ps(Linear, _mm_mul_ps(Sin1, OneOverSin)));
+
+			glm_vec4 R0 = _mm_add_ps(_mm_mul_ps(X0, Weight0), _mm_mul_ps(Y0, Weight1));
+			glm_vec4 R1 = _mm_add_ps(_mm_mul_ps(X1, Weight0), _mm_mul_ps(Y1, Weight1));
+			glm_vec4 R2 = _mm_add_ps(_mm_mul_ps(X2, Weight0), _mm_mul_ps(Y2, Weight1));
+			glm_vec4 R3 = _mm_add_ps(_mm_mul_ps(X3, Weight0), _mm_mul_ps(Y3, Weight1));
+			_MM_TRANSPOSE4_PS(R0, R1, R2, R3);
+			_mm_storeu_ps(Out + i * 4 + 0, R0);
+			_mm_storeu_ps(Out + i * 4 + 4, R1);
+			_mm_storeu_ps(Out + i * 4 + 8, R2);
+			_mm_storeu_ps(Out + i * 4 + 12, R3);
+		}
+		return Blocks;
+	}
+#	endif//GLM_ARCH & GLM_ARCH_SSE2_BIT
+
+#	if GLM_CONFIG_SIMD_DISPATCH == GLM_ENABLE
+	// glm_vec4_sin and glm_vec4_acos on eight lanes
+	GLM_SIMD_TARGET("avx2,fma") inline __m256 sin_avx2(__m256 x)
+	{
+		__m256 const Turns = _mm256_round_ps(_mm256_mul_ps(x, _mm256_set1_ps(0.15915494309189533577f)), _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC);
+		__m256 r = _mm256_fnmadd_ps(Turns, _mm256_set1_ps(6.28318530717958647692f), x);
+		r = _mm256_min_ps(r, _mm256_sub_ps(_mm256_set1_ps(3.14159265358979323846f), r));
+		r = _mm256_max_ps(r, _mm256_sub_ps(_mm256_set1_ps(-3.14159265358979323846f), r));
+
+		__m256 const r2 = _mm256_mul_ps(r, r);
+		__m256 p = _mm256_set1_ps(-2.5052108385e-8f);
+		p = _mm256_fmadd_ps(p, r2, _mm256_set1_ps(2.7557319224e-6f));
+		p = _mm256_fmadd_ps(p, r2, _mm256_set1_ps(-1.9841269841e-4f));
+		p = _mm256_fmadd_ps(p, r2, _mm256_set1_ps(8.3333333333e-3f));
+		p = _mm256_fmadd_ps(p, r2, _mm256_set1_ps(-1.6666666667e-1f));
+		return _mm256_fmadd_ps(_mm256_mul_ps(r, r2), p, r);
+	}
+
+	GLM_SIMD_TARGET("avx2,fma") inline __m256 acos_avx2(__m256 x)
+	{
+		__m256 const a = _mm256_min_ps(_mm256_andnot_ps(_mm256_set1_ps(-0.0f), x), _mm256_set1_ps(1.0f));
+
+		__m256 p = _mm256_set1_ps(-0.0012624911f);
+		p = _mm256_fmadd_ps(p, a, _mm256_set1_ps(0.0066700901f));
+		p = _mm256_fmadd_ps(p, a, _mm256_set1_ps(-0.0170881256f));
+		p = _mm256_fmadd_ps(p, a, _mm256_set1_ps(0.0308918810f));
+		p = _mm256_fmadd_ps(p, a, _mm256_set1_ps(-0.0501743046f));
+		p = _mm256_fmadd_ps(p, a, _mm256_set1_ps(0.0889789874f));
+		p = _mm256_fmadd_ps(p, a, _mm256_set1_ps(-0.2145988016f));
+		p = _mm256_fmadd_ps(p, a, _mm256_set1_ps(1.5707963050f));
+
+		__m256 const r = _mm256_mul_ps(_mm256_sqrt_ps(_mm256_sub_ps(_mm256_set1_ps(1.0f), a)), p);
+		__m256 const Negative = _mm256_cmp_ps(x, _mm256_setzero_ps(), _CMP_LT_OQ);
+		return _mm256_blendv_ps(r, _mm256_sub_ps(_mm256_set1_ps(3.14159265358979323846f), r), Negative);
+	}
+
+	// _MM_TRANSPOSE4_PS within each 128 bit lane
+	GLM_SIMD_TARGET("avx2,fma") inline void transpose4_avx2(__m256& R0, __m256& R1, __m256& R2, __m256& R3)
+	{
+		__m256 const T0 = _mm256_unpacklo_ps(R0, R1);
+		__m256 const T1 = _mm256_unpacklo_ps(R2, R3);
+		__m256 const T2 = _mm256_unpackhi_ps(R0, R1);
+		__m256 const T3 = _mm256_unpackhi_ps(R2, R3);
+		R0 = _mm256_shuffle_ps(T0, T1, _MM_SHUFFLE(1, 0, 1, 0));
+		R1 = _mm256_shuffle_ps(T0, T1, _MM_SHUFFLE(3, 2, 3, 2));
+		R2 = _mm256_shuffle_ps(T2, T3, _MM_SHUFFLE(1, 0, 1, 0));
+		R3 = _mm256_shuffle_ps(T2, T3, _MM_SHUFFLE(3, 2, 3, 2));
+	}
+
+	GLM_SIMD_TARGET("avx2,fma") inline std::size_t slerp_quat_avx2(float const* X, float const* Y, float const* A, float* Out, std::size_t Count)
+	{
+		__m256 const Threshold = _mm256_set1_ps(1.0f - std::numeric_limits<float>::epsilon());
+		__m256 const One = _mm256_set1_ps(1.0f);
+
+		// Two quaternions per register, lane 0 holds the pairs 0, 2, 4, 6 and lane 1 the pairs 1, 3, 5, 7
+		__m256i const Order = _mm256_setr_epi32(0, 2, 4, 6, 1, 3, 5, 7);
+
+		std::size_t const Blocks = Count & ~static_cast<std::size_t>(7);
+		for(std::size_t i = 0; i < Blocks; i += 8)
+		{
+			__m256 X0 = _mm256_loadu_ps(X + i * 4 + 0);
+			__m256 X1 = _mm256_loadu_ps(X + i * 4 + 8);
+			__m256 X2 = _mm256_loadu_ps(X + i * 4 + 16);
+			__m256 X3 = _mm256_loadu_ps(X + i * 4 + 24);
+			__m256 Y0 = _mm256_loadu_ps(Y + i * 4 + 0);
+			__m256 Y1 = _mm256_loadu_ps(Y + i * 4 + 8);
+			__m256 Y2 = _mm256_loadu_ps(Y + i * 4 + 16);
+			__m256 Y3 = _mm256_loadu_ps(Y + i * 4 + 24);
+			transpose4_avx2(X0, X1, X2, X3);
+			transpose4_avx2(Y0, Y1, Y2, Y3);
+			__m256 const a = _mm256_permutevar8x32_ps(_mm256_loadu_ps(A + i), Order);
+
+			__m256 CosTheta = _mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(X0, Y0), _mm256_mul_ps(X1, Y1)), _mm256_add_ps(_mm256_mul_ps(X2, Y2), _mm256_mul_ps(X3, Y3)));
+
+			__m256 const Sign = _mm256_and_ps(_mm256_cmp_ps(CosTheta, _mm256_setzero_ps(), _CMP_LT_OQ), _mm256_set1_ps(-0.0f));
+			CosTheta = _mm256_xor_ps(CosTheta, Sign);
+			Y0 = _mm256_xor_ps(Y0, Sign);
+			Y1 = _mm256_xor_ps(Y1, Sign);
+			Y2 = _mm256_xor_ps(Y2, Sign);
+			Y3 = _mm256_xor_ps(Y3, Sign);
+
+			__m256 const Angle = acos_avx2(CosTheta);
+			__m256 const OneOverSin = _mm256_div_ps(One, sin_avx2(Angle));
+			__m256 const Sin0 = sin_avx2(_mm256_mul_ps(_mm256_sub_ps(One, a), Angle));
+			__m256 const Sin1 = sin_avx2(_mm256_mul_ps(a, Angle));
+
+			__m256 const Linear = _mm256_cmp_ps(CosTheta, Threshold, _CMP_GT_OQ);
+			__m256 const Weight0 = _mm256_blendv_ps(_mm256_mul_ps(Sin0, OneOverSin), _mm256_sub_ps(One, a), Linear);
+			__m256 const Weight1 = _mm256_blendv_ps(_mm256_mul_ps(Sin1, OneOverSin), a, Linear);
+
+			__m256 R0 = _mm256_fmadd_ps(X0, Weight0, _mm256_mul_ps(Y0, Weight1));
+			__m256 R1 = _mm256_fmadd_ps(X1, Weight0, _mm256_mul_ps(Y1, Weight1));
+			__m256 R2 = _mm256_fmadd_ps(X2, Weight0, _mm256_mul_ps(Y2, Weight1));
+			__m256 R3 = _mm256_fmadd_ps(X3, Weight0, _mm256_mul_ps(Y3, Weight1));
+			transpose4_avx2(R0, R1, R2, R3);
+			_mm256_storeu_ps(Out + i * 4 + 0, R0);
+			_mm256_storeu_ps(Out + i * 4 + 8, R1);
+			_mm256_storeu_ps(Out + i * 4 + 16, R2);
+			_mm256_storeu_ps(Out + i * 4 + 24, R3);
+		}
+		return Blocks;
+	}
+#	endif//GLM_CONFIG_SIMD_DISPATCH == GLM_ENABLE
+
+	GLM_FUNC_QUALIFIER std::size_t slerp_quat(float const* X, float const* Y, float const* A, float* Out, std::size_t Count)
+	{
+		std::size_t Done = 0;
+		unsigned int const Features = glm_simd_features();
+#		if GLM_CONFIG_SIMD_DISPATCH == GLM_ENABLE
+			if(Features & GLM_SIMD_AVX2)
+				Done = slerp_quat_avx2(X, Y, A, Out, Count);
+			else
+#		endif
+#		if GLM_ARCH & GLM_ARCH_SSE2_BIT
+			if(Features & GLM_SIMD_SSE2)
+				Done = slerp_quat_sse2(X, Y, A, Out, Count);
+#		endif
+		static_cast<void>(Features);
+		static_cast<void>(X);
+		static_cast<void>(Y);
+		static_cast<void>(A);
+		static_cast<void>(Out);
+
+		return Done;
+	}
+}//namespace detail
+
+	template<qualifier Q>
+	GLM_FUNC_QUALIFIER void slerp(qua<float, Q> const* X, qua<float, Q> const* Y, float const* A, qua<float, Q>* Out, std::size_t Count)
+	{
+		GLM_STATIC_ASSERT(sizeof(qua<float, Q>) == 4 * sizeof(float), "'slerp' only accepts quaternions of 4 contiguous floats");
+
+		std::size_t const Done = detail::slerp_quat(reinterpret_cast<float const*>(X), reinterpret_cast<float const*>(Y), A, reinterpret_cast<float*>(Out), Count);
+		for(std::size_t i = Done; i < Count; ++i)
+			Out[i] = slerp(X[i], Y[i], A[i]);
+	}
+}//namespace glm
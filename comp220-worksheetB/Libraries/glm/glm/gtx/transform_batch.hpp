@@ -0,0 +1,71 @@
+/// @ref gtx_transform_batch
+/// @file glm/gtx/transform_batch.hpp
+///
+/// @see core (dependence)
+///
+/// @defgroup gtx_transform_batch GLM_GTX_transform_batch
+/// @ingroup gtx
+///
+/// Include <glm/gtx/transform_batch.hpp> to use the features of this extension.
+///
+/// Transform arrays of points, directions and matrices by one matrix.
+/// SSE2, AVX2 and AVX-512 code paths are chosen at runtime with glm_simd_features().
+///
+/// Alignment: array of structures inputs and matrices have no alignment requirement.
+/// Structure of arrays inputs and outputs must be aligned to 16 bytes.
+/// Outputs may be the same arrays as the inputs, but must not partially overlap them.
+
+#pragma once
+
+// Dependency:
+#include "../glm.hpp"
+#include "../simd/dispatch.h"
+
+#ifndef GLM_ENABLE_EXPERIMENTAL
+#	error "GLM: GLM_GTX_transform_batch is an experimental extension and may change in the future. Use #define GLM_ENABLE_EXPERIMENTAL before including it, if you really want to use it."
+#endif
+
+#if GLM_MESSAGES == GLM_ENABLE && !defined(GLM_EXT_INCLUDED)
+#	pragma message("GLM: GLM_GTX_transform_batch extension included")
+#endif
+
+namespace glm
+{
+	/// @addtogroup gtx_transform_batch
+	/// @{
+
+	/// Out[i] = vec3(M * vec4(In[i], 1)), without perspective divide.
+	/// vec3 must be a packed type, 12 bytes per element.
+	/// @see gtx_transform_batch
+	template<qualifier Q, qualifier P>
+	GLM_FUNC_DECL void transformPoints(mat<4, 4, float, Q> const& M, vec<3, float, P> const* In, vec<3, float, P>* Out, std::size_t Count);
+
+	/// Out[i] = vec3(M * vec4(In[i], 0)), the translation is ignored.
+	/// vec3 must be a packed type, 12 bytes per element.
+	/// @see gtx_transform_batch
+	template<qualifier Q, qualifier P>
+	GLM_FUNC_DECL void transformDirections(mat<4, 4, float, Q> const& M, vec<3, float, P> const* In, vec<3, float, P>* Out, std::size_t Count);
+
+	/// Structure of arrays transformPoints, every array aligned to 16 bytes.
+	/// @see gtx_transform_batch
+	template<qualifier Q>
+	GLM_FUNC_DECL void transformPoints(mat<4, 4, float, Q> const& M,
+		float const* InX, float const* InY, float const* InZ,
+		float* OutX, float* OutY, float* OutZ, std::size_t Count);
+
+	/// Structure of arrays transformDirections, every array aligned to 16 bytes.
+	/// @see gtx_transform_batch
+	template<qualifier Q>
+	GLM_FUNC_DECL void transformDirections(mat<4, 4, float, Q> const& M,
+		float const* InX, float const* InY, float const* InZ,
+		float* OutX, float* OutY, float* OutZ, std::size_t Count);
+
+	/// Out[i] = M * In[i]
+	/// @see gtx_transform_batch
+	template<qualifier Q, qualifier P>
+	GLM_FUNC_DECL void transformMatrices(mat<4, 4, float, Q> const& M, mat<4, 4, float, P> const* In, mat<4, 4, float, P>* Out, std::size_t Count);
+
+	/// @}
+}// namespace glm
+
+#include "transform_batch.inl"
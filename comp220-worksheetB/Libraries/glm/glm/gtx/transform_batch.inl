@@ -0,0 +1,420 @@
+/// @ref gtx_transform_batch
+
+#include "../simd/platform.h"
+
+namespace glm{
+namespace detail
+{
+	// Kernels take the matrix as 16 column major floats and return how many elements they transformed,
+	// always a multiple of their width, the caller finishes the rest with the scalar kernel.
+
+	GLM_FUNC_QUALIFIER void transform_vec3_scalar(float const* M, float const* InX, float const* InY, float const* InZ,
+		float* OutX, float* OutY, float* OutZ, std::size_t Stride, std::size_t Count)
+	{
+		for(std::size_t i = 0; i < Count; ++i)
+		{
+			float const x = InX[i * Stride];
+			float const y = InY[i * Stride];
+			float const z = InZ[i * Stride];
+			OutX[i * Stride] = M[0] * x + M[4] * y + M[8] * z + M[12];
+			OutY[i * Stride] = M[1] * x + M[5] * y + M[9] * z + M[13];
+			OutZ[i * Stride] = M[2] * x + M[6] * y + M[10] * z + M[14];
+		}
+	}
+
+#	if GLM_ARCH & GLM_ARCH_SSE2_BIT
+	// x0 y0 z0 x1 | y1 z1 x2 y2 | z2 x3 y3 z3 to x0 x1 x2 x3 | y0 y1 y2 y3 | z0 z1 z2 z3 and back.
+	// The shuffles only move floats within 128 bit lanes, so the AVX and AVX-512 kernels use the same pattern on 2 and 4 groups at once.
+#	define GLM_DETAIL_DEINTERLEAVE3(shuffle, A, B, C, X, Y, Z) \
+		X = shuffle(shuffle(A, A, _MM_SHUFFLE(3, 3, 0, 0)), shuffle(B, C, _MM_SHUFFLE(1, 1, 2, 2)), _MM_SHUFFLE(2, 0, 2, 0)); \
+		Y = shuffle(shuffle(A, B, _MM_SHUFFLE(0, 0, 1, 1)), shuffle(B, C, _MM_SHUFFLE(2, 2, 3, 3)), _MM_SHUFFLE(2, 0, 2, 0)); \
+		Z = shuffle(shuffle(A, B, _MM_SHUFFLE(1, 1, 2, 2)), shuffle(C, C, _MM_SHUFFLE(3, 3, 0, 0)), _MM_SHUFFLE(2, 0, 2, 0))
+
+#	define GLM_DETAIL_INTERLEAVE3(shuffle, X, Y, Z, A, B, C) \
+		A = shuffle(shuffle(X, Y, _MM_SHUFFLE(0, 0, 0, 0)), shuffle(Z, X, _MM_SHUFFLE(1, 1, 0, 0)), _MM_SHUFFLE(2, 0, 2, 0)); \
+		B = shuffle(shuffle(Y, Z, _MM_SHUFFLE(1, 1, 1, 1)), shuffle(X, Y, _MM_SHUFFLE(2, 2, 2, 2)), _MM_SHUFFLE(2, 0, 2, 0)); \
+		C = shuffle(shuffle(Z, X, _MM_SHUFFLE(3, 3, 2, 2)), shuffle(Y, Z, _MM_SHUFFLE(3, 3, 3, 3)), _MM_SHUFFLE(2, 0, 2, 0))
+
+	GLM_FUNC_QUALIFIER void transform_vec3_sse2(float const* M, glm_vec4 X, glm_vec4 Y, glm_vec4 Z, glm_vec4& OutX, glm_vec4& OutY, glm_vec4& OutZ)
+	{
+		OutX = _mm_add_ps(_mm_add_ps(_mm_mul_ps(_mm_set1_ps(M[0]), X), _mm_mul_ps(_mm_set1_ps(M[4]), Y)), _mm_add_ps(_mm_mul_ps(_mm_set1_ps(M[8]), Z), _mm_set1_ps(M[12])));
+		OutY = _mm_add_ps(_mm_add_ps(_mm_mul_ps(_mm_set1_ps(M[1]), X), _mm_mul_ps(_mm_set1_ps(M[5]), Y)), _mm_add_ps(_mm_mul_ps(_mm_set1_ps(M[9]), Z), _mm_set1_ps(M[13])));
+		OutZ = _mm_add_ps(_mm_add_ps(_mm_mul_ps(_mm_set1_ps(M[2]), X), _mm_mul_ps(_mm_set1_ps(M[6]), Y)), _mm_add_ps(_mm_mul_ps(_mm_set1_ps(M[10]), Z), _mm_set1_ps(M[14])));
+	}
+
+	GLM_FUNC_QUALIFIER std::size_t transform_vec3_aos_sse2(float const* M, float const* In, float* Out, std::size_t Count)
+	{
+		std::size_t const Blocks = Count & ~static_cast<std::size_t>(3);
+		for(std::size_t i = 0; i < Blocks; i += 4)
+		{
+			glm_vec4 const A = _mm_loadu_ps(In + i * 3 + 0);
+			glm_vec4 const B = _mm_loadu_ps(In + i * 3 + 4);
+			glm_vec4 const C = _mm_loadu_ps(In + i * 3 + 8);
+			glm_vec4 X, Y, Z, OutA, OutB, OutC;
+			GLM_DETAIL_DEINTERLEAVE3(_mm_shuffle_ps, A, B, C, X, Y, Z);
+			transform_vec3_sse2(M, X, Y, Z, X, Y, Z);
+			GLM_DETAIL_INTERLEAVE3(_mm_shuffle_ps, X, Y, Z, OutA, OutB, OutC);
+			_mm_storeu_ps(Out + i * 3 + 0, OutA);
+			_mm_storeu_ps(Out + i * 3 + 4, OutB);
+			_mm_storeu_ps(Out + i * 3 + 8, OutC);
+		}
+		return Blocks;
+	}
+
+	GLM_FUNC_QUALIFIER std::size_t transform_vec3_soa_sse2(float const* M, float const* InX, float const* InY, float const* InZ,
+		float* OutX, float* OutY, float* OutZ, std::size_t Count)
+	{
+		std::size_t const Blocks = Count & ~static_cast<std::size_t>(3);
+		for(std::size_t i = 0; i < Blocks; i += 4)
+		{
+			glm_vec4 X, Y, Z;
+			transform_vec3_sse2(M, _mm_load_ps(InX + i), _mm_load_ps(InY + i), _mm_load_ps(InZ + i), X, Y, Z);
+			_mm_store_ps(OutX + i, X);
+			_mm_store_ps(OutY + i, Y);
+			_mm_store_ps(OutZ + i, Z);
+		}
+		return Blocks;
+	}
+
+	GLM_FUNC_QUALIFIER std::size_t transform_mat4_sse2(float const* M, float const* In, float* Out, std::size_t Count)
+	{
+		glm_vec4 Matrix[4];
+		for(int c = 0; c < 4; ++c)
+			Matrix[c] = _mm_loadu_ps(M + c * 4);
+
+		for(std::size_t i = 0; i < Count; ++i)
+		{
+			// Each output column is a combination of the columns of M, weighted by one input column
+			glm_vec4 Result[4];
+			for(int c = 0; c < 4; ++c)
+			{
+				float const* Column = In + i * 16 + c * 4;
+				glm_vec4 const X = _mm_mul_ps(Matrix[0], _mm_set1_ps(Column[0]));
+				glm_vec4 const Y = _mm_mul_ps(Matrix[1], _mm_set1_ps(Column[1]));
+				glm_vec4 const Z = _mm_mul_ps(Matrix[2], _mm_set1_ps(Column[2]));
+				glm_vec4 const W = _mm_mul_ps(Matrix[3], _mm_set1_ps(Column[3]));
+				Result[c] = _mm_add_ps(_mm_add_ps(X, Y), _mm_add_ps(Z, W));
+			}
+			for(int c = 0; c < 4; ++c)
+				_mm_storeu_ps(Out + i * 16 + c * 4, Result[c]);
+		}
+		return Count;
+	}
+#	endif//GLM_ARCH & GLM_ARCH_SSE2_BIT
+
+#	if GLM_CONFIG_SIMD_DISPATCH == GLM_ENABLE
+	GLM_SIMD_TARGET("avx2,fma") inline void transform_vec3_avx2(float const* M, __m256 X, __m256 Y, __m256 Z, __m256& OutX, __m256& OutY, __m256& OutZ)
+	{
+		OutX = _mm256_fmadd_ps(_mm256_set1_ps(M[0]), X, _mm256_fmadd_ps(_mm256_set1_ps(M[4]), Y, _mm256_fmadd_ps(_mm256_set1_ps(M[8]), Z, _mm256_set1_ps(M[12]))));
+		OutY = _mm256_fmadd_ps(_mm256_set1_ps(M[1]), X, _mm256_fmadd_ps(_mm256_set1_ps(M[5]), Y, _mm256_fmadd_ps(_mm256_set1_ps(M[9]), Z, _mm256_set1_ps(M[13]))));
+		OutZ = _mm256_fmadd_ps(_mm256_set1_ps(M[2]), X, _mm256_fmadd_ps(_mm256_set1_ps(M[6]), Y, _mm256_fmadd_ps(_mm256_set1_ps(M[10]), Z, _mm256_set1_ps(M[14]))));
+	}
+
+	GLM_SIMD_TARGET("avx2,fma") inline __m256 load_lanes_avx2(float const* Low, float const* High)
+	{
+		return _mm256_insertf128_ps(_mm256_castps128_ps256(_mm_loadu_ps(Low)), _mm_loadu_ps(High), 1);
+	}
+
+	GLM_SIMD_TARGET("avx2,fma") inline void store_lanes_avx2(float* Low, float* High, __m256 Value)
+	{
+		_mm_storeu_ps(Low, _mm256_castps256_ps128(Value));
+		_mm_storeu_ps(High, _mm256_extractf128_ps(Value, 1));
+	}
+
+	GLM_SIMD_TARGET("avx2,fma") inline std::size_t transform_vec3_aos_avx2(float const* M, float const* In, float* Out, std::size_t Count)
+	{
+		std::size_t const Blocks = Count & ~static_cast<std::size_t>(7);
+		for(std::size_t i = 0; i < Blocks; i += 8)
+		{
+			// Lane 0 holds points i to i + 3 and lane 1 points i + 4 to i + 7
+			float const* Src = In + i * 3;
+			__m256 const A = load_lanes_avx2(Src + 0, Src + 12);
+			__m256 const B = load_lanes_avx2(Src + 4, Src + 16);
+			__m256 const C = load_lanes_avx2(Src + 8, Src + 20);
+			__m256 X, Y, Z, OutA, OutB, OutC;
+			GLM_DETAIL_DEINTERLEAVE3(_mm256_shuffle_ps, A, B, C, X, Y, Z);
+			transform_vec3_avx2(M, X, Y, Z, X, Y, Z);
+			GLM_DETAIL_INTERLEAVE3(_mm256_shuffle_ps, X, Y, Z, OutA, OutB, OutC);
+			float* Dst = Out + i * 3;
+			store_lanes_avx2(Dst + 0, Dst + 12, OutA);
+			store_lanes_avx2(Dst + 4, Dst + 16, OutB);
+			store_lanes_avx2(Dst + 8, Dst + 20, OutC);
+		}
+		return Blocks;
+	}
+
+	GLM_SIMD_TARGET("avx2,fma") inline std::size_t transform_vec3_soa_avx2(float const* M, float const* InX, float const* InY, float const* InZ,
+		float* OutX, float* OutY, float* OutZ, std::size_t Count)
+	{
+		std::size_t const Blocks = Count & ~static_cast<std::size_t>(7);
+		for(std::size_t i = 0; i < Blocks; i += 8)
+		{
+			__m256 X, Y, Z;
+			transform_vec3_avx2(M, _mm256_loadu_ps(InX + i), _mm256_loadu_ps(InY + i), _mm256_loadu_ps(InZ + i), X, Y, Z);
+			_mm256_storeu_ps(OutX + i, X);
+			_mm256_storeu_ps(OutY + i, Y);
+			_mm256_storeu_ps(OutZ + i, Z);
+		}
+		return Blocks;
+	}
+
+	GLM_SIMD_TARGET("avx2,fma") inline std::size_t transform_mat4_avx2(float const* M, float const* In, float* Out, std::size_t Count)
+	{
+		// Two columns of the input per register, every column of M repeated in both lanes
+		__m256 const M0 = _mm256_broadcast_ps(reinterpret_cast<__m128 const*>(M + 0));
+		__m256 const M1 = _mm256_broadcast_ps(reinterpret_cast<__m128 const*>(M + 4));
+		__m256 const M2 = _mm256_broadcast_ps(reinterpret_cast<__m128 const*>(M + 8));
+		__m256 const M3 = _mm256_broadcast_ps(reinterpret_cast<__m128 const*>(M + 12));
+
+		for(std::size_t i = 0; i < Count; ++i)
+		{
+			__m256 const C01 = _mm256_loadu_ps(In + i * 16 + 0);
+			__m256 const C23 = _mm256_loadu_ps(In + i * 16 + 8);
+			__m256 R01 = _mm256_mul_ps(M0, _mm256_permute_ps(C01, 0x00));
+			__m256 R23 = _mm256_mul_ps(M0, _mm256_permute_ps(C23, 0x00));
+			R01 = _mm256_fmadd_ps(M1, _mm256_permute_ps(C01, 0x55), R01);
+			R23 = _mm256_fmadd_ps(M1, _mm256_permute_ps(C23, 0x55), R23);
+			R01 = _mm256_fmadd_ps(M2, _mm256_permute_ps(C01, 0xAA), R01);
+			R23 = _mm256_fmadd_ps(M2, _mm256_permute_ps(C23, 0xAA), R23);
+			R01 = _mm256_fmadd_ps(M3, _mm256_permute_ps(C01, 0xFF), R01);
+			R23 = _mm256_fmadd_ps(M3, _mm256_permute_ps(C23, 0xFF), R23);
+			_mm256_storeu_ps(Out + i * 16 + 0, R01);
+			_mm256_storeu_ps(Out + i * 16 + 8, R23);
+		}
+		return Count;
+	}
+#	endif//GLM_CONFIG_SIMD_DISPATCH == GLM_ENABLE
+
+#	if GLM_CONFIG_SIMD_DISPATCH_AVX512 == GLM_ENABLE
+	GLM_SIMD_TARGET("avx512f,avx2,fma") inline void transform_vec3_avx512(float const* M, __m512 X, __m512 Y, __m512 Z, __m512& OutX, __m512& OutY, __m512& OutZ)
+	{
+		OutX = _mm512_fmadd_ps(_mm512_set1_ps(M[0]), X, _mm512_fmadd_ps(_mm512_set1_ps(M[4]), Y, _mm512_fmadd_ps(_mm512_set1_ps(M[8]), Z, _mm512_set1_ps(M[12]))));
+		OutY = _mm512_fmadd_ps(_mm512_set1_ps(M[1]), X, _mm512_fmadd_ps(_mm512_set1_ps(M[5]), Y, _mm512_fmadd_ps(_mm512_set1_ps(M[9]), Z, _mm512_set1_ps(M[13]))));
+		OutZ = _mm512_fmadd_ps(_mm512_set1_ps(M[2]), X, _mm512_fmadd_ps(_mm512_set1_ps(M[6]), Y, _mm512_fmadd_ps(_mm512_set1_ps(M[10]), Z, _mm512_set1_ps(M[14]))));
+	}
+
+	// Lane k starts at Src + k * Step
+	GLM_SIMD_TARGET("avx512f,avx2,fma") inline __m512 load_lanes_avx512(float const* Src, std::size_t Step)
+	{
+		// Inserting into zero rather than casting, a cast leaves the upper lanes undefined and GCC 12 warns
+		__m512 Value = _mm512_insertf32x4(_mm512_setzero_ps(), _mm_loadu_ps(Src), 0);
+		Value = _mm512_insertf32x4(Value, _mm_loadu_ps(Src + Step * 1), 1);
+		Value = _mm512_insertf32x4(Value, _mm_loadu_ps(Src + Step * 2), 2);
+		Value = _mm512_insertf32x4(Value, _mm_loadu_ps(Src + Step * 3), 3);
+		return Value;
+	}
+
+	GLM_SIMD_TARGET("avx512f,avx2,fma") inline void store_lanes_avx512(float* Dst, std::size_t Step, __m512 Value)
+	{
+		// Zero masked extracts, the unmasked ones and the cast pass an undefined source that GCC 12 warns about
+		_mm_storeu_ps(Dst, _mm512_maskz_extractf32x4_ps(0xF, Value, 0));
+		_mm_storeu_ps(Dst + Step * 1, _mm512_maskz_extractf32x4_ps(0xF, Value, 1));
+		_mm_storeu_ps(Dst + Step * 2, _mm512_maskz_extractf32x4_ps(0xF, Value, 2));
+		_mm_storeu_ps(Dst + Step * 3, _mm512_maskz_extractf32x4_ps(0xF, Value, 3));
+	}
+
+	GLM_SIMD_TARGET("avx512f,avx2,fma") inline std::size_t transform_vec3_aos_avx512(float const* M, float const* In, float* Out, std::size_t Count)
+	{
+		std::size_t const Blocks = Count & ~static_cast<std::size_t>(15);
+		for(std::size_t i = 0; i < Blocks; i += 16)
+		{
+			float const* Src = In + i * 3;
+			__m512 const A = load_lanes_avx512(Src + 0, 12);
+			__m512 const B = load_lanes_avx512(Src + 4, 12);
+			__m512 const C = load_lanes_avx512(Src + 8, 12);
+			__m512 X, Y, Z, OutA, OutB, OutC;
+			GLM_DETAIL_DEINTERLEAVE3(_mm512_shuffle_ps, A, B, C, X, Y, Z);
+			transform_vec3_avx512(M, X, Y, Z, X, Y, Z);
+			GLM_DETAIL_INTERLEAVE3(_mm512_shuffle_ps, X, Y, Z, OutA, OutB, OutC);
+			float* Dst = Out + i * 3;
+			store_lanes_avx512(Dst + 0, 12, OutA);
+			store_lanes_avx512(Dst + 4, 12, OutB);
+			store_lanes_avx512(Dst + 8, 12, OutC);
+		}
+		return Blocks;
+	}
+
+	GLM_SIMD_TARGET("avx512f,avx2,fma") inline std::size_t transform_vec3_soa_avx512(float const* M, float const* InX, float const* InY, float const* InZ,
+		float* OutX, float* OutY, float* OutZ, std::size_t Count)
+	{
+		std::size_t const Blocks = Count & ~static_cast<std::size_t>(15);
+		for(std::size_t i = 0; i < Blocks; i += 16)
+		{
+			__m512 X, Y, Z;
+			transform_vec3_avx512(M, _mm512_loadu_ps(InX + i), _mm512_loadu_ps(InY + i), _mm512_loadu_ps(InZ + i), X, Y, Z);
+			_mm512_storeu_ps(OutX + i, X);
+			_mm512_storeu_ps(OutY + i, Y);
+			_mm512_storeu_ps(OutZ + i, Z);
+		}
+		return Blocks;
+	}
+
+	GLM_SIMD_TARGET("avx512f,avx2,fma") inline std::size_t transform_mat4_avx512(float const* M, float const* In, float* Out, std::size_t Count)
+	{
+		// The whole input matrix in one register, every column of M repeated in all four lanes
+		// The zero-masked forms are used throughout, the plain ones start from an undefined register and GCC 12 warns
+		__m512 const M0 = _mm512_maskz_broadcast_f32x4(0xFFFF, _mm_loadu_ps(M + 0));
+		__m512 const M1 = _mm512_maskz_broadcast_f32x4(0xFFFF, _mm_loadu_ps(M + 4));
+		__m512 const M2 = _mm512_maskz_broadcast_f32x4(0xFFFF, _mm_loadu_ps(M + 8));
+		__m512 const M3 = _mm512_maskz_broadcast_f32x4(0xFFFF, _mm_loadu_ps(M + 12));
+
+		for(std::size_t i = 0; i < Count; ++i)
+		{
+			__m512 const C = _mm512_loadu_ps(In + i * 16);
+			__m512 R = _mm512_mul_ps(M0, _mm512_maskz_permute_ps(0xFFFF, C, 0x00));
+			R = _mm512_fmadd_ps(M1, _mm512_maskz_permute_ps(0xFFFF, C, 0x55), R);
+			R = _mm512_fmadd_ps(M2, _mm512_maskz_permute_ps(0xFFFF, C, 0xAA), R);
+			R = _mm512_fmadd_ps(M3, _mm512_maskz_permute_ps(0xFFFF, C, 0xFF), R);
+			_mm512_storeu_ps(Out + i * 16, R);
+		}
+		return Count;
+	}
+#	endif//GLM_CONFIG_SIMD_DISPATCH_AVX512 == GLM_ENABLE
+
+#	if GLM_ARCH & GLM_ARCH_SSE2_BIT
+#	undef GLM_DETAIL_DEINTERLEAVE3
+#	undef GLM_DETAIL_INTERLEAVE3
+#	endif
+
+	GLM_FUNC_QUALIFIER void transform_vec3_aos(float const* M, float const* In, float* Out, std::size_t Count)
+	{
+		std::size_t Done = 0;
+		unsigned int const Features = glm_simd_features();
+#		if GLM_CONFIG_SIMD_DISPATCH_AVX512 == GLM_ENABLE
+			if(Features & GLM_SIMD_AVX512F)
+				Done = transform_vec3_aos_avx512(M, In, Out, Count);
+			else
+#		endif
+#		if GLM_CONFIG_SIMD_DISPATCH == GLM_ENABLE
+			if(Features & GLM_SIMD_AVX2)
+				Done = transform_vec3_aos_avx2(M, In, Out, Count);
+			else
+#		endif
+#		if GLM_ARCH & GLM_ARCH_SSE2_BIT
+			if(Features & GLM_SIMD_SSE2)
+				Done = transform_vec3_aos_sse2(M, In, Out, Count);
+#		endif
+		static_cast<void>(Features);
+
+		transform_vec3_scalar(M, In + Done * 3 + 0, In + Done * 3 + 1, In + Done * 3 + 2, Out + Done * 3 + 0, Out + Done * 3 + 1, Out + Done * 3 + 2, 3, Count - Done);
+	}
+
+	GLM_FUNC_QUALIFIER void transform_vec3_soa(float const* M, float const* InX, float const* InY, float const* InZ,
+		float* OutX, float* OutY, float* OutZ, std::size_t Count)
+	{
+		assert(reinterpret_cast<std::size_t>(InX) % 16 == 0 && reinterpret_cast<std::size_t>(InY) % 16 == 0 && reinterpret_cast<std::size_t>(InZ) % 16 == 0);
+		assert(reinterpret_cast<std::size_t>(OutX) % 16 == 0 && reinterpret_cast<std::size_t>(OutY) % 16 == 0 && reinterpret_cast<std::size_t>(OutZ) % 16 == 0);
+
+		std::size_t Done = 0;
+		unsigned int const Features = glm_simd_features();
+#		if GLM_CONFIG_SIMD_DISPATCH_AVX512 == GLM_ENABLE
+			if(Features & GLM_SIMD_AVX512F)
+				Done = transform_vec3_soa_avx512(M, InX, InY, InZ, OutX, OutY, OutZ, Count);
+			else
+#		endif
+#		if GLM_CONFIG_SIMD_DISPATCH == GLM_ENABLE
+			if(Features & GLM_SIMD_AVX2)
+				Done = transform_vec3_soa_avx2(M, InX, InY, InZ, OutX, OutY, OutZ, Count);
+			else
+#		endif
+#		if GLM_ARCH & GLM_ARCH_SSE2_BIT
+			if(Features & GLM_SIMD_SSE2)
+				Done = transform_vec3_soa_sse2(M, InX, InY, InZ, OutX, OutY, OutZ, Count);
+#		endif
+		static_cast<void>(Features);
+
+		transform_vec3_scalar(M, InX + Done, InY + Done, InZ + Done, OutX + Done, OutY + Done, OutZ + Done, 1, Count - Done);
+	}
+
+	GLM_FUNC_QUALIFIER void transform_mat4(float const* M, float const* In, float* Out, std::size_t Count)
+	{
+		std::size_t Done = 0;
+		unsigned int const Features = glm_simd_features();
+#		if GLM_CONFIG_SIMD_DISPATCH_AVX512 == GLM_ENABLE
+			if(Features & GLM_SIMD_AVX512F)
+				Done = transform_mat4_avx512(M, In, Out, Count);
+			else
+#		endif
+#		if GLM_CONFIG_SIMD_DISPATCH == GLM_ENABLE
+			if(Features & GLM_SIMD_AVX2)
+				Done = transform_mat4_avx2(M, In, Out, Count);
+			else
+#		endif
+#		if GLM_ARCH & GLM_ARCH_SSE2_BIT
+			if(Features & GLM_SIMD_SSE2)
+				Done = transform_mat4_sse2(M, In, Out, Count);
+#		endif
+		static_cast<void>(Features);
+
+		for(std::size_t i = Done; i < Count; ++i)
+		{
+			float Result[16];
+			for(int c = 0; c < 4; ++c)
+			for(int r = 0; r < 4; ++r)
+				Result[c * 4 + r] = M[r] * In[i * 16 + c * 4] + M[4 + r] * In[i * 16 + c * 4 + 1] + M[8 + r] * In[i * 16 + c * 4 + 2] + M[12 + r] * In[i * 16 + c * 4 + 3];
+			for(int j = 0; j < 16; ++j)
+				Out[i * 16 + j] = Result[j];
+		}
+	}
+}//namespace detail
+
+	template<qualifier Q, qualifier P>
+	GLM_FUNC_QUALIFIER void transformPoints(mat<4, 4, float, Q> const& M, vec<3, float, P> const* In, vec<3, float, P>* Out, std::size_t Count)
+	{
+		GLM_STATIC_ASSERT(sizeof(vec<3, float, P>) == 3 * sizeof(float), "'transformPoints' only accepts packed vec3 arrays");
+
+		float Matrix[16];
+		for(length_t c = 0; c < 4; ++c)
+		for(length_t r = 0; r < 4; ++r)
+			Matrix[c * 4 + r] = M[c][r];
+		detail::transform_vec3_aos(Matrix, reinterpret_cast<float const*>(In), reinterpret_cast<float*>(Out), Count);
+	}
+
+	template<qualifier Q, qualifier P>
+	GLM_FUNC_QUALIFIER void transformDirections(mat<4, 4, float, Q> const& M, vec<3, float, P> const* In, vec<3, float, P>* Out, std::size_t Count)
+	{
+		GLM_STATIC_ASSERT(sizeof(vec<3, float, P>) == 3 * sizeof(float), "'transformDirections' only accepts packed vec3 arrays");
+
+		float Matrix[16];
+		for(length_t c = 0; c < 4; ++c)
+		for(length_t r = 0; r < 4; ++r)
+			Matrix[c * 4 + r] = c < 3 ? M[c][r] : 0.0f;
+		detail::transform_vec3_aos(Matrix, reinterpret_cast<float const*>(In), reinterpret_cast<float*>(Out), Count);
+	}
+
+	template<qualifier Q>
+	GLM_FUNC_QUALIFIER void transformPoints(mat<4, 4, float, Q> const& M,
+		float const* InX, float const* InY, float const* InZ,
+		float* OutX, float* OutY, float* OutZ, std::size_t Count)
+	{
+		float Matrix[16];
+		for(length_t c = 0; c < 4; ++c)
+		for(length_t r = 0; r < 4; ++r)
+			Matrix[c * 4 + r] = M[c][r];
+		detail::transform_vec3_soa(Matrix, InX, InY, InZ, OutX, OutY, OutZ, Count);
+	}
+
+	template<qualifier Q>
+	GLM_FUNC_QUALIFIER void transformDirections(mat<4, 4, float, Q> const& M,
+		float const* InX, float const* InY, float const* InZ,
+		float* OutX, float* OutY, float* OutZ, std::size_t Count)
+	{
+		float Matrix[16];
+		for(length_t c = 0; c < 4; ++c)
+		for(length_t r = 0; r < 4; ++r)
+			Matrix[c * 4 + r] = c < 3 ? M[c][r] : 0.0f;
+		detail::transform_vec3_soa(Matrix, InX, InY, InZ, OutX, OutY, OutZ, Count);
+	}
+
+	template<qualifier Q, qualifier P>
+	GLM_FUNC_QUALIFIER void transformMatrices(mat<4, 4, float, Q> const& M, mat<4, 4, float, P> const* In, mat<4, 4, float, P>* Out, std::size_t Count)
+	{
+		GLM_STATIC_ASSERT(sizeof(mat<4, 4, float, P>) == 16 * sizeof(float), "'transformMatrices' only accepts matrices of 16 contiguous floats");
+
+		float Matrix[16];
+		for(length_t c = 0; c < 4; ++c)
+		for(length_t r = 0; r < 4; ++r)
+			Matrix[c * 4 + r] = M[c][r];
+		detail::transform_mat4(Matrix, reinterpret_cast<float const*>(In), reinterpret_cast<float*>(Out), Count);
+	}
+}//namespace glm
@@ -0,0 +1,132 @@
+/// @ref simd
+/// @file glm/simd/dispatch.h
+///
+/// Runtime detection of the x86 instruction sets the batch functions can use.
+/// Kernels for instruction sets wider than the ones the translation unit is compiled for
+/// are built with GLM_SIMD_TARGET and only called when glm_simd_features() reports them.
+
+#pragma once
+
+#include "platform.h"
+
+#define GLM_SIMD_SSE2		(0x00000001)
+#define GLM_SIMD_SSE41		(0x00000002)
+#define GLM_SIMD_AVX		(0x00000004)
+#define GLM_SIMD_AVX2		(0x00000008) // AVX2 and FMA3
+#define GLM_SIMD_F16C		(0x00000010)
+#define GLM_SIMD_AVX512F	(0x00000020)
+
+// Compilers that accept intrinsics of any instruction set in functions marked with GLM_SIMD_TARGET
+#if !(GLM_ARCH & GLM_ARCH_SSE2_BIT) || defined(__CUDACC__)
+#	define GLM_CONFIG_SIMD_DISPATCH GLM_DISABLE
+#elif GLM_COMPILER & GLM_COMPILER_VC
+#	define GLM_CONFIG_SIMD_DISPATCH GLM_ENABLE
+#	define GLM_SIMD_TARGET(Target)
+#elif (GLM_COMPILER & GLM_COMPILER_CLANG) || ((GLM_COMPILER & GLM_COMPILER_GCC) && GLM_COMPILER >= GLM_COMPILER_GCC49)
+#	define GLM_CONFIG_SIMD_DISPATCH GLM_ENABLE
+#	define GLM_SIMD_TARGET(Target) __attribute__((target(Target)))
+#else
+#	define GLM_CONFIG_SIMD_DISPATCH GLM_DISABLE
+#endif
+
+// AVX-512 intrinsics need a newer compiler than the rest
+#if GLM_CONFIG_SIMD_DISPATCH == GLM_ENABLE && ( \
+	((GLM_COMPILER & GLM_COMPILER_VC) && GLM_COMPILER >= GLM_COMPILER_VC15_3) || \
+	((GLM_COMPILER & GLM_COMPILER_GCC) && GLM_COMPILER >= GLM_COMPILER_GCC5) || \
+	((GLM_COMPILER & GLM_COMPILER_CLANG) && GLM_COMPILER >= GLM_COMPILER_CLANG39))
+#	define GLM_CONFIG_SIMD_DISPATCH_AVX512 GLM_ENABLE
+#else
+#	define GLM_CONFIG_SIMD_DISPATCH_AVX512 GLM_DISABLE
+#endif
+
+#if GLM_CONFIG_SIMD_DISPATCH == GLM_ENABLE
+#	if GLM_COMPILER & GLM_COMPILER_VC
+#		include <intrin.h>
+#	else
+#		include <cpuid.h>
+#	endif
+#	include <immintrin.h>
+#endif
+
+GLM_FUNC_QUALIFIER unsigned int glm_simd_detect_features()
+{
+	unsigned int Features = 0;
+
+#	if GLM_ARCH & GLM_ARCH_SSE2_BIT
+		Features |= GLM_SIMD_SSE2;
+#	endif
+
+#	if GLM_CONFIG_SIMD_DISPATCH == GLM_ENABLE
+		unsigned int Leaf1[4] = {0, 0, 0, 0};
+		unsigned int Leaf7[4] = {0, 0, 0, 0};
+		unsigned long long XCR0 = 0;
+
+#		if GLM_COMPILER & GLM_COMPILER_VC
+			int Info[4];
+			__cpuid(Info, 0);
+			int const MaxLeaf = Info[0];
+			__cpuid(Info, 1);
+			for(int i = 0; i < 4; ++i)
+				Leaf1[i] = static_cast<unsigned int>(Info[i]);
+			if(MaxLeaf >= 7)
+			{
+				__cpuidex(Info, 7, 0);
+				for(int i = 0; i < 4; ++i)
+					Leaf7[i] = static_cast<unsigned int>(Info[i]);
+			}
+			if(Leaf1[2] & (1u << 27))
+				XCR0 = _xgetbv(0);
+#		else
+			unsigned int const MaxLeaf = __get_cpuid_max(0, 0);
+			if(MaxLeaf >= 1)
+				__cpuid(1, Leaf1[0], Leaf1[1], Leaf1[2], Leaf1[3]);
+			if(MaxLeaf >= 7)
+				__cpuid_count(7, 0, Leaf7[0], Leaf7[1], Leaf7[2], Leaf7[3]);
+			if(Leaf1[2] & (1u << 27))
+			{
+				unsigned int Low, High;
+				__asm__ __volatile__("xgetbv" : "=a"(Low), "=d"(High) : "c"(0));
+				XCR0 = (static_cast<unsigned long long>(High) << 32) | Low;
+			}
+#		endif
+
+		// The OS has to save the YMM and ZMM registers, not just the CPU support the instructions
+		bool const YMM = (XCR0 & 0x06) == 0x06;
+		bool const ZMM = (XCR0 & 0xE6) == 0xE6;
+
+		if(Leaf1[2] & (1u << 19))
+			Features |= GLM_SIMD_SSE41;
+		if(YMM && (Leaf1[2] & (1u << 28)))
+			Features |= GLM_SIMD_AVX;
+		if((Features & GLM_SIMD_AVX) && (Leaf1[2] & (1u << 29)))
+			Features |= GLM_SIMD_F16C;
+		if((Features & GLM_SIMD_AVX) && (Leaf7[1] & (1u << 5)) && (Leaf1[2] & (1u << 12)))
+			Features |= GLM_SIMD_AVX2;
+		if((Features & GLM_SIMD_AVX2) && ZMM && (Leaf7[1] & (1u << 16)))
+			Features |= GLM_SIMD_AVX512F;
+#	endif
+
+	return Features;
+}
+
+/// Whether the CPU has every instruction set of Features, whatever glm_simd_feature_mask() restricts them to.
+/// Benchmarks use it to skip the code paths that would only measure the next narrower one again.
+GLM_FUNC_QUALIFIER bool glm_simd_has_features(unsigned int Features)
+{
+	return (glm_simd_detect_features() & Features) == Features;
+}
+
+/// Restricts the instruction sets glm_simd_features() reports, to test or benchmark the narrower code paths.
+/// Not synchronized, set it before other threads call batch functions.
+GLM_FUNC_QUALIFIER unsigned int& glm_simd_feature_mask()
+{
+	static unsigned int Mask = ~0u;
+	return Mask;
+}
+
+/// Instruction sets usable on this CPU, detected on the first call.
+GLM_FUNC_QUALIFIER unsigned int glm_simd_features()
+{
+	static unsigned int const Features = glm_simd_detect_features();
+	return Features & glm_simd_feature_mask();
+}
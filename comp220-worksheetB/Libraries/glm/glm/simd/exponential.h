@@ -17,4 +17,38 @@ GLM_FUNC_QUALIFIER glm_f32vec4 glm_vec4_sqrt_lowp(glm_f32vec4 x)
 	return _mm_mul_ps(_mm_rsqrt_ps(x), x);
 }
 
+/// Natural logarithm for x > 0, relative error under 2e-7 for normal numbers.
+/// Cephes logf: x = m * 2^e with m in [sqrt(0.5), sqrt(2)), then a polynomial in m - 1.
+GLM_FUNC_QUALIFIER glm_f32vec4 glm_vec4_log(glm_f32vec4 x)
+{
+	glm_f32vec4 const One = _mm_set1_ps(1.0f);
+
+	x = _mm_max_ps(x, _mm_castsi128_ps(_mm_set1_epi32(0x00800000)));
+	glm_i32vec4 const Exponent = _mm_sub_epi32(_mm_srli_epi32(_mm_castps_si128(x), 23), _mm_set1_epi32(126));
+	glm_f32vec4 e = _mm_cvtepi32_ps(Exponent);
+
+	// m in [0.5, 1)
+	glm_f32vec4 m = _mm_or_ps(_mm_and_ps(x, _mm_castsi128_ps(_mm_set1_epi32(~0x7f800000))), _mm_set1_ps(0.5f));
+	glm_f32vec4 const Small = _mm_cmplt_ps(m, _mm_set1_ps(0.707106781186547524f));
+	e = _mm_sub_ps(e, _mm_and_ps(One, Small));
+	m = _mm_add_ps(_mm_sub_ps(m, One), _mm_and_ps(m, Small));
+
+	glm_f32vec4 const z = _mm_mul_ps(m, m);
+	glm_f32vec4 p = _mm_set1_ps(7.0376836292e-2f);
+	p = _mm_add_ps(_mm_mul_ps(p, m), _mm_set1_ps(-1.1514610310e-1f));
+	p = _mm_add_ps(_mm_mul_ps(p, m), _mm_set1_ps(1.1676998740e-1f));
+	p = _mm_add_ps(_mm_mul_ps(p, m), _mm_set1_ps(-1.2420140846e-1f));
+	p = _mm_add_ps(_mm_mul_ps(p, m), _mm_set1_ps(1.4249322787e-1f));
+	p = _mm_add_ps(_mm_mul_ps(p, m), _mm_set1_ps(-1.6668057665e-1f));
+	p = _mm_add_ps(_mm_mul_ps(p, m), _mm_set1_ps(2.0000714765e-1f));
+	p = _mm_add_ps(_mm_mul_ps(p, m), _mm_set1_ps(-2.4999993993e-1f));
+	p = _mm_add_ps(_mm_mul_ps(p, m), _mm_set1_ps(3.3333331174e-1f));
+	p = _mm_mul_ps(_mm_mul_ps(p, m), z);
+
+	// ln(2) split in two parts for precision
+	p = _mm_add_ps(p, _mm_mul_ps(e, _mm_set1_ps(-2.12194440e-4f)));
+	p = _mm_sub_ps(p, _mm_mul_ps(z, _mm_set1_ps(0.5f)));
+	return _mm_add_ps(_mm_add_ps(m, p), _mm_mul_ps(e, _mm_set1_ps(0.693359375f)));
+}
+
 #endif//GLM_ARCH & GLM_ARCH_SSE2_BIT
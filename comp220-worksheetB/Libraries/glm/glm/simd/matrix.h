@@ -31,6 +31,14 @@ GLM_FUNC_QUALIFIER void glm_mat4_sub(glm_vec4 const in1[4], glm_vec4 const in2[4
 	out[3] = _mm_sub_ps(in1[3], in2[3]);
 }
 
+GLM_FUNC_QUALIFIER void glm_mat4_mul_scalar(glm_vec4 const in[4], glm_vec4 s, glm_vec4 out[4])
+{
+	out[0] = _mm_mul_ps(in[0], s);
+	out[1] = _mm_mul_ps(in[1], s);
+	out[2] = _mm_mul_ps(in[2], s);
+	out[3] = _mm_mul_ps(in[3], s);
+}
+
 GLM_FUNC_QUALIFIER glm_vec4 glm_mat4_mul_vec4(glm_vec4 const m[4], glm_vec4 v)
 {
 	__m128 v0 = _mm_shuffle_ps(v, v, _MM_SHUFFLE(0, 0, 0, 0));
@@ -1026,3 +1034,192 @@ GLM_FUNC_QUALIFIER void glm_mat4_outerProduct(__m128 const& c, __m128 const& r,
 }
 
 #endif//GLM_ARCH & GLM_ARCH_SSE2_BIT
+
+#if GLM_ARCH & GLM_ARCH_AVX_BIT
+
+// AVX can't shuffle doubles across the two 128 bits halves in one instruction,
+// so without AVX2 each swizzle first picks the halves with vperm2f128 then the lanes within them.
+GLM_FUNC_QUALIFIER glm_dvec4 glm_dvec4_swizzle_xxxx(glm_dvec4 v)
+{
+#	if GLM_ARCH & GLM_ARCH_AVX2_BIT
+		return _mm256_permute4x64_pd(v, 0x00);
+#	else
+		return _mm256_permute_pd(_mm256_permute2f128_pd(v, v, 0x00), 0x0);
+#	endif
+}
+
+GLM_FUNC_QUALIFIER glm_dvec4 glm_dvec4_swizzle_yyyy(glm_dvec4 v)
+{
+#	if GLM_ARCH & GLM_ARCH_AVX2_BIT
+		return _mm256_permute4x64_pd(v, 0x55);
+#	else
+		return _mm256_permute_pd(_mm256_permute2f128_pd(v, v, 0x00), 0xF);
+#	endif
+}
+
+GLM_FUNC_QUALIFIER glm_dvec4 glm_dvec4_swizzle_zzzz(glm_dvec4 v)
+{
+#	if GLM_ARCH & GLM_ARCH_AVX2_BIT
+		return _mm256_permute4x64_pd(v, 0xAA);
+#	else
+		return _mm256_permute_pd(_mm256_permute2f128_pd(v, v, 0x11), 0x0);
+#	endif
+}
+
+GLM_FUNC_QUALIFIER glm_dvec4 glm_dvec4_swizzle_wwww(glm_dvec4 v)
+{
+#	if GLM_ARCH & GLM_ARCH_AVX2_BIT
+		return _mm256_permute4x64_pd(v, 0xFF);
+#	else
+		return _mm256_permute_pd(_mm256_permute2f128_pd(v, v, 0x11), 0xF);
+#	endif
+}
+
+GLM_FUNC_QUALIFIER glm_dvec4 glm_dvec4_swizzle_yxxx(glm_dvec4 v)
+{
+#	if GLM_ARCH & GLM_ARCH_AVX2_BIT
+		return _mm256_permute4x64_pd(v, 0x01);
+#	else
+		return _mm256_permute_pd(_mm256_permute2f128_pd(v, v, 0x00), 0x1);
+#	endif
+}
+
+GLM_FUNC_QUALIFIER glm_dvec4 glm_dvec4_swizzle_zzyy(glm_dvec4 v)
+{
+#	if GLM_ARCH & GLM_ARCH_AVX2_BIT
+		return _mm256_permute4x64_pd(v, 0x5A);
+#	else
+		return _mm256_permute_pd(_mm256_permute2f128_pd(v, v, 0x01), 0xC);
+#	endif
+}
+
+GLM_FUNC_QUALIFIER glm_dvec4 glm_dvec4_swizzle_wwwz(glm_dvec4 v)
+{
+#	if GLM_ARCH & GLM_ARCH_AVX2_BIT
+		return _mm256_permute4x64_pd(v, 0xBF);
+#	else
+		return _mm256_permute_pd(_mm256_permute2f128_pd(v, v, 0x11), 0x7);
+#	endif
+}
+
+// Sum of the four lanes, in every lane
+GLM_FUNC_QUALIFIER glm_dvec4 glm_dvec4_sum(glm_dvec4 v)
+{
+	glm_dvec4 const add0 = _mm256_add_pd(v, _mm256_permute2f128_pd(v, v, 0x01));
+	glm_dvec4 const add1 = _mm256_add_pd(add0, _mm256_permute_pd(add0, 0x5));
+	return add1;
+}
+
+GLM_FUNC_QUALIFIER glm_dvec4 glm_dmat4_mul_dvec4(glm_dvec4 const m[4], glm_dvec4 v)
+{
+	glm_dvec4 const m0 = _mm256_mul_pd(m[0], glm_dvec4_swizzle_xxxx(v));
+	glm_dvec4 const m1 = _mm256_mul_pd(m[1], glm_dvec4_swizzle_yyyy(v));
+	glm_dvec4 const m2 = _mm256_mul_pd(m[2], glm_dvec4_swizzle_zzzz(v));
+	glm_dvec4 const m3 = _mm256_mul_pd(m[3], glm_dvec4_swizzle_wwww(v));
+
+	glm_dvec4 const a0 = _mm256_add_pd(m0, m1);
+	glm_dvec4 const a1 = _mm256_add_pd(m2, m3);
+	return _mm256_add_pd(a0, a1);
+}
+
+GLM_FUNC_QUALIFIER void glm_dmat4_mul(glm_dvec4 const in1[4], glm_dvec4 const in2[4], glm_dvec4 out[4])
+{
+	// Computed before storing so that out may alias in1 or in2
+	glm_dvec4 const r0 = glm_dmat4_mul_dvec4(in1, in2[0]);
+	glm_dvec4 const r1 = glm_dmat4_mul_dvec4(in1, in2[1]);
+	glm_dvec4 const r2 = glm_dmat4_mul_dvec4(in1, in2[2]);
+	glm_dvec4 const r3 = glm_dmat4_mul_dvec4(in1, in2[3]);
+
+	out[0] = r0;
+	out[1] = r1;
+	out[2] = r2;
+	out[3] = r3;
+}
+
+GLM_FUNC_QUALIFIER void glm_dmat4_transpose(glm_dvec4 const in[4], glm_dvec4 out[4])
+{
+	glm_dvec4 const tmp0 = _mm256_unpacklo_pd(in[0], in[1]);
+	glm_dvec4 const tmp1 = _mm256_unpackhi_pd(in[0], in[1]);
+	glm_dvec4 const tmp2 = _mm256_unpacklo_pd(in[2], in[3]);
+	glm_dvec4 const tmp3 = _mm256_unpackhi_pd(in[2], in[3]);
+
+	out[0] = _mm256_permute2f128_pd(tmp0, tmp2, 0x20);
+	out[1] = _mm256_permute2f128_pd(tmp1, tmp3, 0x20);
+	out[2] = _mm256_permute2f128_pd(tmp0, tmp2, 0x31);
+	out[3] = _mm256_permute2f128_pd(tmp1, tmp3, 0x31);
+}
+
+// Same cofactor expansion as compute_determinant<4, 4>, the four cofactors of the first column in one register
+GLM_FUNC_QUALIFIER glm_dvec4 glm_dmat4_determinant(glm_dvec4 const m[4])
+{
+	glm_dvec4 const m2_yxxx = glm_dvec4_swizzle_yxxx(m[2]);
+	glm_dvec4 const m2_zzyy = glm_dvec4_swizzle_zzyy(m[2]);
+	glm_dvec4 const m2_wwwz = glm_dvec4_swizzle_wwwz(m[2]);
+	glm_dvec4 const m3_yxxx = glm_dvec4_swizzle_yxxx(m[3]);
+	glm_dvec4 const m3_zzyy = glm_dvec4_swizzle_zzyy(m[3]);
+	glm_dvec4 const m3_wwwz = glm_dvec4_swizzle_wwwz(m[3]);
+
+	// (SubFactor00, SubFactor00, SubFactor01, SubFactor02)
+	glm_dvec4 const Sub0 = _mm256_sub_pd(_mm256_mul_pd(m2_zzyy, m3_wwwz), _mm256_mul_pd(m3_zzyy, m2_wwwz));
+	// (SubFactor01, SubFactor03, SubFactor03, SubFactor04)
+	glm_dvec4 const Sub1 = _mm256_sub_pd(_mm256_mul_pd(m2_yxxx, m3_wwwz), _mm256_mul_pd(m3_yxxx, m2_wwwz));
+	// (SubFactor02, SubFactor04, SubFactor05, SubFactor05)
+	glm_dvec4 const Sub2 = _mm256_sub_pd(_mm256_mul_pd(m2_yxxx, m3_zzyy), _mm256_mul_pd(m3_yxxx, m2_zzyy));
+
+	glm_dvec4 const Mul0 = _mm256_mul_pd(glm_dvec4_swizzle_yxxx(m[1]), Sub0);
+	glm_dvec4 const Mul1 = _mm256_mul_pd(glm_dvec4_swizzle_zzyy(m[1]), Sub1);
+	glm_dvec4 const Mul2 = _mm256_mul_pd(glm_dvec4_swizzle_wwwz(m[1]), Sub2);
+	glm_dvec4 const Cof = _mm256_add_pd(_mm256_sub_pd(Mul0, Mul1), Mul2);
+
+	glm_dvec4 const DetCof = _mm256_mul_pd(Cof, _mm256_set_pd(-1.0, 1.0, -1.0, 1.0));
+	return glm_dvec4_sum(_mm256_mul_pd(m[0], DetCof));
+}
+
+// Same algorithm as compute_inverse<4, 4>, working on the rows so that each Fac vector
+// is built from the same lanes of two rows
+GLM_FUNC_QUALIFIER void glm_dmat4_inverse(glm_dvec4 const in[4], glm_dvec4 out[4])
+{
+	glm_dvec4 Row[4];
+	glm_dmat4_transpose(in, Row);
+
+	glm_dvec4 A[4], B[4], Vec[4];
+	for(int i = 0; i < 4; ++i)
+	{
+		A[i] = glm_dvec4_swizzle_zzyy(Row[i]);
+		B[i] = glm_dvec4_swizzle_wwwz(Row[i]);
+		Vec[i] = glm_dvec4_swizzle_yxxx(Row[i]);
+	}
+
+	glm_dvec4 const Fac0 = _mm256_sub_pd(_mm256_mul_pd(A[2], B[3]), _mm256_mul_pd(B[2], A[3]));
+	glm_dvec4 const Fac1 = _mm256_sub_pd(_mm256_mul_pd(A[1], B[3]), _mm256_mul_pd(B[1], A[3]));
+	glm_dvec4 const Fac2 = _mm256_sub_pd(_mm256_mul_pd(A[1], B[2]), _mm256_mul_pd(B[1], A[2]));
+	glm_dvec4 const Fac3 = _mm256_sub_pd(_mm256_mul_pd(A[0], B[3]), _mm256_mul_pd(B[0], A[3]));
+	glm_dvec4 const Fac4 = _mm256_sub_pd(_mm256_mul_pd(A[0], B[2]), _mm256_mul_pd(B[0], A[2]));
+	glm_dvec4 const Fac5 = _mm256_sub_pd(_mm256_mul_pd(A[0], B[1]), _mm256_mul_pd(B[0], A[1]));
+
+	glm_dvec4 const Inv0 = _mm256_add_pd(_mm256_sub_pd(_mm256_mul_pd(Vec[1], Fac0), _mm256_mul_pd(Vec[2], Fac1)), _mm256_mul_pd(Vec[3], Fac2));
+	glm_dvec4 const Inv1 = _mm256_add_pd(_mm256_sub_pd(_mm256_mul_pd(Vec[0], Fac0), _mm256_mul_pd(Vec[2], Fac3)), _mm256_mul_pd(Vec[3], Fac4));
+	glm_dvec4 const Inv2 = _mm256_add_pd(_mm256_sub_pd(_mm256_mul_pd(Vec[0], Fac1), _mm256_mul_pd(Vec[1], Fac3)), _mm256_mul_pd(Vec[3], Fac5));
+	glm_dvec4 const Inv3 = _mm256_add_pd(_mm256_sub_pd(_mm256_mul_pd(Vec[0], Fac2), _mm256_mul_pd(Vec[1], Fac4)), _mm256_mul_pd(Vec[2], Fac5));
+
+	glm_dvec4 const SignA = _mm256_set_pd(-1.0, 1.0, -1.0, 1.0);
+	glm_dvec4 const SignB = _mm256_set_pd(1.0, -1.0, 1.0, -1.0);
+	glm_dvec4 const Col0 = _mm256_mul_pd(Inv0, SignA);
+	glm_dvec4 const Col1 = _mm256_mul_pd(Inv1, SignB);
+	glm_dvec4 const Col2 = _mm256_mul_pd(Inv2, SignA);
+	glm_dvec4 const Col3 = _mm256_mul_pd(Inv3, SignB);
+
+	// First row of the adjugate, dotted with the first column gives the determinant
+	glm_dvec4 const Row01 = _mm256_unpacklo_pd(Col0, Col1);
+	glm_dvec4 const Row23 = _mm256_unpacklo_pd(Col2, Col3);
+	glm_dvec4 const Row0 = _mm256_permute2f128_pd(Row01, Row23, 0x20);
+	glm_dvec4 const Det = glm_dvec4_sum(_mm256_mul_pd(in[0], Row0));
+	glm_dvec4 const OneOverDeterminant = _mm256_div_pd(_mm256_set1_pd(1.0), Det);
+
+	out[0] = _mm256_mul_pd(Col0, OneOverDeterminant);
+	out[1] = _mm256_mul_pd(Col1, OneOverDeterminant);
+	out[2] = _mm256_mul_pd(Col2, OneOverDeterminant);
+	out[3] = _mm256_mul_pd(Col3, OneOverDeterminant);
+}
+
+#endif//GLM_ARCH & GLM_ARCH_AVX_BIT
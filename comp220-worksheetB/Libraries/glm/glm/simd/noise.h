@@ -0,0 +1,344 @@
+/// @ref simd
+/// @file glm/simd/noise.h
+///
+/// Noise of four points at once, one point per lane, the coordinates in separate registers.
+/// Every lane performs the operations of the gtc_noise functions in the same order,
+/// giving the same bits as perlin and simplex on packed vectors.
+
+#pragma once
+
+#include "platform.h"
+
+#if GLM_ARCH & GLM_ARCH_SSE2_BIT
+
+/// floor of every lane, exact for every float unlike the SSE2 fallback of glm_vec4_floor.
+GLM_FUNC_QUALIFIER glm_vec4 glm_noise_floor(glm_vec4 x)
+{
+#	if GLM_ARCH & GLM_ARCH_SSE41_BIT
+		return _mm_floor_ps(x);
+#	else
+		glm_vec4 const trc0 = _mm_cvtepi32_ps(_mm_cvttps_epi32(x));
+		glm_vec4 const flr0 = _mm_sub_ps(trc0, _mm_and_ps(_mm_cmplt_ps(x, trc0), _mm_set1_ps(1.0f)));
+
+		// Lanes from 2^23 are integers already and overflow the conversion from 2^31, zeros keep their sign
+		glm_vec4 const abs0 = _mm_andnot_ps(_mm_set1_ps(-0.0f), x);
+		glm_vec4 const keep = _mm_or_ps(_mm_cmpge_ps(abs0, _mm_set1_ps(8388608.0f)), _mm_cmpeq_ps(x, _mm_setzero_ps()));
+		return _mm_or_ps(_mm_and_ps(keep, x), _mm_andnot_ps(keep, flr0));
+#	endif
+}
+
+GLM_FUNC_QUALIFIER glm_vec4 glm_noise_fract(glm_vec4 x)
+{
+	return _mm_sub_ps(x, glm_noise_floor(x));
+}
+
+GLM_FUNC_QUALIFIER glm_vec4 glm_noise_abs(glm_vec4 x)
+{
+	return _mm_andnot_ps(_mm_set1_ps(-0.0f), x);
+}
+
+// step(edge, x) = x < edge ? 0 : 1
+GLM_FUNC_QUALIFIER glm_vec4 glm_noise_step(glm_vec4 edge, glm_vec4 x)
+{
+	return _mm_andnot_ps(_mm_cmplt_ps(x, edge), _mm_set1_ps(1.0f));
+}
+
+// mix(x, y, a) = x + a * (y - x)
+GLM_FUNC_QUALIFIER glm_vec4 glm_noise_mix(glm_vec4 x, glm_vec4 y, glm_vec4 a)
+{
+	return _mm_add_ps(x, _mm_mul_ps(a, _mm_sub_ps(y, x)));
+}
+
+// mod(x, 289) dividing like glm::mod
+GLM_FUNC_QUALIFIER glm_vec4 glm_noise_mod(glm_vec4 x)
+{
+	glm_vec4 const m = _mm_set1_ps(289.0f);
+	return _mm_sub_ps(x, _mm_mul_ps(m, glm_noise_floor(_mm_div_ps(x, m))));
+}
+
+// detail::mod289 multiplying by the reciprocal
+GLM_FUNC_QUALIFIER glm_vec4 glm_noise_mod289(glm_vec4 x)
+{
+	return _mm_sub_ps(x, _mm_mul_ps(glm_noise_floor(_mm_mul_ps(x, _mm_set1_ps(1.0f / 289.0f))), _mm_set1_ps(289.0f)));
+}
+
+GLM_FUNC_QUALIFIER glm_vec4 glm_noise_permute(glm_vec4 x)
+{
+	return glm_noise_mod289(_mm_mul_ps(_mm_add_ps(_mm_mul_ps(x, _mm_set1_ps(34.0f)), _mm_set1_ps(1.0f)), x));
+}
+
+GLM_FUNC_QUALIFIER glm_vec4 glm_noise_taylorInvSqrt(glm_vec4 r)
+{
+	return _mm_sub_ps(_mm_set1_ps(static_cast<float>(1.79284291400159)), _mm_mul_ps(_mm_set1_ps(static_cast<float>(0.85373472095314)), r));
+}
+
+GLM_FUNC_QUALIFIER glm_vec4 glm_noise_fade(glm_vec4 t)
+{
+	glm_vec4 const t3 = _mm_mul_ps(_mm_mul_ps(t, t), t);
+	glm_vec4 const poly = _mm_add_ps(_mm_mul_ps(t, _mm_sub_ps(_mm_mul_ps(t, _mm_set1_ps(6.0f)), _mm_set1_ps(15.0f))), _mm_set1_ps(10.0f));
+	return _mm_mul_ps(t3, poly);
+}
+
+// Contribution of a corner of the 2D perlin noise, hash i and offset (fx, fy) from the corner
+GLM_FUNC_QUALIFIER glm_vec4 glm_noise_perlin2_corner(glm_vec4 i, glm_vec4 fx, glm_vec4 fy)
+{
+	glm_vec4 gx = _mm_sub_ps(_mm_mul_ps(_mm_set1_ps(2.0f), glm_noise_fract(_mm_div_ps(i, _mm_set1_ps(41.0f)))), _mm_set1_ps(1.0f));
+	glm_vec4 const gy = _mm_sub_ps(glm_noise_abs(gx), _mm_set1_ps(0.5f));
+	glm_vec4 const tx = glm_noise_floor(_mm_add_ps(gx, _mm_set1_ps(0.5f)));
+	gx = _mm_sub_ps(gx, tx);
+
+	glm_vec4 const norm = glm_noise_taylorInvSqrt(_mm_add_ps(_mm_mul_ps(gx, gx), _mm_mul_ps(gy, gy)));
+	return _mm_add_ps(_mm_mul_ps(_mm_mul_ps(gx, norm), fx), _mm_mul_ps(_mm_mul_ps(gy, norm), fy));
+}
+
+/// Classic perlin noise of the points (x, y)
+GLM_FUNC_QUALIFIER glm_vec4 glm_vec4_perlin2(glm_vec4 x, glm_vec4 y)
+{
+	glm_vec4 const zero = _mm_setzero_ps();
+	glm_vec4 const one = _mm_set1_ps(1.0f);
+
+	glm_vec4 const Pix0 = glm_noise_mod(_mm_add_ps(glm_noise_floor(x), zero));
+	glm_vec4 const Piy0 = glm_noise_mod(_mm_add_ps(glm_noise_floor(y), zero));
+	glm_vec4 const Pix1 = glm_noise_mod(_mm_add_ps(glm_noise_floor(x), one));
+	glm_vec4 const Piy1 = glm_noise_mod(_mm_add_ps(glm_noise_floor(y), one));
+	glm_vec4 const Pfx0 = _mm_sub_ps(glm_noise_fract(x), zero);
+	glm_vec4 const Pfy0 = _mm_sub_ps(glm_noise_fract(y), zero);
+	glm_vec4 const Pfx1 = _mm_sub_ps(glm_noise_fract(x), one);
+	glm_vec4 const Pfy1 = _mm_sub_ps(glm_noise_fract(y), one);
+
+	glm_vec4 const px0 = glm_noise_permute(Pix0);
+	glm_vec4 const px1 = glm_noise_permute(Pix1);
+	glm_vec4 const n00 = glm_noise_perlin2_corner(glm_noise_permute(_mm_add_ps(px0, Piy0)), Pfx0, Pfy0);
+	glm_vec4 const n10 = glm_noise_perlin2_corner(glm_noise_permute(_mm_add_ps(px1, Piy0)), Pfx1, Pfy0);
+	glm_vec4 const n01 = glm_noise_perlin2_corner(glm_noise_permute(_mm_add_ps(px0, Piy1)), Pfx0, Pfy1);
+	glm_vec4 const n11 = glm_noise_perlin2_corner(glm_noise_permute(_mm_add_ps(px1, Piy1)), Pfx1, Pfy1);
+
+	glm_vec4 const fade_x = glm_noise_fade(Pfx0);
+	glm_vec4 const fade_y = glm_noise_fade(Pfy0);
+	glm_vec4 const n_x0 = glm_noise_mix(n00, n10, fade_x);
+	glm_vec4 const n_x1 = glm_noise_mix(n01, n11, fade_x);
+	return _mm_mul_ps(_mm_set1_ps(static_cast<float>(2.3)), glm_noise_mix(n_x0, n_x1, fade_y));
+}
+
+// Contribution of a corner of the 3D perlin noise, hash ixy and offset (fx, fy, fz) from the corner
+GLM_FUNC_QUALIFIER glm_vec4 glm_noise_perlin3_corner(glm_vec4 ixy, glm_vec4 fx, glm_vec4 fy, glm_vec4 fz)
+{
+	glm_vec4 const zero = _mm_setzero_ps();
+	glm_vec4 const half = _mm_set1_ps(0.5f);
+	glm_vec4 const seventh = _mm_set1_ps(static_cast<float>(1.0 / 7.0));
+
+	glm_vec4 gx = _mm_mul_ps(ixy, seventh);
+	glm_vec4 gy = _mm_sub_ps(glm_noise_fract(_mm_mul_ps(glm_noise_floor(gx), seventh)), half);
+	gx = glm_noise_fract(gx);
+	glm_vec4 gz = _mm_sub_ps(_mm_sub_ps(half, glm_noise_abs(gx)), glm_noise_abs(gy));
+	glm_vec4 const sz = glm_noise_step(gz, zero);
+	gx = _mm_sub_ps(gx, _mm_mul_ps(sz, _mm_sub_ps(glm_noise_step(zero, gx), half)));
+	gy = _mm_sub_ps(gy, _mm_mul_ps(sz, _mm_sub_ps(glm_noise_step(zero, gy), half)));
+
+	glm_vec4 const norm = glm_noise_taylorInvSqrt(_mm_add_ps(_mm_add_ps(_mm_mul_ps(gx, gx), _mm_mul_ps(gy, gy)), _mm_mul_ps(gz, gz)));
+	gx = _mm_mul_ps(gx, norm);
+	gy = _mm_mul_ps(gy, norm);
+	gz = _mm_mul_ps(gz, norm);
+	return _mm_add_ps(_mm_add_ps(_mm_mul_ps(gx, fx), _mm_mul_ps(gy, fy)), _mm_mul_ps(gz, fz));
+}
+
+/// Classic perlin noise of the points (x, y, z)
+GLM_FUNC_QUALIFIER glm_vec4 glm_vec4_perlin3(glm_vec4 x, glm_vec4 y, glm_vec4 z)
+{
+	glm_vec4 const one = _mm_set1_ps(1.0f);
+
+	glm_vec4 const Pix0 = glm_noise_mod289(glm_noise_floor(x));
+	glm_vec4 const Piy0 = glm_noise_mod289(glm_noise_floor(y));
+	glm_vec4 const Piz0 = glm_noise_mod289(glm_noise_floor(z));
+	glm_vec4 const Pix1 = glm_noise_mod289(_mm_add_ps(glm_noise_floor(x), one));
+	glm_vec4 const Piy1 = glm_noise_mod289(_mm_add_ps(glm_noise_floor(y), one));
+	glm_vec4 const Piz1 = glm_noise_mod289(_mm_add_ps(glm_noise_floor(z), one));
+	glm_vec4 const Pfx0 = glm_noise_fract(x);
+	glm_vec4 const Pfy0 = glm_noise_fract(y);
+	glm_vec4 const Pfz0 = glm_noise_fract(z);
+	glm_vec4 const Pfx1 = _mm_sub_ps(Pfx0, one);
+	glm_vec4 const Pfy1 = _mm_sub_ps(Pfy0, one);
+	glm_vec4 const Pfz1 = _mm_sub_ps(Pfz0, one);
+
+	glm_vec4 const px0 = glm_noise_permute(Pix0);
+	glm_vec4 const px1 = glm_noise_permute(Pix1);
+	glm_vec4 const ixy00 = glm_noise_permute(_mm_add_ps(px0, Piy0));
+	glm_vec4 const ixy10 = glm_noise_permute(_mm_add_ps(px1, Piy0));
+	glm_vec4 const ixy01 = glm_noise_permute(_mm_add_ps(px0, Piy1));
+	glm_vec4 const ixy11 = glm_noise_permute(_mm_add_ps(px1, Piy1));
+
+	glm_vec4 const n000 = glm_noise_perlin3_corner(glm_noise_permute(_mm_add_ps(ixy00, Piz0)), Pfx0, Pfy0, Pfz0);
+	glm_vec4 const n100 = glm_noise_perlin3_corner(glm_noise_permute(_mm_add_ps(ixy10, Piz0)), Pfx1, Pfy0, Pfz0);
+	glm_vec4 const n010 = glm_noise_perlin3_corner(glm_noise_permute(_mm_add_ps(ixy01, Piz0)), Pfx0, Pfy1, Pfz0);
+	glm_vec4 const n110 = glm_noise_perlin3_corner(glm_noise_permute(_mm_add_ps(ixy11, Piz0)), Pfx1, Pfy1, Pfz0);
+	glm_vec4 const n001 = glm_noise_perlin3_corner(glm_noise_permute(_mm_add_ps(ixy00, Piz1)), Pfx0, Pfy0, Pfz1);
+	glm_vec4 const n101 = glm_noise_perlin3_corner(glm_noise_permute(_mm_add_ps(ixy10, Piz1)), Pfx1, Pfy0, Pfz1);
+	glm_vec4 const n011 = glm_noise_perlin3_corner(glm_noise_permute(_mm_add_ps(ixy01, Piz1)), Pfx0, Pfy1, Pfz1);
+	glm_vec4 const n111 = glm_noise_perlin3_corner(glm_noise_permute(_mm_add_ps(ixy11, Piz1)), Pfx1, Pfy1, Pfz1);
+
+	glm_vec4 const fade_x = glm_noise_fade(Pfx0);
+	glm_vec4 const fade_y = glm_noise_fade(Pfy0);
+	glm_vec4 const fade_z = glm_noise_fade(Pfz0);
+	glm_vec4 const n_z00 = glm_noise_mix(n000, n001, fade_z);
+	glm_vec4 const n_z10 = glm_noise_mix(n100, n101, fade_z);
+	glm_vec4 const n_z01 = glm_noise_mix(n010, n011, fade_z);
+	glm_vec4 const n_z11 = glm_noise_mix(n110, n111, fade_z);
+	glm_vec4 const n_yz0 = glm_noise_mix(n_z00, n_z01, fade_y);
+	glm_vec4 const n_yz1 = glm_noise_mix(n_z10, n_z11, fade_y);
+	return _mm_mul_ps(_mm_set1_ps(static_cast<float>(2.2)), glm_noise_mix(n_yz0, n_yz1, fade_x));
+}
+
+// Contribution of a corner of the 2D simplex noise, hash p and offset (x0, y0) from the corner
+GLM_FUNC_QUALIFIER glm_vec4 glm_noise_simplex2_corner(glm_vec4 p, glm_vec4 x0, glm_vec4 y0)
+{
+	glm_vec4 m = _mm_max_ps(_mm_setzero_ps(), _mm_sub_ps(_mm_set1_ps(0.5f), _mm_add_ps(_mm_mul_ps(x0, x0), _mm_mul_ps(y0, y0))));
+	m = _mm_mul_ps(m, m);
+	m = _mm_mul_ps(m, m);
+
+	glm_vec4 const x = _mm_sub_ps(_mm_mul_ps(_mm_set1_ps(2.0f), glm_noise_fract(_mm_mul_ps(p, _mm_set1_ps(static_cast<float>(0.024390243902439))))), _mm_set1_ps(1.0f));
+	glm_vec4 const h = _mm_sub_ps(glm_noise_abs(x), _mm_set1_ps(0.5f));
+	glm_vec4 const ox = glm_noise_floor(_mm_add_ps(x, _mm_set1_ps(0.5f)));
+	glm_vec4 const a0 = _mm_sub_ps(x, ox);
+
+	m = _mm_mul_ps(m, glm_noise_taylorInvSqrt(_mm_add_ps(_mm_mul_ps(a0, a0), _mm_mul_ps(h, h))));
+	return _mm_mul_ps(m, _mm_add_ps(_mm_mul_ps(a0, x0), _mm_mul_ps(h, y0)));
+}
+
+/// Simplex noise of the points (x, y)
+GLM_FUNC_QUALIFIER glm_vec4 glm_vec4_simplex2(glm_vec4 x, glm_vec4 y)
+{
+	glm_vec4 const one = _mm_set1_ps(1.0f);
+	glm_vec4 const C0 = _mm_set1_ps(static_cast<float>(0.211324865405187));
+	glm_vec4 const C1 = _mm_set1_ps(static_cast<float>(0.366025403784439));
+	glm_vec4 const C2 = _mm_set1_ps(static_cast<float>(-0.577350269189626));
+
+	// First corner
+	glm_vec4 const s = _mm_add_ps(_mm_mul_ps(x, C1), _mm_mul_ps(y, C1));
+	glm_vec4 ix = glm_noise_floor(_mm_add_ps(x, s));
+	glm_vec4 iy = glm_noise_floor(_mm_add_ps(y, s));
+	glm_vec4 const t = _mm_add_ps(_mm_mul_ps(ix, C0), _mm_mul_ps(iy, C0));
+	glm_vec4 const x0 = _mm_add_ps(_mm_sub_ps(x, ix), t);
+	glm_vec4 const y0 = _mm_add_ps(_mm_sub_ps(y, iy), t);
+
+	// Other corners
+	glm_vec4 const cmp = _mm_cmpgt_ps(x0, y0);
+	glm_vec4 const i1x = _mm_and_ps(cmp, one);
+	glm_vec4 const i1y = _mm_andnot_ps(cmp, one);
+	glm_vec4 const x1 = _mm_sub_ps(_mm_add_ps(x0, C0), i1x);
+	glm_vec4 const y1 = _mm_sub_ps(_mm_add_ps(y0, C0), i1y);
+	glm_vec4 const x2 = _mm_add_ps(x0, C2);
+	glm_vec4 const y2 = _mm_add_ps(y0, C2);
+
+	// Permutations
+	ix = glm_noise_mod(ix);
+	iy = glm_noise_mod(iy);
+	glm_vec4 const p0 = glm_noise_permute(_mm_add_ps(_mm_add_ps(glm_noise_permute(_mm_add_ps(iy, _mm_setzero_ps())), ix), _mm_setzero_ps()));
+	glm_vec4 const p1 = glm_noise_permute(_mm_add_ps(_mm_add_ps(glm_noise_permute(_mm_add_ps(iy, i1y)), ix), i1x));
+	glm_vec4 const p2 = glm_noise_permute(_mm_add_ps(_mm_add_ps(glm_noise_permute(_mm_add_ps(iy, one)), ix), one));
+
+	glm_vec4 const n0 = glm_noise_simplex2_corner(p0, x0, y0);
+	glm_vec4 const n1 = glm_noise_simplex2_corner(p1, x1, y1);
+	glm_vec4 const n2 = glm_noise_simplex2_corner(p2, x2, y2);
+	return _mm_mul_ps(_mm_set1_ps(130.0f), _mm_add_ps(_mm_add_ps(n0, n1), n2));
+}
+
+// Gradient of a corner of the 3D simplex noise, dotted with the offset (x0, y0, z0) from the corner
+GLM_FUNC_QUALIFIER glm_vec4 glm_noise_simplex3_corner(glm_vec4 p, glm_vec4 x0, glm_vec4 y0, glm_vec4 z0)
+{
+	glm_vec4 const zero = _mm_setzero_ps();
+	glm_vec4 const one = _mm_set1_ps(1.0f);
+	float const n_ = static_cast<float>(0.142857142857);
+	glm_vec4 const nsx = _mm_set1_ps(n_ * 2.0f - 0.0f);
+	glm_vec4 const nsy = _mm_set1_ps(n_ * 0.5f - 1.0f);
+	glm_vec4 const nsz = _mm_set1_ps(n_ * 1.0f - 0.0f);
+
+	glm_vec4 const j = _mm_sub_ps(p, _mm_mul_ps(_mm_set1_ps(49.0f), glm_noise_floor(_mm_mul_ps(_mm_mul_ps(p, nsz), nsz))));
+	glm_vec4 const x_ = glm_noise_floor(_mm_mul_ps(j, nsz));
+	glm_vec4 const y_ = glm_noise_floor(_mm_sub_ps(j, _mm_mul_ps(_mm_set1_ps(7.0f), x_)));
+
+	glm_vec4 const x = _mm_add_ps(_mm_mul_ps(x_, nsx), nsy);
+	glm_vec4 const y = _mm_add_ps(_mm_mul_ps(y_, nsx), nsy);
+	glm_vec4 const h = _mm_sub_ps(_mm_sub_ps(one, glm_noise_abs(x)), glm_noise_abs(y));
+
+	glm_vec4 const sx = _mm_add_ps(_mm_mul_ps(glm_noise_floor(x), _mm_set1_ps(2.0f)), one);
+	glm_vec4 const sy = _mm_add_ps(_mm_mul_ps(glm_noise_floor(y), _mm_set1_ps(2.0f)), one);
+	glm_vec4 const sh = _mm_xor_ps(glm_noise_step(h, zero), _mm_set1_ps(-0.0f));
+
+	glm_vec4 gx = _mm_add_ps(x, _mm_mul_ps(sx, sh));
+	glm_vec4 gy = _mm_add_ps(y, _mm_mul_ps(sy, sh));
+	glm_vec4 const norm = glm_noise_taylorInvSqrt(_mm_add_ps(_mm_add_ps(_mm_mul_ps(gx, gx), _mm_mul_ps(gy, gy)), _mm_mul_ps(h, h)));
+	gx = _mm_mul_ps(gx, norm);
+	gy = _mm_mul_ps(gy, norm);
+	glm_vec4 const gz = _mm_mul_ps(h, norm);
+	return _mm_add_ps(_mm_add_ps(_mm_mul_ps(gx, x0), _mm_mul_ps(gy, y0)), _mm_mul_ps(gz, z0));
+}
+
+// Falloff of a corner of the 3D simplex noise, squared
+GLM_FUNC_QUALIFIER glm_vec4 glm_noise_simplex3_falloff(glm_vec4 x0, glm_vec4 y0, glm_vec4 z0)
+{
+	glm_vec4 const d = _mm_add_ps(_mm_add_ps(_mm_mul_ps(x0, x0), _mm_mul_ps(y0, y0)), _mm_mul_ps(z0, z0));
+	glm_vec4 const m = _mm_max_ps(_mm_setzero_ps(), _mm_sub_ps(_mm_set1_ps(static_cast<float>(0.6)), d));
+	glm_vec4 const m2 = _mm_mul_ps(m, m);
+	return _mm_mul_ps(m2, m2);
+}
+
+/// Simplex noise of the points (x, y, z)
+GLM_FUNC_QUALIFIER glm_vec4 glm_vec4_simplex3(glm_vec4 x, glm_vec4 y, glm_vec4 z)
+{
+	glm_vec4 const zero = _mm_setzero_ps();
+	glm_vec4 const one = _mm_set1_ps(1.0f);
+	glm_vec4 const Cx = _mm_set1_ps(static_cast<float>(1.0 / 6.0));
+	glm_vec4 const Cy = _mm_set1_ps(static_cast<float>(1.0 / 3.0));
+
+	// First corner
+	glm_vec4 const s = _mm_add_ps(_mm_add_ps(_mm_mul_ps(x, Cy), _mm_mul_ps(y, Cy)), _mm_mul_ps(z, Cy));
+	glm_vec4 ix = glm_noise_floor(_mm_add_ps(x, s));
+	glm_vec4 iy = glm_noise_floor(_mm_add_ps(y, s));
+	glm_vec4 iz = glm_noise_floor(_mm_add_ps(z, s));
+	glm_vec4 const t = _mm_add_ps(_mm_add_ps(_mm_mul_ps(ix, Cx), _mm_mul_ps(iy, Cx)), _mm_mul_ps(iz, Cx));
+	glm_vec4 const x0 = _mm_add_ps(_mm_sub_ps(x, ix), t);
+	glm_vec4 const y0 = _mm_add_ps(_mm_sub_ps(y, iy), t);
+	glm_vec4 const z0 = _mm_add_ps(_mm_sub_ps(z, iz), t);
+
+	// Other corners, min(a, b) and max(a, b) of glm are _mm_min_ps(b, a) and _mm_max_ps(b, a)
+	glm_vec4 const gx = glm_noise_step(y0, x0);
+	glm_vec4 const gy = glm_noise_step(z0, y0);
+	glm_vec4 const gz = glm_noise_step(x0, z0);
+	glm_vec4 const lx = _mm_sub_ps(one, gx);
+	glm_vec4 const ly = _mm_sub_ps(one, gy);
+	glm_vec4 const lz = _mm_sub_ps(one, gz);
+	glm_vec4 const i1x = _mm_min_ps(lz, gx);
+	glm_vec4 const i1y = _mm_min_ps(lx, gy);
+	glm_vec4 const i1z = _mm_min_ps(ly, gz);
+	glm_vec4 const i2x = _mm_max_ps(lz, gx);
+	glm_vec4 const i2y = _mm_max_ps(lx, gy);
+	glm_vec4 const i2z = _mm_max_ps(ly, gz);
+
+	glm_vec4 const x1 = _mm_add_ps(_mm_sub_ps(x0, i1x), Cx);
+	glm_vec4 const y1 = _mm_add_ps(_mm_sub_ps(y0, i1y), Cx);
+	glm_vec4 const z1 = _mm_add_ps(_mm_sub_ps(z0, i1z), Cx);
+	glm_vec4 const x2 = _mm_add_ps(_mm_sub_ps(x0, i2x), Cy);
+	glm_vec4 const y2 = _mm_add_ps(_mm_sub_ps(y0, i2y), Cy);
+	glm_vec4 const z2 = _mm_add_ps(_mm_sub_ps(z0, i2z), Cy);
+	glm_vec4 const x3 = _mm_sub_ps(x0, _mm_set1_ps(0.5f));
+	glm_vec4 const y3 = _mm_sub_ps(y0, _mm_set1_ps(0.5f));
+	glm_vec4 const z3 = _mm_sub_ps(z0, _mm_set1_ps(0.5f));
+
+	// Permutations
+	ix = glm_noise_mod289(ix);
+	iy = glm_noise_mod289(iy);
+	iz = glm_noise_mod289(iz);
+	glm_vec4 const p0 = glm_noise_permute(_mm_add_ps(_mm_add_ps(glm_noise_permute(_mm_add_ps(_mm_add_ps(glm_noise_permute(_mm_add_ps(iz, zero)), iy), zero)), ix), zero));
+	glm_vec4 const p1 = glm_noise_permute(_mm_add_ps(_mm_add_ps(glm_noise_permute(_mm_add_ps(_mm_add_ps(glm_noise_permute(_mm_add_ps(iz, i1z)), iy), i1y)), ix), i1x));
+	glm_vec4 const p2 = glm_noise_permute(_mm_add_ps(_mm_add_ps(glm_noise_permute(_mm_add_ps(_mm_add_ps(glm_noise_permute(_mm_add_ps(iz, i2z)), iy), i2y)), ix), i2x));
+	glm_vec4 const p3 = glm_noise_permute(_mm_add_ps(_mm_add_ps(glm_noise_permute(_mm_add_ps(_mm_add_ps(glm_noise_permute(_mm_add_ps(iz, one)), iy), one)), ix), one));
+
+	// Mix final noise value
+	glm_vec4 const n0 = _mm_mul_ps(glm_noise_simplex3_falloff(x0, y0, z0), glm_noise_simplex3_corner(p0, x0, y0, z0));
+	glm_vec4 const n1 = _mm_mul_ps(glm_noise_simplex3_falloff(x1, y1, z1), glm_noise_simplex3_corner(p1, x1, y1, z1));
+	glm_vec4 const n2 = _mm_mul_ps(glm_noise_simplex3_falloff(x2, y2, z2), glm_noise_simplex3_corner(p2, x2, y2, z2));
+	glm_vec4 const n3 = _mm_mul_ps(glm_noise_simplex3_falloff(x3, y3, z3), glm_noise_simplex3_corner(p3, x3, y3, z3));
+	return _mm_mul_ps(_mm_set1_ps(42.0f), _mm_add_ps(_mm_add_ps(n0, n1), _mm_add_ps(n2, n3)));
+}
+
+#endif//GLM_ARCH & GLM_ARCH_SSE2_BIT
@@ -1,8 +1,320 @@
 /// @ref simd
 /// @file glm/simd/packing.h
+///
+/// Packing and unpacking of four values at once for the gtc_packing array functions.
+/// Every lane gives the same bits as the gtc_packing function of one value.
 
 #pragma once
 
+#include "platform.h"
+
 #if GLM_ARCH & GLM_ARCH_SSE2_BIT
 
+/// round of every lane converted to integers, halfway cases away from zero like std::round.
+/// Exact for |x| < 2^31, unlike _mm_cvtps_epi32 that rounds them to even.
+GLM_FUNC_QUALIFIER glm_ivec4 glm_vec4_iround(glm_vec4 x)
+{
+	glm_ivec4 const trc0 = _mm_cvttps_epi32(x);
+	glm_vec4 const frc0 = _mm_sub_ps(x, _mm_cvtepi32_ps(trc0));
+
+	// Comparison masks are -1, subtracting one adds 1
+	glm_ivec4 const up0 = _mm_castps_si128(_mm_cmpge_ps(frc0, _mm_set1_ps(0.5f)));
+	glm_ivec4 const dn0 = _mm_castps_si128(_mm_cmple_ps(frc0, _mm_set1_ps(-0.5f)));
+	return _mm_add_epi32(_mm_sub_epi32(trc0, up0), dn0);
+}
+
+/// packHalf1x16 of every lane, sign extended to 32 bits so _mm_packs_epi32 keeps the 16 bits.
+/// Halfway cases round up like packHalf1x16, where the F16C instructions round them to even.
+GLM_FUNC_QUALIFIER glm_ivec4 glm_vec4_packHalf(glm_vec4 v)
+{
+	glm_ivec4 const bits = _mm_castps_si128(v);
+	glm_ivec4 const sign = _mm_and_si128(_mm_srli_epi32(bits, 16), _mm_set1_epi32(0x8000));
+	glm_ivec4 const abs0 = _mm_and_si128(bits, _mm_set1_epi32(0x7fffffff));
+	glm_ivec4 const man0 = _mm_and_si128(bits, _mm_set1_epi32(0x007fffff));
+
+	// Normalized halves: rebias the exponent and round on the 13th bit, a carry goes to the exponent
+	glm_ivec4 nrm0 = _mm_srli_epi32(_mm_add_epi32(_mm_sub_epi32(abs0, _mm_set1_epi32(0x38000000)), _mm_set1_epi32(0x1000)), 13);
+#	if GLM_ARCH & GLM_ARCH_SSE41_BIT
+		nrm0 = _mm_min_epu32(nrm0, _mm_set1_epi32(0x7c00));
+#	else
+		glm_ivec4 const ovf0 = _mm_cmpgt_epi32(nrm0, _mm_set1_epi32(0x7c00));
+		nrm0 = _mm_or_si128(_mm_andnot_si128(ovf0, nrm0), _mm_and_si128(ovf0, _mm_set1_epi32(0x7c00)));
+#	endif
+
+	// Denormalized halves: the significand shifted right by 113 - exponent then rounded on the 13th bit.
+	// The shift is a multiplication by a power of two, exact in floats for 24-bit significands
+	glm_vec4 const sig0 = _mm_cvtepi32_ps(_mm_or_si128(man0, _mm_set1_epi32(0x00800000)));
+	glm_vec4 const scl0 = _mm_castsi128_ps(_mm_slli_epi32(_mm_add_epi32(_mm_srli_epi32(abs0, 23), _mm_set1_epi32(14)), 23));
+	glm_ivec4 const den0 = _mm_srli_epi32(_mm_add_epi32(_mm_cvttps_epi32(_mm_mul_ps(sig0, scl0)), _mm_set1_epi32(0x1000)), 13);
+
+	// NaNs keep the 10 leftmost bits of the significand, at least one set
+	glm_ivec4 const nanm = _mm_srli_epi32(man0, 13);
+	glm_ivec4 const nan0 = _mm_or_si128(_mm_or_si128(nanm, _mm_set1_epi32(0x7c00)), _mm_and_si128(_mm_cmpeq_epi32(nanm, _mm_setzero_si128()), _mm_set1_epi32(1)));
+
+	glm_ivec4 const isNrm = _mm_cmpgt_epi32(abs0, _mm_set1_epi32(0x387fffff));
+	glm_ivec4 const isDen = _mm_cmpgt_epi32(abs0, _mm_set1_epi32(0x32ffffff));
+	glm_ivec4 const isNan = _mm_cmpgt_epi32(abs0, _mm_set1_epi32(0x7f800000));
+
+	// Smaller than the smallest denormalized half, a zero
+	glm_ivec4 half = _mm_and_si128(isDen, _mm_or_si128(_mm_and_si128(isNrm, nrm0), _mm_andnot_si128(isNrm, den0)));
+	half = _mm_or_si128(_mm_andnot_si128(isNan, half), _mm_and_si128(isNan, nan0));
+	return _mm_srai_epi32(_mm_slli_epi32(_mm_or_si128(sign, half), 16), 16);
+}
+
+/// unpackHalf1x16 of the low 16 bits of every lane.
+GLM_FUNC_QUALIFIER glm_vec4 glm_vec4_unpackHalf(glm_ivec4 h)
+{
+	glm_ivec4 const sign = _mm_slli_epi32(_mm_and_si128(h, _mm_set1_epi32(0x8000)), 16);
+	glm_ivec4 const abs0 = _mm_and_si128(h, _mm_set1_epi32(0x7fff));
+
+	// Normalized halves rebias the exponent, infinities and NaNs rebias it twice to reach 255
+	glm_ivec4 const isInf = _mm_cmpgt_epi32(abs0, _mm_set1_epi32(0x7bff));
+	glm_ivec4 nrm0 = _mm_add_epi32(_mm_slli_epi32(abs0, 13), _mm_set1_epi32(0x38000000));
+	nrm0 = _mm_add_epi32(nrm0, _mm_and_si128(isInf, _mm_set1_epi32(0x38000000)));
+
+	// Denormalized halves and zeros are their significand times 2^-24
+	glm_ivec4 const den0 = _mm_castps_si128(_mm_mul_ps(_mm_cvtepi32_ps(abs0), _mm_set1_ps(5.9604644775390625e-8f)));
+
+	glm_ivec4 const isDen = _mm_cmplt_epi32(abs0, _mm_set1_epi32(0x0400));
+	return _mm_castsi128_ps(_mm_or_si128(sign, _mm_or_si128(_mm_and_si128(isDen, den0), _mm_andnot_si128(isDen, nrm0))));
+}
+
+/// packUnorm4x8 of four vectors, one packed value per lane.
+GLM_FUNC_QUALIFIER glm_uvec4 glm_vec4_packUnorm4x8(glm_vec4 v0, glm_vec4 v1, glm_vec4 v2, glm_vec4 v3)
+{
+	glm_vec4 const zero = _mm_setzero_ps();
+	glm_vec4 const one = _mm_set1_ps(1.0f);
+	glm_vec4 const scale = _mm_set1_ps(255.0f);
+
+	// clamp(v, 0, 1) is min(max(v, 0), 1), with the operands of glm's min and max
+	glm_ivec4 const i0 = glm_vec4_iround(_mm_mul_ps(_mm_min_ps(one, _mm_max_ps(zero, v0)), scale));
+	glm_ivec4 const i1 = glm_vec4_iround(_mm_mul_ps(_mm_min_ps(one, _mm_max_ps(zero, v1)), scale));
+	glm_ivec4 const i2 = glm_vec4_iround(_mm_mul_ps(_mm_min_ps(one, _mm_max_ps(zero, v2)), scale));
+	glm_ivec4 const i3 = glm_vec4_iround(_mm_mul_ps(_mm_min_ps(one, _mm_max_ps(zero, v3)), scale));
+
+	return _mm_packus_epi16(_mm_packs_epi32(i0, i1), _mm_packs_epi32(i2, i3));
+}
+
+/// unpackUnorm4x8 of the four packed values in p.
+GLM_FUNC_QUALIFIER void glm_vec4_unpackUnorm4x8(glm_uvec4 p, glm_vec4 Out[4])
+{
+	glm_vec4 const scale = _mm_set1_ps(0.0039215686274509803921568627451f);
+
+#	if GLM_ARCH & GLM_ARCH_SSE41_BIT
+		Out[0] = _mm_mul_ps(_mm_cvtepi32_ps(_mm_cvtepu8_epi32(p)), scale);
+		Out[1] = _mm_mul_ps(_mm_cvtepi32_ps(_mm_cvtepu8_epi32(_mm_srli_si128(p, 4))), scale);
+		Out[2] = _mm_mul_ps(_mm_cvtepi32_ps(_mm_cvtepu8_epi32(_mm_srli_si128(p, 8))), scale);
+		Out[3] = _mm_mul_ps(_mm_cvtepi32_ps(_mm_cvtepu8_epi32(_mm_srli_si128(p, 12))), scale);
+#	else
+		glm_ivec4 const zero = _mm_setzero_si128();
+		glm_ivec4 const lo = _mm_unpacklo_epi8(p, zero);
+		glm_ivec4 const hi = _mm_unpackhi_epi8(p, zero);
+		Out[0] = _mm_mul_ps(_mm_cvtepi32_ps(_mm_unpacklo_epi16(lo, zero)), scale);
+		Out[1] = _mm_mul_ps(_mm_cvtepi32_ps(_mm_unpackhi_epi16(lo, zero)), scale);
+		Out[2] = _mm_mul_ps(_mm_cvtepi32_ps(_mm_unpacklo_epi16(hi, zero)), scale);
+		Out[3] = _mm_mul_ps(_mm_cvtepi32_ps(_mm_unpackhi_epi16(hi, zero)), scale);
+#	endif
+}
+
+/// packSnorm3x10_1x2 of four vectors, one packed value per lane.
+GLM_FUNC_QUALIFIER glm_uvec4 glm_vec4_packSnorm3x10_1x2(glm_vec4 v0, glm_vec4 v1, glm_vec4 v2, glm_vec4 v3)
+{
+	glm_vec4 const minV = _mm_set1_ps(-1.0f);
+	glm_vec4 const maxV = _mm_set1_ps(1.0f);
+	glm_vec4 const scale = _mm_set_ps(1.0f, 511.0f, 511.0f, 511.0f);
+
+	glm_vec4 x = _mm_castsi128_ps(glm_vec4_iround(_mm_mul_ps(_mm_min_ps(maxV, _mm_max_ps(minV, v0)), scale)));
+	glm_vec4 y = _mm_castsi128_ps(glm_vec4_iround(_mm_mul_ps(_mm_min_ps(maxV, _mm_max_ps(minV, v1)), scale)));
+	glm_vec4 z = _mm_castsi128_ps(glm_vec4_iround(_mm_mul_ps(_mm_min_ps(maxV, _mm_max_ps(minV, v2)), scale)));
+	glm_vec4 w = _mm_castsi128_ps(glm_vec4_iround(_mm_mul_ps(_mm_min_ps(maxV, _mm_max_ps(minV, v3)), scale)));
+
+	// One register per component, the bit fields keep the low bits of the two's complement
+	_MM_TRANSPOSE4_PS(x, y, z, w);
+
+	glm_ivec4 const mask = _mm_set1_epi32(0x3ff);
+	glm_ivec4 Pack = _mm_and_si128(_mm_castps_si128(x), mask);
+	Pack = _mm_or_si128(Pack, _mm_slli_epi32(_mm_and_si128(_mm_castps_si128(y), mask), 10));
+	Pack = _mm_or_si128(Pack, _mm_slli_epi32(_mm_and_si128(_mm_castps_si128(z), mask), 20));
+	return _mm_or_si128(Pack, _mm_slli_epi32(_mm_castps_si128(w), 30));
+}
+
+/// unpackSnorm3x10_1x2 of the four packed values in p.
+GLM_FUNC_QUALIFIER void glm_vec4_unpackSnorm3x10_1x2(glm_uvec4 p, glm_vec4 Out[4])
+{
+	glm_vec4 const minV = _mm_set1_ps(-1.0f);
+	glm_vec4 const maxV = _mm_set1_ps(1.0f);
+	glm_vec4 const scale = _mm_set1_ps(1.f / 511.f);
+
+	// Sign extension of the bit fields
+	glm_vec4 x = _mm_cvtepi32_ps(_mm_srai_epi32(_mm_slli_epi32(p, 22), 22));
+	glm_vec4 y = _mm_cvtepi32_ps(_mm_srai_epi32(_mm_slli_epi32(p, 12), 22));
+	glm_vec4 z = _mm_cvtepi32_ps(_mm_srai_epi32(_mm_slli_epi32(p, 2), 22));
+	glm_vec4 w = _mm_cvtepi32_ps(_mm_srai_epi32(p, 30));
+
+	x = _mm_min_ps(maxV, _mm_max_ps(minV, _mm_mul_ps(x, scale)));
+	y = _mm_min_ps(maxV, _mm_max_ps(minV, _mm_mul_ps(y, scale)));
+	z = _mm_min_ps(maxV, _mm_max_ps(minV, _mm_mul_ps(z, scale)));
+	w = _mm_min_ps(maxV, _mm_max_ps(minV, w));
+
+	_MM_TRANSPOSE4_PS(x, y, z, w);
+	Out[0] = x;
+	Out[1] = y;
+	Out[2] = z;
+	Out[3] = w;
+}
+
+/// floatTo11bit of every lane, masked to the 11 bits.
+GLM_FUNC_QUALIFIER glm_ivec4 glm_vec4_packF11(glm_vec4 v)
+{
+	glm_ivec4 const bits = _mm_castps_si128(v);
+	glm_ivec4 const expo = _mm_and_si128(_mm_srli_epi32(_mm_sub_epi32(_mm_and_si128(bits, _mm_set1_epi32(0x7f800000)), _mm_set1_epi32(0x38000000)), 17), _mm_set1_epi32(0x07c0));
+	glm_ivec4 const mant = _mm_and_si128(_mm_srli_epi32(bits, 17), _mm_set1_epi32(0x003f));
+
+	glm_ivec4 const isZero = _mm_castps_si128(_mm_cmpeq_ps(v, _mm_setzero_ps()));
+	glm_ivec4 const isNan = _mm_castps_si128(_mm_cmpunord_ps(v, v));
+	glm_ivec4 const isInf = _mm_cmpeq_epi32(_mm_and_si128(bits, _mm_set1_epi32(0x7fffffff)), _mm_set1_epi32(0x7f800000));
+
+	glm_ivec4 Pack = _mm_andnot_si128(_mm_or_si128(isZero, isInf), _mm_or_si128(expo, mant));
+	Pack = _mm_or_si128(Pack, _mm_and_si128(isInf, _mm_set1_epi32(0x1f << 6)));
+	return _mm_or_si128(Pack, _mm_and_si128(isNan, _mm_set1_epi32(0x07ff)));
+}
+
+/// floatTo10bit of every lane, masked to the 10 bits.
+GLM_FUNC_QUALIFIER glm_ivec4 glm_vec4_packF10(glm_vec4 v)
+{
+	glm_ivec4 const bits = _mm_castps_si128(v);
+	glm_ivec4 const expo = _mm_and_si128(_mm_srli_epi32(_mm_sub_epi32(_mm_and_si128(bits, _mm_set1_epi32(0x7f800000)), _mm_set1_epi32(0x38000000)), 18), _mm_set1_epi32(0x03e0));
+	glm_ivec4 const mant = _mm_and_si128(_mm_srli_epi32(bits, 18), _mm_set1_epi32(0x001f));
+
+	glm_ivec4 const isZero = _mm_castps_si128(_mm_cmpeq_ps(v, _mm_setzero_ps()));
+	glm_ivec4 const isNan = _mm_castps_si128(_mm_cmpunord_ps(v, v));
+	glm_ivec4 const isInf = _mm_cmpeq_epi32(_mm_and_si128(bits, _mm_set1_epi32(0x7fffffff)), _mm_set1_epi32(0x7f800000));
+
+	glm_ivec4 Pack = _mm_andnot_si128(_mm_or_si128(isZero, isInf), _mm_or_si128(expo, mant));
+	Pack = _mm_or_si128(Pack, _mm_and_si128(isInf, _mm_set1_epi32(0x1f << 5)));
+	return _mm_or_si128(Pack, _mm_and_si128(isNan, _mm_set1_epi32(0x03ff)));
+}
+
+/// packed11bitToFloat of every lane.
+/// Like the scalar function the special values are only recognized when the bits above the 11 are zero,
+/// and NaN and infinity give -1.
+GLM_FUNC_QUALIFIER glm_vec4 glm_vec4_unpackF11(glm_ivec4 p)
+{
+	glm_ivec4 const expo = _mm_and_si128(_mm_add_epi32(_mm_slli_epi32(_mm_and_si128(p, _mm_set1_epi32(0x07c0)), 17), _mm_set1_epi32(0x38000000)), _mm_set1_epi32(0x7f800000));
+	glm_ivec4 const mant = _mm_slli_epi32(_mm_and_si128(p, _mm_set1_epi32(0x003f)), 17);
+
+	glm_ivec4 const isZero = _mm_cmpeq_epi32(p, _mm_setzero_si128());
+	glm_ivec4 const isSpecial = _mm_or_si128(_mm_cmpeq_epi32(p, _mm_set1_epi32(0x07ff)), _mm_cmpeq_epi32(p, _mm_set1_epi32(0x1f << 6)));
+
+	glm_ivec4 const Result = _mm_andnot_si128(_mm_or_si128(isZero, isSpecial), _mm_or_si128(expo, mant));
+	return _mm_or_ps(_mm_castsi128_ps(Result), _mm_and_ps(_mm_castsi128_ps(isSpecial), _mm_set1_ps(-1.0f)));
+}
+
+/// packed10bitToFloat of every lane, with the special values of glm_vec4_unpackF11.
+GLM_FUNC_QUALIFIER glm_vec4 glm_vec4_unpackF10(glm_ivec4 p)
+{
+	glm_ivec4 const expo = _mm_and_si128(_mm_add_epi32(_mm_slli_epi32(_mm_and_si128(p, _mm_set1_epi32(0x03e0)), 18), _mm_set1_epi32(0x38000000)), _mm_set1_epi32(0x7f800000));
+	glm_ivec4 const mant = _mm_slli_epi32(_mm_and_si128(p, _mm_set1_epi32(0x001f)), 18);
+
+	glm_ivec4 const isZero = _mm_cmpeq_epi32(p, _mm_setzero_si128());
+	glm_ivec4 const isSpecial = _mm_or_si128(_mm_cmpeq_epi32(p, _mm_set1_epi32(0x03ff)), _mm_cmpeq_epi32(p, _mm_set1_epi32(0x1f << 5)));
+
+	glm_ivec4 const Result = _mm_andnot_si128(_mm_or_si128(isZero, isSpecial), _mm_or_si128(expo, mant));
+	return _mm_or_ps(_mm_castsi128_ps(Result), _mm_and_ps(_mm_castsi128_ps(isSpecial), _mm_set1_ps(-1.0f)));
+}
+
+/// packF2x11_1x10 of four vectors given as one register per component, one packed value per lane.
+GLM_FUNC_QUALIFIER glm_uvec4 glm_vec4_packF2x11_1x10(glm_vec4 x, glm_vec4 y, glm_vec4 z)
+{
+	return _mm_or_si128(_mm_or_si128(
+		glm_vec4_packF11(x),
+		_mm_slli_epi32(glm_vec4_packF11(y), 11)),
+		_mm_slli_epi32(glm_vec4_packF10(z), 22));
+}
+
+/// unpackF2x11_1x10 of the four packed values in p, one register per component.
+GLM_FUNC_QUALIFIER void glm_vec4_unpackF2x11_1x10(glm_uvec4 p, glm_vec4 Out[3])
+{
+	Out[0] = glm_vec4_unpackF11(p);
+	Out[1] = glm_vec4_unpackF11(_mm_srli_epi32(p, 11));
+	Out[2] = glm_vec4_unpackF10(_mm_srli_epi32(p, 22));
+}
+
+/// packF3x9_E1x5 of four vectors given as one register per component, one packed value per lane.
+/// The exponent is read from the bits of the largest component rather than with log2.
+/// Where log2 rounds to the next integer the mantissa rounds to 512 and bumps the exponent, giving the same bits.
+GLM_FUNC_QUALIFIER glm_uvec4 glm_vec4_packF3x9_E1x5(glm_vec4 x, glm_vec4 y, glm_vec4 z)
+{
+	glm_vec4 const zero = _mm_setzero_ps();
+	glm_vec4 const half = _mm_set1_ps(0.5f);
+	glm_vec4 const SharedExpMax = _mm_set1_ps(32768.0f);
+
+	glm_vec4 const cx = _mm_min_ps(SharedExpMax, _mm_max_ps(zero, x));
+	glm_vec4 const cy = _mm_min_ps(SharedExpMax, _mm_max_ps(zero, y));
+	glm_vec4 const cz = _mm_min_ps(SharedExpMax, _mm_max_ps(zero, z));
+	glm_vec4 const MaxColor = _mm_max_ps(_mm_max_ps(cz, cy), cx);
+
+	// floor(log2(MaxColor)) clamped to -16, zeros and denormals included
+	glm_ivec4 const MaxBits = _mm_and_si128(_mm_castps_si128(MaxColor), _mm_set1_epi32(0x7fffffff));
+	glm_ivec4 Exp = _mm_sub_epi32(_mm_srli_epi32(MaxBits, 23), _mm_set1_epi32(127));
+	glm_ivec4 const Low = _mm_cmplt_epi32(Exp, _mm_set1_epi32(-16));
+	Exp = _mm_or_si128(_mm_andnot_si128(Low, Exp), _mm_and_si128(Low, _mm_set1_epi32(-16)));
+
+	// ExpSharedP - 15 - 9 == Exp - 8, the divisions are by powers of two built from their bits
+	glm_ivec4 const ExpSharedP = _mm_add_epi32(Exp, _mm_set1_epi32(16));
+	glm_vec4 const ScaleP = _mm_castsi128_ps(_mm_slli_epi32(_mm_add_epi32(ExpSharedP, _mm_set1_epi32(127 - 24)), 23));
+	glm_ivec4 const MaxShared = _mm_cvttps_epi32(_mm_add_ps(_mm_div_ps(MaxColor, ScaleP), half));
+	glm_ivec4 const ExpShared = _mm_sub_epi32(ExpSharedP, _mm_cmpeq_epi32(MaxShared, _mm_set1_epi32(512)));
+	glm_vec4 const Scale = _mm_castsi128_ps(_mm_slli_epi32(_mm_add_epi32(ExpShared, _mm_set1_epi32(127 - 24)), 23));
+
+	// The inputs are positive, truncation is floor; 512 wraps to 0 in the 9-bit fields like the scalar bit fields
+	glm_ivec4 const mask = _mm_set1_epi32(0x1ff);
+	glm_ivec4 Pack = _mm_and_si128(_mm_cvttps_epi32(_mm_add_ps(_mm_div_ps(cx, Scale), half)), mask);
+	Pack = _mm_or_si128(Pack, _mm_slli_epi32(_mm_and_si128(_mm_cvttps_epi32(_mm_add_ps(_mm_div_ps(cy, Scale), half)), mask), 9));
+	Pack = _mm_or_si128(Pack, _mm_slli_epi32(_mm_and_si128(_mm_cvttps_epi32(_mm_add_ps(_mm_div_ps(cz, Scale), half)), mask), 18));
+	return _mm_or_si128(Pack, _mm_slli_epi32(ExpShared, 27));
+}
+
+/// unpackF3x9_E1x5 of the four packed values in p, one register per component.
+GLM_FUNC_QUALIFIER void glm_vec4_unpackF3x9_E1x5(glm_uvec4 p, glm_vec4 Out[3])
+{
+	glm_ivec4 const mask = _mm_set1_epi32(0x1ff);
+	glm_vec4 const Scale = _mm_castsi128_ps(_mm_slli_epi32(_mm_add_epi32(_mm_srli_epi32(p, 27), _mm_set1_epi32(127 - 24)), 23));
+
+	Out[0] = _mm_mul_ps(_mm_cvtepi32_ps(_mm_and_si128(p, mask)), Scale);
+	Out[1] = _mm_mul_ps(_mm_cvtepi32_ps(_mm_and_si128(_mm_srli_epi32(p, 9), mask)), Scale);
+	Out[2] = _mm_mul_ps(_mm_cvtepi32_ps(_mm_and_si128(_mm_srli_epi32(p, 18), mask)), Scale);
+}
+
+/// Four consecutive vec3 loaded in three registers to one register per component.
+GLM_FUNC_QUALIFIER void glm_vec4_deinterleave3(glm_vec4 a, glm_vec4 b, glm_vec4 c, glm_vec4 Out[3])
+{
+	// a = x0 y0 z0 x1, b = y1 z1 x2 y2, c = z2 x3 y3 z3
+	glm_vec4 const x01 = _mm_shuffle_ps(a, a, _MM_SHUFFLE(3, 3, 0, 0));
+	glm_vec4 const x23 = _mm_shuffle_ps(b, c, _MM_SHUFFLE(1, 1, 2, 2));
+	glm_vec4 const y01 = _mm_shuffle_ps(a, b, _MM_SHUFFLE(0, 0, 1, 1));
+	glm_vec4 const y23 = _mm_shuffle_ps(b, c, _MM_SHUFFLE(2, 2, 3, 3));
+	glm_vec4 const z01 = _mm_shuffle_ps(a, b, _MM_SHUFFLE(1, 1, 2, 2));
+	glm_vec4 const z23 = _mm_shuffle_ps(c, c, _MM_SHUFFLE(3, 3, 0, 0));
+
+	Out[0] = _mm_shuffle_ps(x01, x23, _MM_SHUFFLE(2, 0, 2, 0));
+	Out[1] = _mm_shuffle_ps(y01, y23, _MM_SHUFFLE(2, 0, 2, 0));
+	Out[2] = _mm_shuffle_ps(z01, z23, _MM_SHUFFLE(2, 0, 2, 0));
+}
+
+/// The reverse of glm_vec4_deinterleave3, four vec3 in three registers to store consecutively.
+GLM_FUNC_QUALIFIER void glm_vec4_interleave3(glm_vec4 x, glm_vec4 y, glm_vec4 z, glm_vec4 Out[3])
+{
+	glm_vec4 const xy01 = _mm_unpacklo_ps(x, y);
+	glm_vec4 const xy23 = _mm_unpackhi_ps(x, y);
+	glm_vec4 const z0x1 = _mm_shuffle_ps(z, x, _MM_SHUFFLE(1, 1, 0, 0));
+	glm_vec4 const y1z1 = _mm_shuffle_ps(y, z, _MM_SHUFFLE(1, 1, 1, 1));
+	glm_vec4 const z2x3 = _mm_shuffle_ps(z, x, _MM_SHUFFLE(3, 3, 2, 2));
+	glm_vec4 const y3z3 = _mm_shuffle_ps(y, z, _MM_SHUFFLE(3, 3, 3, 3));
+
+	Out[0] = _mm_shuffle_ps(xy01, z0x1, _MM_SHUFFLE(2, 0, 1, 0));
+	Out[1] = _mm_shuffle_ps(y1z1, xy23, _MM_SHUFFLE(1, 0, 2, 0));
+	Out[2] = _mm_shuffle_ps(z2x3, y3z3, _MM_SHUFFLE(2, 0, 2, 0));
+}
+
 #endif//GLM_ARCH & GLM_ARCH_SSE2_BIT
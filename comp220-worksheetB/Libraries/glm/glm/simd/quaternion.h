@@ -0,0 +1,93 @@
+/// @ref simd
+/// @file glm/simd/quaternion.h
+///
+/// Quaternions are stored x, y, z, w in the four lanes.
+
+#pragma once
+
+#include "geometric.h"
+#include "trigonometric.h"
+
+#if GLM_ARCH & GLM_ARCH_SSE2_BIT
+
+GLM_FUNC_QUALIFIER glm_vec4 glm_quat_mul_vec4(glm_vec4 q, glm_vec4 v)
+{
+	glm_vec4 const q_wwww = _mm_shuffle_ps(q, q, _MM_SHUFFLE(3, 3, 3, 3));
+	glm_vec4 const q_swp0 = _mm_shuffle_ps(q, q, _MM_SHUFFLE(3, 0, 2, 1));
+	glm_vec4 const q_swp1 = _mm_shuffle_ps(q, q, _MM_SHUFFLE(3, 1, 0, 2));
+	glm_vec4 const v_swp0 = _mm_shuffle_ps(v, v, _MM_SHUFFLE(3, 0, 2, 1));
+	glm_vec4 const v_swp1 = _mm_shuffle_ps(v, v, _MM_SHUFFLE(3, 1, 0, 2));
+
+	glm_vec4 uv      = _mm_sub_ps(_mm_mul_ps(q_swp0, v_swp1), _mm_mul_ps(q_swp1, v_swp0));
+	glm_vec4 uv_swp0 = _mm_shuffle_ps(uv, uv, _MM_SHUFFLE(3, 0, 2, 1));
+	glm_vec4 uv_swp1 = _mm_shuffle_ps(uv, uv, _MM_SHUFFLE(3, 1, 0, 2));
+	glm_vec4 uuv     = _mm_sub_ps(_mm_mul_ps(q_swp0, uv_swp1), _mm_mul_ps(q_swp1, uv_swp0));
+
+	glm_vec4 const two = _mm_set1_ps(2.0f);
+	uv  = _mm_mul_ps(uv, _mm_mul_ps(q_wwww, two));
+	uuv = _mm_mul_ps(uuv, two);
+
+	return _mm_add_ps(v, _mm_add_ps(uv, uuv));
+}
+
+GLM_FUNC_QUALIFIER glm_vec4 glm_quat_normalize(glm_vec4 q)
+{
+	glm_vec4 const len0 = _mm_sqrt_ps(glm_vec4_dot(q, q));
+	if(_mm_cvtss_f32(len0) <= 0.0f)
+		return _mm_set_ps(1.0f, 0.0f, 0.0f, 0.0f);
+	return _mm_mul_ps(q, _mm_div_ps(_mm_set1_ps(1.0f), len0));
+}
+
+/// Rotation matrix of a unit quaternion, the same terms as mat3_cast grouped by column.
+GLM_FUNC_QUALIFIER void glm_quat_to_mat4(glm_vec4 q, glm_vec4 out[4])
+{
+	glm_vec4 const q2 = _mm_add_ps(q, q);
+
+	// col0 = (1 - 2yy - 2zz, 2xy + 2wz, 2xz - 2wy, 0)
+	glm_vec4 const a0 = _mm_mul_ps(_mm_shuffle_ps(q, q, _MM_SHUFFLE(3, 0, 0, 1)), _mm_mul_ps(_mm_shuffle_ps(q2, q2, _MM_SHUFFLE(3, 2, 1, 1)), _mm_set_ps(0.0f, 1.0f, 1.0f, -1.0f)));
+	glm_vec4 const b0 = _mm_mul_ps(_mm_shuffle_ps(q, q, _MM_SHUFFLE(3, 3, 3, 2)), _mm_mul_ps(_mm_shuffle_ps(q2, q2, _MM_SHUFFLE(3, 1, 2, 2)), _mm_set_ps(0.0f, -1.0f, 1.0f, -1.0f)));
+
+	// col1 = (2xy - 2wz, 1 - 2xx - 2zz, 2yz + 2wx, 0)
+	glm_vec4 const a1 = _mm_mul_ps(_mm_shuffle_ps(q, q, _MM_SHUFFLE(3, 1, 0, 1)), _mm_mul_ps(_mm_shuffle_ps(q2, q2, _MM_SHUFFLE(3, 2, 0, 0)), _mm_set_ps(0.0f, 1.0f, -1.0f, 1.0f)));
+	glm_vec4 const b1 = _mm_mul_ps(_mm_shuffle_ps(q, q, _MM_SHUFFLE(3, 3, 2, 3)), _mm_mul_ps(_mm_shuffle_ps(q2, q2, _MM_SHUFFLE(3, 0, 2, 2)), _mm_set_ps(0.0f, 1.0f, -1.0f, -1.0f)));
+
+	// col2 = (2xz + 2wy, 2yz - 2wx, 1 - 2xx - 2yy, 0)
+	glm_vec4 const a2 = _mm_mul_ps(_mm_shuffle_ps(q, q, _MM_SHUFFLE(3, 0, 2, 2)), _mm_mul_ps(_mm_shuffle_ps(q2, q2, _MM_SHUFFLE(3, 0, 1, 0)), _mm_set_ps(0.0f, -1.0f, 1.0f, 1.0f)));
+	glm_vec4 const b2 = _mm_mul_ps(_mm_shuffle_ps(q, q, _MM_SHUFFLE(3, 1, 3, 3)), _mm_mul_ps(_mm_shuffle_ps(q2, q2, _MM_SHUFFLE(3, 1, 0, 1)), _mm_set_ps(0.0f, -1.0f, -1.0f, 1.0f)));
+
+	out[0] = _mm_add_ps(_mm_set_ps(0.0f, 0.0f, 0.0f, 1.0f), _mm_add_ps(a0, b0));
+	out[1] = _mm_add_ps(_mm_set_ps(0.0f, 0.0f, 1.0f, 0.0f), _mm_add_ps(a1, b1));
+	out[2] = _mm_add_ps(_mm_set_ps(0.0f, 1.0f, 0.0f, 0.0f), _mm_add_ps(a2, b2));
+	out[3] = _mm_set_ps(1.0f, 0.0f, 0.0f, 0.0f);
+}
+
+/// Spherical interpolation of x and y by a, cosTheta is dot(x, y) in every lane.
+/// Falls back to a linear interpolation when the angle is too small for sin(angle) to divide by.
+GLM_FUNC_QUALIFIER glm_vec4 glm_quat_mix_cos(glm_vec4 x, glm_vec4 y, glm_vec4 cosTheta, float a)
+{
+	if(_mm_cvtss_f32(cosTheta) > 1.0f - 1.19209290e-7f)
+		return _mm_add_ps(_mm_mul_ps(x, _mm_set1_ps(1.0f - a)), _mm_mul_ps(y, _mm_set1_ps(a)));
+
+	// sin((1 - a) * angle), sin(a * angle) and sin(angle) at once
+	glm_vec4 const angle = glm_vec4_acos(cosTheta);
+	glm_vec4 const sin0 = glm_vec4_sin(_mm_mul_ps(angle, _mm_set_ps(0.0f, 1.0f, a, 1.0f - a)));
+
+	glm_vec4 const mul0 = _mm_mul_ps(x, _mm_shuffle_ps(sin0, sin0, _MM_SHUFFLE(0, 0, 0, 0)));
+	glm_vec4 const mul1 = _mm_mul_ps(y, _mm_shuffle_ps(sin0, sin0, _MM_SHUFFLE(1, 1, 1, 1)));
+	return _mm_div_ps(_mm_add_ps(mul0, mul1), _mm_shuffle_ps(sin0, sin0, _MM_SHUFFLE(2, 2, 2, 2)));
+}
+
+GLM_FUNC_QUALIFIER glm_vec4 glm_quat_mix(glm_vec4 x, glm_vec4 y, float a)
+{
+	return glm_quat_mix_cos(x, y, glm_vec4_dot(x, y), a);
+}
+
+GLM_FUNC_QUALIFIER glm_vec4 glm_quat_slerp(glm_vec4 x, glm_vec4 y, float a)
+{
+	// Negate y when cosTheta < 0 so the interpolation takes the short way around the sphere
+	glm_vec4 const cos0 = glm_vec4_dot(x, y);
+	glm_vec4 const sgn0 = _mm_and_ps(_mm_cmplt_ps(cos0, _mm_setzero_ps()), _mm_set1_ps(-0.0f));
+	return glm_quat_mix_cos(x, _mm_xor_ps(y, sgn0), _mm_xor_ps(cos0, sgn0), a);
+}
+
+#endif//GLM_ARCH & GLM_ARCH_SSE2_BIT
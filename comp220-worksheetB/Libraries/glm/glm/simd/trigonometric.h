@@ -3,7 +3,59 @@
 
 #pragma once
 
+#include "platform.h"
+
 #if GLM_ARCH & GLM_ARCH_SSE2_BIT
 
-#endif//GLM_ARCH & GLM_ARCH_SSE2_BIT
+/// sin(x), absolute error under 3e-7 for x in [-pi, pi], growing with |x| outside.
+/// Reduced to [-pi, pi] by whole turns, folded to [-pi/2, pi/2] then a Taylor polynomial to the 11th degree.
+GLM_FUNC_QUALIFIER glm_vec4 glm_vec4_sin(glm_vec4 x)
+{
+	glm_vec4 const Turns = _mm_cvtepi32_ps(_mm_cvtps_epi32(_mm_mul_ps(x, _mm_set1_ps(0.15915494309189533577f))));
+	glm_vec4 r = _mm_sub_ps(x, _mm_mul_ps(Turns, _mm_set1_ps(6.28318530717958647692f)));
+
+	// sin(x) = sin(pi - x) = sin(-pi - x)
+	r = _mm_min_ps(r, _mm_sub_ps(_mm_set1_ps(3.14159265358979323846f), r));
+	r = _mm_max_ps(r, _mm_sub_ps(_mm_set1_ps(-3.14159265358979323846f), r));
+
+	glm_vec4 const r2 = _mm_mul_ps(r, r);
+
+	glm_vec4 p = _mm_set1_ps(-2.5052108385e-8f);
+	p = _mm_add_ps(_mm_mul_ps(p, r2), _mm_set1_ps(2.7557319224e-6f));
+	p = _mm_add_ps(_mm_mul_ps(p, r2), _mm_set1_ps(-1.9841269841e-4f));
+	p = _mm_add_ps(_mm_mul_ps(p, r2), _mm_set1_ps(8.3333333333e-3f));
+	p = _mm_add_ps(_mm_mul_ps(p, r2), _mm_set1_ps(-1.6666666667e-1f));
+
+	return _mm_add_ps(r, _mm_mul_ps(_mm_mul_ps(r, r2), p));
+}
 
+/// cos(x), with the accuracy of glm_vec4_sin.
+GLM_FUNC_QUALIFIER glm_vec4 glm_vec4_cos(glm_vec4 x)
+{
+	return glm_vec4_sin(_mm_add_ps(x, _mm_set1_ps(1.57079632679489661923f)));
+}
+
+/// acos(x) for x in [-1, 1], absolute error under 5e-7.
+/// Abramowitz and Stegun 4.4.46, inputs outside the range are clamped.
+GLM_FUNC_QUALIFIER glm_vec4 glm_vec4_acos(glm_vec4 x)
+{
+	glm_vec4 const a = _mm_min_ps(_mm_andnot_ps(_mm_set1_ps(-0.0f), x), _mm_set1_ps(1.0f));
+
+	glm_vec4 p = _mm_set1_ps(-0.0012624911f);
+	p = _mm_add_ps(_mm_mul_ps(p, a), _mm_set1_ps(0.0066700901f));
+	p = _mm_add_ps(_mm_mul_ps(p, a), _mm_set1_ps(-0.0170881256f));
+	p = _mm_add_ps(_mm_mul_ps(p, a), _mm_set1_ps(0.0308918810f));
+	p = _mm_add_ps(_mm_mul_ps(p, a), _mm_set1_ps(-0.0501743046f));
+	p = _mm_add_ps(_mm_mul_ps(p, a), _mm_set1_ps(0.0889789874f));
+	p = _mm_add_ps(_mm_mul_ps(p, a), _mm_set1_ps(-0.2145988016f));
+	p = _mm_add_ps(_mm_mul_ps(p, a), _mm_set1_ps(1.5707963050f));
+
+	glm_vec4 const r = _mm_mul_ps(_mm_sqrt_ps(_mm_sub_ps(_mm_set1_ps(1.0f), a)), p);
+
+	// acos(-x) = pi - acos(x)
+	glm_vec4 const Negative = _mm_cmplt_ps(x, _mm_setzero_ps());
+	glm_vec4 const Flipped = _mm_sub_ps(_mm_set1_ps(3.14159265358979323846f), r);
+	return _mm_or_ps(_mm_and_ps(Negative, Flipped), _mm_andnot_ps(Negative, r));
+}
+
+#endif//GLM_ARCH & GLM_ARCH_SSE2_BIT
@@ -1,6 +1,7 @@
 #include <glm/glm.hpp>
 
-#if GLM_CONFIG_CONSTEXP == GLM_ENABLE
+// The constructors of the aligned types are built with SIMD intrinsics which aren't constexpr
+#if GLM_CONFIG_CONSTEXP == GLM_ENABLE && !(defined(GLM_FORCE_DEFAULT_ALIGNED_GENTYPES) && GLM_CONFIG_SIMD == GLM_ENABLE)
 
 #include <glm/gtc/constants.hpp>
 #include <glm/gtc/quaternion.hpp>
@@ -9,6 +10,9 @@
 #include <glm/ext/vector_bool1.hpp>
 #include <glm/ext/vector_bool4.hpp>
 #include <glm/ext/vector_float1.hpp>
+#include <glm/ext/matrix_transform.hpp>
+#include <glm/ext/matrix_clip_space.hpp>
+#include <glm/ext/matrix_relational.hpp>
 #include <glm/vector_relational.hpp>
 
 static int test_vec1()
@@ -730,19 +734,75 @@ static int test_mat2x2()
 	return Error;
 }
 
+static int test_mat4x4()
+{
+	int Error = 0;
+
+	{
+		constexpr glm::mat4 Translate = glm::translate(glm::mat4(1.0f), glm::vec3(1.0f, 2.0f, 3.0f));
+		static_assert(Translate[3] == glm::vec4(1.0f, 2.0f, 3.0f, 1.0f), "GLM: Failed constexpr");
+
+		constexpr glm::mat4 Scale = glm::scale(glm::mat4(1.0f), glm::vec3(2.0f));
+		static_assert(Scale[0][0] == 2.0f && Scale[1][1] == 2.0f && Scale[2][2] == 2.0f && Scale[3][3] == 1.0f, "GLM: Failed constexpr");
+
+		constexpr glm::mat4 Model = Translate * Scale;
+		static_assert(Model * glm::vec4(1.0f) == glm::vec4(3.0f, 4.0f, 5.0f, 1.0f), "GLM: Failed constexpr");
+
+		glm::mat4 const Runtime = glm::translate(glm::mat4(1.0f), glm::vec3(1.0f, 2.0f, 3.0f)) * glm::scale(glm::mat4(1.0f), glm::vec3(2.0f));
+		Error += glm::all(glm::equal(Model, Runtime)) ? 0 : 1;
+	}
+
+	{
+		constexpr glm::mat4 Ortho = glm::orthoRH_NO(-1.0f, 1.0f, -1.0f, 1.0f, -1.0f, 1.0f);
+		static_assert(glm::all(glm::equal(Ortho, glm::scale(glm::mat4(1.0f), glm::vec3(1.0f, 1.0f, -1.0f)))), "GLM: Failed constexpr");
+
+		constexpr glm::mat4 Frustum = glm::frustumRH_ZO(-1.0f, 1.0f, -1.0f, 1.0f, 1.0f, 3.0f);
+		static_assert(Frustum * glm::vec4(0.0f, 0.0f, -1.0f, 1.0f) == glm::vec4(0.0f, 0.0f, 0.0f, 1.0f), "GLM: Failed constexpr");
+	}
+
+#	if GLM_HAS_IS_CONSTANT_EVALUATED
+	{
+		// Rotations and projections are computed with sine, cosine and tangent approximations at compile time
+		constexpr glm::mat4 Rotate = glm::rotate(glm::mat4(1.0f), glm::pi<float>() * 0.5f, glm::vec3(0.0f, 0.0f, 2.0f));
+		static_assert(glm::all(glm::equal(Rotate * glm::vec4(1.0f, 0.0f, 0.0f, 1.0f), glm::vec4(0.0f, 1.0f, 0.0f, 1.0f), 0.000001f)), "GLM: Failed constexpr");
+		Error += glm::all(glm::equal(Rotate, glm::rotate(glm::mat4(1.0f), glm::pi<float>() * 0.5f, glm::vec3(0.0f, 0.0f, 2.0f)), 0.000001f)) ? 0 : 1;
+
+		constexpr glm::mat4 Projection = glm::perspective(glm::pi<float>() * 0.25f, 1.5f, 0.1f, 100.0f);
+		Error += glm::all(glm::equal(Projection, glm::perspective(glm::pi<float>() * 0.25f, 1.5f, 0.1f, 100.0f), 0.000001f)) ? 0 : 1;
+
+		constexpr glm::mat4 ProjectionFov = glm::perspectiveFov(glm::pi<float>() * 0.25f, 640.0f, 480.0f, 0.1f, 100.0f);
+		Error += glm::all(glm::equal(ProjectionFov, glm::perspectiveFov(glm::pi<float>() * 0.25f, 640.0f, 480.0f, 0.1f, 100.0f), 0.000001f)) ? 0 : 1;
+
+		constexpr glm::mat4 Infinite = glm::infinitePerspective(glm::pi<float>() * 0.25f, 1.5f, 0.1f);
+		Error += glm::all(glm::equal(Infinite, glm::infinitePerspective(glm::pi<float>() * 0.25f, 1.5f, 0.1f), 0.000001f)) ? 0 : 1;
+
+		constexpr glm::mat4 View = glm::lookAt(glm::vec3(1.0f, 2.0f, 5.0f), glm::vec3(0.0f), glm::vec3(0.0f, 1.0f, 0.0f));
+		static_assert(glm::all(glm::equal(View * glm::vec4(1.0f, 2.0f, 5.0f, 1.0f), glm::vec4(0.0f, 0.0f, 0.0f, 1.0f), 0.000001f)), "GLM: Failed constexpr");
+		Error += glm::all(glm::equal(View, glm::lookAt(glm::vec3(1.0f, 2.0f, 5.0f), glm::vec3(0.0f), glm::vec3(0.0f, 1.0f, 0.0f)), 0.000001f)) ? 0 : 1;
+
+		constexpr glm::dmat4 ViewProjection = glm::perspective(glm::pi<double>() * 0.25, 1.5, 0.1, 100.0) * glm::lookAt(glm::dvec3(1, 2, 5), glm::dvec3(0), glm::dvec3(0, 1, 0));
+		glm::dmat4 const RuntimeViewProjection = glm::perspective(glm::pi<double>() * 0.25, 1.5, 0.1, 100.0) * glm::lookAt(glm::dvec3(1, 2, 5), glm::dvec3(0), glm::dvec3(0, 1, 0));
+		Error += glm::all(glm::equal(ViewProjection, RuntimeViewProjection, 0.000000000001)) ? 0 : 1;
+	}
+#	endif//GLM_HAS_IS_CONSTANT_EVALUATED
+
+	return Error;
+}
+
 #endif//GLM_CONFIG_CONSTEXP == GLM_ENABLE
 
 int main()
 {
 	int Error = 0;
 
-#	if GLM_CONFIG_CONSTEXP == GLM_ENABLE
+#	if GLM_CONFIG_CONSTEXP == GLM_ENABLE && !(defined(GLM_FORCE_DEFAULT_ALIGNED_GENTYPES) && GLM_CONFIG_SIMD == GLM_ENABLE)
 		Error += test_vec1();
 		Error += test_vec2();
 		Error += test_vec3();
 		Error += test_vec4();
 		Error += test_quat();
 		Error += test_mat2x2();
+		Error += test_mat4x4();
 #	endif//GLM_CONFIG_CONSTEXP == GLM_ENABLE
 
 	return Error;
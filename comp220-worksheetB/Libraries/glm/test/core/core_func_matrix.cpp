@@ -257,6 +257,53 @@ int test_inverse_simd()
 	return Error;
 }
 
+// The aligned dmat4 operations use AVX when it's enabled, they must match the packed ones
+int test_dmat4_aligned()
+{
+	int Error = 0;
+
+#	if GLM_CONFIG_ALIGNED_GENTYPES == GLM_ENABLE
+		typedef glm::mat<4, 4, double, glm::aligned_highp> aligned_dmat4;
+		typedef glm::vec<4, double, glm::aligned_highp> aligned_dvec4;
+
+		glm::dmat4 const A = glm::rotate(glm::translate(glm::dmat4(2.0), glm::dvec3(1, -2, 3)), 0.7, glm::normalize(glm::dvec3(1, 2, 3)));
+		glm::dmat4 const B(
+			glm::dvec4(4, 0.5, 1, 0),
+			glm::dvec4(0, 3, -1, 2),
+			glm::dvec4(1, 0, 2, 0),
+			glm::dvec4(0.5, 1, 0, 1));
+		glm::dvec4 const V(1, -2, 3, 1);
+
+		aligned_dmat4 const AlignedA(A);
+		aligned_dmat4 const AlignedB(B);
+		aligned_dvec4 const AlignedV(V);
+
+		glm::dmat4 const Mul(AlignedA * AlignedB);
+		glm::dmat4 const Transpose(glm::transpose(AlignedB));
+		glm::dmat4 const Inverse(glm::inverse(AlignedB));
+		glm::dvec4 const MulVec(AlignedA * AlignedV);
+
+		glm::dmat4 const ExpectedMul = A * B;
+		glm::dmat4 const ExpectedTranspose = glm::transpose(B);
+		glm::dmat4 const ExpectedInverse = glm::inverse(B);
+		for(length_t i = 0; i < 4; ++i)
+		{
+			Error += glm::all(glm::epsilonEqual(Mul[i], ExpectedMul[i], 1e-12)) ? 0 : 1;
+			Error += glm::all(glm::epsilonEqual(Inverse[i], ExpectedInverse[i], 1e-12)) ? 0 : 1;
+		}
+		Error += Transpose == ExpectedTranspose ? 0 : 1;
+		Error += glm::all(glm::epsilonEqual(MulVec, A * V, 1e-12)) ? 0 : 1;
+		Error += glm::epsilonEqual(glm::determinant(AlignedA), glm::determinant(A), 1e-12) ? 0 : 1;
+		Error += glm::epsilonEqual(glm::determinant(AlignedB), glm::determinant(B), 1e-12) ? 0 : 1;
+
+		glm::dmat4 const Identity(AlignedB * glm::inverse(AlignedB));
+		for(length_t i = 0; i < 4; ++i)
+			Error += glm::all(glm::epsilonEqual(Identity[i], glm::dmat4(1.0)[i], 1e-12)) ? 0 : 1;
+#	endif
+
+	return Error;
+}
+
 template<typename VEC3, typename MAT4>
 int test_inverse_perf(std::size_t Count, std::size_t Instance, char const * Message)
 {
@@ -311,6 +358,7 @@ int main()
 	Error += test_determinant();
 	Error += test_inverse();
 	Error += test_inverse_simd();
+	Error += test_dmat4_aligned();
 
 #	ifdef NDEBUG
 	std::size_t const Samples = 1000;
@@ -44,6 +44,48 @@ static int test_operators()
 	return Error;
 }
 
+// Aligned types take the SIMD operators when they are enabled, the results must match the packed ones
+template <typename T>
+static int test_operators_aligned()
+{
+	int Error = 0;
+
+#	if GLM_CONFIG_ALIGNED_GENTYPES == GLM_ENABLE
+		typedef glm::mat<4, 4, T, glm::defaultp> packedMat;
+		typedef glm::vec<4, T, glm::defaultp> packedVec;
+		typedef glm::mat<4, 4, T, glm::aligned_highp> alignedMat;
+		typedef glm::vec<4, T, glm::aligned_highp> alignedVec;
+
+		T const Epsilon = static_cast<T>(0.0001);
+
+		packedMat const A(1, 2, 3, 4, -5, 6, 7, 8, 9, 10, -11, 12, 13, 14, 15, 16);
+		packedMat const B(0.5, 0, 1, 2, 0, -1, 0.25, 3, 1, 0, 2, 0, 4, 0.5, -2, 1);
+		packedVec const V(1, -2, 3, 0.5);
+		T const S = static_cast<T>(1.5);
+
+		alignedMat const AlignedA(A);
+		alignedMat const AlignedB(B);
+		alignedVec const AlignedV(V);
+
+		Error += glm::all(glm::equal(packedMat(AlignedA * AlignedB), A * B, Epsilon)) ? 0 : 1;
+		Error += glm::all(glm::equal(packedMat(AlignedA + AlignedB), A + B, Epsilon)) ? 0 : 1;
+		Error += glm::all(glm::equal(packedMat(AlignedA - AlignedB), A - B, Epsilon)) ? 0 : 1;
+		Error += glm::all(glm::equal(packedMat(AlignedA * S), A * S, Epsilon)) ? 0 : 1;
+		Error += glm::all(glm::equal(packedMat(S * AlignedA), S * A, Epsilon)) ? 0 : 1;
+		Error += glm::all(glm::equal(packedVec(AlignedA * AlignedV), A * V, Epsilon)) ? 0 : 1;
+		Error += glm::all(glm::equal(packedVec(AlignedV * AlignedA), V * A, Epsilon)) ? 0 : 1;
+
+		alignedMat C(AlignedA);
+		C += AlignedB;
+		C *= S;
+		C -= AlignedA;
+		C *= AlignedB;
+		Error += glm::all(glm::equal(packedMat(C), ((A + B) * S - A) * B, Epsilon)) ? 0 : 1;
+#	endif
+
+	return Error;
+}
+
 template <typename matType>
 static int test_inverse()
 {
@@ -201,6 +243,9 @@ int main()
 	Error += test_operators<glm::mediump_dmat4, glm::mediump_dvec4>();
 	Error += test_operators<glm::highp_dmat4, glm::highp_dvec4>();
 
+	Error += test_operators_aligned<float>();
+	Error += test_operators_aligned<double>();
+
 	Error += test_inverse<glm::mat4>();
 	Error += test_inverse<glm::lowp_mat4>();
 	Error += test_inverse<glm::mediump_mat4>();
@@ -2,6 +2,8 @@
 #include <glm/gtc/noise.hpp>
 #include <glm/gtc/type_precision.hpp>
 #include <glm/gtx/raw_data.hpp>
+#include <vector>
+#include <cstring>
 
 int test_simplex()
 {
@@ -36,6 +38,125 @@ int test_perlin_pedioric()
 	return Error;
 }
 
+static bool same_bits(float a, float b)
+{
+	return std::memcmp(&a, &b, sizeof(float)) == 0;
+}
+
+static float get_coord(std::size_t i)
+{
+	// Whole numbers, zeros and values around multiples of 289 among spread values
+	static float const Special[] = {0.0f, -0.0f, 1.0f, -1.0f, 0.5f, 288.999f, 289.0f, -289.0f, 12345.678f, -0.25f};
+	if(i % 7 == 0)
+		return Special[(i / 7) % (sizeof(Special) / sizeof(Special[0]))];
+	return static_cast<float>(static_cast<int>((i * 2654435761u) % 60000u) - 30000) * 0.0137f;
+}
+
+template<glm::length_t L>
+static int test_batch_points(std::size_t Count)
+{
+	int Error = 0;
+
+	std::vector<glm::vec<L, float, glm::packed_highp> > Points(Count);
+	for(std::size_t i = 0; i < Count; ++i)
+	for(glm::length_t c = 0; c < L; ++c)
+		Points[i][c] = get_coord(i * L + c);
+
+	std::vector<float> Perlin(Count), Simplex(Count), PerlinFbm(Count), SimplexFbm(Count);
+
+	unsigned int const Masks[] = {~0u, GLM_SIMD_SSE2, 0u};
+	for(std::size_t m = 0; m < sizeof(Masks) / sizeof(Masks[0]); ++m)
+	{
+		glm_simd_feature_mask() = Masks[m];
+
+		glm::perlin(&Points[0], &Perlin[0], Count);
+		glm::simplex(&Points[0], &Simplex[0], Count);
+		glm::perlinFbm(&Points[0], &PerlinFbm[0], Count, 5, 2.0f, 0.5f);
+		glm::simplexFbm(&Points[0], &SimplexFbm[0], Count, 4, 1.9f, 0.6f);
+
+		for(std::size_t i = 0; i < Count; ++i)
+		{
+			Error += same_bits(Perlin[i], glm::perlin(Points[i])) ? 0 : 1;
+			Error += same_bits(Simplex[i], glm::simplex(Points[i])) ? 0 : 1;
+			Error += same_bits(PerlinFbm[i], glm::perlinFbm(Points[i], 5, 2.0f, 0.5f)) ? 0 : 1;
+			Error += same_bits(SimplexFbm[i], glm::simplexFbm(Points[i], 4, 1.9f, 0.6f)) ? 0 : 1;
+		}
+	}
+	glm_simd_feature_mask() = ~0u;
+
+	return Error;
+}
+
+int test_batch()
+{
+	int Error = 0;
+
+	Error += test_batch_points<2>(1003);
+	Error += test_batch_points<3>(1003);
+
+	return Error;
+}
+
+int test_grid()
+{
+	int Error = 0;
+
+	// 2D grid and the same grid filled by bands of rows
+	{
+		glm::vec2 const Origin(-3.1f, 7.3f);
+		glm::vec2 const Step(0.37f, 0.11f);
+		glm::ivec2 const Begin(-5, 2);
+		glm::ivec2 const End(70, 19);
+		std::size_t const Columns = static_cast<std::size_t>(End.x - Begin.x);
+
+		std::vector<float> Grid(Columns * static_cast<std::size_t>(End.y - Begin.y));
+		glm::perlinGrid(Origin, Step, Begin, End, &Grid[0], 3, 2.0f, 0.5f);
+
+		for(int y = Begin.y; y < End.y; ++y)
+		for(int x = Begin.x; x < End.x; ++x)
+		{
+			float const Reference = glm::perlinFbm(Origin + glm::vec2(glm::ivec2(x, y)) * Step, 3, 2.0f, 0.5f);
+			Error += same_bits(Grid[static_cast<std::size_t>(y - Begin.y) * Columns + static_cast<std::size_t>(x - Begin.x)], Reference) ? 0 : 1;
+		}
+
+		std::vector<float> Bands(Grid.size());
+		for(int y = Begin.y; y < End.y; y += 4)
+		{
+			int const Last = glm::min(y + 4, End.y);
+			float* const Band = &Bands[static_cast<std::size_t>(y - Begin.y) * Columns];
+			glm::perlinGrid(Origin, Step, glm::ivec2(Begin.x, y), glm::ivec2(End.x, Last), Band, 3, 2.0f, 0.5f);
+		}
+		for(std::size_t i = 0; i < Grid.size(); ++i)
+			Error += same_bits(Grid[i], Bands[i]) ? 0 : 1;
+	}
+
+	// 3D grid
+	{
+		glm::vec3 const Origin(0.5f, -1.25f, 3.0f);
+		glm::vec3 const Step(0.2f, 0.3f, 0.7f);
+		glm::ivec3 const Begin(0, -2, 1);
+		glm::ivec3 const End(21, 3, 5);
+
+		std::vector<float> Grid(21 * 5 * 4);
+		glm::simplexGrid(Origin, Step, Begin, End, &Grid[0], 2, 2.0f, 0.5f);
+
+		std::size_t i = 0;
+		for(int z = Begin.z; z < End.z; ++z)
+		for(int y = Begin.y; y < End.y; ++y)
+		for(int x = Begin.x; x < End.x; ++x, ++i)
+			Error += same_bits(Grid[i], glm::simplexFbm(Origin + glm::vec3(glm::ivec3(x, y, z)) * Step, 2, 2.0f, 0.5f)) ? 0 : 1;
+	}
+
+	// Empty box
+	{
+		float Out = 1.0f;
+		glm::simplexGrid(glm::vec2(0.0f), glm::vec2(1.0f), glm::ivec2(3, 0), glm::ivec2(3, 10), &Out, 1, 2.0f, 0.5f);
+		Error += Out == 1.0f ? 0 : 1;
+	}
+
+	return Error;
+}
+
 int main()
 {
 	int Error = 0;
@@ -43,6 +164,8 @@ int main()
 	Error += test_simplex();
 	Error += test_perlin();
 	Error += test_perlin_pedioric();
+	Error += test_batch();
+	Error += test_grid();
 
 	return Error;
 }
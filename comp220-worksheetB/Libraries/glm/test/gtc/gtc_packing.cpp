@@ -2,7 +2,10 @@
 #include <glm/gtc/packing.hpp>
 #include <glm/gtc/epsilon.hpp>
 #include <glm/ext/vector_relational.hpp>
+#include <cmath>
 #include <cstdio>
+#include <cstring>
+#include <limits>
 #include <vector>
 
 void print_bits(float const& s)
@@ -822,6 +825,220 @@ int test_packInt2x32()
 	return Error;
 }
 
+static unsigned int get_bits(std::size_t i)
+{
+	unsigned int x = static_cast<unsigned int>(i) * 2654435761u + 0x9e3779b9u;
+	x ^= x >> 15;
+	x *= 0x2c1b3c6du;
+	x ^= x >> 12;
+	return x;
+}
+
+static float get_float_bits(std::size_t i)
+{
+	unsigned int const Bits = get_bits(i);
+	float Value = 0.0f;
+	std::memcpy(&Value, &Bits, sizeof(Value));
+	return Value;
+}
+
+template<typename genType>
+static bool same_bits(genType const& a, genType const& b)
+{
+	return std::memcmp(&a, &b, sizeof(genType)) == 0;
+}
+
+// NaNs may differ in their payload
+static bool same_float(float a, float b)
+{
+	return same_bits(a, b) || (a != a && b != b);
+}
+
+static int test_batch_Half1x16(std::size_t Count)
+{
+	int Error = 0;
+
+	float const Inf = std::numeric_limits<float>::infinity();
+	float const Special[] = {
+		0.0f, -0.0f, 1.0f, -1.0f, 65504.0f, 65519.99f, 65520.0f, -65536.0f, Inf, -Inf, std::numeric_limits<float>::quiet_NaN(),
+		std::ldexp(1.0f, -14), std::ldexp(1.0f, -24), std::ldexp(1.0f, -25), std::ldexp(3.0f, -26), std::ldexp(1.0f, -26), 1e-40f,
+		1.0f + std::ldexp(1.0f, -11), 1.0f + std::ldexp(3.0f, -11), -2049.0f, std::ldexp(1023.5f, -24)};
+	std::size_t const SpecialCount = sizeof(Special) / sizeof(Special[0]);
+
+	// Special values, then every float bit pattern, then values in the range of halves
+	std::vector<float> In(Count);
+	for(std::size_t i = 0; i < Count; ++i)
+	{
+		if(i < SpecialCount)
+			In[i] = Special[i];
+		else if(i % 2)
+			In[i] = get_float_bits(i);
+		else
+			In[i] = static_cast<float>(static_cast<int>(get_bits(i) % 140000u) - 70000) * 0.937f / static_cast<float>(1 << (get_bits(i + 1) % 31u));
+	}
+
+	std::vector<glm::uint16> Packed(Count), Bits(Count);
+	std::vector<float> Unpacked(Count);
+	for(std::size_t i = 0; i < Count; ++i)
+		Bits[i] = static_cast<glm::uint16>(get_bits(i));
+
+	unsigned int const Masks[] = {~0u, GLM_SIMD_SSE2, 0u};
+	for(std::size_t m = 0; m < sizeof(Masks) / sizeof(Masks[0]); ++m)
+	{
+		glm_simd_feature_mask() = Masks[m];
+
+		glm::packHalf1x16(&In[0], &Packed[0], Count);
+		for(std::size_t i = 0; i < Count; ++i)
+			Error += Packed[i] == glm::packHalf1x16(In[i]) ? 0 : 1;
+
+		glm::unpackHalf1x16(&Packed[0], &Unpacked[0], Count);
+		for(std::size_t i = 0; i < Count; ++i)
+			Error += same_float(Unpacked[i], glm::unpackHalf1x16(Packed[i])) ? 0 : 1;
+
+		glm::unpackHalf1x16(&Bits[0], &Unpacked[0], Count);
+		for(std::size_t i = 0; i < Count; ++i)
+			Error += same_float(Unpacked[i], glm::unpackHalf1x16(Bits[i])) ? 0 : 1;
+	}
+	glm_simd_feature_mask() = ~0u;
+
+	return Error;
+}
+
+static int test_batch_Unorm4x8_Snorm3x10_1x2(std::size_t Count)
+{
+	int Error = 0;
+
+	// Mostly in [-1.5, 1.5], with halfway cases, zeros and infinities
+	float const Inf = std::numeric_limits<float>::infinity();
+	float const Special[] = {0.0f, -0.0f, 1.0f, -1.0f, 0.5f / 255.0f, 2.5f / 255.0f, 0.5f / 511.0f, -0.5f / 511.0f, -1.5f / 511.0f, 0.5f, -0.5f, 2.0f, -2.0f, Inf, -Inf};
+	std::size_t const SpecialCount = sizeof(Special) / sizeof(Special[0]);
+
+	std::vector<glm::vec4> In(Count);
+	for(std::size_t i = 0; i < Count; ++i)
+	for(glm::length_t c = 0; c < 4; ++c)
+	{
+		std::size_t const j = i * 4 + static_cast<std::size_t>(c);
+		if(j % 5 == 0)
+			In[i][c] = Special[(j / 5) % SpecialCount];
+		else
+			In[i][c] = static_cast<float>(static_cast<int>(get_bits(j) % 3001u) - 1500) * 0.001f;
+	}
+
+	std::vector<glm::uint32> Unorm(Count), Snorm(Count), Bits(Count);
+	std::vector<glm::vec4> Unpacked(Count);
+	for(std::size_t i = 0; i < Count; ++i)
+		Bits[i] = get_bits(i);
+
+	unsigned int const Masks[] = {~0u, GLM_SIMD_SSE2, 0u};
+	for(std::size_t m = 0; m < sizeof(Masks) / sizeof(Masks[0]); ++m)
+	{
+		glm_simd_feature_mask() = Masks[m];
+
+		glm::packUnorm4x8(&In[0], &Unorm[0], Count);
+		glm::packSnorm3x10_1x2(&In[0], &Snorm[0], Count);
+		for(std::size_t i = 0; i < Count; ++i)
+		{
+			Error += Unorm[i] == glm::packUnorm4x8(In[i]) ? 0 : 1;
+			Error += Snorm[i] == glm::packSnorm3x10_1x2(In[i]) ? 0 : 1;
+		}
+
+		glm::unpackUnorm4x8(&Unorm[0], &Unpacked[0], Count);
+		for(std::size_t i = 0; i < Count; ++i)
+			Error += same_bits(Unpacked[i], glm::unpackUnorm4x8(Unorm[i])) ? 0 : 1;
+
+		glm::unpackSnorm3x10_1x2(&Snorm[0], &Unpacked[0], Count);
+		for(std::size_t i = 0; i < Count; ++i)
+			Error += same_bits(Unpacked[i], glm::unpackSnorm3x10_1x2(Snorm[i])) ? 0 : 1;
+
+		glm::unpackUnorm4x8(&Bits[0], &Unpacked[0], Count);
+		for(std::size_t i = 0; i < Count; ++i)
+			Error += same_bits(Unpacked[i], glm::unpackUnorm4x8(Bits[i])) ? 0 : 1;
+
+		glm::unpackSnorm3x10_1x2(&Bits[0], &Unpacked[0], Count);
+		for(std::size_t i = 0; i < Count; ++i)
+			Error += same_bits(Unpacked[i], glm::unpackSnorm3x10_1x2(Bits[i])) ? 0 : 1;
+	}
+	glm_simd_feature_mask() = ~0u;
+
+	return Error;
+}
+
+static int test_batch_F2x11_1x10_F3x9_E1x5(std::size_t Count)
+{
+	int Error = 0;
+
+	// Every float bit pattern for F2x11_1x10; positive values of all magnitudes for F3x9_E1x5,
+	// with values just under powers of two where log2 may round to the next integer
+	float const Inf = std::numeric_limits<float>::infinity();
+	float const Special[] = {
+		0.0f, -0.0f, 1.0f, -1.0f, Inf, -Inf, std::numeric_limits<float>::quiet_NaN(), 65000.0f, 1e-7f, 1e-40f,
+		32768.0f, 40000.0f, 511.75f, std::nextafter(32768.0f, 0.0f), std::nextafter(1.0f, 0.0f), std::nextafter(4096.0f, 0.0f),
+		std::nextafter(std::ldexp(1.0f, -15), 0.0f), std::ldexp(1.0f, -16), std::ldexp(1.0f, -24), std::ldexp(1.0f, -25)};
+	std::size_t const SpecialCount = sizeof(Special) / sizeof(Special[0]);
+
+	std::vector<glm::vec3> Floats(Count), Colors(Count);
+	for(std::size_t i = 0; i < Count; ++i)
+	for(glm::length_t c = 0; c < 3; ++c)
+	{
+		std::size_t const j = i * 3 + static_cast<std::size_t>(c);
+		Floats[i][c] = j % 5 == 0 ? Special[(j / 5) % SpecialCount] : get_float_bits(j);
+
+		float const Mantissa = static_cast<float>(get_bits(j) % 100000u) * 0.00001f + 0.5f;
+		float const Color = j % 5 == 0 ? Special[(j / 5) % SpecialCount] : std::ldexp(Mantissa, static_cast<int>(get_bits(j + 1) % 48u) - 30);
+		Colors[i][c] = Color != Color ? 1.0f : Color;
+	}
+
+	std::vector<glm::uint32> F2x11(Count), F3x9(Count), Bits(Count);
+	std::vector<glm::vec3> Unpacked(Count);
+	for(std::size_t i = 0; i < Count; ++i)
+		Bits[i] = get_bits(i);
+
+	unsigned int const Masks[] = {~0u, GLM_SIMD_SSE2, 0u};
+	for(std::size_t m = 0; m < sizeof(Masks) / sizeof(Masks[0]); ++m)
+	{
+		glm_simd_feature_mask() = Masks[m];
+
+		glm::packF2x11_1x10(&Floats[0], &F2x11[0], Count);
+		glm::packF3x9_E1x5(&Colors[0], &F3x9[0], Count);
+		for(std::size_t i = 0; i < Count; ++i)
+		{
+			Error += F2x11[i] == glm::packF2x11_1x10(Floats[i]) ? 0 : 1;
+			Error += F3x9[i] == glm::packF3x9_E1x5(Colors[i]) ? 0 : 1;
+		}
+
+		glm::unpackF2x11_1x10(&F2x11[0], &Unpacked[0], Count);
+		for(std::size_t i = 0; i < Count; ++i)
+			Error += same_bits(Unpacked[i], glm::unpackF2x11_1x10(F2x11[i])) ? 0 : 1;
+
+		glm::unpackF3x9_E1x5(&F3x9[0], &Unpacked[0], Count);
+		for(std::size_t i = 0; i < Count; ++i)
+			Error += same_bits(Unpacked[i], glm::unpackF3x9_E1x5(F3x9[i])) ? 0 : 1;
+
+		glm::unpackF2x11_1x10(&Bits[0], &Unpacked[0], Count);
+		for(std::size_t i = 0; i < Count; ++i)
+			Error += same_bits(Unpacked[i], glm::unpackF2x11_1x10(Bits[i])) ? 0 : 1;
+
+		glm::unpackF3x9_E1x5(&Bits[0], &Unpacked[0], Count);
+		for(std::size_t i = 0; i < Count; ++i)
+			Error += same_bits(Unpacked[i], glm::unpackF3x9_E1x5(Bits[i])) ? 0 : 1;
+	}
+	glm_simd_feature_mask() = ~0u;
+
+	return Error;
+}
+
+// The arrays give the same bits as the functions of one value, on every code path and with the scalar tails
+int test_batch()
+{
+	int Error = 0;
+
+	Error += test_batch_Half1x16(100003);
+	Error += test_batch_Unorm4x8_Snorm3x10_1x2(10003);
+	Error += test_batch_F2x11_1x10_F3x9_E1x5(10003);
+
+	return Error;
+}
+
 int main()
 {
 	int Error = 0;
@@ -874,5 +1091,7 @@ int main()
 	Error += test_Half1x16();
 	Error += test_Half4x16();
 
+	Error += test_batch();
+
 	return Error;
 }
@@ -248,6 +248,49 @@ int test_identity()
 	return Error;
 }
 
+// Aligned quaternions take the SIMD functions when they are enabled, the results must match the packed ones
+static int test_aligned()
+{
+	int Error = 0;
+
+#	if GLM_CONFIG_ALIGNED_GENTYPES == GLM_ENABLE
+		typedef glm::qua<float, glm::aligned_highp> alignedQuat;
+		typedef glm::vec<3, float, glm::aligned_highp> alignedVec3;
+		typedef glm::vec<4, float, glm::aligned_highp> alignedVec4;
+
+		float const Epsilon = 0.00001f;
+
+		glm::quat const A = glm::angleAxis(0.8f, glm::normalize(glm::vec3(1.0f, 2.0f, -3.0f)));
+		glm::quat const B = glm::angleAxis(-2.1f, glm::normalize(glm::vec3(-2.0f, 0.5f, 1.0f)));
+		glm::vec3 const V(1.0f, -2.0f, 0.5f);
+
+		alignedQuat const AlignedA(A);
+		alignedQuat const AlignedB(B);
+
+		for(int i = 0; i <= 8; ++i)
+		{
+			float const t = static_cast<float>(i) / 8.0f;
+			Error += glm::all(glm::equal(glm::quat(glm::slerp(AlignedA, AlignedB, t)), glm::slerp(A, B, t), Epsilon)) ? 0 : 1;
+			Error += glm::all(glm::equal(glm::quat(glm::slerp(AlignedA, -AlignedB, t)), glm::slerp(A, -B, t), Epsilon)) ? 0 : 1;
+			Error += glm::all(glm::equal(glm::quat(glm::mix(AlignedA, AlignedB, t)), glm::mix(A, B, t), Epsilon)) ? 0 : 1;
+		}
+
+		// cosTheta close to 1 takes the linear interpolation
+		Error += glm::all(glm::equal(glm::quat(glm::slerp(AlignedA, AlignedA, 0.3f)), glm::slerp(A, A, 0.3f), Epsilon)) ? 0 : 1;
+
+		Error += glm::all(glm::equal(glm::quat(glm::normalize(AlignedA * 3.0f)), glm::normalize(A * 3.0f), Epsilon)) ? 0 : 1;
+		Error += glm::quat(glm::normalize(alignedQuat(0, 0, 0, 0))) == glm::quat(1, 0, 0, 0) ? 0 : 1;
+
+		Error += glm::all(glm::equal(glm::mat3(glm::mat3_cast(AlignedA)), glm::mat3_cast(A), Epsilon)) ? 0 : 1;
+		Error += glm::all(glm::equal(glm::mat4(glm::mat4_cast(AlignedB)), glm::mat4_cast(B), Epsilon)) ? 0 : 1;
+
+		Error += glm::all(glm::equal(glm::vec3(AlignedA * alignedVec3(V)), A * V, Epsilon)) ? 0 : 1;
+		Error += glm::all(glm::equal(glm::vec4(AlignedB * alignedVec4(V, 1.0f)), B * glm::vec4(V, 1.0f), Epsilon)) ? 0 : 1;
+#	endif
+
+	return Error;
+}
+
 int main()
 {
 	int Error = 0;
@@ -261,6 +304,7 @@ int main()
 	Error += test_quat_euler();
 	Error += test_quat_slerp();
 	Error += test_identity();
+	Error += test_aligned();
 
 	return Error;
 }
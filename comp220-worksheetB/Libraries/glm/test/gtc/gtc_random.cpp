@@ -2,6 +2,7 @@
 #include <glm/gtc/random.hpp>
 #include <glm/gtc/epsilon.hpp>
 #include <glm/gtc/type_precision.hpp>
+#include <vector>
 #if GLM_LANG & GLM_LANG_CXX0X_FLAG
 #	include <array>
 #endif
@@ -322,6 +323,173 @@ int test_ballRand()
 
 	return Error;
 }
+int test_philox()
+{
+	int Error = 0;
+
+	// Known answers of Philox4x32-10
+	{
+		glm::uint32 const Key[2] = {0u, 0u};
+		glm::uint32 Out[4];
+		glm::detail::philox4x32_block(Key, 0, 0, Out);
+		Error += Out[0] == 0x6627e8d5u && Out[1] == 0xe169c58du && Out[2] == 0xbc57ac4cu && Out[3] == 0x9b00dbd8u ? 0 : 1;
+	}
+
+	{
+		glm::uint32 const Key[2] = {0xffffffffu, 0xffffffffu};
+		glm::uint32 Out[4];
+		glm::detail::philox4x32_block(Key, ~glm::uint64(0), ~glm::uint64(0), Out);
+		Error += Out[0] == 0x408f276du && Out[1] == 0x41c83b0eu && Out[2] == 0xa20bc7c6u && Out[3] == 0x6d5451fdu ? 0 : 1;
+	}
+
+	{
+		glm::uint32 const Key[2] = {0xa4093822u, 0x299f31d0u};
+		glm::uint32 Out[4];
+		glm::detail::philox4x32_block(Key, 0x0370734413198a2eull, 0x85a308d3243f6a88ull, Out);
+		Error += Out[0] == 0xd16cfe09u && Out[1] == 0x94fdccebu && Out[2] == 0x5001e420u && Out[3] == 0x24126ea1u ? 0 : 1;
+	}
+
+	// Streams of a seed don't overlap
+	{
+		glm::philox4x32 A(42, 0);
+		glm::philox4x32 B(42, 1);
+		int Same = 0;
+		for(int i = 0; i < 64; ++i)
+			Same += A() == B() ? 1 : 0;
+		Error += Same < 4 ? 0 : 1;
+	}
+
+	// discard(n) skips what n calls would return
+	for(glm::uint64 Skip = 0; Skip < 11; ++Skip)
+	{
+		glm::philox4x32 A(7, 3);
+		glm::philox4x32 B(7, 3);
+		for(glm::uint64 i = 0; i < Skip; ++i)
+			A();
+		B.discard(Skip);
+		for(int i = 0; i < 9; ++i)
+			Error += A() == B() ? 0 : 1;
+	}
+
+	// The blocks of every code path are the blocks of the scalar function
+	{
+		glm::uint32 const Key[2] = {0x12345678u, 0x9abcdef0u};
+		std::size_t const Blocks = 37;
+		glm::uint64 const First = 0xfffffff0ull;
+
+		glm::uint32 Reference[Blocks * 4];
+		for(std::size_t i = 0; i < Blocks; ++i)
+			glm::detail::philox4x32_block(Key, 5, First + i, Reference + i * 4);
+
+		unsigned int const Masks[] = {~0u, GLM_SIMD_SSE2, 0u};
+		for(std::size_t m = 0; m < sizeof(Masks) / sizeof(Masks[0]); ++m)
+		{
+			glm_simd_feature_mask() = Masks[m];
+
+			glm::uint32 Out[Blocks * 4];
+			glm::detail::philox4x32_blocks(Key, 5, First, Out, Blocks);
+			for(std::size_t i = 0; i < Blocks * 4; ++i)
+				Error += Out[i] == Reference[i] ? 0 : 1;
+		}
+		glm_simd_feature_mask() = ~0u;
+	}
+
+	return Error;
+}
+
+int test_philox_rand()
+{
+	int Error = 0;
+
+	// Scalar functions
+	{
+		glm::philox4x32 Engine(1234);
+
+		float MinFloat = 1.0f, MaxFloat = 0.0f;
+		double Sum = 0.0, SumSq = 0.0;
+		for(std::size_t i = 0; i < TestSamples; ++i)
+		{
+			float const Linear = glm::linearRand(Engine, 2.0f, 3.0f);
+			MinFloat = glm::min(MinFloat, Linear - 2.0f);
+			MaxFloat = glm::max(MaxFloat, Linear - 2.0f);
+
+			double const Gauss = glm::gaussRand(Engine, 5.0, 2.0);
+			Sum += Gauss;
+			SumSq += (Gauss - 5.0) * (Gauss - 5.0);
+
+			Error += glm::epsilonEqual(glm::length(glm::sphericalRand(Engine, 3.0f)), 3.0f, 0.001f) ? 0 : 1;
+			Error += glm::length(glm::ballRand(Engine, 3.0)) <= 3.0 ? 0 : 1;
+		}
+		Error += MinFloat >= 0.0f && MinFloat < 0.01f ? 0 : 1;
+		Error += MaxFloat <= 1.0f && MaxFloat > 0.99f ? 0 : 1;
+		Error += glm::epsilonEqual(Sum / double(TestSamples), 5.0, 0.1) ? 0 : 1;
+		Error += glm::epsilonEqual(glm::sqrt(SumSq / double(TestSamples)), 2.0, 0.1) ? 0 : 1;
+	}
+
+	// Array functions give the same numbers on every code path, up to the polynomial log, sin and cos
+	{
+		std::size_t const Count = 1000;
+		unsigned int const Masks[] = {~0u, GLM_SIMD_SSE2, 0u};
+
+		std::vector<float> Linear[3], Gauss[3];
+		std::vector<glm::vec3> Spherical[3], Ball[3];
+		for(std::size_t m = 0; m < sizeof(Masks) / sizeof(Masks[0]); ++m)
+		{
+			glm_simd_feature_mask() = Masks[m];
+
+			glm::philox4x32 Engine(99, 2);
+			Linear[m].resize(Count);
+			Gauss[m].resize(Count);
+			Spherical[m].resize(Count);
+			Ball[m].resize(Count);
+			glm::linearRand(Engine, -1.0f, 1.0f, &Linear[m][0], Count);
+			glm::gaussRand(Engine, 0.0f, 1.0f, &Gauss[m][0], Count);
+			glm::sphericalRand(Engine, 2.0f, &Spherical[m][0], Count);
+			glm::ballRand(Engine, 2.0f, &Ball[m][0], Count);
+
+			// Scalar calls continue after the array fills
+			Error += Engine.Position % 4 == 0 ? 0 : 1;
+		}
+		glm_simd_feature_mask() = ~0u;
+
+		for(std::size_t m = 1; m < sizeof(Masks) / sizeof(Masks[0]); ++m)
+		for(std::size_t i = 0; i < Count; ++i)
+		{
+			Error += Linear[m][i] == Linear[0][i] ? 0 : 1;
+			Error += glm::epsilonEqual(Gauss[m][i], Gauss[0][i], 0.0001f) ? 0 : 1;
+			Error += glm::all(glm::epsilonEqual(Spherical[m][i], Spherical[0][i], 0.0001f)) ? 0 : 1;
+			Error += glm::all(glm::epsilonEqual(Ball[m][i], Ball[0][i], 0.0001f)) ? 0 : 1;
+		}
+
+		double Sum = 0.0, SumSq = 0.0;
+		for(std::size_t i = 0; i < Count; ++i)
+		{
+			Error += Linear[0][i] >= -1.0f && Linear[0][i] <= 1.0f ? 0 : 1;
+			Error += glm::epsilonEqual(glm::length(Spherical[0][i]), 2.0f, 0.001f) ? 0 : 1;
+			Error += glm::length(Ball[0][i]) <= 2.001f ? 0 : 1;
+			Sum += Gauss[0][i];
+			SumSq += Gauss[0][i] * Gauss[0][i];
+		}
+		Error += glm::abs(Sum / double(Count)) < 0.15 ? 0 : 1;
+		Error += glm::epsilonEqual(glm::sqrt(SumSq / double(Count)), 1.0, 0.1) ? 0 : 1;
+	}
+
+	// Half of the points of a ball are further than 0.5^(1/3) of the radius
+	{
+		std::size_t const Count = 4096;
+		std::vector<glm::vec3> Ball(Count);
+		glm::philox4x32 Engine(5);
+		glm::ballRand(Engine, 1.0f, &Ball[0], Count);
+
+		std::size_t Outside = 0;
+		for(std::size_t i = 0; i < Count; ++i)
+			Outside += glm::length(Ball[i]) > 0.7937005f ? 1 : 0;
+		Error += glm::abs(static_cast<int>(Outside) - static_cast<int>(Count / 2)) < 160 ? 0 : 1;
+	}
+
+	return Error;
+}
+
 /*
 #if(GLM_LANG & GLM_LANG_CXX0X_FLAG)
 int test_grid()
@@ -372,6 +540,8 @@ int main()
 	Error += test_sphericalRand();
 	Error += test_diskRand();
 	Error += test_ballRand();
+	Error += test_philox();
+	Error += test_philox_rand();
 /*
 #if(GLM_LANG & GLM_LANG_CXX0X_FLAG)
 	Error += test_grid();
@@ -0,0 +1,164 @@
+#define GLM_ENABLE_EXPERIMENTAL
+#include <glm/gtx/frustum.hpp>
+#include <glm/ext/matrix_clip_space.hpp>
+#include <glm/ext/matrix_transform.hpp>
+#include <glm/ext/scalar_relational.hpp>
+#include <glm/ext/scalar_constants.hpp>
+
+static glm::ffrustum get_frustum()
+{
+	// Camera at (0, 0, 5) looking at the origin, 90 degrees field of view, from 1 to 100
+	glm::mat4 const Projection = glm::perspective(glm::pi<float>() * 0.5f, 1.0f, 1.0f, 100.0f);
+	glm::mat4 const View = glm::lookAt(glm::vec3(0, 0, 5), glm::vec3(0), glm::vec3(0, 1, 0));
+	return glm::ffrustum(Projection * View);
+}
+
+static int test_planes()
+{
+	int Error = 0;
+
+	glm::ffrustum const Frustum = get_frustum();
+
+	for(glm::length_t i = 0; i < Frustum.length(); ++i)
+		Error += glm::equal(glm::length(glm::vec3(Frustum[i])), 1.0f, 0.0001f) ? 0 : 1;
+
+	// Distances of the camera axis to the near and far planes
+	Error += glm::equal(glm::dot(glm::vec3(Frustum[4]), glm::vec3(0, 0, 0)) + Frustum[4].w, 4.0f, 0.001f) ? 0 : 1;
+	Error += glm::equal(glm::dot(glm::vec3(Frustum[5]), glm::vec3(0, 0, 0)) + Frustum[5].w, 95.0f, 0.01f) ? 0 : 1;
+
+	// 45 degrees from the camera axis on each side
+	Error += glm::equal(glm::dot(glm::vec3(Frustum[0]), glm::vec3(-5, 0, 0)) + Frustum[0].w, 0.0f, 0.0001f) ? 0 : 1;
+	Error += glm::equal(glm::dot(glm::vec3(Frustum[1]), glm::vec3(5, 0, 0)) + Frustum[1].w, 0.0f, 0.0001f) ? 0 : 1;
+	Error += glm::equal(glm::dot(glm::vec3(Frustum[2]), glm::vec3(0, -5, 0)) + Frustum[2].w, 0.0f, 0.0001f) ? 0 : 1;
+	Error += glm::equal(glm::dot(glm::vec3(Frustum[3]), glm::vec3(0, 5, 0)) + Frustum[3].w, 0.0f, 0.0001f) ? 0 : 1;
+
+	return Error;
+}
+
+static int test_intersectFrustumSphere()
+{
+	int Error = 0;
+
+	glm::ffrustum const Frustum = get_frustum();
+
+	Error += glm::intersectFrustumSphere(Frustum, glm::vec3(0), 1.0f) ? 0 : 1;
+	Error += glm::intersectFrustumSphere(Frustum, glm::vec3(0, 0, 10), 1.0f) ? 1 : 0;
+	Error += glm::intersectFrustumSphere(Frustum, glm::vec3(0, 0, 4.5f), 1.0f) ? 0 : 1;
+	Error += glm::intersectFrustumSphere(Frustum, glm::vec3(0, 0, -200), 1.0f) ? 1 : 0;
+	Error += glm::intersectFrustumSphere(Frustum, glm::vec3(7, 0, 0), 1.0f) ? 1 : 0;
+	Error += glm::intersectFrustumSphere(Frustum, glm::vec3(7, 0, 0), 2.0f) ? 0 : 1;
+
+	return Error;
+}
+
+static int test_intersectFrustumAABB()
+{
+	int Error = 0;
+
+	glm::ffrustum const Frustum = get_frustum();
+
+	Error += glm::intersectFrustumAABB(Frustum, glm::vec3(-1), glm::vec3(1)) ? 0 : 1;
+	Error += glm::intersectFrustumAABB(Frustum, glm::vec3(-1, -1, 6), glm::vec3(1, 1, 8)) ? 1 : 0;
+	Error += glm::intersectFrustumAABB(Frustum, glm::vec3(-1, -1, 3), glm::vec3(1, 1, 8)) ? 0 : 1;
+	Error += glm::intersectFrustumAABB(Frustum, glm::vec3(7, -1, -1), glm::vec3(9, 1, 1)) ? 1 : 0;
+	Error += glm::intersectFrustumAABB(Frustum, glm::vec3(4, -1, -1), glm::vec3(8, 1, 1)) ? 0 : 1;
+
+	return Error;
+}
+
+static int test_intersectFrustumOBB()
+{
+	int Error = 0;
+
+	glm::ffrustum const Frustum = get_frustum();
+
+	glm::mat3 const Identity(1.0f);
+	glm::mat3 const Rotation(glm::rotate(glm::mat4(1.0f), glm::pi<float>() * 0.25f, glm::vec3(0, 0, 1)));
+
+	Error += glm::intersectFrustumOBB(Frustum, glm::vec3(0), glm::vec3(1), Identity) ? 0 : 1;
+	Error += glm::intersectFrustumOBB(Frustum, glm::vec3(7.2f, 0, 0), glm::vec3(1), Identity) ? 1 : 0;
+
+	// Turned by 45 degrees around z, a corner of the box gets closer to the right plane
+	Error += glm::intersectFrustumOBB(Frustum, glm::vec3(7.2f, 0, 0), glm::vec3(1), Rotation) ? 0 : 1;
+	Error += glm::intersectFrustumOBB(Frustum, glm::vec3(7.6f, 0, 0), glm::vec3(1), Rotation) ? 1 : 0;
+
+	return Error;
+}
+
+static float get_value(int i)
+{
+	return static_cast<float>(static_cast<int>((static_cast<unsigned int>(i) * 2654435761u) % 2001u) - 1000) * 0.001f;
+}
+
+// The packets must give the results of the scalar functions on every code path
+template<glm::length_t W>
+static int test_packets()
+{
+	int Error = 0;
+
+	glm::ffrustum const Frustum = get_frustum();
+	unsigned int const Masks[] = {~0u, GLM_SIMD_SSE2, 0u};
+
+	for(int Seed = 0; Seed < 64; ++Seed)
+	{
+		float Center[3][W], HalfExtents[3][W], Radius[W], BoxMin[3][W], BoxMax[3][W], Orientation[3][3][W];
+		for(glm::length_t i = 0; i < W; ++i)
+		{
+			int const Index = (Seed * W + i) * 8;
+			glm::vec3 const Position = glm::vec3(get_value(Index + 0), get_value(Index + 1), get_value(Index + 2) * 10.0f) * 8.0f;
+			glm::vec3 const Size = glm::abs(glm::vec3(get_value(Index + 3), get_value(Index + 4), get_value(Index + 5))) * 3.0f;
+			glm::mat3 const Rotation(glm::rotate(glm::mat4(1.0f), get_value(Index + 6) * 3.0f, glm::normalize(glm::vec3(1.0f, get_value(Index + 7), 0.5f))));
+
+			Radius[i] = Size.x;
+			for(int a = 0; a < 3; ++a)
+			{
+				Center[a][i] = Position[a];
+				HalfExtents[a][i] = Size[a];
+				BoxMin[a][i] = Position[a] - Size[a];
+				BoxMax[a][i] = Position[a] + Size[a];
+				for(int r = 0; r < 3; ++r)
+					Orientation[a][r][i] = Rotation[a][r];
+			}
+		}
+
+		int SphereRef = 0, AABBRef = 0, OBBRef = 0;
+		for(glm::length_t i = 0; i < W; ++i)
+		{
+			glm::vec3 const c(Center[0][i], Center[1][i], Center[2][i]);
+			glm::vec3 const h(HalfExtents[0][i], HalfExtents[1][i], HalfExtents[2][i]);
+			glm::mat3 const o(
+				Orientation[0][0][i], Orientation[0][1][i], Orientation[0][2][i],
+				Orientation[1][0][i], Orientation[1][1][i], Orientation[1][2][i],
+				Orientation[2][0][i], Orientation[2][1][i], Orientation[2][2][i]);
+			SphereRef |= glm::intersectFrustumSphere(Frustum, c, Radius[i]) ? 1 << i : 0;
+			AABBRef |= glm::intersectFrustumAABB(Frustum, c - h, c + h) ? 1 << i : 0;
+			OBBRef |= glm::intersectFrustumOBB(Frustum, c, h, o) ? 1 << i : 0;
+		}
+
+		for(std::size_t m = 0; m < sizeof(Masks) / sizeof(Masks[0]); ++m)
+		{
+			glm_simd_feature_mask() = Masks[m];
+
+			Error += glm::intersectFrustumSpheres(Frustum, Center, Radius) == SphereRef ? 0 : 1;
+			Error += glm::intersectFrustumAABBs(Frustum, BoxMin, BoxMax) == AABBRef ? 0 : 1;
+			Error += glm::intersectFrustumOBBs(Frustum, Center, HalfExtents, Orientation) == OBBRef ? 0 : 1;
+		}
+		glm_simd_feature_mask() = ~0u;
+	}
+
+	return Error;
+}
+
+int main()
+{
+	int Error = 0;
+
+	Error += test_planes();
+	Error += test_intersectFrustumSphere();
+	Error += test_intersectFrustumAABB();
+	Error += test_intersectFrustumOBB();
+	Error += test_packets<4>();
+	Error += test_packets<8>();
+
+	return Error;
+}
@@ -1,7 +1,9 @@
 #define GLM_ENABLE_EXPERIMENTAL
 #include <glm/glm.hpp>
 #include <glm/gtc/epsilon.hpp>
+#include <glm/ext/vector_float1.hpp>
 #include <glm/gtx/intersect.hpp>
+#include <cstring>
 
 int test_intersectRayTriangle()
 {
@@ -43,12 +45,164 @@ int test_intersectLineTriangle()
 	return Error;
 }
 
+int test_intersectRayBox()
+{
+	int Error = 0;
+
+	glm::vec3 const BoxMin(-1, -1, -1);
+	glm::vec3 const BoxMax(1, 1, 1);
+	float Distance = 0;
+
+	Error += glm::intersectRayBox(glm::vec3(0, 0, 3), glm::vec3(0, 0, -1), BoxMin, BoxMax, Distance) ? 0 : 1;
+	Error += glm::abs(Distance - 2.f) <= std::numeric_limits<float>::epsilon() ? 0 : 1;
+
+	// From inside the box, the ray enters it at its origin
+	Error += glm::intersectRayBox(glm::vec3(0.5f, 0, 0), glm::vec3(1, 0, 0), BoxMin, BoxMax, Distance) ? 0 : 1;
+	Error += glm::abs(Distance) <= std::numeric_limits<float>::epsilon() ? 0 : 1;
+
+	// Axis aligned rays divide by 0 on the other axes
+	Error += glm::intersectRayBox(glm::vec3(2, 0, 3), glm::vec3(0, 0, -1), BoxMin, BoxMax, Distance) ? 1 : 0;
+	Error += glm::intersectRayBox(glm::vec3(0, 0, 3), glm::vec3(0, 0, 1), BoxMin, BoxMax, Distance) ? 1 : 0;
+	Error += glm::intersectRayBox(glm::vec3(0, 0, 3), glm::vec3(1, 1, -1), BoxMin, BoxMax, Distance) ? 1 : 0;
+
+	return Error;
+}
+
+static float get_value(int i)
+{
+	return static_cast<float>(static_cast<int>((static_cast<unsigned int>(i) * 2654435761u) % 2001u) - 1000) * 0.002f;
+}
+
+// With SSE2 the packets must report the hits of the scalar functions with the same bits. Without it x87
+// keeps intermediates in extended precision and rounds them wherever they are spilled, so the scalar
+// functions themselves give different bits depending on where they are inlined
+template<glm::length_t L>
+static bool same_result(glm::vec<L, float> const& Out, glm::vec<L, float> const& Ref)
+{
+#	if GLM_ARCH & GLM_ARCH_SSE2_BIT
+		return std::memcmp(&Out, &Ref, sizeof(Out)) == 0;
+#	else
+		return glm::all(glm::epsilonEqual(Out, Ref, glm::max(glm::vec<L, float>(1), glm::abs(Ref)) * (std::numeric_limits<float>::epsilon() * 4.0f)));
+#	endif
+}
+
+template<glm::length_t W>
+int test_packets()
+{
+	int Error = 0;
+
+	unsigned int const Masks[] = {~0u, GLM_SIMD_SSE2, 0u};
+
+	for(int Seed = 0; Seed < 64; ++Seed)
+	{
+		float Orig[3][W], Dir[3][W], Vert0[3][W], Vert1[3][W], Vert2[3][W];
+		for(int a = 0; a < 3; ++a)
+		for(glm::length_t i = 0; i < W; ++i)
+		{
+			int const Index = ((Seed * W + i) * 3 + a) * 5;
+			Orig[a][i] = get_value(Index + 0) + (a == 2 ? 3.0f : 0.0f);
+			Dir[a][i] = get_value(Index + 1) * 0.5f - (a == 2 ? 1.0f : 0.0f);
+			Vert0[a][i] = get_value(Index + 2);
+			Vert1[a][i] = get_value(Index + 3);
+			Vert2[a][i] = get_value(Index + 4);
+		}
+		// Make some rays axis aligned and some triangles degenerate
+		Dir[0][0] = Dir[1][0] = 0.0f;
+		Vert2[0][1] = Vert1[0][1];
+		Vert2[1][1] = Vert1[1][1];
+		Vert2[2][1] = Vert1[2][1];
+
+		glm::vec3 const RayOrig(Orig[0][0], Orig[1][0], Orig[2][0]);
+		glm::vec3 const RayDir(Dir[0][0], Dir[1][0], Dir[2][0]);
+		glm::vec3 const TriVert0(Vert0[0][2], Vert0[1][2], Vert0[2][2]);
+		glm::vec3 const TriVert1(Vert1[0][2], Vert1[1][2], Vert1[2][2]);
+		glm::vec3 const TriVert2(Vert2[0][2], Vert2[1][2], Vert2[2][2]);
+
+		for(std::size_t m = 0; m < sizeof(Masks) / sizeof(Masks[0]); ++m)
+		{
+			glm_simd_feature_mask() = Masks[m];
+
+			float Bary[2][W], Distance[W];
+
+			int const TrianglesMask = glm::intersectRayTriangles(RayOrig, RayDir, Vert0, Vert1, Vert2, Bary, Distance);
+			for(glm::length_t i = 0; i < W; ++i)
+			{
+				glm::vec2 RefBary(0);
+				float RefDistance = 0;
+				bool const Hit = glm::intersectRayTriangle(RayOrig, RayDir,
+					glm::vec3(Vert0[0][i], Vert0[1][i], Vert0[2][i]), glm::vec3(Vert1[0][i], Vert1[1][i], Vert1[2][i]), glm::vec3(Vert2[0][i], Vert2[1][i], Vert2[2][i]),
+					RefBary, RefDistance);
+				Error += Hit == ((TrianglesMask >> i) & 1) ? 0 : 1;
+				if(Hit)
+				{
+					glm::vec3 const Out(Bary[0][i], Bary[1][i], Distance[i]);
+					glm::vec3 const Ref(RefBary, RefDistance);
+					Error += same_result(Out, Ref) ? 0 : 1;
+				}
+			}
+
+			int const RaysMask = glm::intersectRaysTriangle(Orig, Dir, TriVert0, TriVert1, TriVert2, Bary, Distance);
+			for(glm::length_t i = 0; i < W; ++i)
+			{
+				glm::vec2 RefBary(0);
+				float RefDistance = 0;
+				bool const Hit = glm::intersectRayTriangle(glm::vec3(Orig[0][i], Orig[1][i], Orig[2][i]), glm::vec3(Dir[0][i], Dir[1][i], Dir[2][i]),
+					TriVert0, TriVert1, TriVert2, RefBary, RefDistance);
+				Error += Hit == ((RaysMask >> i) & 1) ? 0 : 1;
+				if(Hit)
+				{
+					glm::vec3 const Out(Bary[0][i], Bary[1][i], Distance[i]);
+					glm::vec3 const Ref(RefBary, RefDistance);
+					Error += same_result(Out, Ref) ? 0 : 1;
+				}
+			}
+
+			// Boxes around the triangles, so that about half of them are hit
+			float BoxMin[3][W], BoxMax[3][W];
+			for(int a = 0; a < 3; ++a)
+			for(glm::length_t i = 0; i < W; ++i)
+			{
+				BoxMin[a][i] = glm::min(Vert0[a][i], Vert1[a][i]);
+				BoxMax[a][i] = glm::max(Vert0[a][i], Vert1[a][i]);
+			}
+
+			int const BoxesMask = glm::intersectRayBoxes(RayOrig, RayDir, BoxMin, BoxMax, Distance);
+			for(glm::length_t i = 0; i < W; ++i)
+			{
+				float RefDistance = 0;
+				bool const Hit = glm::intersectRayBox(RayOrig, RayDir, glm::vec3(BoxMin[0][i], BoxMin[1][i], BoxMin[2][i]), glm::vec3(BoxMax[0][i], BoxMax[1][i], BoxMax[2][i]), RefDistance);
+				Error += Hit == ((BoxesMask >> i) & 1) ? 0 : 1;
+				if(Hit)
+					Error += same_result(glm::vec1(Distance[i]), glm::vec1(RefDistance)) ? 0 : 1;
+			}
+
+			glm::vec3 const Box0(BoxMin[0][2], BoxMin[1][2], BoxMin[2][2]);
+			glm::vec3 const Box1(BoxMax[0][2], BoxMax[1][2], BoxMax[2][2]);
+			int const RaysBoxMask = glm::intersectRaysBox(Orig, Dir, Box0, Box1, Distance);
+			for(glm::length_t i = 0; i < W; ++i)
+			{
+				float RefDistance = 0;
+				bool const Hit = glm::intersectRayBox(glm::vec3(Orig[0][i], Orig[1][i], Orig[2][i]), glm::vec3(Dir[0][i], Dir[1][i], Dir[2][i]), Box0, Box1, RefDistance);
+				Error += Hit == ((RaysBoxMask >> i) & 1) ? 0 : 1;
+				if(Hit)
+					Error += same_result(glm::vec1(Distance[i]), glm::vec1(RefDistance)) ? 0 : 1;
+			}
+		}
+		glm_simd_feature_mask() = ~0u;
+	}
+
+	return Error;
+}
+
 int main()
 {
 	int Error = 0;
 
 	Error += test_intersectRayTriangle();
 	Error += test_intersectLineTriangle();
+	Error += test_intersectRayBox();
+	Error += test_packets<4>();
+	Error += test_packets<8>();
 
 	return Error;
 }
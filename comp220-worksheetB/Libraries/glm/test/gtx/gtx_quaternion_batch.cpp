@@ -0,0 +1,120 @@
+#define GLM_ENABLE_EXPERIMENTAL
+#include <glm/gtx/quaternion_batch.hpp>
+#include <glm/ext/quaternion_relational.hpp>
+#include <vector>
+
+// Masks selecting each code path, the widest first and 0 for the scalar fallback
+// Paths the CPU doesn't have fall through to the next narrower one
+static std::vector<unsigned int> get_feature_masks()
+{
+	std::vector<unsigned int> Masks;
+	Masks.push_back(~0u);
+	Masks.push_back(GLM_SIMD_SSE2);
+	Masks.push_back(0u);
+	return Masks;
+}
+
+// Pairs with cosTheta of both signs, equal and nearly equal pairs for the linear interpolation path
+static void get_pairs(std::size_t Count, std::vector<glm::quat>& X, std::vector<glm::quat>& Y, std::vector<float>& A)
+{
+	X.resize(Count);
+	Y.resize(Count);
+	A.resize(Count);
+	for(std::size_t i = 0; i < Count; ++i)
+	{
+		float const f = static_cast<float>(i);
+		X[i] = glm::angleAxis(f * 0.37f, glm::normalize(glm::vec3(1.0f, f * 0.1f, -2.0f)));
+		switch(i % 4)
+		{
+		default:
+			Y[i] = glm::angleAxis(f * -0.61f + 1.0f, glm::normalize(glm::vec3(f * 0.2f, 3.0f, 1.0f)));
+			break;
+		case 1:
+			Y[i] = -glm::angleAxis(f * 0.29f, glm::normalize(glm::vec3(-1.0f, 1.0f, f * 0.3f)));
+			break;
+		case 2:
+			Y[i] = X[i];
+			break;
+		case 3:
+			Y[i] = glm::normalize(X[i] + glm::quat(0.0f, 0.0f, 1e-5f, 0.0f));
+			break;
+		}
+		A[i] = static_cast<float>(i % 9) / 8.0f;
+	}
+}
+
+// Every count up to a few blocks of the widest kernel, so each tail length is covered
+static int test_slerp()
+{
+	int Error = 0;
+
+	std::vector<unsigned int> const Masks = get_feature_masks();
+	for(std::size_t m = 0; m < Masks.size(); ++m)
+	{
+		glm_simd_feature_mask() = Masks[m];
+		for(std::size_t Count = 0; Count < 40; ++Count)
+		{
+			std::vector<glm::quat> X, Y, Out(Count);
+			std::vector<float> A;
+			get_pairs(Count, X, Y, A);
+			if(Count > 0)
+				glm::slerp(&X[0], &Y[0], &A[0], &Out[0], Count);
+
+			for(std::size_t i = 0; i < Count; ++i)
+				Error += glm::all(glm::equal(Out[i], glm::slerp(X[i], Y[i], A[i]), 0.00001f)) ? 0 : 1;
+		}
+	}
+	glm_simd_feature_mask() = ~0u;
+
+	return Error;
+}
+
+static int test_slerp_in_place()
+{
+	int Error = 0;
+
+	std::vector<glm::quat> X, Y;
+	std::vector<float> A;
+	get_pairs(100, X, Y, A);
+	std::vector<glm::quat> Out(X);
+	glm::slerp(&Out[0], &Y[0], &A[0], &Out[0], Out.size());
+
+	for(std::size_t i = 0; i < X.size(); ++i)
+		Error += glm::all(glm::equal(Out[i], glm::slerp(X[i], Y[i], A[i]), 0.00001f)) ? 0 : 1;
+
+	return Error;
+}
+
+static int test_slerp_bounds()
+{
+	int Error = 0;
+
+	std::vector<glm::quat> X, Y;
+	std::vector<float> A;
+	get_pairs(64, X, Y, A);
+	std::vector<float> const Zero(X.size(), 0.0f), One(X.size(), 1.0f);
+	std::vector<glm::quat> Out0(X.size()), Out1(X.size());
+	glm::slerp(&X[0], &Y[0], &Zero[0], &Out0[0], X.size());
+	glm::slerp(&X[0], &Y[0], &One[0], &Out1[0], X.size());
+
+	// The results stay unit quaternions and end on X and Y, or -Y for the short path
+	for(std::size_t i = 0; i < X.size(); ++i)
+	{
+		glm::quat const End = glm::dot(X[i], Y[i]) < 0.0f ? -Y[i] : Y[i];
+		Error += glm::all(glm::equal(Out0[i], X[i], 0.00001f)) ? 0 : 1;
+		Error += glm::all(glm::equal(Out1[i], End, 0.00001f)) ? 0 : 1;
+	}
+
+	return Error;
+}
+
+int main()
+{
+	int Error = 0;
+
+	Error += test_slerp();
+	Error += test_slerp_in_place();
+	Error += test_slerp_bounds();
+
+	return Error;
+}
@@ -0,0 +1,189 @@
+#define GLM_ENABLE_EXPERIMENTAL
+#include <glm/gtx/transform_batch.hpp>
+#include <glm/ext/matrix_transform.hpp>
+#include <glm/ext/matrix_relational.hpp>
+#include <glm/ext/vector_relational.hpp>
+#include <vector>
+
+// Masks selecting each code path, the widest first and 0 for the scalar fallback
+// Paths the CPU doesn't have fall through to the next narrower one
+static std::vector<unsigned int> get_feature_masks()
+{
+	std::vector<unsigned int> Masks;
+	Masks.push_back(~0u);
+	Masks.push_back(GLM_SIMD_SSE2 | GLM_SIMD_SSE41 | GLM_SIMD_AVX | GLM_SIMD_AVX2);
+	Masks.push_back(GLM_SIMD_SSE2);
+	Masks.push_back(0u);
+	return Masks;
+}
+
+static glm::mat4 get_transform()
+{
+	glm::mat4 M = glm::translate(glm::mat4(1.0f), glm::vec3(1.0f, -2.0f, 3.0f));
+	M = glm::rotate(M, 0.7f, glm::normalize(glm::vec3(1.0f, 2.0f, 3.0f)));
+	return glm::scale(M, glm::vec3(2.0f, 0.5f, 1.5f));
+}
+
+static std::vector<glm::vec3> get_points(std::size_t Count)
+{
+	std::vector<glm::vec3> Points(Count);
+	for(std::size_t i = 0; i < Count; ++i)
+		Points[i] = glm::vec3(static_cast<float>(i) * 0.25f, static_cast<float>(i % 7) - 3.0f, 1.0f - static_cast<float>(i % 13) * 0.5f);
+	return Points;
+}
+
+// Every count up to a few blocks of the widest kernel, so each tail length is covered
+static int test_aos()
+{
+	int Error = 0;
+
+	glm::mat4 const M = get_transform();
+	std::vector<unsigned int> const Masks = get_feature_masks();
+	for(std::size_t m = 0; m < Masks.size(); ++m)
+	{
+		glm_simd_feature_mask() = Masks[m];
+		for(std::size_t Count = 0; Count < 70; ++Count)
+		{
+			std::vector<glm::vec3> const In = get_points(Count);
+			std::vector<glm::vec3> Points(Count), Directions(Count);
+			if(Count > 0)
+			{
+				glm::transformPoints(M, &In[0], &Points[0], Count);
+				glm::transformDirections(M, &In[0], &Directions[0], Count);
+			}
+
+			for(std::size_t i = 0; i < Count; ++i)
+			{
+				Error += glm::all(glm::equal(Points[i], glm::vec3(M * glm::vec4(In[i], 1.0f)), 0.0001f)) ? 0 : 1;
+				Error += glm::all(glm::equal(Directions[i], glm::vec3(M * glm::vec4(In[i], 0.0f)), 0.0001f)) ? 0 : 1;
+			}
+		}
+	}
+	glm_simd_feature_mask() = ~0u;
+
+	return Error;
+}
+
+static int test_aos_in_place()
+{
+	int Error = 0;
+
+	glm::mat4 const M = get_transform();
+	std::vector<glm::vec3> const In = get_points(100);
+	std::vector<glm::vec3> Points(In);
+	glm::transformPoints(M, &Points[0], &Points[0], Points.size());
+
+	for(std::size_t i = 0; i < In.size(); ++i)
+		Error += glm::all(glm::equal(Points[i], glm::vec3(M * glm::vec4(In[i], 1.0f)), 0.0001f)) ? 0 : 1;
+
+	return Error;
+}
+
+static float* align16(std::vector<float>& Storage)
+{
+	std::size_t const Address = reinterpret_cast<std::size_t>(&Storage[0]);
+	return &Storage[0] + ((16 - Address % 16) % 16) / sizeof(float);
+}
+
+static int test_soa()
+{
+	int Error = 0;
+
+	glm::mat4 const M = get_transform();
+	std::vector<unsigned int> const Masks = get_feature_masks();
+	std::size_t const MaxCount = 70;
+
+	std::vector<float> Storage[6];
+	float* Arrays[6];
+	for(int a = 0; a < 6; ++a)
+	{
+		Storage[a].resize(MaxCount + 4);
+		Arrays[a] = align16(Storage[a]);
+	}
+
+	for(std::size_t m = 0; m < Masks.size(); ++m)
+	{
+		glm_simd_feature_mask() = Masks[m];
+		for(std::size_t Count = 0; Count < MaxCount; ++Count)
+		{
+			std::vector<glm::vec3> const In = get_points(Count);
+			for(std::size_t i = 0; i < Count; ++i)
+			{
+				Arrays[0][i] = In[i].x;
+				Arrays[1][i] = In[i].y;
+				Arrays[2][i] = In[i].z;
+			}
+
+			glm::transformPoints(M, Arrays[0], Arrays[1], Arrays[2], Arrays[3], Arrays[4], Arrays[5], Count);
+			for(std::size_t i = 0; i < Count; ++i)
+				Error += glm::all(glm::equal(glm::vec3(Arrays[3][i], Arrays[4][i], Arrays[5][i]), glm::vec3(M * glm::vec4(In[i], 1.0f)), 0.0001f)) ? 0 : 1;
+
+			// In place
+			glm::transformDirections(M, Arrays[0], Arrays[1], Arrays[2], Arrays[0], Arrays[1], Arrays[2], Count);
+			for(std::size_t i = 0; i < Count; ++i)
+				Error += glm::all(glm::equal(glm::vec3(Arrays[0][i], Arrays[1][i], Arrays[2][i]), glm::vec3(M * glm::vec4(In[i], 0.0f)), 0.0001f)) ? 0 : 1;
+		}
+	}
+	glm_simd_feature_mask() = ~0u;
+
+	return Error;
+}
+
+static int test_matrices()
+{
+	int Error = 0;
+
+	glm::mat4 const M = get_transform();
+	std::vector<unsigned int> const Masks = get_feature_masks();
+	for(std::size_t m = 0; m < Masks.size(); ++m)
+	{
+		glm_simd_feature_mask() = Masks[m];
+
+		std::vector<glm::mat4> In(19), Out(19);
+		for(std::size_t i = 0; i < In.size(); ++i)
+			In[i] = glm::rotate(glm::mat4(static_cast<float>(i) * 0.5f + 1.0f), static_cast<float>(i), glm::vec3(0.0f, 1.0f, 0.0f));
+
+		glm::transformMatrices(M, &In[0], &Out[0], In.size());
+		for(std::size_t i = 0; i < In.size(); ++i)
+			Error += glm::all(glm::equal(Out[i], M * In[i], 0.0001f)) ? 0 : 1;
+
+		glm::transformMatrices(M, &In[0], &In[0], In.size());
+		for(std::size_t i = 0; i < In.size(); ++i)
+			Error += glm::all(glm::equal(In[i], Out[i], 0.0f)) ? 0 : 1;
+	}
+	glm_simd_feature_mask() = ~0u;
+
+	return Error;
+}
+
+static int test_features()
+{
+	int Error = 0;
+
+	unsigned int const Features = glm_simd_features();
+
+	// Every wider instruction set implies the narrower ones the kernels rely on
+	Error += (Features & GLM_SIMD_AVX512F) && !(Features & GLM_SIMD_AVX2) ? 1 : 0;
+	Error += (Features & GLM_SIMD_AVX2) && !(Features & GLM_SIMD_AVX) ? 1 : 0;
+	Error += (Features & GLM_SIMD_F16C) && !(Features & GLM_SIMD_AVX) ? 1 : 0;
+
+	glm_simd_feature_mask() = GLM_SIMD_SSE2;
+	Error += (glm_simd_features() & ~GLM_SIMD_SSE2) == 0 ? 0 : 1;
+	glm_simd_feature_mask() = ~0u;
+	Error += glm_simd_features() == Features ? 0 : 1;
+
+	return Error;
+}
+
+int main()
+{
+	int Error = 0;
+
+	Error += test_features();
+	Error += test_aos();
+	Error += test_aos_in_place();
+	Error += test_soa();
+	Error += test_matrices();
+
+	return Error;
+}
@@ -0,0 +1,264 @@
+#define GLM_FORCE_INLINE
+#define GLM_ENABLE_EXPERIMENTAL
+#include <glm/gtx/intersect.hpp>
+#include <glm/gtc/constants.hpp>
+#include <vector>
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+
+typedef std::chrono::high_resolution_clock::time_point time_point;
+
+static struct
+{
+	char const* Name;
+	unsigned int Mask;
+} const CodePaths[] =
+{
+	{"Scalar", 0u},
+	{"SSE2", GLM_SIMD_SSE2},
+	{"AVX", GLM_SIMD_SSE2 | GLM_SIMD_SSE41 | GLM_SIMD_AVX}
+};
+
+static double get_rays_per_second(time_point t1, time_point t2, std::size_t Rays)
+{
+	double const Duration = static_cast<double>(std::chrono::duration_cast<std::chrono::nanoseconds>(t2 - t1).count());
+	return Duration > 0.0 ? static_cast<double>(Rays) * 1e9 / Duration : 0.0;
+}
+
+// Triangles of a bumpy torus, stored W at a time as vertex[axis][triangle]; about the triangle count of a game model
+template<glm::length_t W>
+struct mesh
+{
+	struct packet
+	{
+		float Vert0[3][W];
+		float Vert1[3][W];
+		float Vert2[3][W];
+		float BoxMin[3][W];
+		float BoxMax[3][W];
+	};
+
+	std::vector<packet> Packets;
+};
+
+static glm::vec3 torus(int Ring, int Side, int Rings, int Sides)
+{
+	float const u = static_cast<float>(Ring) * glm::two_pi<float>() / static_cast<float>(Rings);
+	float const v = static_cast<float>(Side) * glm::two_pi<float>() / static_cast<float>(Sides);
+	float const r = 0.4f + 0.03f * glm::sin(u * 7.0f) * glm::cos(v * 5.0f);
+	return glm::vec3((1.0f + r * glm::cos(v)) * glm::cos(u), r * glm::sin(v), (1.0f + r * glm::cos(v)) * glm::sin(u));
+}
+
+template<glm::length_t W>
+static void init_mesh(mesh<W>& Mesh, std::vector<glm::vec3>& Triangles, int Rings, int Sides)
+{
+	Triangles.clear();
+	for(int i = 0; i < Rings; ++i)
+	for(int j = 0; j < Sides; ++j)
+	{
+		glm::vec3 const A = torus(i, j, Rings, Sides);
+		glm::vec3 const B = torus(i + 1, j, Rings, Sides);
+		glm::vec3 const C = torus(i + 1, j + 1, Rings, Sides);
+		glm::vec3 const D = torus(i, j + 1, Rings, Sides);
+		Triangles.push_back(A); Triangles.push_back(B); Triangles.push_back(C);
+		Triangles.push_back(A); Triangles.push_back(C); Triangles.push_back(D);
+	}
+
+	std::size_t const Count = Triangles.size() / 3;
+	Mesh.Packets.resize((Count + W - 1) / W);
+	std::memset(&Mesh.Packets[0], 0, sizeof(typename mesh<W>::packet) * Mesh.Packets.size());
+	for(std::size_t t = 0; t < Count; ++t)
+	{
+		typename mesh<W>::packet& Packet = Mesh.Packets[t / W];
+		std::size_t const i = t % W;
+		for(int a = 0; a < 3; ++a)
+		{
+			Packet.Vert0[a][i] = Triangles[t * 3 + 0][a];
+			Packet.Vert1[a][i] = Triangles[t * 3 + 1][a];
+			Packet.Vert2[a][i] = Triangles[t * 3 + 2][a];
+			Packet.BoxMin[a][i] = glm::min(glm::min(Packet.Vert0[a][i], Packet.Vert1[a][i]), Packet.Vert2[a][i]);
+			Packet.BoxMax[a][i] = glm::max(glm::max(Packet.Vert0[a][i], Packet.Vert1[a][i]), Packet.Vert2[a][i]);
+		}
+	}
+}
+
+// Rays of a camera looking at the mesh, half of them miss it
+static void init_rays(std::vector<glm::vec3>& Orig, std::vector<glm::vec3>& Dir, int Size)
+{
+	Orig.clear();
+	Dir.clear();
+	for(int y = 0; y < Size; ++y)
+	for(int x = 0; x < Size; ++x)
+	{
+		glm::vec3 const Target(static_cast<float>(x) / static_cast<float>(Size) * 3.2f - 1.6f, static_cast<float>(y) / static_cast<float>(Size) * 2.0f - 1.0f, 0.0f);
+		Orig.push_back(glm::vec3(0.0f, 1.5f, 4.0f));
+		Dir.push_back(glm::normalize(Target - Orig.back()));
+	}
+}
+
+// Closest hit in front of the ray, 0 for a miss
+template<glm::length_t W>
+static float closest_hit(mesh<W> const& Mesh, glm::vec3 const& Orig, glm::vec3 const& Dir)
+{
+	float Closest = 0.0f;
+	for(std::size_t p = 0; p < Mesh.Packets.size(); ++p)
+	{
+		typename mesh<W>::packet const& Packet = Mesh.Packets[p];
+		float Bary[2][W], Distance[W];
+		int const Mask = glm::intersectRayTriangles(Orig, Dir, Packet.Vert0, Packet.Vert1, Packet.Vert2, Bary, Distance);
+		for(glm::length_t i = 0; i < W; ++i)
+			if(((Mask >> i) & 1) && Distance[i] > 0.0f && (Closest == 0.0f || Distance[i] < Closest))
+				Closest = Distance[i];
+	}
+	return Closest;
+}
+
+// Prints the rays traced per second on every code path, returns the number of closest hits different from the scalar ones
+template<glm::length_t W>
+static int perf_ray_triangles(mesh<W> const& Mesh, std::vector<glm::vec3> const& Orig, std::vector<glm::vec3> const& Dir)
+{
+	int Error = 0;
+
+	std::size_t const Count = Orig.size();
+	std::vector<float> Reference(Count), Closest(Count);
+
+	glm_simd_feature_mask() = 0u;
+	for(std::size_t r = 0; r < Count; ++r)
+		Reference[r] = closest_hit(Mesh, Orig[r], Dir[r]);
+
+	printf("intersectRayTriangles, %d triangles per packet:\n", static_cast<int>(W));
+	for(std::size_t c = 0; c < sizeof(CodePaths) / sizeof(CodePaths[0]); ++c)
+	{
+		if(!glm_simd_has_features(CodePaths[c].Mask))
+			continue;
+		glm_simd_feature_mask() = CodePaths[c].Mask;
+
+		time_point const t1 = std::chrono::high_resolution_clock::now();
+		for(std::size_t r = 0; r < Count; ++r)
+			Closest[r] = closest_hit(Mesh, Orig[r], Dir[r]);
+		time_point const t2 = std::chrono::high_resolution_clock::now();
+
+		printf("- %s: %.0f rays/s\n", CodePaths[c].Name, get_rays_per_second(t1, t2, Count));
+
+		Error += std::memcmp(&Closest[0], &Reference[0], sizeof(float) * Count) == 0 ? 0 : 1;
+	}
+	glm_simd_feature_mask() = ~0u;
+
+	return Error;
+}
+
+// Packets of W coherent rays against every triangle
+template<glm::length_t W>
+static int perf_rays_triangle(std::vector<glm::vec3> const& Triangles, std::vector<glm::vec3> const& Orig, std::vector<glm::vec3> const& Dir)
+{
+	int Error = 0;
+
+	std::size_t const Count = Orig.size() / W * W;
+	std::vector<float> Reference(Count), Closest(Count);
+
+	printf("intersectRaysTriangle, %d rays per packet:\n", static_cast<int>(W));
+	for(std::size_t c = 0; c < sizeof(CodePaths) / sizeof(CodePaths[0]); ++c)
+	{
+		if(!glm_simd_has_features(CodePaths[c].Mask))
+			continue;
+		glm_simd_feature_mask() = CodePaths[c].Mask;
+
+		time_point const t1 = std::chrono::high_resolution_clock::now();
+		for(std::size_t r = 0; r < Count; r += W)
+		{
+			float RayOrig[3][W], RayDir[3][W];
+			for(glm::length_t i = 0; i < W; ++i)
+			for(int a = 0; a < 3; ++a)
+			{
+				RayOrig[a][i] = Orig[r + i][a];
+				RayDir[a][i] = Dir[r + i][a];
+			}
+
+			for(glm::length_t i = 0; i < W; ++i)
+				Closest[r + i] = 0.0f;
+			for(std::size_t t = 0; t < Triangles.size(); t += 3)
+			{
+				float Bary[2][W], Distance[W];
+				int const Mask = glm::intersectRaysTriangle(RayOrig, RayDir, Triangles[t + 0], Triangles[t + 1], Triangles[t + 2], Bary, Distance);
+				for(glm::length_t i = 0; i < W; ++i)
+					if(((Mask >> i) & 1) && Distance[i] > 0.0f && (Closest[r + i] == 0.0f || Distance[i] < Closest[r + i]))
+						Closest[r + i] = Distance[i];
+			}
+		}
+		time_point const t2 = std::chrono::high_resolution_clock::now();
+
+		printf("- %s: %.0f rays/s\n", CodePaths[c].Name, get_rays_per_second(t1, t2, Count));
+
+		if(c == 0)
+			Reference = Closest;
+		Error += std::memcmp(&Closest[0], &Reference[0], sizeof(float) * Count) == 0 ? 0 : 1;
+	}
+	glm_simd_feature_mask() = ~0u;
+
+	return Error;
+}
+
+// The bounding boxes of the triangles, as the leaves of a bounding volume hierarchy
+template<glm::length_t W>
+static int perf_ray_boxes(mesh<W> const& Mesh, std::vector<glm::vec3> const& Orig, std::vector<glm::vec3> const& Dir)
+{
+	int Error = 0;
+
+	std::size_t const Count = Orig.size();
+	std::vector<int> Reference(Count), Hits(Count);
+
+	printf("intersectRayBoxes, %d boxes per packet:\n", static_cast<int>(W));
+	for(std::size_t c = 0; c < sizeof(CodePaths) / sizeof(CodePaths[0]); ++c)
+	{
+		if(!glm_simd_has_features(CodePaths[c].Mask))
+			continue;
+		glm_simd_feature_mask() = CodePaths[c].Mask;
+
+		time_point const t1 = std::chrono::high_resolution_clock::now();
+		for(std::size_t r = 0; r < Count; ++r)
+		{
+			Hits[r] = 0;
+			for(std::size_t p = 0; p < Mesh.Packets.size(); ++p)
+			{
+				float Distance[W];
+				int const Mask = glm::intersectRayBoxes(Orig[r], Dir[r], Mesh.Packets[p].BoxMin, Mesh.Packets[p].BoxMax, Distance);
+				for(glm::length_t i = 0; i < W; ++i)
+					Hits[r] += (Mask >> i) & 1;
+			}
+		}
+		time_point const t2 = std::chrono::high_resolution_clock::now();
+
+		printf("- %s: %.0f rays/s\n", CodePaths[c].Name, get_rays_per_second(t1, t2, Count));
+
+		if(c == 0)
+			Reference = Hits;
+		Error += Hits == Reference ? 0 : 1;
+	}
+	glm_simd_feature_mask() = ~0u;
+
+	return Error;
+}
+
+int main()
+{
+	int Error = 0;
+
+	std::vector<glm::vec3> Orig, Dir, Triangles;
+	init_rays(Orig, Dir, 48);
+
+	mesh<4> Mesh4;
+	mesh<8> Mesh8;
+	init_mesh(Mesh4, Triangles, 64, 40);
+	init_mesh(Mesh8, Triangles, 64, 40);
+	printf("%d triangles, %d rays\n", static_cast<int>(Triangles.size() / 3), static_cast<int>(Orig.size()));
+
+	Error += perf_ray_triangles(Mesh4, Orig, Dir);
+	Error += perf_ray_triangles(Mesh8, Orig, Dir);
+	Error += perf_rays_triangle<4>(Triangles, Orig, Dir);
+	Error += perf_rays_triangle<8>(Triangles, Orig, Dir);
+	Error += perf_ray_boxes(Mesh4, Orig, Dir);
+	Error += perf_ray_boxes(Mesh8, Orig, Dir);
+
+	return Error;
+}
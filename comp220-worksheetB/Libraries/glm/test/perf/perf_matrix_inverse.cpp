@@ -1,5 +1,6 @@
 #define GLM_FORCE_INLINE
 #include <glm/matrix.hpp>
+#include <glm/common.hpp>
 #include <glm/ext/matrix_float4x4.hpp>
 #include <glm/ext/matrix_double4x4.hpp>
 #include <glm/ext/matrix_relational.hpp>
@@ -113,6 +114,51 @@ static int comp_mat4_inverse(std::size_t Samples)
 	return Error;
 }
 
+template <typename matType>
+static int launch_mat_determinant(std::vector<typename matType::value_type>& O, matType const& Scale, std::size_t Samples)
+{
+	typedef typename matType::value_type T;
+
+	std::vector<matType> I(Samples);
+	O.resize(Samples);
+
+	for(std::size_t i = 0; i < Samples; ++i)
+		I[i] = Scale * static_cast<T>(i) + Scale;
+
+	std::chrono::high_resolution_clock::time_point t1 = std::chrono::high_resolution_clock::now();
+	for(std::size_t i = 0; i < Samples; ++i)
+		O[i] = glm::determinant(I[i]);
+	std::chrono::high_resolution_clock::time_point t2 = std::chrono::high_resolution_clock::now();
+
+	return static_cast<int>(std::chrono::duration_cast<std::chrono::microseconds>(t2 - t1).count());
+}
+
+template <typename packedMatType, typename alignedMatType>
+static int comp_mat4_determinant(std::size_t Samples)
+{
+	typedef typename packedMatType::value_type T;
+
+	int Error = 0;
+
+	packedMatType const Scale(0.01, 0.02, 0.05, 0.04, 0.02, 0.08, 0.05, 0.01, 0.08, 0.03, 0.05, 0.06, 0.02, 0.03, 0.07, 0.05);
+
+	std::vector<T> SISD;
+	printf("- SISD: %d us\n", launch_mat_determinant<packedMatType>(SISD, Scale, Samples));
+
+	std::vector<T> SIMD;
+	printf("- SIMD: %d us\n", launch_mat_determinant<alignedMatType>(SIMD, Scale, Samples));
+
+	for(std::size_t i = 0; i < Samples; ++i)
+	{
+		// The determinant grows with the fourth power of the samples, compare relatively
+		T const Tolerance = glm::max(glm::abs(SISD[i]), static_cast<T>(1)) * static_cast<T>(0.001);
+		Error += glm::abs(SISD[i] - SIMD[i]) <= Tolerance ? 0 : 1;
+		assert(!Error);
+	}
+
+	return Error;
+}
+
 int main()
 {
 	std::size_t const Samples = 100000;
@@ -137,6 +183,12 @@ int main()
 	printf("glm::inverse(dmat4):\n");
 	Error += comp_mat4_inverse<glm::dmat4, glm::aligned_dmat4>(Samples);
 
+	printf("glm::determinant(mat4):\n");
+	Error += comp_mat4_determinant<glm::mat4, glm::aligned_mat4>(Samples);
+
+	printf("glm::determinant(dmat4):\n");
+	Error += comp_mat4_determinant<glm::dmat4, glm::aligned_dmat4>(Samples);
+
 	return Error;
 }
 
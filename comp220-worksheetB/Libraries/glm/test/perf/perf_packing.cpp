@@ -0,0 +1,105 @@
+#define GLM_FORCE_INLINE
+#include <glm/gtc/packing.hpp>
+#include <vector>
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+
+typedef std::chrono::high_resolution_clock::time_point time_point;
+
+static struct
+{
+	char const* Name;
+	unsigned int Mask;
+} const CodePaths[] =
+{
+	{"Scalar", 0u},
+	{"SSE2", GLM_SIMD_SSE2},
+	{"AVX2", GLM_SIMD_SSE2 | GLM_SIMD_SSE41 | GLM_SIMD_AVX | GLM_SIMD_AVX2 | GLM_SIMD_F16C}
+};
+
+static float get_value(std::size_t i)
+{
+	return static_cast<float>(static_cast<int>((i * 2654435761u) % 4001u) - 2000) * 0.0007f;
+}
+
+// Prints the bytes read and written per nanosecond on every code path, returns the number of results different from the scalar ones
+template<typename inType, typename outType>
+static int perf_array(char const* Name, void (*Function)(inType const*, outType*, std::size_t), std::vector<inType> const& In, std::vector<outType>& Out, std::size_t Repeat)
+{
+	int Error = 0;
+
+	std::size_t const Count = In.size();
+	std::vector<outType> Reference(Count);
+	Out.resize(Count);
+
+	glm_simd_feature_mask() = 0u;
+	Function(&In[0], &Reference[0], Count);
+
+	printf("%s:\n", Name);
+	for(std::size_t p = 0; p < sizeof(CodePaths) / sizeof(CodePaths[0]); ++p)
+	{
+		if(!glm_simd_has_features(CodePaths[p].Mask))
+			continue;
+		glm_simd_feature_mask() = CodePaths[p].Mask;
+
+		time_point const t1 = std::chrono::high_resolution_clock::now();
+		for(std::size_t r = 0; r < Repeat; ++r)
+			Function(&In[0], &Out[0], Count);
+		time_point const t2 = std::chrono::high_resolution_clock::now();
+
+		double const Duration = static_cast<double>(std::chrono::duration_cast<std::chrono::nanoseconds>(t2 - t1).count());
+		double const Bytes = static_cast<double>((sizeof(inType) + sizeof(outType)) * Count * Repeat);
+		printf("- %s: %.2f GB/s\n", CodePaths[p].Name, Duration > 0.0 ? Bytes / Duration : 0.0);
+
+		Error += std::memcmp(&Out[0], &Reference[0], sizeof(outType) * Count) == 0 ? 0 : 1;
+	}
+	glm_simd_feature_mask() = ~0u;
+
+	return Error;
+}
+
+int main()
+{
+	std::size_t const Count = 1 << 20;
+	std::size_t const Repeat = 10;
+
+	int Error = 0;
+
+	// Texture coordinates and colors of a vertex stream, normals in [-1, 1]
+	std::vector<float> Floats(Count);
+	std::vector<glm::vec4> Vec4s(Count);
+	for(std::size_t i = 0; i < Count; ++i)
+	{
+		Floats[i] = get_value(i) * 100.0f;
+		Vec4s[i] = glm::vec4(get_value(i * 4 + 0), get_value(i * 4 + 1), get_value(i * 4 + 2), get_value(i * 4 + 3));
+	}
+
+	// HDR colors, up to 2^14
+	std::vector<glm::vec3> Colors(Count);
+	for(std::size_t i = 0; i < Count; ++i)
+		Colors[i] = glm::abs(glm::vec3(get_value(i * 3 + 0), get_value(i * 3 + 1), get_value(i * 3 + 2))) * static_cast<float>(1 << (i % 15));
+
+	std::vector<glm::uint16> Halfs;
+	std::vector<glm::uint32> Packed;
+	std::vector<float> UnpackedFloats;
+	std::vector<glm::vec4> UnpackedVec4s;
+	std::vector<glm::vec3> UnpackedVec3s;
+
+	Error += perf_array<float, glm::uint16>("packHalf1x16", glm::packHalf1x16, Floats, Halfs, Repeat);
+	Error += perf_array<glm::uint16, float>("unpackHalf1x16", glm::unpackHalf1x16, Halfs, UnpackedFloats, Repeat);
+
+	Error += perf_array<glm::vec4, glm::uint32>("packUnorm4x8", glm::packUnorm4x8, Vec4s, Packed, Repeat);
+	Error += perf_array<glm::uint32, glm::vec4>("unpackUnorm4x8", glm::unpackUnorm4x8, Packed, UnpackedVec4s, Repeat);
+
+	Error += perf_array<glm::vec4, glm::uint32>("packSnorm3x10_1x2", glm::packSnorm3x10_1x2, Vec4s, Packed, Repeat);
+	Error += perf_array<glm::uint32, glm::vec4>("unpackSnorm3x10_1x2", glm::unpackSnorm3x10_1x2, Packed, UnpackedVec4s, Repeat);
+
+	Error += perf_array<glm::vec3, glm::uint32>("packF2x11_1x10", glm::packF2x11_1x10, Colors, Packed, Repeat);
+	Error += perf_array<glm::uint32, glm::vec3>("unpackF2x11_1x10", glm::unpackF2x11_1x10, Packed, UnpackedVec3s, Repeat);
+
+	Error += perf_array<glm::vec3, glm::uint32>("packF3x9_E1x5", glm::packF3x9_E1x5, Colors, Packed, Repeat);
+	Error += perf_array<glm::uint32, glm::vec3>("unpackF3x9_E1x5", glm::unpackF3x9_E1x5, Packed, UnpackedVec3s, Repeat);
+
+	return Error;
+}
@@ -0,0 +1,231 @@
+#define GLM_FORCE_INLINE
+#define GLM_ENABLE_EXPERIMENTAL
+#include <glm/gtx/quaternion_batch.hpp>
+#include <glm/gtc/quaternion.hpp>
+#include <glm/ext/matrix_relational.hpp>
+#include <glm/ext/quaternion_relational.hpp>
+#include <glm/ext/vector_relational.hpp>
+#if GLM_CONFIG_SIMD == GLM_ENABLE
+#include <glm/gtc/type_aligned.hpp>
+#endif
+#include <vector>
+#include <chrono>
+#include <cstdio>
+
+typedef std::chrono::high_resolution_clock::time_point time_point;
+
+static int get_us(time_point t1, time_point t2)
+{
+	return static_cast<int>(std::chrono::duration_cast<std::chrono::microseconds>(t2 - t1).count());
+}
+
+static glm::quat get_quat(std::size_t i)
+{
+	float const f = static_cast<float>(i);
+	return glm::angleAxis(f * 0.01f, glm::normalize(glm::vec3(1.0f, f * 0.001f, -2.0f)));
+}
+
+template <glm::qualifier Q>
+static void init_samples(std::vector<glm::qua<float, Q> >& X, std::vector<glm::qua<float, Q> >& Y, std::vector<float>& A, std::size_t Samples)
+{
+	X.resize(Samples);
+	Y.resize(Samples);
+	A.resize(Samples);
+	for(std::size_t i = 0; i < Samples; ++i)
+	{
+		X[i] = glm::qua<float, Q>(get_quat(i));
+		Y[i] = glm::qua<float, Q>(get_quat(i * 7 + 3) * -1.0f);
+		A[i] = static_cast<float>(i % 101) / 100.0f;
+	}
+}
+
+// Each launch_* times one function over the samples and returns the duration in microseconds
+template <glm::qualifier Q>
+static int launch_slerp(std::vector<glm::qua<float, Q> >& O, std::size_t Samples)
+{
+	std::vector<glm::qua<float, Q> > X, Y;
+	std::vector<float> A;
+	init_samples(X, Y, A, Samples);
+	O.resize(Samples);
+
+	time_point const t1 = std::chrono::high_resolution_clock::now();
+	for(std::size_t i = 0; i < Samples; ++i)
+		O[i] = glm::slerp(X[i], Y[i], A[i]);
+	time_point const t2 = std::chrono::high_resolution_clock::now();
+
+	return get_us(t1, t2);
+}
+
+template <glm::qualifier Q>
+static int launch_mix(std::vector<glm::qua<float, Q> >& O, std::size_t Samples)
+{
+	std::vector<glm::qua<float, Q> > X, Y;
+	std::vector<float> A;
+	init_samples(X, Y, A, Samples);
+	O.resize(Samples);
+
+	// mix doesn't take the short way, near opposite pairs would divide by sin(angle) close to 0
+	for(std::size_t i = 0; i < Samples; ++i)
+		if(glm::dot(X[i], Y[i]) < 0.0f)
+			Y[i] = -Y[i];
+
+	time_point const t1 = std::chrono::high_resolution_clock::now();
+	for(std::size_t i = 0; i < Samples; ++i)
+		O[i] = glm::mix(X[i], Y[i], A[i]);
+	time_point const t2 = std::chrono::high_resolution_clock::now();
+
+	return get_us(t1, t2);
+}
+
+template <glm::qualifier Q>
+static int launch_normalize(std::vector<glm::qua<float, Q> >& O, std::size_t Samples)
+{
+	std::vector<glm::qua<float, Q> > X, Y;
+	std::vector<float> A;
+	init_samples(X, Y, A, Samples);
+	O.resize(Samples);
+
+	time_point const t1 = std::chrono::high_resolution_clock::now();
+	for(std::size_t i = 0; i < Samples; ++i)
+		O[i] = glm::normalize(X[i] * (A[i] + 1.0f));
+	time_point const t2 = std::chrono::high_resolution_clock::now();
+
+	return get_us(t1, t2);
+}
+
+template <glm::qualifier Q>
+static int launch_mat4_cast(std::vector<glm::mat<4, 4, float, Q> >& O, std::size_t Samples)
+{
+	std::vector<glm::qua<float, Q> > X, Y;
+	std::vector<float> A;
+	init_samples(X, Y, A, Samples);
+	O.resize(Samples);
+
+	time_point const t1 = std::chrono::high_resolution_clock::now();
+	for(std::size_t i = 0; i < Samples; ++i)
+		O[i] = glm::mat4_cast(X[i]);
+	time_point const t2 = std::chrono::high_resolution_clock::now();
+
+	return get_us(t1, t2);
+}
+
+template <glm::qualifier Q>
+static int launch_mul_vec3(std::vector<glm::vec<3, float, Q> >& O, std::size_t Samples)
+{
+	std::vector<glm::qua<float, Q> > X, Y;
+	std::vector<float> A;
+	init_samples(X, Y, A, Samples);
+	O.resize(Samples);
+
+	time_point const t1 = std::chrono::high_resolution_clock::now();
+	for(std::size_t i = 0; i < Samples; ++i)
+		O[i] = X[i] * glm::vec<3, float, Q>(A[i], 1.0f, -2.0f);
+	time_point const t2 = std::chrono::high_resolution_clock::now();
+
+	return get_us(t1, t2);
+}
+
+static int comp_single(std::size_t Samples)
+{
+	int Error = 0;
+
+#	if GLM_CONFIG_SIMD == GLM_ENABLE
+		std::vector<glm::quat> SISD;
+		std::vector<glm::qua<float, glm::aligned_highp> > SIMD;
+
+		printf("slerp:\n");
+		printf("- SISD: %d us\n", launch_slerp(SISD, Samples));
+		printf("- SIMD: %d us\n", launch_slerp(SIMD, Samples));
+		for(std::size_t i = 0; i < Samples; ++i)
+			Error += glm::all(glm::equal(SISD[i], glm::quat(SIMD[i]), 0.00001f)) ? 0 : 1;
+
+		printf("mix:\n");
+		printf("- SISD: %d us\n", launch_mix(SISD, Samples));
+		printf("- SIMD: %d us\n", launch_mix(SIMD, Samples));
+		for(std::size_t i = 0; i < Samples; ++i)
+			Error += glm::all(glm::equal(SISD[i], glm::quat(SIMD[i]), 0.00001f)) ? 0 : 1;
+
+		printf("normalize:\n");
+		printf("- SISD: %d us\n", launch_normalize(SISD, Samples));
+		printf("- SIMD: %d us\n", launch_normalize(SIMD, Samples));
+		for(std::size_t i = 0; i < Samples; ++i)
+			Error += glm::all(glm::equal(SISD[i], glm::quat(SIMD[i]), 0.00001f)) ? 0 : 1;
+
+		std::vector<glm::mat4> SISDMat;
+		std::vector<glm::aligned_mat4> SIMDMat;
+		printf("mat4_cast:\n");
+		printf("- SISD: %d us\n", launch_mat4_cast(SISDMat, Samples));
+		printf("- SIMD: %d us\n", launch_mat4_cast(SIMDMat, Samples));
+		for(std::size_t i = 0; i < Samples; ++i)
+			Error += glm::all(glm::equal(SISDMat[i], glm::mat4(SIMDMat[i]), 0.00001f)) ? 0 : 1;
+
+		std::vector<glm::vec3> SISDVec;
+		std::vector<glm::aligned_vec3> SIMDVec;
+		printf("quat * vec3:\n");
+		printf("- SISD: %d us\n", launch_mul_vec3(SISDVec, Samples));
+		printf("- SIMD: %d us\n", launch_mul_vec3(SIMDVec, Samples));
+		for(std::size_t i = 0; i < Samples; ++i)
+			Error += glm::all(glm::equal(SISDVec[i], glm::vec3(SIMDVec[i]), 0.0001f)) ? 0 : 1;
+#	else
+		static_cast<void>(Samples);
+#	endif
+
+	return Error;
+}
+
+static struct
+{
+	char const* Name;
+	unsigned int Mask;
+} const CodePaths[] =
+{
+	{"Scalar", 0u},
+	{"SSE2", GLM_SIMD_SSE2},
+	{"AVX2", GLM_SIMD_SSE2 | GLM_SIMD_SSE41 | GLM_SIMD_AVX | GLM_SIMD_AVX2}
+};
+
+static int perf_batch_slerp(std::size_t Samples, std::size_t Repeat)
+{
+	int Error = 0;
+
+	std::vector<glm::quat> X, Y, Out(Samples), Reference(Samples);
+	std::vector<float> A;
+	init_samples(X, Y, A, Samples);
+
+	for(std::size_t i = 0; i < Samples; ++i)
+		Reference[i] = glm::slerp(X[i], Y[i], A[i]);
+
+	printf("slerp, arrays of pairs:\n");
+	for(std::size_t p = 0; p < sizeof(CodePaths) / sizeof(CodePaths[0]); ++p)
+	{
+		if(!glm_simd_has_features(CodePaths[p].Mask))
+			continue;
+		glm_simd_feature_mask() = CodePaths[p].Mask;
+
+		time_point const t1 = std::chrono::high_resolution_clock::now();
+		for(std::size_t r = 0; r < Repeat; ++r)
+			glm::slerp(&X[0], &Y[0], &A[0], &Out[0], Samples);
+		time_point const t2 = std::chrono::high_resolution_clock::now();
+
+		double const Duration = static_cast<double>(std::chrono::duration_cast<std::chrono::nanoseconds>(t2 - t1).count());
+		printf("- %s: %.3f quaternions/ns\n", CodePaths[p].Name, Duration > 0.0 ? static_cast<double>(Samples * Repeat) / Duration : 0.0);
+
+		for(std::size_t i = 0; i < Samples; ++i)
+			Error += glm::all(glm::equal(Out[i], Reference[i], 0.00001f)) ? 0 : 1;
+	}
+	glm_simd_feature_mask() = ~0u;
+
+	return Error;
+}
+
+int main()
+{
+	std::size_t const Samples = 100000;
+
+	int Error = 0;
+
+	Error += comp_single(Samples);
+	Error += perf_batch_slerp(Samples, 10);
+
+	return Error;
+}
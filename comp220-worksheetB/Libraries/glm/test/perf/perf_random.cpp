@@ -0,0 +1,108 @@
+#define GLM_FORCE_INLINE
+#include <glm/gtc/random.hpp>
+#include <glm/ext/scalar_relational.hpp>
+#include <glm/vec3.hpp>
+#include <glm/geometric.hpp>
+#include <vector>
+#include <chrono>
+#include <cstdio>
+
+typedef std::chrono::high_resolution_clock::time_point time_point;
+
+static struct
+{
+	char const* Name;
+	unsigned int Mask;
+} const CodePaths[] =
+{
+	{"Scalar", 0u},
+	{"SSE2", GLM_SIMD_SSE2},
+	{"AVX2", GLM_SIMD_SSE2 | GLM_SIMD_SSE41 | GLM_SIMD_AVX | GLM_SIMD_AVX2}
+};
+
+static double get_rate(time_point t1, time_point t2, std::size_t Count)
+{
+	double const Duration = static_cast<double>(std::chrono::duration_cast<std::chrono::nanoseconds>(t2 - t1).count());
+	return Duration > 0.0 ? static_cast<double>(Count) / Duration : 0.0;
+}
+
+static int perf_std_rand(std::size_t Samples)
+{
+	std::vector<float> Out(Samples);
+
+	time_point const t1 = std::chrono::high_resolution_clock::now();
+	for(std::size_t i = 0; i < Samples; ++i)
+		Out[i] = glm::linearRand(0.0f, 1.0f);
+	time_point const t2 = std::chrono::high_resolution_clock::now();
+
+	printf("linearRand, std::rand: %.3f numbers/ns\n", get_rate(t1, t2, Samples));
+
+	int Error = 0;
+	for(std::size_t i = 0; i < Samples; ++i)
+		Error += Out[i] >= 0.0f && Out[i] <= 1.0f ? 0 : 1;
+	return Error;
+}
+
+static int perf_philox(std::size_t Samples, std::size_t Repeat)
+{
+	int Error = 0;
+
+	std::vector<float> Linear(Samples), Gauss(Samples);
+	std::vector<glm::vec3> Spherical(Samples);
+
+	{
+		glm::philox4x32 Engine(1);
+		time_point const t1 = std::chrono::high_resolution_clock::now();
+		for(std::size_t r = 0; r < Repeat; ++r)
+		for(std::size_t i = 0; i < Samples; ++i)
+			Linear[i] = glm::linearRand(Engine, 0.0f, 1.0f);
+		time_point const t2 = std::chrono::high_resolution_clock::now();
+		printf("linearRand, philox4x32 one by one: %.3f numbers/ns\n", get_rate(t1, t2, Samples * Repeat));
+	}
+
+	for(std::size_t p = 0; p < sizeof(CodePaths) / sizeof(CodePaths[0]); ++p)
+	{
+		if(!glm_simd_has_features(CodePaths[p].Mask))
+			continue;
+		glm_simd_feature_mask() = CodePaths[p].Mask;
+		printf("%s:\n", CodePaths[p].Name);
+
+		glm::philox4x32 Engine(1);
+
+		time_point const t1 = std::chrono::high_resolution_clock::now();
+		for(std::size_t r = 0; r < Repeat; ++r)
+			glm::linearRand(Engine, 0.0f, 1.0f, &Linear[0], Samples);
+		time_point const t2 = std::chrono::high_resolution_clock::now();
+		for(std::size_t r = 0; r < Repeat; ++r)
+			glm::gaussRand(Engine, 0.0f, 1.0f, &Gauss[0], Samples);
+		time_point const t3 = std::chrono::high_resolution_clock::now();
+		for(std::size_t r = 0; r < Repeat; ++r)
+			glm::sphericalRand(Engine, 1.0f, &Spherical[0], Samples);
+		time_point const t4 = std::chrono::high_resolution_clock::now();
+
+		printf("- linearRand: %.3f numbers/ns\n", get_rate(t1, t2, Samples * Repeat));
+		printf("- gaussRand: %.3f numbers/ns\n", get_rate(t2, t3, Samples * Repeat));
+		printf("- sphericalRand: %.3f vectors/ns\n", get_rate(t3, t4, Samples * Repeat));
+
+		for(std::size_t i = 0; i < Samples; ++i)
+		{
+			Error += Linear[i] >= 0.0f && Linear[i] <= 1.0f ? 0 : 1;
+			Error += glm::equal(glm::length(Spherical[i]), 1.0f, 0.001f) ? 0 : 1;
+		}
+	}
+	glm_simd_feature_mask() = ~0u;
+
+	return Error;
+}
+
+int main()
+{
+	std::size_t const Samples = 100000;
+
+	int Error = 0;
+
+	Error += perf_std_rand(Samples);
+	Error += perf_philox(Samples, 10);
+
+	return Error;
+}
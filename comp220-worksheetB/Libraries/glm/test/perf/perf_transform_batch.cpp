@@ -0,0 +1,165 @@
+#define GLM_ENABLE_EXPERIMENTAL
+#include <glm/gtx/transform_batch.hpp>
+#include <glm/ext/matrix_transform.hpp>
+#include <glm/ext/matrix_relational.hpp>
+#include <glm/ext/vector_relational.hpp>
+#include <vector>
+#include <chrono>
+#include <cstdio>
+
+static struct
+{
+	char const* Name;
+	unsigned int Mask;
+} const CodePaths[] =
+{
+	{"Scalar", 0u},
+	{"SSE2", GLM_SIMD_SSE2},
+	{"AVX2", GLM_SIMD_SSE2 | GLM_SIMD_SSE41 | GLM_SIMD_AVX | GLM_SIMD_AVX2},
+	{"AVX-512", GLM_SIMD_SSE2 | GLM_SIMD_SSE41 | GLM_SIMD_AVX | GLM_SIMD_AVX2 | GLM_SIMD_AVX512F}
+};
+
+static double get_elements_per_ns(std::chrono::high_resolution_clock::time_point t1, std::chrono::high_resolution_clock::time_point t2, std::size_t Elements)
+{
+	double const Duration = static_cast<double>(std::chrono::duration_cast<std::chrono::nanoseconds>(t2 - t1).count());
+	return Duration > 0.0 ? static_cast<double>(Elements) / Duration : 0.0;
+}
+
+static glm::mat4 get_transform()
+{
+	glm::mat4 M = glm::translate(glm::mat4(1.0f), glm::vec3(1.0f, -2.0f, 3.0f));
+	return glm::rotate(M, 0.7f, glm::normalize(glm::vec3(1.0f, 2.0f, 3.0f)));
+}
+
+static int perf_points_aos(std::size_t Samples, std::size_t Repeat)
+{
+	int Error = 0;
+
+	glm::mat4 const M = get_transform();
+	std::vector<glm::vec3> In(Samples), Out(Samples), Reference(Samples);
+	for(std::size_t i = 0; i < Samples; ++i)
+		In[i] = glm::vec3(static_cast<float>(i % 101), static_cast<float>(i % 37) * 0.5f, -static_cast<float>(i % 11));
+
+	glm_simd_feature_mask() = 0u;
+	glm::transformPoints(M, &In[0], &Reference[0], Samples);
+
+	printf("transformPoints, array of structures:\n");
+	for(std::size_t p = 0; p < sizeof(CodePaths) / sizeof(CodePaths[0]); ++p)
+	{
+		if(!glm_simd_has_features(CodePaths[p].Mask))
+			continue;
+		glm_simd_feature_mask() = CodePaths[p].Mask;
+
+		std::chrono::high_resolution_clock::time_point t1 = std::chrono::high_resolution_clock::now();
+		for(std::size_t r = 0; r < Repeat; ++r)
+			glm::transformPoints(M, &In[0], &Out[0], Samples);
+		std::chrono::high_resolution_clock::time_point t2 = std::chrono::high_resolution_clock::now();
+
+		printf("- %s: %.3f points/ns\n", CodePaths[p].Name, get_elements_per_ns(t1, t2, Samples * Repeat));
+
+		for(std::size_t i = 0; i < Samples; ++i)
+			Error += glm::all(glm::equal(Out[i], Reference[i], 0.001f)) ? 0 : 1;
+	}
+	glm_simd_feature_mask() = ~0u;
+
+	return Error;
+}
+
+static int perf_points_soa(std::size_t Samples, std::size_t Repeat)
+{
+	int Error = 0;
+
+	glm::mat4 const M = get_transform();
+
+	// 16 bytes aligned arrays, with room to move the start
+	std::vector<float> Storage(Samples * 9 + 12);
+	std::size_t const Address = reinterpret_cast<std::size_t>(&Storage[0]);
+	float* Base = &Storage[0] + ((16 - Address % 16) % 16) / sizeof(float);
+	std::size_t const Stride = (Samples + 3) & ~static_cast<std::size_t>(3);
+	float* In[3] = {Base, Base + Stride, Base + Stride * 2};
+	float* Out[3] = {Base + Stride * 3, Base + Stride * 4, Base + Stride * 5};
+	float* Reference[3] = {Base + Stride * 6, Base + Stride * 7, Base + Stride * 8};
+
+	for(std::size_t i = 0; i < Samples; ++i)
+	{
+		In[0][i] = static_cast<float>(i % 101);
+		In[1][i] = static_cast<float>(i % 37) * 0.5f;
+		In[2][i] = -static_cast<float>(i % 11);
+	}
+
+	glm_simd_feature_mask() = 0u;
+	glm::transformPoints(M, In[0], In[1], In[2], Reference[0], Reference[1], Reference[2], Samples);
+
+	printf("transformPoints, structure of arrays:\n");
+	for(std::size_t p = 0; p < sizeof(CodePaths) / sizeof(CodePaths[0]); ++p)
+	{
+		if(!glm_simd_has_features(CodePaths[p].Mask))
+			continue;
+		glm_simd_feature_mask() = CodePaths[p].Mask;
+
+		std::chrono::high_resolution_clock::time_point t1 = std::chrono::high_resolution_clock::now();
+		for(std::size_t r = 0; r < Repeat; ++r)
+			glm::transformPoints(M, In[0], In[1], In[2], Out[0], Out[1], Out[2], Samples);
+		std::chrono::high_resolution_clock::time_point t2 = std::chrono::high_resolution_clock::now();
+
+		printf("- %s: %.3f points/ns\n", CodePaths[p].Name, get_elements_per_ns(t1, t2, Samples * Repeat));
+
+		for(std::size_t i = 0; i < Samples; ++i)
+		{
+			glm::vec3 const A(Out[0][i], Out[1][i], Out[2][i]);
+			glm::vec3 const B(Reference[0][i], Reference[1][i], Reference[2][i]);
+			Error += glm::all(glm::equal(A, B, 0.001f)) ? 0 : 1;
+		}
+	}
+	glm_simd_feature_mask() = ~0u;
+
+	return Error;
+}
+
+static int perf_matrices(std::size_t Samples, std::size_t Repeat)
+{
+	int Error = 0;
+
+	glm::mat4 const M = get_transform();
+	std::vector<glm::mat4> In(Samples), Out(Samples), Reference(Samples);
+	for(std::size_t i = 0; i < Samples; ++i)
+		In[i] = glm::translate(glm::mat4(1.0f), glm::vec3(static_cast<float>(i % 17), 0.0f, static_cast<float>(i % 5)));
+
+	glm_simd_feature_mask() = 0u;
+	glm::transformMatrices(M, &In[0], &Reference[0], Samples);
+
+	printf("transformMatrices:\n");
+	for(std::size_t p = 0; p < sizeof(CodePaths) / sizeof(CodePaths[0]); ++p)
+	{
+		if(!glm_simd_has_features(CodePaths[p].Mask))
+			continue;
+		glm_simd_feature_mask() = CodePaths[p].Mask;
+
+		std::chrono::high_resolution_clock::time_point t1 = std::chrono::high_resolution_clock::now();
+		for(std::size_t r = 0; r < Repeat; ++r)
+			glm::transformMatrices(M, &In[0], &Out[0], Samples);
+		std::chrono::high_resolution_clock::time_point t2 = std::chrono::high_resolution_clock::now();
+
+		printf("- %s: %.3f matrices/ns\n", CodePaths[p].Name, get_elements_per_ns(t1, t2, Samples * Repeat));
+
+		for(std::size_t i = 0; i < Samples; ++i)
+			Error += glm::all(glm::equal(Out[i], Reference[i], 0.001f)) ? 0 : 1;
+	}
+	glm_simd_feature_mask() = ~0u;
+
+	return Error;
+}
+
+int main()
+{
+	std::size_t const Samples = 100000;
+	std::size_t const Repeat = 10;
+
+	int Error = 0;
+
+	Error += perf_points_aos(Samples, Repeat);
+	Error += perf_points_soa(Samples, Repeat);
+	Error += perf_matrices(Samples, Repeat);
+
+	return Error;
+}
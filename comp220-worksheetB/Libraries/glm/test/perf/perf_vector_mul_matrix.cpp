@@ -111,7 +111,9 @@ static int comp_vec4_mul_mat4(std::size_t Samples)
 	{
 		packedVecType const A = SISD[i];
 		packedVecType const B = SIMD[i];
-		Error += glm::all(glm::equal(A, B, static_cast<T>(0.001))) ? 0 : 1;
+		// The SIMD code sums in a different order, the rounding error grows with the inputs
+		T const Epsilon = static_cast<T>(0.001) * static_cast<T>(i + 1);
+		Error += glm::all(glm::equal(A, B, Epsilon)) ? 0 : 1;
 	}
 	
 	return Error;
@@ -0,0 +1,381 @@
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <map>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include <SDL.h>
+#include <SDL_image.h>
+#include <assimp\Importer.hpp>
+#include <assimp\scene.h>
+#include <assimp\postprocess.h>
+
+#include "archive.h"
+#include "cooked.h"
+#include "jobs.h"
+#include "meshlet.h"
+#include "simplify.h"
+
+//Turns source assets into the runtime formats in cooked.h
+//cook <output directory> <inputs...> [--force]
+//Models become .mesh files with LODs, meshlets and quantized vertices, images become .tex files with a full mip chain
+//Inputs whose contents haven't changed since the last cook are skipped, using the hashes in the output directory's manifest
+
+#define MANIFEST_FILENAME "manifest.txt"
+
+enum CookStatus
+{
+	COOK_FAILED,
+	COOK_COOKED,
+	COOK_SKIPPED
+};
+
+static const char *s_StatusNames[] = { "failed", "cooked", "skipped" };
+
+struct CookItem
+{
+	std::string source;
+	std::string output;
+	uint64_t hash;
+	CookStatus status;
+	double milliseconds;
+	size_t inputBytes;
+	size_t outputBytes;
+};
+
+//FNV-1a over the contents, seeded with the cook version so a new cooker rebuilds everything
+static uint64_t hashContents(const std::vector<unsigned char>& data)
+{
+	uint64_t hash = 14695981039346656037ull ^ COOKED_VERSION;
+	for (unsigned char byte : data)
+	{
+		hash ^= byte;
+		hash *= 1099511628211ull;
+	}
+	return hash;
+}
+
+static std::string getExtension(const std::string& filename)
+{
+	size_t dot = filename.find_last_of('.');
+	size_t separator = filename.find_last_of("/\\");
+	if (dot == std::string::npos || (separator != std::string::npos && dot < separator))
+	{
+		return std::string();
+	}
+	return normaliseAssetPath(filename.substr(dot));
+}
+
+static bool isImage(const std::string& filename)
+{
+	std::string extension = getExtension(filename);
+	return extension == ".png" || extension == ".jpg" || extension == ".tga" || extension == ".bmp";
+}
+
+//Output goes flat into the output directory, Models/Tank1.FBX becomes Tank1.mesh
+static std::string getOutputName(const std::string& source)
+{
+	size_t separator = source.find_last_of("/\\");
+	std::string name = separator == std::string::npos ? source : source.substr(separator + 1);
+	size_t dot = name.find_last_of('.');
+	if (dot != std::string::npos)
+	{
+		name.erase(dot);
+	}
+	return name + (isImage(source) ? ".tex" : ".mesh");
+}
+
+static size_t getFileSize(const std::string& filename)
+{
+	std::ifstream file(filename, std::ios::in | std::ios::binary | std::ios::ate);
+	return file.is_open() ? (size_t)file.tellg() : 0;
+}
+
+//Depth first like Scene, so the runtime can add the nodes in file order
+static void cookNode(const aiNode *node, int parent, CookedModel& model)
+{
+	CookedNode cookedNode;
+	cookedNode.info.parent = parent;
+	cookedNode.info.firstMesh = model.nodeMeshes.size();
+	cookedNode.info.numberOfMeshes = node->mNumMeshes;
+	cookedNode.info.nameLength = 0;
+	cookedNode.name = node->mName.C_Str();
+
+	//Assimp matrices are row major
+	for (unsigned int row = 0; row < 4; row++)
+	{
+		for (unsigned int column = 0; column < 4; column++)
+		{
+			cookedNode.info.transform[column * 4 + row] = node->mTransformation[row][column];
+		}
+	}
+	model.nodeMeshes.insert(model.nodeMeshes.end(), node->mMeshes, node->mMeshes + node->mNumMeshes);
+
+	int nodeIndex = model.nodes.size();
+	model.nodes.push_back(cookedNode);
+	for (unsigned int i = 0; i < node->mNumChildren; i++)
+	{
+		cookNode(node->mChildren[i], nodeIndex, model);
+	}
+}
+
+static bool cookModel(const std::string& source, const std::vector<unsigned char>& data, const std::string& outputFilename)
+{
+	//Same post processing as the runtime import plus the steps that are too slow to run at load
+	Assimp::Importer importer;
+	std::string extension = getExtension(source);
+	const aiScene* scene = importer.ReadFileFromMemory(data.data(), data.size(), aiProcess_Triangulate | aiProcess_FlipUVs | aiProcess_GenSmoothNormals
+		| aiProcess_GenUVCoords | aiProcess_CalcTangentSpace | aiProcess_JoinIdenticalVertices | aiProcess_ImproveCacheLocality,
+		extension.empty() ? "" : extension.c_str() + 1);
+	if (!scene)
+	{
+		printf("Model Loading Error - %s - %s\n", source.c_str(), importer.GetErrorString());
+		return false;
+	}
+
+	CookedModel model;
+	std::vector<CookedMesh>& cookedMeshes = model.meshes;
+	cookedMeshes.resize(scene->mNumMeshes);
+	std::vector<Vertex> vertices;
+	std::vector<unsigned int> indices;
+	std::vector<std::vector<unsigned int>> lodIndices;
+	for (unsigned int i = 0; i < scene->mNumMeshes; i++)
+	{
+		CookedMesh& cookedMesh = cookedMeshes[i];
+		CookedMeshInfo& info = cookedMesh.info;
+
+		vertices.clear();
+		indices.clear();
+		copyMeshData(scene->mMeshes[i], vertices, indices);
+
+		generateLODs(vertices.data(), vertices.size(), indices, COOKED_MAX_LODS, lodIndices);
+		buildMeshlets(vertices.data(), vertices.size(), lodIndices[0], cookedMesh.meshlets);
+		optimizeVertexFetch(vertices, lodIndices);
+
+		info.numberOfVertices = vertices.size();
+		info.numberOfMeshlets = cookedMesh.meshlets.size();
+		info.numberOfLODs = lodIndices.size();
+		for (unsigned int lod = 0; lod < COOKED_MAX_LODS; lod++)
+		{
+			info.lodFirstIndex[lod] = cookedMesh.indices.size();
+			info.lodNumberOfIndices[lod] = lod < lodIndices.size() ? lodIndices[lod].size() : 0;
+			if (lod < lodIndices.size())
+			{
+				cookedMesh.indices.insert(cookedMesh.indices.end(), lodIndices[lod].begin(), lodIndices[lod].end());
+			}
+		}
+		info.numberOfIndices = cookedMesh.indices.size();
+
+		glm::vec3 boundsMin = glm::vec3(0.0f);
+		glm::vec3 boundsMax = glm::vec3(0.0f);
+		if (!vertices.empty())
+		{
+			boundsMin = glm::vec3(vertices[0].x, vertices[0].y, vertices[0].z);
+			boundsMax = boundsMin;
+		}
+		for (const Vertex& vertex : vertices)
+		{
+			boundsMin = glm::min(boundsMin, glm::vec3(vertex.x, vertex.y, vertex.z));
+			boundsMax = glm::max(boundsMax, glm::vec3(vertex.x, vertex.y, vertex.z));
+		}
+		for (int axis = 0; axis < 3; axis++)
+		{
+			info.boundsMin[axis] = boundsMin[axis];
+			info.boundsMax[axis] = boundsMax[axis];
+		}
+		cookedMesh.vertices.resize(vertices.size());
+		quantizeVertices(vertices.data(), vertices.size(), boundsMin, boundsMax, cookedMesh.vertices.data());
+
+		info.doubleSided = 0;
+		if (scene->mMeshes[i]->mMaterialIndex < scene->mNumMaterials)
+		{
+			int twoSided = 0;
+			if (scene->mMaterials[scene->mMeshes[i]->mMaterialIndex]->Get(AI_MATKEY_TWOSIDED, twoSided) == AI_SUCCESS)
+			{
+				info.doubleSided = twoSided != 0;
+			}
+		}
+	}
+
+	//The node hierarchy places each mesh, the runtime rebuilds its Scene from it
+	if (scene->mRootNode)
+	{
+		cookNode(scene->mRootNode, -1, model);
+	}
+	return writeCookedModel(outputFilename, model);
+}
+
+static bool cookImage(const std::string& source, const std::vector<unsigned char>& data, const std::string& outputFilename)
+{
+	SDL_Surface* surface = IMG_Load_RW(SDL_RWFromConstMem(data.data(), data.size()), 1);
+	if (surface == nullptr)
+	{
+		printf("Could not load image file %s\n", source.c_str());
+		return false;
+	}
+	SDL_Surface* rgbaSurface = SDL_ConvertSurfaceFormat(surface, SDL_PIXELFORMAT_ABGR8888, 0);
+	SDL_FreeSurface(surface);
+	if (rgbaSurface == nullptr)
+	{
+		printf("Could not convert image file %s\n", source.c_str());
+		return false;
+	}
+
+	std::vector<unsigned char> pixels(rgbaSurface->w * rgbaSurface->h * 4);
+	for (int row = 0; row < rgbaSurface->h; row++)
+	{
+		const unsigned char *pRow = (const unsigned char*)rgbaSurface->pixels + row * rgbaSurface->pitch;
+		std::copy(pRow, pRow + rgbaSurface->w * 4, pixels.begin() + row * rgbaSurface->w * 4);
+	}
+
+	CookedTexture texture;
+	buildMipChain(pixels.data(), rgbaSurface->w, rgbaSurface->h, texture);
+	SDL_FreeSurface(rgbaSurface);
+
+	return writeCookedTexture(outputFilename, texture);
+}
+
+//Source path to content hash from the last run
+static std::map<std::string, uint64_t> readManifest(const std::string& filename)
+{
+	std::map<std::string, uint64_t> hashes;
+	std::ifstream file(filename);
+	std::string line;
+	while (std::getline(file, line))
+	{
+		if (line.empty() || line[0] == '#')
+		{
+			continue;
+		}
+		std::istringstream fields(line);
+		std::string source, output, hash, status;
+		if (std::getline(fields, source, '\t') && std::getline(fields, output, '\t') && std::getline(fields, hash, '\t')
+			&& std::getline(fields, status, '\t') && status != s_StatusNames[COOK_FAILED])
+		{
+			hashes[source] = strtoull(hash.c_str(), nullptr, 16);
+		}
+	}
+	return hashes;
+}
+
+static bool writeManifest(const std::string& filename, const std::vector<CookItem>& items)
+{
+	FILE *pFile = fopen(filename.c_str(), "w");
+	if (pFile == nullptr)
+	{
+		printf("Could not write %s\n", filename.c_str());
+		return false;
+	}
+	fprintf(pFile, "#source\toutput\thash\tstatus\tmilliseconds\tinputBytes\toutputBytes\n");
+	for (const CookItem& item : items)
+	{
+		fprintf(pFile, "%s\t%s\t%016llx\t%s\t%.2f\t%llu\t%llu\n", item.source.c_str(), item.output.c_str(), (unsigned long long)item.hash,
+			s_StatusNames[item.status], item.milliseconds, (unsigned long long)item.inputBytes, (unsigned long long)item.outputBytes);
+	}
+	fclose(pFile);
+	return true;
+}
+
+int main(int argc, char ** argsv)
+{
+	bool force = false;
+	std::vector<std::string> arguments;
+	for (int i = 1; i < argc; i++)
+	{
+		if (std::string(argsv[i]) == "--force")
+		{
+			force = true;
+		}
+		else
+		{
+			arguments.push_back(argsv[i]);
+		}
+	}
+	if (arguments.size() < 2)
+	{
+		printf("Usage: cook <output directory> <inputs...> [--force]\n");
+		return 1;
+	}
+
+	if (IMG_Init(IMG_INIT_JPG | IMG_INIT_PNG) < 0)
+	{
+		printf("SDL_image failed - %s\n", SDL_GetError());
+		return 1;
+	}
+
+	std::string outputDirectory = arguments[0];
+	if (outputDirectory.back() != '/' && outputDirectory.back() != '\\')
+	{
+		outputDirectory += '/';
+	}
+	std::map<std::string, uint64_t> previousHashes = readManifest(outputDirectory + MANIFEST_FILENAME);
+
+	std::vector<CookItem> items(arguments.size() - 1);
+	for (unsigned int i = 0; i < items.size(); i++)
+	{
+		items[i].source = arguments[i + 1];
+		items[i].output = getOutputName(items[i].source);
+	}
+
+	//One file per job, the files are independent and even a big FBX fits in memory
+	JobSystem jobSystem;
+	jobSystem.init();
+	typedef std::chrono::high_resolution_clock Clock;
+	Clock::time_point cookStart = Clock::now();
+	jobSystem.parallelFor(items.size(), 1, [&](unsigned int start, unsigned int end)
+	{
+		for (unsigned int i = start; i < end; i++)
+		{
+			CookItem& item = items[i];
+			std::string outputFilename = outputDirectory + item.output;
+			Clock::time_point itemStart = Clock::now();
+
+			std::vector<unsigned char> data;
+			bool read = readAsset(item.source, data);
+			item.hash = read ? hashContents(data) : 0;
+			item.inputBytes = data.size();
+
+			auto previous = previousHashes.find(item.source);
+			if (!read)
+			{
+				printf("Could not read %s\n", item.source.c_str());
+				item.status = COOK_FAILED;
+			}
+			else if (!force && previous != previousHashes.end() && previous->second == item.hash && getFileSize(outputFilename) > 0)
+			{
+				item.status = COOK_SKIPPED;
+			}
+			else
+			{
+				bool cooked = isImage(item.source) ? cookImage(item.source, data, outputFilename) : cookModel(item.source, data, outputFilename);
+				item.status = cooked ? COOK_COOKED : COOK_FAILED;
+			}
+
+			item.milliseconds = std::chrono::duration<double, std::milli>(Clock::now() - itemStart).count();
+			item.outputBytes = item.status == COOK_FAILED ? 0 : getFileSize(outputFilename);
+		}
+	});
+	double totalTime = std::chrono::duration<double, std::milli>(Clock::now() - cookStart).count();
+	unsigned int numberOfThreads = jobSystem.getNumberOfWorkers() + 1;
+	jobSystem.shutdown();
+	IMG_Quit();
+
+	unsigned int counts[3] = { 0, 0, 0 };
+	for (const CookItem& item : items)
+	{
+		counts[item.status]++;
+		printf("%-8s %8.2fms %10llu -> %10llu  %s\n", s_StatusNames[item.status], item.milliseconds,
+			(unsigned long long)item.inputBytes, (unsigned long long)item.outputBytes, item.source.c_str());
+	}
+	printf("Cooked %u, skipped %u, failed %u in %.2fms on %u threads\n", counts[COOK_COOKED], counts[COOK_SKIPPED], counts[COOK_FAILED],
+		totalTime, numberOfThreads);
+
+	if (!writeManifest(outputDirectory + MANIFEST_FILENAME, items))
+	{
+		return 1;
+	}
+	return counts[COOK_FAILED] > 0 ? 1 : 0;
+}